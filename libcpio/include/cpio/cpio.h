@@ -34,6 +34,25 @@ struct cpio_header {
     char c_check[8];      /* Checksum. */
 };
 
+/**
+ * The numeric fields of a CPIO header, decoded.
+ */
+struct cpio_header_fields {
+    unsigned long ino;
+    unsigned long mode;
+    unsigned long uid;
+    unsigned long gid;
+    unsigned long nlink;
+    unsigned long mtime;
+    unsigned long filesize;
+    unsigned long devmajor;
+    unsigned long devminor;
+    unsigned long rdevmajor;
+    unsigned long rdevminor;
+    unsigned long namesize;
+    unsigned long check;
+};
+
 /**
  * Stores information about the underlying implementation.
  */
@@ -84,3 +103,276 @@ int cpio_info(void *archive, unsigned long len, struct cpio_info *info);
  */
 void cpio_ls(void *archive, unsigned long len, char **buf, unsigned long buf_len);
 
+
+/**
+ * Decode the numeric fields of a CPIO header
+ * @param[in] header   The header to decode
+ * @param[out] fields  The decoded fields
+ * @return             0 on success, -1 if the magic is wrong or a field is not
+ *                     made up of hex digits.
+ */
+int cpio_header_decode(const struct cpio_header *header, struct cpio_header_fields *fields);
+
+/**
+ * Validate a whole CPIO archive in a single pass. Checks the alignment of the
+ * archive, and that every header has the right magic and well formed fields,
+ * that every name is NULL terminated at exactly its recorded length, that all
+ * entries lie within the archive and that the archive ends with a trailer.
+ * Once an archive has been validated the other functions cannot fail on it
+ * other than to report a missing file or index, and the _unchecked functions
+ * below can be used to look it up without checking each header again.
+ * @param[in] archive  The location of the CPIO archive
+ * @param[out] info    If not NULL, populated as by cpio_info
+ * @return             0 if the archive is valid, -1 otherwise.
+ */
+int cpio_validate(void *archive, unsigned long len, struct cpio_info *info);
+
+/**
+ * As cpio_get_entry, for an archive that has passed cpio_validate. Headers are
+ * not checked, so the result is undefined for any other archive.
+ * @param[in] archive  The location of the validated CPIO archive
+ * @param[in] index    The index of the CPIO entry to query
+ * @param[out] name    A pointer to the NULL terminated file name of the entry
+ * @param[out] size    The size of the file in question
+ * @return             The location of the file in memory; NULL if the index
+ *                     exceeds the number of files in the CPIO archive.
+ */
+void *cpio_get_entry_unchecked(void *archive, int index, const char **name, unsigned long *size);
+
+/**
+ * As cpio_get_file, for an archive that has passed cpio_validate. Headers are
+ * not checked, so the result is undefined for any other archive.
+ * @param[in] archive  The location of the validated CPIO archive
+ * @param[in] name     The name of the file in question.
+ * @param[out] size    The retrieved size of the file in question
+ * @return             The location of the file in memory; NULL if the file
+ *                     does not exist.
+ */
+void *cpio_get_file_unchecked(void *archive, const char *name, unsigned long *size);
+
+/**
+ * An entry of a CPIO index.
+ */
+struct cpio_index_entry {
+    /// The NULL terminated file name
+    const char *name;
+    /// The location of the file in memory
+    void *data;
+    /// The size of the file
+    unsigned long size;
+    /// Hash of the file name
+    unsigned int hash;
+    /// One more than the index of the next entry in the same hash bucket, 0 if none
+    unsigned int next;
+};
+
+/**
+ * An index of the entries of a CPIO archive, built by walking the archive
+ * once. Lookups by name take O(1) expected time and by index O(1) time.
+ */
+struct cpio_index {
+    /// The entries, in archive order
+    struct cpio_index_entry *entries;
+    unsigned int num_entries;
+    /// Heads of the hash chains, as one more than an entry index, 0 if empty
+    unsigned int *buckets;
+    unsigned int num_buckets;
+};
+
+/**
+ * Build an index of a CPIO archive in caller provided storage
+ * @param[out] index       The index to build
+ * @param[in] archive      The location of the CPIO archive
+ * @param[in] entries      Storage for one entry per file, see cpio_info for
+ *                         the number of files
+ * @param[in] max_entries  The number of entries provided
+ * @param[in] buckets      Storage for the hash buckets
+ * @param[in] num_buckets  The number of buckets provided. Must be a power of
+ *                         two, around the number of files is a good choice
+ * @return                 0 on success, 1 if there are more files than
+ *                         max_entries, and -1 if the archive is invalid.
+ */
+int cpio_index_build(struct cpio_index *index, void *archive, unsigned long len,
+                     struct cpio_index_entry *entries, unsigned int max_entries,
+                     unsigned int *buckets, unsigned int num_buckets);
+
+/**
+ * Retrieve file information from a CPIO index by position, as cpio_get_entry
+ * @param[in] index    The index of the CPIO archive
+ * @param[in] n        The index of the CPIO entry to query
+ * @param[out] name    A pointer to the NULL terminated file name of the entry
+ * @param[out] size    The size of the file in question
+ * @return             The location of the file in memory; NULL if n exceeds
+ *                     the number of files in the CPIO archive.
+ */
+void *cpio_index_get_entry(const struct cpio_index *index, unsigned int n, const char **name,
+                           unsigned long *size);
+
+/**
+ * Retrieve file information from a CPIO index by name, as cpio_get_file
+ * @param[in] index    The index of the CPIO archive
+ * @param[in] name     The name of the file in question.
+ * @param[out] size    The retrieved size of the file in question
+ * @return             The location of the file in memory; NULL if the file
+ *                     does not exist.
+ */
+void *cpio_index_get_file(const struct cpio_index *index, const char *name, unsigned long *size);
+
+/**
+ * Read part of a CPIO archive for a streaming reader
+ * @param[in] cookie   The cookie given to cpio_reader_init
+ * @param[in] offset   The offset into the archive to read from
+ * @param[out] buf     Where to read to
+ * @param[in] len      The number of bytes wanted
+ * @return             The number of bytes read, which may be less than len
+ *                     but more than 0, or 0 or less at the end of the archive
+ *                     or on error.
+ */
+typedef long (*cpio_read_fn_t)(void *cookie, unsigned long offset, void *buf, unsigned long len);
+
+/**
+ * A streaming CPIO reader, which reads an archive a piece at a time through a
+ * callback rather than needing it mapped in full. The reader holds no more
+ * than the current entry's name. Should not be modified directly.
+ */
+struct cpio_reader {
+    cpio_read_fn_t read;
+    void *cookie;
+    char *name_buf;
+    unsigned long name_buf_len;
+    /// The offset of the next byte to read
+    unsigned long offset;
+    /// The bytes of the current entry's data not yet read
+    unsigned long data_remaining;
+    /// The offset of the header following the current entry
+    unsigned long data_end;
+    /// 0 while reading, 1 once the trailer has been reached, -1 on error
+    int state;
+};
+
+/**
+ * An entry of a CPIO archive yielded by a streaming reader.
+ */
+struct cpio_stream_entry {
+    /// The NULL terminated file name, valid until the next call to cpio_reader_next
+    const char *name;
+    /// The size of the file
+    unsigned long size;
+    /// The offset of the file's data in the archive. The read callback is
+    /// called with increasing offsets, so this can be used to start fetching
+    /// the data, e.g. by DMA, before it is read.
+    unsigned long data_offset;
+    /// All of the header fields
+    struct cpio_header_fields fields;
+};
+
+/**
+ * Initialise a streaming CPIO reader
+ * @param[out] reader      The reader to initialise
+ * @param[in] read         The callback to read the archive with
+ * @param[in] cookie       A cookie to pass to the read callback
+ * @param[in] name_buf     Storage for the name of the current entry
+ * @param[in] name_buf_len The size of name_buf. Archives with longer names,
+ *                         including the NULL terminator, are rejected.
+ * @return                 Non-zero on error.
+ */
+int cpio_reader_init(struct cpio_reader *reader, cpio_read_fn_t read, void *cookie,
+                     char *name_buf, unsigned long name_buf_len);
+
+/**
+ * Advance to the next entry of the archive, skipping any unread data of the
+ * current one. Skipped data is not read through the callback.
+ * @param[in] reader   The reader
+ * @param[out] entry   If not NULL, populated with the entry
+ * @return             0 on success, 1 at the end of the archive, and -1 if
+ *                     the archive is invalid or could not be read.
+ */
+int cpio_reader_next(struct cpio_reader *reader, struct cpio_stream_entry *entry);
+
+/**
+ * Read the next chunk of the current entry's data
+ * @param[in] reader   The reader
+ * @param[out] buf     Where to read to
+ * @param[in] len      The maximum number of bytes to read
+ * @return             The number of bytes read, 0 once all of the entry's data
+ *                     has been read, or -1 on error.
+ */
+long cpio_reader_read(struct cpio_reader *reader, void *buf, unsigned long len);
+
+/**
+ * Consume part of a CPIO archive being written
+ * @param[in] cookie   The cookie given to cpio_writer_init_callback
+ * @param[in] data     The next bytes of the archive. For entries added with
+ *                     cpio_writer_add this is the caller's data itself, so
+ *                     the callback may keep a reference to it instead of
+ *                     copying it, e.g. to build a gather list.
+ * @param[in] len      The number of bytes in data
+ * @return             Non-zero on error.
+ */
+typedef int (*cpio_write_fn_t)(void *cookie, const void *data, unsigned long len);
+
+/**
+ * A CPIO archive writer, producing a newc archive either in a buffer or
+ * through a callback. Should not be modified directly.
+ */
+struct cpio_writer {
+    char *buf;
+    unsigned long buf_len;
+    cpio_write_fn_t write;
+    void *cookie;
+    /// The number of bytes of archive produced so far
+    unsigned long offset;
+    /// The inode number of the next entry
+    unsigned long ino;
+    /// Set once an error has occurred, after which nothing more is written
+    int error;
+};
+
+/**
+ * Initialise a writer that builds an archive in a buffer
+ * @param[out] writer  The writer to initialise
+ * @param[in] buf      The buffer to build the archive in
+ * @param[in] len      The size of buf
+ */
+void cpio_writer_init_buffer(struct cpio_writer *writer, void *buf, unsigned long len);
+
+/**
+ * Initialise a writer that hands the archive to a callback as it is built
+ * @param[out] writer  The writer to initialise
+ * @param[in] write    The callback to pass the archive to
+ * @param[in] cookie   A cookie to pass to the callback
+ */
+void cpio_writer_init_callback(struct cpio_writer *writer, cpio_write_fn_t write, void *cookie);
+
+/**
+ * Append a file to an archive
+ * @param[in] writer   The writer
+ * @param[in] name     The NULL terminated file name
+ * @param[in] mode     The file mode, e.g. 0100644 for a regular file
+ * @param[in] data     The contents of the file
+ * @param[in] size     The size of the file
+ * @return             Non-zero on error, including running out of buffer.
+ */
+int cpio_writer_add(struct cpio_writer *writer, const char *name, unsigned long mode,
+                    const void *data, unsigned long size);
+
+/**
+ * Append a file to an archive being built in a buffer, leaving space for its
+ * contents to be filled in place by the caller
+ * @param[in] writer   The writer, which must have been initialised with
+ *                     cpio_writer_init_buffer
+ * @param[in] name     The NULL terminated file name
+ * @param[in] mode     The file mode
+ * @param[in] size     The size of the file
+ * @return             Where to put the file's contents, or NULL on error.
+ */
+void *cpio_writer_reserve(struct cpio_writer *writer, const char *name, unsigned long mode,
+                          unsigned long size);
+
+/**
+ * Append the trailer that ends an archive
+ * @param[in] writer   The writer
+ * @return             The total size of the archive, or -1 if an error
+ *                     occurred at any point while writing it.
+ */
+long cpio_writer_finish(struct cpio_writer *writer);
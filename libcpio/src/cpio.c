@@ -29,26 +29,46 @@ static unsigned long align_up(unsigned long n, unsigned long align)
     return (n + align - 1) & (~(align - 1));
 }
 
-/* Parse an ASCII hex string into an integer. */
-static unsigned long parse_hex_str(char *s, unsigned int max_len)
-{
-    unsigned long r = 0;
-    unsigned long i;
+#define SWAR_ONES 0x0101010101010101ull
+#define SWAR_HIGH 0x8080808080808080ull
 
-    for (i = 0; i < max_len; i++) {
-        r *= 16;
-        if (s[i] >= '0' && s[i] <= '9') {
-            r += s[i] - '0';
-        }  else if (s[i] >= 'a' && s[i] <= 'f') {
-            r += s[i] - 'a' + 10;
-        }  else if (s[i] >= 'A' && s[i] <= 'F') {
-            r += s[i] - 'A' + 10;
-        } else {
-            return r;
-        }
-        continue;
+/*
+ * Decode the 8 ASCII hex digits of a header field, 8 at a time (SWAR).
+ *
+ * The field is loaded most significant digit first, the bytes that are hex
+ * digits are found with range checks that work on all 8 bytes at once, and
+ * the nibbles are then folded together pairwise. Return -1 if any character
+ * is not a hex digit.
+ */
+static int decode_hex8(const char *s, unsigned long *out)
+{
+    const unsigned char *p = (const unsigned char *) s;
+    unsigned long long x = (unsigned long long) p[0] << 56 | (unsigned long long) p[1] << 48 |
+                           (unsigned long long) p[2] << 40 | (unsigned long long) p[3] << 32 |
+                           (unsigned long long) p[4] << 24 | (unsigned long long) p[5] << 16 |
+                           (unsigned long long) p[6] << 8 | (unsigned long long) p[7];
+
+    /* The range checks below rely on no byte having its top bit set. */
+    if (x & SWAR_HIGH) {
+        return -1;
     }
-    return r;
+    /* Top bit of each byte set if the byte is in '0'..'9'. */
+    unsigned long long digit = (x + SWAR_ONES * (0x80 - '0')) & ~(x + SWAR_ONES * (0x80 - '9' - 1));
+    /* Top bit of each byte set if the byte is in 'a'..'f' once lower cased. */
+    unsigned long long lower = x | SWAR_ONES * 0x20;
+    unsigned long long letter = (lower + SWAR_ONES * (0x80 - 'a')) & ~(lower + SWAR_ONES * (0x80 - 'f' - 1));
+    if (((digit | letter) & SWAR_HIGH) != SWAR_HIGH) {
+        return -1;
+    }
+
+    /* Value of each digit, letters being 9 more than their low nibble. */
+    unsigned long long nibbles = (x & SWAR_ONES * 0x0f) + ((letter & SWAR_HIGH) >> 7) * 9;
+    /* Fold pairs of nibbles into bytes, bytes into halfwords and halfwords into a word. */
+    nibbles = (nibbles | nibbles >> 4) & 0x00ff00ff00ff00ffull;
+    nibbles = (nibbles | nibbles >> 8) & 0x0000ffff0000ffffull;
+    nibbles = (nibbles | nibbles >> 16) & 0x00000000ffffffffull;
+    *out = (unsigned long) nibbles;
+    return 0;
 }
 
 /*
@@ -97,7 +117,30 @@ static unsigned long cpio_len_next(unsigned long len, void *prev, void *next) {
     if (len < diff) {
         return 0;
     }
-    return len;
+    return len - diff;
+}
+
+int cpio_header_decode(const struct cpio_header *header, struct cpio_header_fields *fields)
+{
+    if (cpio_strncmp(header->c_magic, CPIO_HEADER_MAGIC, sizeof(header->c_magic)) != 0) {
+        return -1;
+    }
+    if (decode_hex8(header->c_ino, &fields->ino) ||
+            decode_hex8(header->c_mode, &fields->mode) ||
+            decode_hex8(header->c_uid, &fields->uid) ||
+            decode_hex8(header->c_gid, &fields->gid) ||
+            decode_hex8(header->c_nlink, &fields->nlink) ||
+            decode_hex8(header->c_mtime, &fields->mtime) ||
+            decode_hex8(header->c_filesize, &fields->filesize) ||
+            decode_hex8(header->c_devmajor, &fields->devmajor) ||
+            decode_hex8(header->c_devminor, &fields->devminor) ||
+            decode_hex8(header->c_rdevmajor, &fields->rdevmajor) ||
+            decode_hex8(header->c_rdevminor, &fields->rdevminor) ||
+            decode_hex8(header->c_namesize, &fields->namesize) ||
+            decode_hex8(header->c_check, &fields->check)) {
+        return -1;
+    }
+    return 0;
 }
 
 /*
@@ -125,11 +168,14 @@ int cpio_parse_header(struct cpio_header *archive, unsigned long len,
     }
 
     /* Get filename and file size. */
-    filesize = parse_hex_str(archive->c_filesize, sizeof(archive->c_filesize));
-    filename_length = parse_hex_str(archive->c_namesize, sizeof(archive->c_namesize));
+    if (decode_hex8(archive->c_filesize, &filesize) ||
+            decode_hex8(archive->c_namesize, &filename_length) || filename_length == 0) {
+        return -1;
+    }
 
     /* Ensure header + filename + file contents are accessible */
-    if (len < sizeof(struct cpio_header) + filename_length + filesize) {
+    if (len - sizeof(struct cpio_header) < filename_length ||
+            len - sizeof(struct cpio_header) - filename_length < filesize) {
         return -1;
     }
 
@@ -270,3 +316,443 @@ void cpio_ls(void *archive, unsigned long len, char **buf, unsigned long buf_len
         header = header_info.next;
     }
 }
+
+int cpio_validate(void *archive, unsigned long len, struct cpio_info *info)
+{
+    struct cpio_header *header = archive;
+    struct cpio_header_fields fields;
+    struct cpio_header_info header_info;
+    unsigned int file_count = 0;
+    unsigned int max_path_sz = 0;
+
+    if (((unsigned long) archive & (CPIO_ALIGNMENT - 1)) != 0) {
+        return -1;
+    }
+    while (1) {
+        if (len < sizeof(struct cpio_header) || cpio_header_decode(header, &fields)) {
+            return -1;
+        }
+        int error = cpio_parse_header(header, len, &header_info);
+        if (error == -1) {
+            return -1;
+        } else if (error == 1) {
+            /* EOF */
+            break;
+        }
+        /* The name must not contain a NUL before its end, and the padding after
+         * the data must lie within the archive. */
+        unsigned int path_sz = cpio_strlen(header_info.filename);
+        if (path_sz + 1 != fields.namesize ||
+                (unsigned long) ((char *) header_info.next - (char *) header) > len) {
+            return -1;
+        }
+        if (path_sz > max_path_sz) {
+            max_path_sz = path_sz;
+        }
+        file_count++;
+        len = cpio_len_next(len, header, header_info.next);
+        header = header_info.next;
+    }
+
+    if (info) {
+        info->file_count = file_count;
+        info->max_path_sz = max_path_sz;
+    }
+    return 0;
+}
+
+/* Decode a header field that cpio_validate has already checked is hex. */
+static unsigned long decode_hex8_unchecked(const char *s)
+{
+    unsigned long value = 0;
+    for (int i = 0; i < 8; i++) {
+        unsigned char c = s[i];
+        value = value << 4 | ((c & 0x0f) + (c >> 6) * 9);
+    }
+    return value;
+}
+
+/*
+ * Parse the header of an entry of an archive that has passed cpio_validate,
+ * without checking it again.
+ *
+ * Return 1 if it is EOF.
+ */
+static int cpio_parse_header_unchecked(struct cpio_header *archive, struct cpio_header_info *info)
+{
+    unsigned long filesize = decode_hex8_unchecked(archive->c_filesize);
+    unsigned long filename_length = decode_hex8_unchecked(archive->c_namesize);
+
+    info->filename = (char *) archive + sizeof(struct cpio_header);
+    if (filename_length >= sizeof(CPIO_FOOTER_MAGIC) && cpio_strncmp(info->filename,
+                CPIO_FOOTER_MAGIC, sizeof(CPIO_FOOTER_MAGIC)) == 0) {
+        return 1;
+    }
+    info->filesize = filesize;
+    info->data = (void *) align_up((unsigned long) info->filename + filename_length, CPIO_ALIGNMENT);
+    info->next = (struct cpio_header *) align_up((unsigned long) info->data + filesize, CPIO_ALIGNMENT);
+    return 0;
+}
+
+void *cpio_get_entry_unchecked(void *archive, int n, const char **name, unsigned long *size)
+{
+    struct cpio_header *header = archive;
+    struct cpio_header_info header_info;
+
+    if (n < 0) {
+        return NULL;
+    }
+    for (int i = 0; i <= n; i++) {
+        if (cpio_parse_header_unchecked(header, &header_info)) {
+            return NULL;
+        }
+        header = header_info.next;
+    }
+
+    if (name) {
+        *name = header_info.filename;
+    }
+    if (size) {
+        *size = header_info.filesize;
+    }
+    return header_info.data;
+}
+
+void *cpio_get_file_unchecked(void *archive, const char *name, unsigned long *size)
+{
+    struct cpio_header *header = archive;
+    struct cpio_header_info header_info;
+
+    while (1) {
+        if (cpio_parse_header_unchecked(header, &header_info)) {
+            return NULL;
+        }
+        if (cpio_strncmp(header_info.filename, name, -1) == 0) {
+            break;
+        }
+        header = header_info.next;
+    }
+
+    if (size) {
+        *size = header_info.filesize;
+    }
+    return header_info.data;
+}
+
+/* FNV-1a hash of a NUL terminated name. */
+static unsigned int cpio_hash(const char *name)
+{
+    unsigned int hash = 2166136261u;
+    for (; *name; name++) {
+        hash = (hash ^ (unsigned char) *name) * 16777619u;
+    }
+    return hash;
+}
+
+int cpio_index_build(struct cpio_index *index, void *archive, unsigned long len,
+                     struct cpio_index_entry *entries, unsigned int max_entries,
+                     unsigned int *buckets, unsigned int num_buckets)
+{
+    struct cpio_header *header = archive;
+    struct cpio_header_info header_info;
+    unsigned int n = 0;
+
+    if (index == NULL || entries == NULL || buckets == NULL ||
+            num_buckets == 0 || (num_buckets & (num_buckets - 1)) != 0) {
+        return -1;
+    }
+
+    while (1) {
+        int error = cpio_parse_header(header, len, &header_info);
+        if (error == -1) {
+            return -1;
+        } else if (error == 1) {
+            /* EOF */
+            break;
+        }
+        if (n == max_entries) {
+            return 1;
+        }
+        entries[n].name = header_info.filename;
+        entries[n].data = header_info.data;
+        entries[n].size = header_info.filesize;
+        entries[n].hash = cpio_hash(header_info.filename);
+        n++;
+        len = cpio_len_next(len, header, header_info.next);
+        header = header_info.next;
+    }
+
+    for (unsigned int i = 0; i < num_buckets; i++) {
+        buckets[i] = 0;
+    }
+    /* Chain in reverse so that, as with cpio_get_file, the first of several entries with
+     * the same name is the one found. */
+    for (unsigned int i = n; i > 0; i--) {
+        unsigned int *bucket = &buckets[entries[i - 1].hash & (num_buckets - 1)];
+        entries[i - 1].next = *bucket;
+        *bucket = i;
+    }
+
+    index->entries = entries;
+    index->num_entries = n;
+    index->buckets = buckets;
+    index->num_buckets = num_buckets;
+    return 0;
+}
+
+void *cpio_index_get_entry(const struct cpio_index *index, unsigned int n, const char **name,
+                           unsigned long *size)
+{
+    if (n >= index->num_entries) {
+        return NULL;
+    }
+    if (name) {
+        *name = index->entries[n].name;
+    }
+    if (size) {
+        *size = index->entries[n].size;
+    }
+    return index->entries[n].data;
+}
+
+void *cpio_index_get_file(const struct cpio_index *index, const char *name, unsigned long *size)
+{
+    unsigned int hash = cpio_hash(name);
+    unsigned int i = index->buckets[hash & (index->num_buckets - 1)];
+
+    for (; i != 0; i = index->entries[i - 1].next) {
+        const struct cpio_index_entry *entry = &index->entries[i - 1];
+        if (entry->hash == hash && cpio_strncmp(entry->name, name, -1) == 0) {
+            if (size) {
+                *size = entry->size;
+            }
+            return entry->data;
+        }
+    }
+    return NULL;
+}
+
+/* Read exactly 'len' bytes at the reader's offset. Return -1 on error or a short read. */
+static int cpio_reader_fill(struct cpio_reader *reader, void *buf, unsigned long len)
+{
+    char *p = buf;
+    while (len > 0) {
+        long ret = reader->read(reader->cookie, reader->offset, p, len);
+        if (ret <= 0 || (unsigned long) ret > len) {
+            return -1;
+        }
+        reader->offset += ret;
+        p += ret;
+        len -= ret;
+    }
+    return 0;
+}
+
+int cpio_reader_init(struct cpio_reader *reader, cpio_read_fn_t read, void *cookie,
+                     char *name_buf, unsigned long name_buf_len)
+{
+    if (reader == NULL || read == NULL || name_buf == NULL || name_buf_len == 0) {
+        return -1;
+    }
+    reader->read = read;
+    reader->cookie = cookie;
+    reader->name_buf = name_buf;
+    reader->name_buf_len = name_buf_len;
+    reader->offset = 0;
+    reader->data_remaining = 0;
+    reader->data_end = 0;
+    reader->state = 0;
+    return 0;
+}
+
+int cpio_reader_next(struct cpio_reader *reader, struct cpio_stream_entry *entry)
+{
+    struct cpio_header header;
+    struct cpio_header_fields fields;
+
+    if (reader->state != 0) {
+        return reader->state;
+    }
+    /* Skip whatever is left of the current entry. Reads are by offset, so the
+     * skipped data is never read. */
+    reader->offset = reader->data_end;
+    reader->data_remaining = 0;
+
+    if (cpio_reader_fill(reader, &header, sizeof(header)) ||
+            cpio_header_decode(&header, &fields) ||
+            fields.namesize == 0 || fields.namesize > reader->name_buf_len ||
+            cpio_reader_fill(reader, reader->name_buf, fields.namesize) ||
+            reader->name_buf[fields.namesize - 1] != 0) {
+        reader->state = -1;
+        return -1;
+    }
+
+    if (fields.namesize >= sizeof(CPIO_FOOTER_MAGIC) && cpio_strncmp(reader->name_buf,
+                CPIO_FOOTER_MAGIC, sizeof(CPIO_FOOTER_MAGIC)) == 0) {
+        reader->state = 1;
+        return 1;
+    }
+
+    reader->offset = align_up(reader->offset, CPIO_ALIGNMENT);
+    reader->data_remaining = fields.filesize;
+    reader->data_end = align_up(reader->offset + fields.filesize, CPIO_ALIGNMENT);
+
+    if (entry) {
+        entry->name = reader->name_buf;
+        entry->size = fields.filesize;
+        entry->data_offset = reader->offset;
+        entry->fields = fields;
+    }
+    return 0;
+}
+
+long cpio_reader_read(struct cpio_reader *reader, void *buf, unsigned long len)
+{
+    if (reader->state == -1) {
+        return -1;
+    }
+    if (len > reader->data_remaining) {
+        len = reader->data_remaining;
+    }
+    if (len == 0) {
+        return 0;
+    }
+    if (cpio_reader_fill(reader, buf, len)) {
+        reader->state = -1;
+        return -1;
+    }
+    reader->data_remaining -= len;
+    return (long) len;
+}
+
+/* Encode a value as the 8 ASCII hex digits of a header field. */
+static void encode_hex8(char *s, unsigned long value)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    for (int i = 7; i >= 0; i--) {
+        s[i] = digits[value & 0xf];
+        value >>= 4;
+    }
+}
+
+/* Emit bytes to the writer's buffer or callback. */
+static int cpio_writer_emit(struct cpio_writer *writer, const void *data, unsigned long len)
+{
+    if (writer->error) {
+        return -1;
+    }
+    if (writer->write) {
+        if (len && writer->write(writer->cookie, data, len)) {
+            writer->error = 1;
+            return -1;
+        }
+    } else {
+        if (writer->buf_len - writer->offset < len) {
+            writer->error = 1;
+            return -1;
+        }
+        const char *from = data;
+        for (unsigned long i = 0; i < len; i++) {
+            writer->buf[writer->offset + i] = from[i];
+        }
+    }
+    writer->offset += len;
+    return 0;
+}
+
+/* Emit zeroes up to the next CPIO_ALIGNMENT boundary. */
+static int cpio_writer_pad(struct cpio_writer *writer)
+{
+    static const char zeroes[CPIO_ALIGNMENT];
+    return cpio_writer_emit(writer, zeroes, align_up(writer->offset, CPIO_ALIGNMENT) - writer->offset);
+}
+
+/* Emit the header and name of an entry, up to where its data starts. */
+static int cpio_writer_header(struct cpio_writer *writer, const char *name, unsigned long mode,
+                              unsigned long size)
+{
+    struct cpio_header header;
+    unsigned long namesize = cpio_strlen(name) + 1;
+
+    for (unsigned long i = 0; i < sizeof(header.c_magic); i++) {
+        header.c_magic[i] = CPIO_HEADER_MAGIC[i];
+    }
+    encode_hex8(header.c_ino, writer->ino++);
+    encode_hex8(header.c_mode, mode);
+    encode_hex8(header.c_uid, 0);
+    encode_hex8(header.c_gid, 0);
+    encode_hex8(header.c_nlink, 1);
+    encode_hex8(header.c_mtime, 0);
+    encode_hex8(header.c_filesize, size);
+    encode_hex8(header.c_devmajor, 0);
+    encode_hex8(header.c_devminor, 0);
+    encode_hex8(header.c_rdevmajor, 0);
+    encode_hex8(header.c_rdevminor, 0);
+    encode_hex8(header.c_namesize, namesize);
+    encode_hex8(header.c_check, 0);
+
+    if (cpio_writer_emit(writer, &header, sizeof(header)) ||
+            cpio_writer_emit(writer, name, namesize) ||
+            cpio_writer_pad(writer)) {
+        return -1;
+    }
+    return 0;
+}
+
+void cpio_writer_init_buffer(struct cpio_writer *writer, void *buf, unsigned long len)
+{
+    writer->buf = buf;
+    writer->buf_len = len;
+    writer->write = NULL;
+    writer->cookie = NULL;
+    writer->offset = 0;
+    writer->ino = 1;
+    writer->error = 0;
+}
+
+void cpio_writer_init_callback(struct cpio_writer *writer, cpio_write_fn_t write, void *cookie)
+{
+    cpio_writer_init_buffer(writer, NULL, 0);
+    writer->write = write;
+    writer->cookie = cookie;
+}
+
+int cpio_writer_add(struct cpio_writer *writer, const char *name, unsigned long mode,
+                    const void *data, unsigned long size)
+{
+    if (size > 0xffffffffUL || cpio_writer_header(writer, name, mode, size) ||
+            cpio_writer_emit(writer, data, size) ||
+            cpio_writer_pad(writer)) {
+        writer->error = 1;
+        return -1;
+    }
+    return 0;
+}
+
+void *cpio_writer_reserve(struct cpio_writer *writer, const char *name, unsigned long mode,
+                          unsigned long size)
+{
+    if (writer->write || size > 0xffffffffUL ||
+            cpio_writer_header(writer, name, mode, size)) {
+        writer->error = 1;
+        return NULL;
+    }
+    char *data = writer->buf + writer->offset;
+    if (writer->buf_len - writer->offset < size) {
+        writer->error = 1;
+        return NULL;
+    }
+    writer->offset += size;
+    if (cpio_writer_pad(writer)) {
+        return NULL;
+    }
+    return data;
+}
+
+long cpio_writer_finish(struct cpio_writer *writer)
+{
+    if (cpio_writer_header(writer, CPIO_FOOTER_MAGIC, 0, 0)) {
+        return -1;
+    }
+    return (long) writer->offset;
+}
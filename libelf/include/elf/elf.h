@@ -107,10 +107,39 @@ ELF file into memory.
 #include <stdint.h>
 #include <elf.h>
 
+/* A program header, independent of the class of the ELF file */
+typedef struct elf_phdr {
+    uint32_t type;
+    uint32_t flags;
+    size_t offset;
+    uintptr_t vaddr;
+    uintptr_t paddr;
+    size_t file_size;
+    size_t mem_size;
+    size_t align;
+} elf_phdr_t;
+
+/* A section header, independent of the class of the ELF file */
+typedef struct elf_shdr {
+    uint32_t name;
+    uint32_t type;
+    size_t flags;
+    uintptr_t addr;
+    size_t offset;
+    size_t size;
+    uint32_t link;
+    uint32_t info;
+    size_t addr_align;
+    size_t entry_size;
+} elf_shdr_t;
+
 struct elf {
     void *elfFile;
     size_t elfSize;
     unsigned char elfClass; /* 32-bit or 64-bit */
+    /* Decoded headers set up by elf_decodeHeaders, or NULL */
+    const elf_phdr_t *phdrs;
+    const elf_shdr_t *shdrs;
 };
 typedef struct elf elf_t;
 
@@ -247,6 +276,44 @@ const char *elf_getStringTable(elf_t *elfFile, size_t string_segment);
 const char *elf_getSectionStringTable(elf_t *elfFile);
 
 
+/**
+ * Decode the program and section headers of an ELF file into caller provided
+ * tables of class independent headers. Once decoded, the header accessors
+ * read the tables instead of the file, so avoid checking the class of the file
+ * and converting the fields on every call.
+ *
+ * @param elfFile Pointer to a valid ELF structure
+ * @param phdrs Table for the program headers, or NULL to not decode them
+ * @param num_phdrs Number of entries in phdrs, at least elf_getNumProgramHeaders
+ * @param shdrs Table for the section headers, or NULL to not decode them
+ * @param num_shdrs Number of entries in shdrs, at least elf_getNumSections
+ *
+ * The tables must remain valid for as long as the ELF structure is used.
+ *
+ * \return 0 on success, otherwise < 0 if a table is too small
+ */
+int elf_decodeHeaders(elf_t *elfFile, elf_phdr_t *phdrs, size_t num_phdrs,
+                      elf_shdr_t *shdrs, size_t num_shdrs);
+
+/**
+ * Get a class independent copy of a program header.
+ *
+ * @param elfFile Pointer to a valid ELF structure
+ * @param ph Index of the program header
+ * @param phdr Returns the program header
+ */
+void elf_getProgramHeader(elf_t *elfFile, size_t ph, elf_phdr_t *phdr);
+
+/**
+ * Get a class independent copy of a section header.
+ *
+ * @param elfFile Pointer to a valid ELF structure
+ * @param i Index of the section
+ * @param shdr Returns the section header
+ */
+void elf_getSectionHeader(elf_t *elfFile, size_t i, elf_shdr_t *shdr);
+
+
 /* Section header functions */
 /**
  * Get a section of an ELF file.
@@ -504,7 +571,7 @@ int elf_vaddrInProgramHeader(elf_t *elfFile, size_t ph, uintptr_t vaddr);
 uintptr_t elf_vtopProgramHeader(elf_t *elfFile, size_t ph, uintptr_t vaddr);
 
 /**
- * Load an ELF file into memory
+ * Load the PT_LOAD segments of an ELF file into memory
  *
  * @param elfFile Pointer to a valid ELF file
  * @param addr_type If PHYSICAL load using the physical address, otherwise using the
@@ -522,3 +589,436 @@ uintptr_t elf_vtopProgramHeader(elf_t *elfFile, size_t ph, uintptr_t vaddr);
  *
  */
 int elf_loadFile(elf_t *elfFile, elf_addr_type_t addr_type);
+
+/* Compression functions */
+
+/* Not defined by older C libraries */
+#ifndef SHF_COMPRESSED
+#define SHF_COMPRESSED (1 << 11)
+#endif
+#ifndef ELFCOMPRESS_ZLIB
+#define ELFCOMPRESS_ZLIB 1
+#endif
+#ifndef ELFCOMPRESS_ZSTD
+#define ELFCOMPRESS_ZSTD 2
+#endif
+
+/*
+ * Opt in convention for compressed PT_LOAD segments, using an OS specific
+ * program header flag. The file contents of such a segment start with an
+ * Elf32_Chdr or Elf64_Chdr, as for a SHF_COMPRESSED section, followed by the
+ * compressed data. ch_size bytes are decompressed to the start of the segment
+ * and the rest of p_memsz is zero filled. Such segments can only be loaded
+ * with a decompressor.
+ */
+#define PF_LIBELF_COMPRESSED 0x00100000
+
+/* Decoded compression header of a compressed section or segment */
+typedef struct elf_compression {
+    /* ELFCOMPRESS_* */
+    uint32_t type;
+    /* Size and alignment of the uncompressed data */
+    size_t size;
+    size_t align;
+    /* The compressed data following the header */
+    const void *data;
+    size_t data_size;
+} elf_compression_t;
+
+/**
+ * Decompress a buffer.
+ *
+ * @param cookie Cookie from the decompressor
+ * @param type Compression algorithm, ELFCOMPRESS_*
+ * @param dest Buffer to decompress into
+ * @param dest_size Exact size of the decompressed data
+ * @param src Compressed data
+ * @param src_size Size of the compressed data
+ *
+ * \return 0 if exactly dest_size bytes were decompressed, otherwise non-zero,
+ *         including for unsupported algorithms
+ */
+typedef int (*elf_decompress_fn_t)(void *cookie, uint32_t type, void *dest, size_t dest_size,
+                                   const void *src, size_t src_size);
+
+/* Decompressor provided by the caller, e.g. wrapping zlib, zstd or lz4 */
+typedef struct elf_decompressor {
+    elf_decompress_fn_t decompress;
+    void *cookie;
+} elf_decompressor_t;
+
+/**
+ * Decode the Elf32_Chdr or Elf64_Chdr at the start of some data.
+ *
+ * @param elf Pointer to a valid ELF structure
+ * @param data Start of the compressed section or segment
+ * @param size Size of the compressed section or segment, including the header
+ * @param comp Returns the decoded header
+ *
+ * \return 0 on success, otherwise < 0 if the data is too small for the header
+ */
+int elf_getCompressionHeader(elf_t *elf, const void *data, size_t size, elf_compression_t *comp);
+
+/**
+ * Get the compression header of a SHF_COMPRESSED section.
+ *
+ * @param elf Pointer to a valid ELF structure
+ * @param i Index of the section
+ * @param comp Returns the decoded header
+ *
+ * \return 0 on success, otherwise < 0 if the section is not compressed or
+ *         is invalid
+ */
+int elf_getSectionCompression(elf_t *elf, size_t i, elf_compression_t *comp);
+
+/**
+ * Get the contents of a section, decompressing it if it is SHF_COMPRESSED.
+ * Uncompressed sections are copied.
+ *
+ * @param elf Pointer to a valid ELF structure
+ * @param i Index of the section
+ * @param decompressor Decompressor to use, may be NULL if the section is
+ *                     not compressed
+ * @param dest Buffer for the contents
+ * @param dest_size Size of dest, at least the uncompressed size of the section
+ *
+ * \return 0 on success, otherwise < 0
+ */
+int elf_decompressSection(elf_t *elf, size_t i, const elf_decompressor_t *decompressor,
+                          void *dest, size_t dest_size);
+
+
+/* Loading functions */
+
+/**
+ * Copy part of a segment into place. The copy does not have to have completed
+ * when this returns, only by the time the loader's wait function returns, so
+ * it can be handed to a DMA engine or to a worker on another core.
+ *
+ * @param cookie Cookie from the loader
+ * @param dest Destination address
+ * @param src Source address within the ELF file
+ * @param len Number of bytes to copy
+ *
+ * \return 0 if the copy was started, otherwise non-zero
+ */
+typedef int (*elf_copy_fn_t)(void *cookie, void *dest, const void *src, size_t len);
+
+/**
+ * Wait for all copies started by the loader's copy function to complete.
+ *
+ * @param cookie Cookie from the loader
+ *
+ * \return 0 if all copies completed successfully, otherwise non-zero
+ */
+typedef int (*elf_copy_wait_fn_t)(void *cookie);
+
+/**
+ * Offer a page aligned range of a segment's zero initialised memory to the
+ * caller, e.g. to be backed by mappings of a shared zero page.
+ *
+ * @param cookie Cookie from the loader
+ * @param start Page aligned start address of the range
+ * @param len Length of the range, a multiple of the page size
+ *
+ * \return 0 if the caller has made the range zero, otherwise non-zero in which
+ *         case the loader zeroes it itself
+ */
+typedef int (*elf_zero_pages_fn_t)(void *cookie, uintptr_t start, size_t len);
+
+/* Hooks used by elf_loadFileWith. Any of the functions may be NULL */
+typedef struct elf_loader {
+    /* Copy function, memcpy is used if NULL */
+    elf_copy_fn_t copy;
+    /* Called once after every copy has been started */
+    elf_copy_wait_fn_t wait;
+    /* If non-zero segments are split into copies of at most this many bytes,
+     * so that a single large segment can be spread over several workers */
+    size_t copy_chunk;
+    /* Called for the whole pages of each segment's zero initialised region,
+     * only the partial pages at either end are then zeroed by the loader */
+    elf_zero_pages_fn_t zero_pages;
+    /* Page size used for zero_pages, must be a power of 2 if zero_pages is set */
+    size_t page_size;
+    /* Added to every load address, to load a position independent file away
+     * from its linked address. Not used by elf_loadPlan, whose entries already
+     * hold the final addresses */
+    uintptr_t load_bias;
+    /* Used for PF_LIBELF_COMPRESSED segments, which fail to load if NULL.
+     * Decompression is done synchronously, not through the copy function */
+    const elf_decompressor_t *decompressor;
+    void *cookie;
+} elf_loader_t;
+
+/**
+ * Load the PT_LOAD segments of an ELF file into memory using caller provided
+ * hooks to do the copying and zeroing.
+ *
+ * Every segment is checked to lie within the file before anything is written.
+ * All copies are then started, and zero initialised memory is only touched
+ * once the wait function has returned.
+ *
+ * @param elf Pointer to a valid ELF file
+ * @param addr_type If PHYSICAL load using the physical address, otherwise using the
+ *                  virtual addresses
+ * @param loader Hooks to use, or NULL to behave like elf_loadFile
+ *
+ * \return true on success, false on failure.
+ */
+int elf_loadFileWith(elf_t *elf, elf_addr_type_t addr_type, const elf_loader_t *loader);
+
+enum elf_segment_action {
+    /* The segment's pages can be mapped directly from the ELF file */
+    ELF_SEGMENT_MAP,
+    /* The segment must be copied, and zero filled, into its own memory */
+    ELF_SEGMENT_COPY,
+    /* The segment is PF_LIBELF_COMPRESSED and must be decompressed, and zero
+     * filled, into its own memory */
+    ELF_SEGMENT_DECOMPRESS
+};
+typedef enum elf_segment_action elf_segment_action_t;
+
+/* How to load a single PT_LOAD segment, as determined by elf_planLoad */
+typedef struct elf_segment_plan {
+    /* Index of the program header */
+    size_t ph;
+    elf_segment_action_t action;
+    /* Load address of the segment, physical or virtual as requested */
+    uintptr_t dest;
+    /* Segment contents within the ELF file. For ELF_SEGMENT_DECOMPRESS this
+     * is the compressed data following the compression header */
+    const char *src;
+    size_t file_size;
+    /* Number of bytes copied or decompressed to dest, the rest of mem_size
+     * is zero filled */
+    size_t data_size;
+    size_t mem_size;
+    /* ELFCOMPRESS_* for ELF_SEGMENT_DECOMPRESS */
+    uint32_t compression;
+    /* Program header flags (PF_R, PF_W, PF_X) */
+    uint32_t flags;
+    /* For ELF_SEGMENT_MAP, the page aligned range of the ELF file to map and
+     * the page aligned address to map it at */
+    uintptr_t map_dest;
+    uintptr_t map_src;
+    size_t map_size;
+} elf_segment_plan_t;
+
+/**
+ * Determine which PT_LOAD segments of an ELF file can be mapped straight from
+ * the pages holding the file, for example to share the text of a component
+ * between several instances, and which must be copied.
+ *
+ * A segment can be mapped if it is not writable, has no zero initialised
+ * region, its address in the file is congruent to its load address modulo the
+ * page size, and the pages it occupies lie entirely within the file. When the
+ * file is page aligned in memory the address condition is the same as the
+ * segment's offset and address being congruent. Note that the first and last
+ * mapped pages may also contain neighbouring parts of the file.
+ *
+ * @param elf Pointer to a valid ELF file
+ * @param addr_type If PHYSICAL plan using the physical address, otherwise using the
+ *                  virtual addresses
+ * @param page_size Size of the pages that will be mapped, must be a power of 2
+ * @param plan Array to fill in, one entry per PT_LOAD segment
+ * @param max_entries Size of the plan array
+ *
+ * \return The number of PT_LOAD segments, which may be larger than max_entries
+ *         in which case only the first max_entries are filled in, or < 0 if a
+ *         segment is invalid.
+ */
+int elf_planLoad(elf_t *elf, elf_addr_type_t addr_type, size_t page_size,
+                 elf_segment_plan_t *plan, size_t max_entries);
+
+/**
+ * Load the ELF_SEGMENT_COPY and ELF_SEGMENT_DECOMPRESS segments of a plan
+ * returned by elf_planLoad, as elf_loadFileWith would. Mapping the
+ * ELF_SEGMENT_MAP segments is left to the caller.
+ *
+ * @param plan Plan returned by elf_planLoad
+ * @param num_entries Number of entries in the plan
+ * @param loader Hooks to use, or NULL to copy and zero with memcpy and memset
+ *
+ * \return true on success, false on failure.
+ */
+int elf_loadPlan(const elf_segment_plan_t *plan, size_t num_entries, const elf_loader_t *loader);
+
+
+/* Symbol functions */
+
+/* A symbol, independent of the class of the ELF file */
+typedef struct elf_symbol {
+    const char *name;
+    uintptr_t value;
+    size_t size;
+    /* st_info, use ELF32_ST_TYPE and ELF32_ST_BIND to decode */
+    unsigned char info;
+    uint16_t shndx;
+    /* Index of the symbol in its symbol table */
+    size_t index;
+} elf_symbol_t;
+
+/*
+ * A symbol table of an ELF file and the hash tables that can be used to look
+ * symbols up by name. Initialise with elf_symtabInit. If the file has no hash
+ * section for the table a hash index can be built in caller provided memory
+ * with elf_symtabBuildIndex, otherwise lookups by name are a linear search.
+ * Lookups by address need an address index from elf_symtabBuildAddressIndex
+ * to avoid a linear search.
+ */
+typedef struct elf_symtab {
+    elf_t *elf;
+    const char *syms;
+    size_t sym_size;
+    size_t num_syms;
+    const char *strtab;
+    size_t strtab_size;
+    /* .gnu.hash or .hash section linked to this table, or NULL */
+    const uint32_t *gnu_hash;
+    const uint32_t *sysv_hash;
+    /* Open addressed table of symbol index + 1, 0 is empty. Size is a power of 2 */
+    uint32_t *index;
+    size_t index_size;
+    /* Indices of function and object symbols sorted by address */
+    uint32_t *addr_index;
+    size_t addr_index_size;
+} elf_symtab_t;
+
+/**
+ * Initialise a symbol table structure for the symbol table of an ELF file.
+ * Sections are found by type, not by name.
+ *
+ * @param elf Pointer to a valid ELF structure
+ * @param dynamic If true use the dynamic symbol table (SHT_DYNSYM), otherwise
+ *                the full symbol table (SHT_SYMTAB)
+ * @param symtab Symbol table structure to initialise
+ *
+ * \return 0 on success, otherwise < 0 if there is no valid symbol table
+ */
+int elf_symtabInit(elf_t *elf, bool dynamic, elf_symtab_t *symtab);
+
+/**
+ * Get a symbol of a symbol table by index.
+ *
+ * @param symtab Initialised symbol table
+ * @param i Index of the symbol
+ * @param sym Returns the symbol
+ *
+ * \return 0 on success, otherwise < 0 if there is no such symbol
+ */
+int elf_symtabGetSymbol(elf_symtab_t *symtab, size_t i, elf_symbol_t *sym);
+
+/**
+ * Return the number of entries for the hash index of a symbol table. Fewer
+ * may be used as long as it is a power of 2 larger than the number of symbols.
+ *
+ * @param symtab Initialised symbol table
+ *
+ * \return Recommended number of uint32_t entries for elf_symtabBuildIndex.
+ */
+size_t elf_symtabIndexSize(elf_symtab_t *symtab);
+
+/**
+ * Build a hash index of the defined symbols of a symbol table, used by
+ * elf_symtabLookup when the file has no hash section for the table.
+ *
+ * @param symtab Initialised symbol table
+ * @param index Memory for the index, which must remain valid while the
+ *              symbol table is used
+ * @param index_size Number of entries in index
+ *
+ * \return 0 on success, otherwise < 0 if the index is too small
+ */
+int elf_symtabBuildIndex(elf_symtab_t *symtab, uint32_t *index, size_t index_size);
+
+/**
+ * Build an index of the defined function and object symbols of a symbol table
+ * sorted by address, used by elf_symtabLookupAddress.
+ *
+ * @param symtab Initialised symbol table
+ * @param index Memory for the index, which must remain valid while the
+ *              symbol table is used. num_syms entries is always sufficient
+ * @param index_size Number of entries in index
+ *
+ * \return 0 on success, otherwise < 0 if the index is too small
+ */
+int elf_symtabBuildAddressIndex(elf_symtab_t *symtab, uint32_t *index, size_t index_size);
+
+/**
+ * Find a defined symbol by name.
+ *
+ * @param symtab Initialised symbol table
+ * @param name Name of the symbol
+ * @param sym Returns the symbol
+ *
+ * \return 0 if the symbol was found, otherwise < 0
+ */
+int elf_symtabLookup(elf_symtab_t *symtab, const char *name, elf_symbol_t *sym);
+
+/**
+ * Find the function or object symbol containing an address, e.g. to
+ * symbolise a backtrace. A symbol with a size of 0 is taken to extend up to
+ * the next symbol.
+ *
+ * @param symtab Initialised symbol table
+ * @param addr Address to look up
+ * @param sym Returns the symbol
+ *
+ * \return 0 if a symbol was found, otherwise < 0
+ */
+int elf_symtabLookupAddress(elf_symtab_t *symtab, uintptr_t addr, elf_symbol_t *sym);
+
+/**
+ * Find a defined symbol in the symbol table of an ELF file, using the dynamic
+ * symbol table's hash section if there is one and otherwise searching the
+ * full symbol table.
+ *
+ * @param elf Pointer to a valid ELF structure
+ * @param name Name of the symbol
+ * @param sym Returns the symbol
+ *
+ * \return 0 if the symbol was found, otherwise < 0
+ */
+int elf_getSymbol(elf_t *elf, const char *name, elf_symbol_t *sym);
+
+
+/* Relocation functions */
+
+/**
+ * Resolve a symbol that is not defined by the file being relocated.
+ *
+ * @param cookie Cookie passed to elf_relocate
+ * @param sym The undefined symbol, from the dynamic symbol table
+ * @param value Returns the address of the symbol
+ *
+ * \return 0 if the symbol was resolved, otherwise non-zero
+ */
+typedef int (*elf_resolve_fn_t)(void *cookie, const elf_symbol_t *sym, uintptr_t *value);
+
+/**
+ * Apply the dynamic relocations of a loaded ELF file, rebasing it to run at
+ * its linked addresses plus bias. Relative relocations, in REL, RELA and RELR
+ * form, and the word sized absolute, GLOB_DAT and JUMP_SLOT relocations of
+ * x86, x86_64, arm, aarch64 and riscv are supported. Any other relocation
+ * fails.
+ *
+ * The relocation and symbol tables are read from the file, the relocated
+ * words are read and written in the loaded image, at their run address plus
+ * write_offset. As with elf_loadFile direct access to the image is assumed.
+ *
+ * @param elf Pointer to a valid ELF file, already loaded with load_bias set to
+ *            bias + write_offset
+ * @param bias Difference between the address the file will run at and the
+ *             address it was linked at
+ * @param write_offset Difference between the address the image is accessed at
+ *                     and the address it will run at, normally 0
+ * @param resolve Function to resolve undefined symbols, may be NULL in which
+ *                case relocations against them fail
+ * @param cookie Cookie to pass to resolve
+ *
+ * \return 0 on success, otherwise < 0 in which case the image may be partly
+ *         relocated and should be reloaded before trying again. A file without
+ *         a PT_DYNAMIC segment can only be relocated with a bias of 0
+ */
+int elf_relocate(elf_t *elf, uintptr_t bias, uintptr_t write_offset,
+                 elf_resolve_fn_t resolve, void *cookie);
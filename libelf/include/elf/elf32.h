@@ -82,6 +82,7 @@
 
 #include <stdint.h>
 #include <elf/elf.h>
+#include <elf/gen_config.h>
 
 /* ELF header functions */
 int elf32_checkFile(elf_t *elf);
@@ -93,7 +94,13 @@ int elf32_checkSectionTable(elf_t *elf);
 static inline bool
 elf_isElf32(elf_t *elf)
 {
+#if defined(CONFIG_LIB_ELF_CLASS_32)
+    return true;
+#elif defined(CONFIG_LIB_ELF_CLASS_64)
+    return false;
+#else
     return elf->elfClass == ELFCLASS32;
+#endif
 }
 
 static inline Elf32_Ehdr
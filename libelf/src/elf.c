@@ -142,15 +142,17 @@ elf_check_magic(char *file)
 int
 elf_checkFile(elf_t *elfFile)
 {
-    int res = elf32_checkFile(elfFile);
-    if (res == 0) {
+#ifndef CONFIG_LIB_ELF_CLASS_64
+    if (elf32_checkFile(elfFile) == 0) {
         return 0;
     }
+#endif
 
-    res = elf64_checkFile(elfFile);
-    if (res == 0) {
+#ifndef CONFIG_LIB_ELF_CLASS_32
+    if (elf64_checkFile(elfFile) == 0) {
         return 0;
     }
+#endif
 
     return -1;
 }
@@ -242,6 +244,102 @@ elf_getSectionStringTable(elf_t *elf)
     return elf_getStringTable(elf, index);
 }
 
+void
+elf_getProgramHeader(elf_t *elf, size_t ph, elf_phdr_t *phdr)
+{
+    if (elf->phdrs) {
+        *phdr = elf->phdrs[ph];
+    } else if (elf_isElf32(elf)) {
+        Elf32_Phdr *p = &elf32_getProgramHeaderTable(elf)[ph];
+        *phdr = (elf_phdr_t) {
+            .type = p->p_type,
+            .flags = p->p_flags,
+            .offset = p->p_offset,
+            .vaddr = p->p_vaddr,
+            .paddr = p->p_paddr,
+            .file_size = p->p_filesz,
+            .mem_size = p->p_memsz,
+            .align = p->p_align,
+        };
+    } else {
+        Elf64_Phdr *p = &elf64_getProgramHeaderTable(elf)[ph];
+        *phdr = (elf_phdr_t) {
+            .type = p->p_type,
+            .flags = p->p_flags,
+            .offset = p->p_offset,
+            .vaddr = p->p_vaddr,
+            .paddr = p->p_paddr,
+            .file_size = p->p_filesz,
+            .mem_size = p->p_memsz,
+            .align = p->p_align,
+        };
+    }
+}
+
+void
+elf_getSectionHeader(elf_t *elf, size_t i, elf_shdr_t *shdr)
+{
+    if (elf->shdrs) {
+        *shdr = elf->shdrs[i];
+    } else if (elf_isElf32(elf)) {
+        Elf32_Shdr *s = &elf32_getSectionTable(elf)[i];
+        *shdr = (elf_shdr_t) {
+            .name = s->sh_name,
+            .type = s->sh_type,
+            .flags = s->sh_flags,
+            .addr = s->sh_addr,
+            .offset = s->sh_offset,
+            .size = s->sh_size,
+            .link = s->sh_link,
+            .info = s->sh_info,
+            .addr_align = s->sh_addralign,
+            .entry_size = s->sh_entsize,
+        };
+    } else {
+        Elf64_Shdr *s = &elf64_getSectionTable(elf)[i];
+        *shdr = (elf_shdr_t) {
+            .name = s->sh_name,
+            .type = s->sh_type,
+            .flags = s->sh_flags,
+            .addr = s->sh_addr,
+            .offset = s->sh_offset,
+            .size = s->sh_size,
+            .link = s->sh_link,
+            .info = s->sh_info,
+            .addr_align = s->sh_addralign,
+            .entry_size = s->sh_entsize,
+        };
+    }
+}
+
+int
+elf_decodeHeaders(elf_t *elf, elf_phdr_t *phdrs, size_t num_phdrs,
+                  elf_shdr_t *shdrs, size_t num_shdrs)
+{
+    size_t num_ph = elf_getNumProgramHeaders(elf);
+    size_t num_sections = elf_getNumSections(elf);
+    if ((phdrs && num_phdrs < num_ph) || (shdrs && num_shdrs < num_sections)) {
+        return -1;
+    }
+
+    /* decode from the file rather than any previously decoded tables */
+    elf->phdrs = NULL;
+    elf->shdrs = NULL;
+    if (phdrs) {
+        for (size_t i = 0; i < num_ph; i++) {
+            elf_getProgramHeader(elf, i, &phdrs[i]);
+        }
+    }
+    if (shdrs) {
+        for (size_t i = 0; i < num_sections; i++) {
+            elf_getSectionHeader(elf, i, &shdrs[i]);
+        }
+    }
+    elf->phdrs = phdrs;
+    elf->shdrs = shdrs;
+    return 0;
+}
+
 
 /* Section header functions */
 void *
@@ -270,8 +368,17 @@ void *
 elf_getSectionNamed(elf_t *elfFile, const char *str, size_t *id)
 {
     size_t numSections = elf_getNumSections(elfFile);
+    size_t str_table_idx = elf_getSectionStringTableIndex(elfFile);
+    const char *str_table = elf_getStringTable(elfFile, str_table_idx);
+    if (str_table == NULL) {
+        return NULL;
+    }
+    size_t str_table_size = elf_getSectionSize(elfFile, str_table_idx);
+
+    /* look the string table up once rather than for every section */
     for (size_t i = 0; i < numSections; i++) {
-        if (strcmp(str, elf_getSectionName(elfFile, i)) == 0) {
+        size_t offset = elf_getSectionNameOffset(elfFile, i);
+        if (offset < str_table_size && strcmp(str, str_table + offset) == 0) {
             if (id != NULL) {
                 *id = i;
             }
@@ -298,6 +405,9 @@ elf_getSectionName(elf_t *elf, size_t i)
 
 size_t elf_getSectionNameOffset(elf_t *elfFile, size_t i)
 {
+    if (elfFile->shdrs) {
+        return elfFile->shdrs[i].name;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getSectionNameOffset(elfFile, i);
     } else {
@@ -308,6 +418,9 @@ size_t elf_getSectionNameOffset(elf_t *elfFile, size_t i)
 uint32_t
 elf_getSectionType(elf_t *elfFile, size_t i)
 {
+    if (elfFile->shdrs) {
+        return elfFile->shdrs[i].type;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getSectionType(elfFile, i);
     } else {
@@ -318,6 +431,9 @@ elf_getSectionType(elf_t *elfFile, size_t i)
 size_t
 elf_getSectionFlags(elf_t *elfFile, size_t i)
 {
+    if (elfFile->shdrs) {
+        return elfFile->shdrs[i].flags;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getSectionFlags(elfFile, i);
     } else {
@@ -328,6 +444,9 @@ elf_getSectionFlags(elf_t *elfFile, size_t i)
 uintptr_t
 elf_getSectionAddr(elf_t *elfFile, size_t i)
 {
+    if (elfFile->shdrs) {
+        return elfFile->shdrs[i].addr;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getSectionAddr(elfFile, i);
     } else {
@@ -338,6 +457,9 @@ elf_getSectionAddr(elf_t *elfFile, size_t i)
 size_t
 elf_getSectionOffset(elf_t *elfFile, size_t i)
 {
+    if (elfFile->shdrs) {
+        return elfFile->shdrs[i].offset;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getSectionOffset(elfFile, i);
     } else {
@@ -348,6 +470,9 @@ elf_getSectionOffset(elf_t *elfFile, size_t i)
 size_t
 elf_getSectionSize(elf_t *elfFile, size_t i)
 {
+    if (elfFile->shdrs) {
+        return elfFile->shdrs[i].size;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getSectionSize(elfFile, i);
     } else {
@@ -358,6 +483,9 @@ elf_getSectionSize(elf_t *elfFile, size_t i)
 uint32_t
 elf_getSectionLink(elf_t *elfFile, size_t i)
 {
+    if (elfFile->shdrs) {
+        return elfFile->shdrs[i].link;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getSectionLink(elfFile, i);
     } else {
@@ -368,6 +496,9 @@ elf_getSectionLink(elf_t *elfFile, size_t i)
 uint32_t
 elf_getSectionInfo(elf_t *elfFile, size_t i)
 {
+    if (elfFile->shdrs) {
+        return elfFile->shdrs[i].info;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getSectionInfo(elfFile, i);
     } else {
@@ -378,6 +509,9 @@ elf_getSectionInfo(elf_t *elfFile, size_t i)
 size_t
 elf_getSectionAddrAlign(elf_t *elfFile, size_t i)
 {
+    if (elfFile->shdrs) {
+        return elfFile->shdrs[i].addr_align;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getSectionAddrAlign(elfFile, i);
     } else {
@@ -388,6 +522,9 @@ elf_getSectionAddrAlign(elf_t *elfFile, size_t i)
 size_t
 elf_getSectionEntrySize(elf_t *elfFile, size_t i)
 {
+    if (elfFile->shdrs) {
+        return elfFile->shdrs[i].entry_size;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getSectionEntrySize(elfFile, i);
     } else {
@@ -397,23 +534,32 @@ elf_getSectionEntrySize(elf_t *elfFile, size_t i)
 
 
 /* Program headers function */
-void *
-elf_getProgramSegment(elf_t *elf, size_t ph)
+static void *
+elf_getSegmentData(elf_t *elf, const elf_phdr_t *phdr)
 {
-    size_t offset = elf_getProgramHeaderOffset(elf, ph);
-    size_t file_size = elf_getProgramHeaderFileSize(elf, ph);
-    size_t segment_end = offset + file_size;
+    size_t segment_end = phdr->offset + phdr->file_size;
     /* possible wraparound - check that segment end is not before segment start */
-    if (elf->elfSize < segment_end || segment_end < offset) {
+    if (elf->elfSize < segment_end || segment_end < phdr->offset) {
         return NULL;
     }
 
-    return elf->elfFile + offset;
+    return elf->elfFile + phdr->offset;
+}
+
+void *
+elf_getProgramSegment(elf_t *elf, size_t ph)
+{
+    elf_phdr_t phdr;
+    elf_getProgramHeader(elf, ph, &phdr);
+    return elf_getSegmentData(elf, &phdr);
 }
 
 uint32_t
 elf_getProgramHeaderType(elf_t *elfFile, size_t ph)
 {
+    if (elfFile->phdrs) {
+        return elfFile->phdrs[ph].type;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getProgramHeaderType(elfFile, ph);
     } else {
@@ -424,6 +570,9 @@ elf_getProgramHeaderType(elf_t *elfFile, size_t ph)
 size_t
 elf_getProgramHeaderOffset(elf_t *elfFile, size_t ph)
 {
+    if (elfFile->phdrs) {
+        return elfFile->phdrs[ph].offset;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getProgramHeaderOffset(elfFile, ph);
     } else {
@@ -434,6 +583,9 @@ elf_getProgramHeaderOffset(elf_t *elfFile, size_t ph)
 uintptr_t
 elf_getProgramHeaderVaddr(elf_t *elfFile, size_t ph)
 {
+    if (elfFile->phdrs) {
+        return elfFile->phdrs[ph].vaddr;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getProgramHeaderVaddr(elfFile, ph);
     } else {
@@ -444,6 +596,9 @@ elf_getProgramHeaderVaddr(elf_t *elfFile, size_t ph)
 uintptr_t
 elf_getProgramHeaderPaddr(elf_t *elfFile, size_t ph)
 {
+    if (elfFile->phdrs) {
+        return elfFile->phdrs[ph].paddr;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getProgramHeaderPaddr(elfFile, ph);
     } else {
@@ -454,6 +609,9 @@ elf_getProgramHeaderPaddr(elf_t *elfFile, size_t ph)
 size_t
 elf_getProgramHeaderFileSize(elf_t *elfFile, size_t ph)
 {
+    if (elfFile->phdrs) {
+        return elfFile->phdrs[ph].file_size;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getProgramHeaderFileSize(elfFile, ph);
     } else {
@@ -464,6 +622,9 @@ elf_getProgramHeaderFileSize(elf_t *elfFile, size_t ph)
 size_t
 elf_getProgramHeaderMemorySize(elf_t *elfFile, size_t ph)
 {
+    if (elfFile->phdrs) {
+        return elfFile->phdrs[ph].mem_size;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getProgramHeaderMemorySize(elfFile, ph);
     } else {
@@ -474,6 +635,9 @@ elf_getProgramHeaderMemorySize(elf_t *elfFile, size_t ph)
 uint32_t
 elf_getProgramHeaderFlags(elf_t *elfFile, size_t ph)
 {
+    if (elfFile->phdrs) {
+        return elfFile->phdrs[ph].flags;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getProgramHeaderFlags(elfFile, ph);
     } else {
@@ -484,6 +648,9 @@ elf_getProgramHeaderFlags(elf_t *elfFile, size_t ph)
 size_t
 elf_getProgramHeaderAlign(elf_t *elfFile, size_t ph)
 {
+    if (elfFile->phdrs) {
+        return elfFile->phdrs[ph].align;
+    }
     if (elf_isElf32(elfFile)) {
         return elf32_getProgramHeaderAlign(elfFile, ph);
     } else {
@@ -502,18 +669,20 @@ elf_getMemoryBounds(elf_t *elfFile, elf_addr_type_t addr_type, uintptr_t *min, u
 
     for(i = 0; i < elf_getNumProgramHeaders(elfFile); i++) {
         uintptr_t sect_min, sect_max;
+        elf_phdr_t phdr;
 
-        if (elf_getProgramHeaderMemorySize(elfFile, i) == 0) {
+        elf_getProgramHeader(elfFile, i, &phdr);
+        if (phdr.mem_size == 0) {
             continue;
         }
 
         if (addr_type == PHYSICAL) {
-            sect_min = elf_getProgramHeaderPaddr(elfFile, i);
+            sect_min = phdr.paddr;
         } else {
-            sect_min = elf_getProgramHeaderVaddr(elfFile, i);
+            sect_min = phdr.vaddr;
         }
 
-        sect_max = sect_min + elf_getProgramHeaderMemorySize(elfFile, i);
+        sect_max = sect_min + phdr.mem_size;
 
         if (sect_max > mem_max) {
             mem_max = sect_max;
@@ -552,25 +721,340 @@ elf_vtopProgramHeader(elf_t *elfFile, size_t ph, uintptr_t vaddr)
     return paddr;
 }
 
+/* Compression functions */
 int
-elf_loadFile(elf_t *elf, elf_addr_type_t addr_type)
+elf_getCompressionHeader(elf_t *elf, const void *data, size_t size, elf_compression_t *comp)
+{
+    const char *p = data;
+    uint32_t type;
+
+    /* read the fields individually as the header may not be aligned */
+    if (elf_isElf32(elf)) {
+        uint32_t ch_size, ch_addralign;
+        if (size < 3 * sizeof(uint32_t)) {
+            return -1;
+        }
+        memcpy(&type, p, sizeof(type));
+        memcpy(&ch_size, p + 4, sizeof(ch_size));
+        memcpy(&ch_addralign, p + 8, sizeof(ch_addralign));
+        comp->size = ch_size;
+        comp->align = ch_addralign;
+        comp->data = p + 12;
+        comp->data_size = size - 12;
+    } else {
+        uint64_t ch_size, ch_addralign;
+        if (size < 6 * sizeof(uint32_t)) {
+            return -1;
+        }
+        memcpy(&type, p, sizeof(type));
+        memcpy(&ch_size, p + 8, sizeof(ch_size));
+        memcpy(&ch_addralign, p + 16, sizeof(ch_addralign));
+        if (ch_size > SIZE_MAX) {
+            return -1;
+        }
+        comp->size = ch_size;
+        comp->align = ch_addralign;
+        comp->data = p + 24;
+        comp->data_size = size - 24;
+    }
+    comp->type = type;
+    return 0;
+}
+
+int
+elf_getSectionCompression(elf_t *elf, size_t i, elf_compression_t *comp)
+{
+    if (!(elf_getSectionFlags(elf, i) & SHF_COMPRESSED)) {
+        return -1;
+    }
+    const void *data = elf_getSection(elf, i);
+    if (data == NULL) {
+        return -1;
+    }
+    return elf_getCompressionHeader(elf, data, elf_getSectionSize(elf, i), comp);
+}
+
+int
+elf_decompressSection(elf_t *elf, size_t i, const elf_decompressor_t *decompressor,
+                      void *dest, size_t dest_size)
+{
+    elf_compression_t comp;
+
+    if (!(elf_getSectionFlags(elf, i) & SHF_COMPRESSED)) {
+        const void *data = elf_getSection(elf, i);
+        size_t size = elf_getSectionSize(elf, i);
+        if (data == NULL || size > dest_size) {
+            return -1;
+        }
+        memcpy(dest, data, size);
+        return 0;
+    }
+
+    if (elf_getSectionCompression(elf, i, &comp) != 0 || comp.size > dest_size ||
+            decompressor == NULL || decompressor->decompress == NULL) {
+        return -1;
+    }
+    return decompressor->decompress(decompressor->cookie, comp.type, dest, comp.size,
+                                    comp.data, comp.data_size) == 0 ? 0 : -1;
+}
+
+
+/* Loading functions */
+static uintptr_t
+elf_getLoadAddress(const elf_phdr_t *phdr, elf_addr_type_t addr_type)
+{
+    if (addr_type == PHYSICAL) {
+        return phdr->paddr;
+    } else {
+        return phdr->vaddr;
+    }
+}
+
+/*
+ * Work out how to load a PT_LOAD segment, checking that it lies within the
+ * file. Segments are always planned as ELF_SEGMENT_COPY or, when they follow
+ * the compressed segment convention, ELF_SEGMENT_DECOMPRESS.
+ */
+static int
+elf_planSegment(elf_t *elf, size_t ph, const elf_phdr_t *phdr, uintptr_t dest,
+                elf_segment_plan_t *entry)
+{
+    const char *src = elf_getSegmentData(elf, phdr);
+    if (src == NULL || phdr->file_size > phdr->mem_size || dest + phdr->mem_size < dest) {
+        return -1;
+    }
+
+    *entry = (elf_segment_plan_t) {
+        .ph = ph,
+        .action = ELF_SEGMENT_COPY,
+        .dest = dest,
+        .src = src,
+        .file_size = phdr->file_size,
+        .data_size = phdr->file_size,
+        .mem_size = phdr->mem_size,
+        .flags = phdr->flags,
+    };
+
+    if (phdr->flags & PF_LIBELF_COMPRESSED) {
+        elf_compression_t comp;
+        if (elf_getCompressionHeader(elf, src, phdr->file_size, &comp) != 0 ||
+                comp.size > phdr->mem_size) {
+            return -1;
+        }
+        entry->action = ELF_SEGMENT_DECOMPRESS;
+        entry->compression = comp.type;
+        entry->src = comp.data;
+        entry->file_size = comp.data_size;
+        entry->data_size = comp.size;
+    }
+    return 0;
+}
+
+static int
+elf_copyRange(const elf_loader_t *loader, uintptr_t dest, const char *src, size_t len)
+{
+    if (loader->copy == NULL) {
+        memcpy((void *) dest, src, len);
+        return 0;
+    }
+    size_t chunk = loader->copy_chunk ? loader->copy_chunk : len;
+    for (size_t off = 0; off < len; off += chunk) {
+        size_t n = len - off < chunk ? len - off : chunk;
+        if (loader->copy(loader->cookie, (void *)(dest + off), src + off, n) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int
+elf_loadSegment(const elf_loader_t *loader, const elf_segment_plan_t *entry)
+{
+    if (entry->action == ELF_SEGMENT_COPY) {
+        return elf_copyRange(loader, entry->dest, entry->src, entry->file_size);
+    }
+    if (entry->action == ELF_SEGMENT_DECOMPRESS) {
+        const elf_decompressor_t *decompressor = loader->decompressor;
+        if (decompressor == NULL || decompressor->decompress == NULL) {
+            return -1;
+        }
+        return decompressor->decompress(decompressor->cookie, entry->compression,
+                                        (void *) entry->dest, entry->data_size,
+                                        entry->src, entry->file_size) == 0 ? 0 : -1;
+    }
+    return 0;
+}
+
+static void
+elf_zeroRange(const elf_loader_t *loader, uintptr_t start, uintptr_t end)
 {
+    if (loader->zero_pages) {
+        uintptr_t page_mask = loader->page_size - 1;
+        uintptr_t page_start = (start + page_mask) & ~page_mask;
+        uintptr_t page_end = end & ~page_mask;
+        /* check page_start for wraparound at the top of the address space */
+        if (page_start >= start && page_start < page_end &&
+                loader->zero_pages(loader->cookie, page_start, page_end - page_start) == 0) {
+            memset((void *) start, 0, page_start - start);
+            memset((void *) page_end, 0, end - page_end);
+            return;
+        }
+    }
+    memset((void *) start, 0, end - start);
+}
+
+static void
+elf_zeroSegment(const elf_loader_t *loader, const elf_segment_plan_t *entry)
+{
+    if (entry->action != ELF_SEGMENT_MAP && entry->mem_size > entry->data_size) {
+        elf_zeroRange(loader, entry->dest + entry->data_size, entry->dest + entry->mem_size);
+    }
+}
+
+static bool
+elf_checkLoader(const elf_loader_t *loader)
+{
+    return loader->zero_pages == NULL ||
+           (loader->page_size != 0 && (loader->page_size & (loader->page_size - 1)) == 0);
+}
+
+int
+elf_loadFileWith(elf_t *elf, elf_addr_type_t addr_type, const elf_loader_t *loader)
+{
+    static const elf_loader_t default_loader = { 0 };
+    size_t num_ph = elf_getNumProgramHeaders(elf);
+    elf_segment_plan_t entry;
+    elf_phdr_t phdr;
     size_t i;
 
-    for(i = 0; i < elf_getNumProgramHeaders(elf); i++) {
-        /* Load that section */
-        uintptr_t dest, src;
-        size_t len;
-        if (addr_type == PHYSICAL) {
-            dest = elf_getProgramHeaderPaddr(elf, i);
-        } else {
-            dest = elf_getProgramHeaderVaddr(elf, i);
+    if (loader == NULL) {
+        loader = &default_loader;
+    }
+    if (!elf_checkLoader(loader)) {
+        return 0;
+    }
+
+    /* Check every segment before writing anything */
+    for (i = 0; i < num_ph; i++) {
+        elf_getProgramHeader(elf, i, &phdr);
+        if (phdr.type == PT_LOAD &&
+                elf_planSegment(elf, i, &phdr, elf_getLoadAddress(&phdr, addr_type) + loader->load_bias,
+                                &entry) != 0) {
+            return 0;
+        }
+    }
+
+    int error = 0;
+    for (i = 0; i < num_ph && !error; i++) {
+        elf_getProgramHeader(elf, i, &phdr);
+        if (phdr.type == PT_LOAD) {
+            elf_planSegment(elf, i, &phdr, elf_getLoadAddress(&phdr, addr_type) + loader->load_bias, &entry);
+            error = elf_loadSegment(loader, &entry);
+        }
+    }
+
+    /* Always wait, so that no copies are left in flight if one failed to start */
+    if (loader->wait && loader->wait(loader->cookie) != 0) {
+        error = 1;
+    }
+    if (error) {
+        return 0;
+    }
+
+    for (i = 0; i < num_ph; i++) {
+        elf_getProgramHeader(elf, i, &phdr);
+        if (phdr.type == PT_LOAD) {
+            elf_planSegment(elf, i, &phdr, elf_getLoadAddress(&phdr, addr_type) + loader->load_bias, &entry);
+            elf_zeroSegment(loader, &entry);
+        }
+    }
+
+    return 1;
+}
+
+int
+elf_loadFile(elf_t *elf, elf_addr_type_t addr_type)
+{
+    return elf_loadFileWith(elf, addr_type, NULL);
+}
+
+int
+elf_planLoad(elf_t *elf, elf_addr_type_t addr_type, size_t page_size,
+             elf_segment_plan_t *plan, size_t max_entries)
+{
+    if (page_size == 0 || (page_size & (page_size - 1)) != 0) {
+        return -1;
+    }
+
+    uintptr_t page_mask = page_size - 1;
+    uintptr_t file_start = (uintptr_t) elf->elfFile;
+    uintptr_t file_end = file_start + elf->elfSize;
+    size_t num_ph = elf_getNumProgramHeaders(elf);
+    size_t n = 0;
+
+    for (size_t i = 0; i < num_ph; i++) {
+        elf_segment_plan_t entry;
+        elf_phdr_t phdr;
+        elf_getProgramHeader(elf, i, &phdr);
+        if (phdr.type != PT_LOAD) {
+            continue;
         }
-        len = elf_getProgramHeaderFileSize(elf, i);
-        src = (uintptr_t) elf->elfFile + elf_getProgramHeaderOffset(elf, i);
-        memcpy((void *) dest, (void *) src, len);
-        dest += len;
-        memset((void *) dest, 0, elf_getProgramHeaderMemorySize(elf, i) - len);
+        if (elf_planSegment(elf, i, &phdr, elf_getLoadAddress(&phdr, addr_type), &entry) != 0) {
+            return -1;
+        }
+
+        /* The source pages are shared rather than copied, so they must never
+         * be written, must not need any zero fill, and must not expose
+         * anything outside of the file */
+        uintptr_t src = (uintptr_t) entry.src;
+        uintptr_t map_src = src & ~page_mask;
+        uintptr_t map_end = (src + entry.file_size + page_mask) & ~page_mask;
+        if (entry.action == ELF_SEGMENT_COPY && !(entry.flags & PF_W) &&
+                entry.file_size != 0 && entry.file_size == entry.mem_size &&
+                ((src ^ entry.dest) & page_mask) == 0 &&
+                map_src >= file_start && map_end <= file_end && map_end > map_src) {
+            entry.action = ELF_SEGMENT_MAP;
+            entry.map_dest = entry.dest & ~page_mask;
+            entry.map_src = map_src;
+            entry.map_size = map_end - map_src;
+        }
+
+        if (n < max_entries) {
+            plan[n] = entry;
+        }
+        n++;
+    }
+
+    return n;
+}
+
+int
+elf_loadPlan(const elf_segment_plan_t *plan, size_t num_entries, const elf_loader_t *loader)
+{
+    static const elf_loader_t default_loader = { 0 };
+    size_t i;
+
+    if (loader == NULL) {
+        loader = &default_loader;
+    }
+    if (!elf_checkLoader(loader)) {
+        return 0;
+    }
+
+    int error = 0;
+    for (i = 0; i < num_entries && !error; i++) {
+        error = elf_loadSegment(loader, &plan[i]);
+    }
+
+    if (loader->wait && loader->wait(loader->cookie) != 0) {
+        error = 1;
+    }
+    if (error) {
+        return 0;
+    }
+
+    for (i = 0; i < num_entries; i++) {
+        elf_zeroSegment(loader, &plan[i]);
     }
 
     return 1;
@@ -0,0 +1,511 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the BSD 2-Clause license. Note that NO WARRANTY is provided.
+ * See "LICENSE_BSD2.txt" for details.
+ *
+ * @TAG(DATA61_BSD)
+ */
+
+#include <elf/elf.h>
+#include <elf/elf32.h>
+#include <elf/elf64.h>
+#include <string.h>
+
+/* Not defined by older C libraries */
+#ifndef DT_RELRSZ
+#define DT_RELRSZ 35
+#define DT_RELR 36
+#define DT_RELRENT 37
+#endif
+#ifndef EM_RISCV
+#define EM_RISCV 243
+#endif
+#ifndef R_RISCV_RELATIVE
+#define R_RISCV_32 1
+#define R_RISCV_64 2
+#define R_RISCV_RELATIVE 3
+#define R_RISCV_JUMP_SLOT 5
+#endif
+
+#define RELOC_UNSUPPORTED UINT32_MAX
+
+/* Relocation types of a machine. R_*_NONE is 0 for every machine */
+typedef struct reloc_types {
+    /* B + A */
+    uint32_t relative;
+    /* S + A, word sized */
+    uint32_t abs;
+    /* S, or S + A with explicit addends */
+    uint32_t glob_dat;
+    uint32_t jump_slot;
+} reloc_types_t;
+
+typedef struct reloc_ctx {
+    elf_t *elf;
+    bool is32;
+    size_t word_size;
+    uintptr_t bias;
+    uintptr_t write_offset;
+    /* linked address range of the PT_LOAD segments */
+    uintptr_t min;
+    uintptr_t max;
+    reloc_types_t types;
+    elf_symtab_t symtab;
+    bool have_symtab;
+    elf_resolve_fn_t resolve;
+    void *cookie;
+} reloc_ctx_t;
+
+/* Dynamic section entries used for relocation */
+typedef struct reloc_dynamic {
+    uintptr_t rela, relasz, relaent;
+    uintptr_t rel, relsz, relent;
+    uintptr_t relr, relrsz, relrent;
+    uintptr_t jmprel, pltrelsz, pltrel;
+} reloc_dynamic_t;
+
+static int
+reloc_getTypes(uint16_t machine, bool is32, reloc_types_t *types)
+{
+    switch (machine) {
+    case EM_X86_64:
+        *types = (reloc_types_t) {
+            R_X86_64_RELATIVE, R_X86_64_64, R_X86_64_GLOB_DAT, R_X86_64_JUMP_SLOT
+        };
+        return is32 ? -1 : 0;
+    case EM_386:
+        *types = (reloc_types_t) {
+            R_386_RELATIVE, R_386_32, R_386_GLOB_DAT, R_386_JMP_SLOT
+        };
+        return is32 ? 0 : -1;
+    case EM_AARCH64:
+        *types = (reloc_types_t) {
+            R_AARCH64_RELATIVE, R_AARCH64_ABS64, R_AARCH64_GLOB_DAT, R_AARCH64_JUMP_SLOT
+        };
+        return is32 ? -1 : 0;
+    case EM_ARM:
+        *types = (reloc_types_t) {
+            R_ARM_RELATIVE, R_ARM_ABS32, R_ARM_GLOB_DAT, R_ARM_JUMP_SLOT
+        };
+        return is32 ? 0 : -1;
+    case EM_RISCV:
+        *types = (reloc_types_t) {
+            R_RISCV_RELATIVE, is32 ? R_RISCV_32 : R_RISCV_64, RELOC_UNSUPPORTED, R_RISCV_JUMP_SLOT
+        };
+        return 0;
+    default:
+        return -1;
+    }
+}
+
+/* Find the contents of the file backing a range of linked addresses */
+static const void *
+reloc_fileData(elf_t *elf, uintptr_t vaddr, size_t size)
+{
+    size_t num_ph = elf_getNumProgramHeaders(elf);
+    for (size_t i = 0; i < num_ph; i++) {
+        elf_phdr_t phdr;
+        elf_getProgramHeader(elf, i, &phdr);
+        if (phdr.type != PT_LOAD || vaddr < phdr.vaddr) {
+            continue;
+        }
+        size_t offset = vaddr - phdr.vaddr;
+        if (offset > phdr.file_size || size > phdr.file_size - offset) {
+            continue;
+        }
+        void *segment = elf_getProgramSegment(elf, i);
+        if (segment == NULL) {
+            return NULL;
+        }
+        return (const char *) segment + offset;
+    }
+    return NULL;
+}
+
+static int
+reloc_checkTarget(reloc_ctx_t *ctx, uintptr_t offset)
+{
+    if (offset < ctx->min || offset > ctx->max || ctx->max - offset < ctx->word_size) {
+        return -1;
+    }
+    return 0;
+}
+
+static uintptr_t
+reloc_read(reloc_ctx_t *ctx, uintptr_t offset)
+{
+    const void *where = (const void *)(offset + ctx->bias + ctx->write_offset);
+    if (ctx->is32) {
+        uint32_t value;
+        memcpy(&value, where, sizeof(value));
+        return value;
+    } else {
+        uint64_t value;
+        memcpy(&value, where, sizeof(value));
+        return value;
+    }
+}
+
+static void
+reloc_write(reloc_ctx_t *ctx, uintptr_t offset, uintptr_t value)
+{
+    void *where = (void *)(offset + ctx->bias + ctx->write_offset);
+    if (ctx->is32) {
+        uint32_t v = value;
+        memcpy(where, &v, sizeof(v));
+    } else {
+        uint64_t v = value;
+        memcpy(where, &v, sizeof(v));
+    }
+}
+
+static int
+reloc_symbolValue(reloc_ctx_t *ctx, uint32_t index, uintptr_t *value)
+{
+    elf_symbol_t sym;
+    if (index == 0) {
+        *value = 0;
+        return 0;
+    }
+    if (!ctx->have_symtab || elf_symtabGetSymbol(&ctx->symtab, index, &sym) != 0) {
+        return -1;
+    }
+    if (sym.shndx == SHN_ABS) {
+        *value = sym.value;
+        return 0;
+    }
+    if (sym.shndx != SHN_UNDEF) {
+        *value = sym.value + ctx->bias;
+        return 0;
+    }
+    if (ctx->resolve && ctx->resolve(ctx->cookie, &sym, value) == 0) {
+        return 0;
+    }
+    if (ELF32_ST_BIND(sym.info) == STB_WEAK) {
+        /* unresolved weak references are 0 */
+        *value = 0;
+        return 0;
+    }
+    return -1;
+}
+
+/* Apply a single relocation of any supported type */
+static int
+reloc_apply(reloc_ctx_t *ctx, uintptr_t offset, uint32_t type, uint32_t sym,
+            uintptr_t addend, bool explicit_addend)
+{
+    uintptr_t value;
+
+    if (type == 0) {
+        return 0;
+    }
+    if (reloc_checkTarget(ctx, offset) != 0) {
+        return -1;
+    }
+    if (type == ctx->types.relative) {
+        reloc_write(ctx, offset, ctx->bias + addend);
+        return 0;
+    }
+    if (type != ctx->types.abs && type != ctx->types.glob_dat && type != ctx->types.jump_slot) {
+        return -1;
+    }
+    if (reloc_symbolValue(ctx, sym, &value) != 0) {
+        return -1;
+    }
+    if (type == ctx->types.abs || explicit_addend) {
+        value += addend;
+    }
+    reloc_write(ctx, offset, value);
+    return 0;
+}
+
+static int
+reloc_rela(reloc_ctx_t *ctx, const void *table, size_t size)
+{
+    uint32_t relative = ctx->types.relative;
+
+    /* Relative relocations, which are most of a typical table and are sorted
+     * to the front of it by the linker, take the short path */
+    if (ctx->is32) {
+        const Elf32_Rela *rela = table;
+        for (size_t i = 0; i < size / sizeof(*rela); i++) {
+            uint32_t type = ELF32_R_TYPE(rela[i].r_info);
+            if (type == relative && reloc_checkTarget(ctx, rela[i].r_offset) == 0) {
+                reloc_write(ctx, rela[i].r_offset, ctx->bias + rela[i].r_addend);
+            } else if (reloc_apply(ctx, rela[i].r_offset, type, ELF32_R_SYM(rela[i].r_info),
+                                   rela[i].r_addend, true) != 0) {
+                return -1;
+            }
+        }
+    } else {
+        const Elf64_Rela *rela = table;
+        for (size_t i = 0; i < size / sizeof(*rela); i++) {
+            uint32_t type = ELF64_R_TYPE(rela[i].r_info);
+            if (type == relative && reloc_checkTarget(ctx, rela[i].r_offset) == 0) {
+                reloc_write(ctx, rela[i].r_offset, ctx->bias + rela[i].r_addend);
+            } else if (reloc_apply(ctx, rela[i].r_offset, type, ELF64_R_SYM(rela[i].r_info),
+                                   rela[i].r_addend, true) != 0) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int
+reloc_rel(reloc_ctx_t *ctx, const void *table, size_t size)
+{
+    uint32_t relative = ctx->types.relative;
+
+    if (ctx->is32) {
+        const Elf32_Rel *rel = table;
+        for (size_t i = 0; i < size / sizeof(*rel); i++) {
+            uint32_t type = ELF32_R_TYPE(rel[i].r_info);
+            if (type == 0) {
+                continue;
+            }
+            if (reloc_checkTarget(ctx, rel[i].r_offset) != 0) {
+                return -1;
+            }
+            uintptr_t addend = reloc_read(ctx, rel[i].r_offset);
+            if (type == relative) {
+                reloc_write(ctx, rel[i].r_offset, ctx->bias + addend);
+            } else if (reloc_apply(ctx, rel[i].r_offset, type, ELF32_R_SYM(rel[i].r_info),
+                                   addend, false) != 0) {
+                return -1;
+            }
+        }
+    } else {
+        const Elf64_Rel *rel = table;
+        for (size_t i = 0; i < size / sizeof(*rel); i++) {
+            uint32_t type = ELF64_R_TYPE(rel[i].r_info);
+            if (type == 0) {
+                continue;
+            }
+            if (reloc_checkTarget(ctx, rel[i].r_offset) != 0) {
+                return -1;
+            }
+            uintptr_t addend = reloc_read(ctx, rel[i].r_offset);
+            if (type == relative) {
+                reloc_write(ctx, rel[i].r_offset, ctx->bias + addend);
+            } else if (reloc_apply(ctx, rel[i].r_offset, type, ELF64_R_SYM(rel[i].r_info),
+                                   addend, false) != 0) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int
+reloc_relrOne(reloc_ctx_t *ctx, uintptr_t offset)
+{
+    if (reloc_checkTarget(ctx, offset) != 0) {
+        return -1;
+    }
+    reloc_write(ctx, offset, reloc_read(ctx, offset) + ctx->bias);
+    return 0;
+}
+
+/*
+ * RELR is a packed list of relative relocations with implicit addends. An
+ * even entry is the address of a relocation, an odd entry is a bitmap of
+ * which of the following word_size * 8 - 1 words also need relocating.
+ */
+static int
+reloc_relr(reloc_ctx_t *ctx, const void *table, size_t size)
+{
+    size_t word = ctx->word_size;
+    size_t num = size / word;
+    uintptr_t where = 0;
+
+    for (size_t i = 0; i < num; i++) {
+        uintptr_t entry = ctx->is32 ? ((const uint32_t *) table)[i] : ((const uint64_t *) table)[i];
+        if ((entry & 1) == 0) {
+            if (reloc_relrOne(ctx, entry) != 0) {
+                return -1;
+            }
+            where = entry + word;
+            continue;
+        }
+        uintptr_t bits = entry >> 1;
+        for (size_t j = 0; bits != 0; j++, bits >>= 1) {
+            if ((bits & 1) && reloc_relrOne(ctx, where + j * word) != 0) {
+                return -1;
+            }
+        }
+        where += (word * 8 - 1) * word;
+    }
+    return 0;
+}
+
+static int
+reloc_readDynamic(elf_t *elf, const elf_phdr_t *phdr, reloc_dynamic_t *dyn)
+{
+    size_t end = phdr->offset + phdr->file_size;
+    if (end > elf->elfSize || end < phdr->offset) {
+        return -1;
+    }
+    const char *data = (const char *) elf->elfFile + phdr->offset;
+
+    memset(dyn, 0, sizeof(*dyn));
+    size_t entsize = elf_isElf32(elf) ? sizeof(Elf32_Dyn) : sizeof(Elf64_Dyn);
+    for (size_t off = 0; off + entsize <= phdr->file_size; off += entsize) {
+        int64_t tag;
+        uintptr_t val;
+        if (elf_isElf32(elf)) {
+            const Elf32_Dyn *d = (const Elf32_Dyn *)(data + off);
+            tag = d->d_tag;
+            val = d->d_un.d_val;
+        } else {
+            const Elf64_Dyn *d = (const Elf64_Dyn *)(data + off);
+            tag = d->d_tag;
+            val = d->d_un.d_val;
+        }
+        switch (tag) {
+        case DT_NULL:
+            return 0;
+        case DT_RELA:
+            dyn->rela = val;
+            break;
+        case DT_RELASZ:
+            dyn->relasz = val;
+            break;
+        case DT_RELAENT:
+            dyn->relaent = val;
+            break;
+        case DT_REL:
+            dyn->rel = val;
+            break;
+        case DT_RELSZ:
+            dyn->relsz = val;
+            break;
+        case DT_RELENT:
+            dyn->relent = val;
+            break;
+        case DT_RELR:
+            dyn->relr = val;
+            break;
+        case DT_RELRSZ:
+            dyn->relrsz = val;
+            break;
+        case DT_RELRENT:
+            dyn->relrent = val;
+            break;
+        case DT_JMPREL:
+            dyn->jmprel = val;
+            break;
+        case DT_PLTRELSZ:
+            dyn->pltrelsz = val;
+            break;
+        case DT_PLTREL:
+            dyn->pltrel = val;
+            break;
+        default:
+            break;
+        }
+    }
+    return 0;
+}
+
+/* Look up a relocation table and check its entry size */
+static int
+reloc_table(elf_t *elf, uintptr_t addr, size_t size, size_t entsize, size_t expected,
+            const void **table)
+{
+    *table = NULL;
+    if (size == 0) {
+        return 0;
+    }
+    if (entsize != 0 && entsize != expected) {
+        return -1;
+    }
+    *table = reloc_fileData(elf, addr, size);
+    return *table ? 0 : -1;
+}
+
+int
+elf_relocate(elf_t *elf, uintptr_t bias, uintptr_t write_offset,
+             elf_resolve_fn_t resolve, void *cookie)
+{
+    reloc_ctx_t ctx = {
+        .elf = elf,
+        .is32 = elf_isElf32(elf),
+        .word_size = elf_isElf32(elf) ? sizeof(uint32_t) : sizeof(uint64_t),
+        .bias = bias,
+        .write_offset = write_offset,
+        .min = UINTPTR_MAX,
+        .max = 0,
+        .resolve = resolve,
+        .cookie = cookie,
+    };
+    elf_phdr_t dynamic = { .type = PT_NULL };
+
+    size_t num_ph = elf_getNumProgramHeaders(elf);
+    for (size_t i = 0; i < num_ph; i++) {
+        elf_phdr_t phdr;
+        elf_getProgramHeader(elf, i, &phdr);
+        if (phdr.type == PT_DYNAMIC) {
+            dynamic = phdr;
+        } else if (phdr.type == PT_LOAD && phdr.mem_size != 0) {
+            if (phdr.vaddr < ctx.min) {
+                ctx.min = phdr.vaddr;
+            }
+            if (phdr.vaddr + phdr.mem_size > ctx.max) {
+                ctx.max = phdr.vaddr + phdr.mem_size;
+            }
+        }
+    }
+    if (dynamic.type != PT_DYNAMIC) {
+        return bias == 0 ? 0 : -1;
+    }
+
+    uint16_t machine = ctx.is32 ? elf32_getHeader(elf).e_machine : elf64_getHeader(elf).e_machine;
+    if (reloc_getTypes(machine, ctx.is32, &ctx.types) != 0) {
+        return -1;
+    }
+    ctx.have_symtab = elf_symtabInit(elf, true, &ctx.symtab) == 0;
+
+    reloc_dynamic_t dyn;
+    if (reloc_readDynamic(elf, &dynamic, &dyn) != 0) {
+        return -1;
+    }
+
+    const void *rela, *rel, *relr, *jmprel;
+    size_t rela_size = ctx.is32 ? sizeof(Elf32_Rela) : sizeof(Elf64_Rela);
+    size_t rel_size = ctx.is32 ? sizeof(Elf32_Rel) : sizeof(Elf64_Rel);
+    if (reloc_table(elf, dyn.rela, dyn.relasz, dyn.relaent, rela_size, &rela) != 0 ||
+            reloc_table(elf, dyn.rel, dyn.relsz, dyn.relent, rel_size, &rel) != 0 ||
+            reloc_table(elf, dyn.relr, dyn.relrsz, dyn.relrent, ctx.word_size, &relr) != 0 ||
+            reloc_table(elf, dyn.jmprel, dyn.pltrelsz, 0, 0, &jmprel) != 0) {
+        return -1;
+    }
+
+    if ((rela && reloc_rela(&ctx, rela, dyn.relasz) != 0) ||
+            (rel && reloc_rel(&ctx, rel, dyn.relsz) != 0) ||
+            (relr && reloc_relr(&ctx, relr, dyn.relrsz) != 0)) {
+        return -1;
+    }
+
+    if (jmprel) {
+        /* Some linkers include the PLT relocations in DT_RELA/DT_REL, applying
+         * implicit addend relocations twice would corrupt them */
+        uintptr_t start = dyn.pltrel == DT_RELA ? dyn.rela : dyn.rel;
+        uintptr_t size = dyn.pltrel == DT_RELA ? dyn.relasz : dyn.relsz;
+        if (dyn.jmprel >= start && dyn.jmprel - start < size) {
+            return 0;
+        }
+        if (dyn.pltrel == DT_RELA) {
+            return reloc_rela(&ctx, jmprel, dyn.pltrelsz);
+        } else if (dyn.pltrel == DT_REL) {
+            return reloc_rel(&ctx, jmprel, dyn.pltrelsz);
+        }
+        return -1;
+    }
+
+    return 0;
+}
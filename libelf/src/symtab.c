@@ -0,0 +1,525 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the BSD 2-Clause license. Note that NO WARRANTY is provided.
+ * See "LICENSE_BSD2.txt" for details.
+ *
+ * @TAG(DATA61_BSD)
+ */
+
+#include <elf/elf.h>
+#include <elf/elf32.h>
+#include <elf/elf64.h>
+#include <string.h>
+
+/* Symbol accessors */
+static uint32_t
+symtab_nameOffset(elf_symtab_t *symtab, size_t i)
+{
+    const char *sym = symtab->syms + i * symtab->sym_size;
+    if (elf_isElf32(symtab->elf)) {
+        return ((const Elf32_Sym *) sym)->st_name;
+    } else {
+        return ((const Elf64_Sym *) sym)->st_name;
+    }
+}
+
+static const char *
+symtab_name(elf_symtab_t *symtab, size_t i)
+{
+    uint32_t offset = symtab_nameOffset(symtab, i);
+    if (offset >= symtab->strtab_size) {
+        return "<corrupted>";
+    }
+    return symtab->strtab + offset;
+}
+
+static uint16_t
+symtab_shndx(elf_symtab_t *symtab, size_t i)
+{
+    const char *sym = symtab->syms + i * symtab->sym_size;
+    if (elf_isElf32(symtab->elf)) {
+        return ((const Elf32_Sym *) sym)->st_shndx;
+    } else {
+        return ((const Elf64_Sym *) sym)->st_shndx;
+    }
+}
+
+static uintptr_t
+symtab_value(elf_symtab_t *symtab, size_t i)
+{
+    const char *sym = symtab->syms + i * symtab->sym_size;
+    if (elf_isElf32(symtab->elf)) {
+        return ((const Elf32_Sym *) sym)->st_value;
+    } else {
+        return ((const Elf64_Sym *) sym)->st_value;
+    }
+}
+
+static void
+symtab_getSymbol(elf_symtab_t *symtab, size_t i, elf_symbol_t *res)
+{
+    const char *sym = symtab->syms + i * symtab->sym_size;
+    if (elf_isElf32(symtab->elf)) {
+        const Elf32_Sym *s = (const Elf32_Sym *) sym;
+        res->value = s->st_value;
+        res->size = s->st_size;
+        res->info = s->st_info;
+        res->shndx = s->st_shndx;
+    } else {
+        const Elf64_Sym *s = (const Elf64_Sym *) sym;
+        res->value = s->st_value;
+        res->size = s->st_size;
+        res->info = s->st_info;
+        res->shndx = s->st_shndx;
+    }
+    res->name = symtab_name(symtab, i);
+    res->index = i;
+}
+
+static bool
+symtab_isNamed(elf_symtab_t *symtab, size_t i)
+{
+    uint32_t offset = symtab_nameOffset(symtab, i);
+    return symtab_shndx(symtab, i) != SHN_UNDEF &&
+           offset < symtab->strtab_size && symtab->strtab[offset] != '\0';
+}
+
+static bool
+symtab_isAddressable(elf_symtab_t *symtab, size_t i)
+{
+    if (symtab_shndx(symtab, i) == SHN_UNDEF) {
+        return false;
+    }
+    const char *sym = symtab->syms + i * symtab->sym_size;
+    unsigned char type = ELF32_ST_TYPE(elf_isElf32(symtab->elf) ?
+                                       ((const Elf32_Sym *) sym)->st_info :
+                                       ((const Elf64_Sym *) sym)->st_info);
+    return type == STT_FUNC || type == STT_OBJECT;
+}
+
+/* Order symbols by address, then size, so that the last symbol at an address
+ * is the largest one */
+static bool
+symtab_addressBefore(elf_symtab_t *symtab, uint32_t a, uint32_t b)
+{
+    elf_symbol_t sa, sb;
+    symtab_getSymbol(symtab, a, &sa);
+    symtab_getSymbol(symtab, b, &sb);
+    if (sa.value != sb.value) {
+        return sa.value < sb.value;
+    }
+    if (sa.size != sb.size) {
+        return sa.size < sb.size;
+    }
+    return a < b;
+}
+
+/* Hash functions */
+static uint32_t
+gnu_hash(const char *name)
+{
+    uint32_t h = 5381;
+    for (const unsigned char *c = (const unsigned char *) name; *c; c++) {
+        h = h * 33 + *c;
+    }
+    return h;
+}
+
+static uint32_t
+sysv_hash(const char *name)
+{
+    uint32_t h = 0;
+    for (const unsigned char *c = (const unsigned char *) name; *c; c++) {
+        h = (h << 4) + *c;
+        uint32_t g = h & 0xf0000000;
+        h ^= g >> 24;
+        h &= ~g;
+    }
+    return h;
+}
+
+static size_t
+index_slot(uint32_t hash, size_t index_size)
+{
+    unsigned int bits = __builtin_ctzl(index_size);
+    if (bits == 0) {
+        return 0;
+    }
+    return (uint32_t)(hash * 2654435761u) >> (32 - bits);
+}
+
+/* Number of uint32_t words in a .gnu.hash bloom filter word */
+static size_t
+gnu_bloomWords(elf_symtab_t *symtab)
+{
+    return elf_isElf32(symtab->elf) ? 1 : 2;
+}
+
+static bool
+gnu_hashValid(elf_symtab_t *symtab, const uint32_t *ht, size_t size)
+{
+    if (size < 4 * sizeof(uint32_t)) {
+        return false;
+    }
+    size_t nbuckets = ht[0], symoffset = ht[1], bloom_size = ht[2], shift = ht[3];
+    /* gnu_lookup shifts the 32 bit hash by the bloom shift */
+    if (nbuckets == 0 || bloom_size == 0 || shift >= 32 || symoffset > symtab->num_syms) {
+        return false;
+    }
+    size_t words = 4 + bloom_size * gnu_bloomWords(symtab) + nbuckets + (symtab->num_syms - symoffset);
+    return words <= size / sizeof(uint32_t);
+}
+
+static bool
+sysv_hashValid(elf_symtab_t *symtab, const uint32_t *ht, size_t size)
+{
+    if (size < 2 * sizeof(uint32_t)) {
+        return false;
+    }
+    size_t nbucket = ht[0], nchain = ht[1];
+    return nbucket != 0 && nchain <= symtab->num_syms &&
+           2 + nbucket + nchain <= size / sizeof(uint32_t);
+}
+
+static int
+gnu_lookup(elf_symtab_t *symtab, const char *name)
+{
+    const uint32_t *ht = symtab->gnu_hash;
+    uint32_t nbuckets = ht[0], symoffset = ht[1], bloom_size = ht[2], shift = ht[3];
+    uint32_t h = gnu_hash(name);
+    const uint32_t *buckets;
+
+    if (elf_isElf32(symtab->elf)) {
+        const uint32_t *bloom = ht + 4;
+        uint32_t word = bloom[(h / 32) % bloom_size];
+        uint32_t mask = (1u << (h % 32)) | (1u << ((h >> shift) % 32));
+        if ((word & mask) != mask) {
+            return -1;
+        }
+        buckets = bloom + bloom_size;
+    } else {
+        const uint64_t *bloom = (const uint64_t *)(ht + 4);
+        uint64_t word = bloom[(h / 64) % bloom_size];
+        uint64_t mask = (1ull << (h % 64)) | (1ull << ((h >> shift) % 64));
+        if ((word & mask) != mask) {
+            return -1;
+        }
+        buckets = ht + 4 + 2 * bloom_size;
+    }
+
+    const uint32_t *chain = buckets + nbuckets;
+    uint32_t i = buckets[h % nbuckets];
+    if (i < symoffset) {
+        return -1;
+    }
+    for (; i < symtab->num_syms; i++) {
+        uint32_t c = chain[i - symoffset];
+        if ((c | 1) == (h | 1) && symtab_shndx(symtab, i) != SHN_UNDEF &&
+                strcmp(name, symtab_name(symtab, i)) == 0) {
+            return i;
+        }
+        if (c & 1) {
+            break;
+        }
+    }
+    return -1;
+}
+
+static int
+sysv_lookup(elf_symtab_t *symtab, const char *name)
+{
+    const uint32_t *ht = symtab->sysv_hash;
+    uint32_t nbucket = ht[0], nchain = ht[1];
+    const uint32_t *buckets = ht + 2;
+    const uint32_t *chain = buckets + nbucket;
+
+    uint32_t i = buckets[sysv_hash(name) % nbucket];
+    /* bound the walk in case the chains contain a cycle */
+    for (uint32_t steps = 0; i != 0 && i < nchain && steps < nchain; steps++) {
+        if (symtab_shndx(symtab, i) != SHN_UNDEF && strcmp(name, symtab_name(symtab, i)) == 0) {
+            return i;
+        }
+        i = chain[i];
+    }
+    return -1;
+}
+
+static int
+index_lookup(elf_symtab_t *symtab, const char *name)
+{
+    size_t mask = symtab->index_size - 1;
+    for (size_t slot = index_slot(gnu_hash(name), symtab->index_size);
+            symtab->index[slot] != 0; slot = (slot + 1) & mask) {
+        uint32_t i = symtab->index[slot] - 1;
+        if (strcmp(name, symtab_name(symtab, i)) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int
+linear_lookup(elf_symtab_t *symtab, const char *name)
+{
+    for (size_t i = 0; i < symtab->num_syms; i++) {
+        if (symtab_isNamed(symtab, i) && strcmp(name, symtab_name(symtab, i)) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int
+elf_symtabInit(elf_t *elf, bool dynamic, elf_symtab_t *symtab)
+{
+    uint32_t type = dynamic ? SHT_DYNSYM : SHT_SYMTAB;
+    size_t num_sections = elf_getNumSections(elf);
+    size_t i;
+
+    for (i = 0; i < num_sections; i++) {
+        if (elf_getSectionType(elf, i) == type) {
+            break;
+        }
+    }
+    const char *syms = elf_getSection(elf, i);
+    if (syms == NULL) {
+        return -1;
+    }
+    uint32_t link = elf_getSectionLink(elf, i);
+    const char *strtab = elf_getStringTable(elf, link);
+    if (strtab == NULL) {
+        return -1;
+    }
+
+    size_t sym_size = elf_isElf32(elf) ? sizeof(Elf32_Sym) : sizeof(Elf64_Sym);
+    *symtab = (elf_symtab_t) {
+        .elf = elf,
+        .syms = syms,
+        .sym_size = sym_size,
+        .num_syms = elf_getSectionSize(elf, i) / sym_size,
+        .strtab = strtab,
+        .strtab_size = elf_getSectionSize(elf, link),
+    };
+
+    for (size_t j = 0; j < num_sections; j++) {
+        uint32_t hash_type = elf_getSectionType(elf, j);
+        if ((hash_type != SHT_GNU_HASH && hash_type != SHT_HASH) || elf_getSectionLink(elf, j) != i) {
+            continue;
+        }
+        const uint32_t *ht = elf_getSection(elf, j);
+        if (ht == NULL) {
+            continue;
+        }
+        size_t size = elf_getSectionSize(elf, j);
+        if (hash_type == SHT_GNU_HASH && gnu_hashValid(symtab, ht, size)) {
+            symtab->gnu_hash = ht;
+        } else if (hash_type == SHT_HASH && sysv_hashValid(symtab, ht, size)) {
+            symtab->sysv_hash = ht;
+        }
+    }
+
+    return 0;
+}
+
+int
+elf_symtabGetSymbol(elf_symtab_t *symtab, size_t i, elf_symbol_t *sym)
+{
+    if (i >= symtab->num_syms) {
+        return -1;
+    }
+    symtab_getSymbol(symtab, i, sym);
+    return 0;
+}
+
+size_t
+elf_symtabIndexSize(elf_symtab_t *symtab)
+{
+    size_t size = 1;
+    while (size < symtab->num_syms * 2) {
+        size *= 2;
+    }
+    return size;
+}
+
+int
+elf_symtabBuildIndex(elf_symtab_t *symtab, uint32_t *index, size_t index_size)
+{
+    if (index_size == 0 || (index_size & (index_size - 1)) != 0 ||
+            index_size > (size_t) UINT32_MAX || symtab->num_syms >= UINT32_MAX) {
+        return -1;
+    }
+    size_t used = 0;
+    for (size_t i = 0; i < symtab->num_syms; i++) {
+        used += symtab_isNamed(symtab, i);
+    }
+    if (used >= index_size) {
+        return -1;
+    }
+
+    memset(index, 0, index_size * sizeof(*index));
+    size_t mask = index_size - 1;
+    for (size_t i = 0; i < symtab->num_syms; i++) {
+        if (!symtab_isNamed(symtab, i)) {
+            continue;
+        }
+        const char *name = symtab_name(symtab, i);
+        size_t slot = index_slot(gnu_hash(name), index_size);
+        /* the first definition of a name wins, as with a linear search */
+        while (index[slot] != 0 && strcmp(name, symtab_name(symtab, index[slot] - 1)) != 0) {
+            slot = (slot + 1) & mask;
+        }
+        if (index[slot] == 0) {
+            index[slot] = i + 1;
+        }
+    }
+
+    symtab->index = index;
+    symtab->index_size = index_size;
+    return 0;
+}
+
+int
+elf_symtabBuildAddressIndex(elf_symtab_t *symtab, uint32_t *index, size_t index_size)
+{
+    if (symtab->num_syms > UINT32_MAX) {
+        return -1;
+    }
+    size_t n = 0;
+    for (size_t i = 0; i < symtab->num_syms; i++) {
+        if (!symtab_isAddressable(symtab, i)) {
+            continue;
+        }
+        if (n == index_size) {
+            return -1;
+        }
+        index[n++] = i;
+    }
+
+    /* Heap sort, as qsort has no way of passing the symbol table through to
+     * the comparison */
+    for (size_t start = n / 2; start-- > 0;) {
+        for (size_t root = start; root * 2 + 1 < n;) {
+            size_t child = root * 2 + 1;
+            if (child + 1 < n && symtab_addressBefore(symtab, index[child], index[child + 1])) {
+                child++;
+            }
+            if (!symtab_addressBefore(symtab, index[root], index[child])) {
+                break;
+            }
+            uint32_t tmp = index[root];
+            index[root] = index[child];
+            index[child] = tmp;
+            root = child;
+        }
+    }
+    for (size_t end = n; end-- > 1;) {
+        uint32_t tmp = index[0];
+        index[0] = index[end];
+        index[end] = tmp;
+        for (size_t root = 0; root * 2 + 1 < end;) {
+            size_t child = root * 2 + 1;
+            if (child + 1 < end && symtab_addressBefore(symtab, index[child], index[child + 1])) {
+                child++;
+            }
+            if (!symtab_addressBefore(symtab, index[root], index[child])) {
+                break;
+            }
+            tmp = index[root];
+            index[root] = index[child];
+            index[child] = tmp;
+            root = child;
+        }
+    }
+
+    symtab->addr_index = index;
+    symtab->addr_index_size = n;
+    return 0;
+}
+
+int
+elf_symtabLookup(elf_symtab_t *symtab, const char *name, elf_symbol_t *sym)
+{
+    int i;
+    if (symtab->gnu_hash) {
+        i = gnu_lookup(symtab, name);
+    } else if (symtab->sysv_hash) {
+        i = sysv_lookup(symtab, name);
+    } else if (symtab->index) {
+        i = index_lookup(symtab, name);
+    } else {
+        i = linear_lookup(symtab, name);
+    }
+    if (i < 0) {
+        return -1;
+    }
+    if (sym) {
+        symtab_getSymbol(symtab, i, sym);
+    }
+    return 0;
+}
+
+int
+elf_symtabLookupAddress(elf_symtab_t *symtab, uintptr_t addr, elf_symbol_t *sym)
+{
+    elf_symbol_t found;
+    bool have_found = false;
+
+    if (symtab->addr_index) {
+        /* find the last symbol starting at or before addr */
+        size_t lo = 0, hi = symtab->addr_index_size;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (symtab_value(symtab, symtab->addr_index[mid]) <= addr) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (lo > 0) {
+            symtab_getSymbol(symtab, symtab->addr_index[lo - 1], &found);
+            have_found = true;
+        }
+    } else {
+        for (size_t i = 0; i < symtab->num_syms; i++) {
+            if (!symtab_isAddressable(symtab, i) || symtab_value(symtab, i) > addr) {
+                continue;
+            }
+            if (!have_found || symtab_addressBefore(symtab, found.index, i)) {
+                symtab_getSymbol(symtab, i, &found);
+                have_found = true;
+            }
+        }
+    }
+
+    if (!have_found || (found.size != 0 && addr - found.value >= found.size)) {
+        return -1;
+    }
+    if (sym) {
+        *sym = found;
+    }
+    return 0;
+}
+
+int
+elf_getSymbol(elf_t *elf, const char *name, elf_symbol_t *sym)
+{
+    elf_symtab_t dynsym, symtab;
+
+    bool have_dynsym = elf_symtabInit(elf, true, &dynsym) == 0;
+    bool dynsym_hashed = have_dynsym && (dynsym.gnu_hash || dynsym.sysv_hash);
+    if (dynsym_hashed && elf_symtabLookup(&dynsym, name, sym) == 0) {
+        return 0;
+    }
+    /* the full symbol table also contains local symbols */
+    if (elf_symtabInit(elf, false, &symtab) == 0) {
+        return elf_symtabLookup(&symtab, name, sym);
+    }
+    if (have_dynsym && !dynsym_hashed) {
+        return elf_symtabLookup(&dynsym, name, sym);
+    }
+    return -1;
+}
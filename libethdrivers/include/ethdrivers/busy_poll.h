@@ -0,0 +1,119 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the GNU General Public License version 2. Note that NO WARRANTY is provided.
+ * See "LICENSE_GPLv2.txt" for details.
+ *
+ * @TAG(DATA61_GPL)
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <ethdrivers/raw.h>
+#include <ethdrivers/stats.h>
+
+/* Busy polling drives an interface from a dedicated core without interrupts.
+ * Every iteration polls the driver, whose raw_poll does at most one ring's
+ * worth of completions, and then lets the stack process whatever arrived.
+ * The driver's interrupt should be left masked while busy polling.
+ *
+ * This works with either glue layer. For picotcp pass pico_stack_tick as the
+ * stack function: in the async driver configuration the rx completions set
+ * __serving_interrupt, so the tick runs the device dsr, otherwise it runs the
+ * device poll; either way at most the stack's loop score worth of frames is
+ * processed per iteration. For lwip received frames are handed to the netif
+ * inline from raw_poll, so the stack function only needs to run timers. */
+
+/**
+ * Let the stack process received frames and run its timers
+ *
+ * @param cookie    Cookie from the config
+ */
+typedef void (*ethif_busy_poll_stack_fn_t)(void *cookie);
+
+/**
+ * Back off after the interface has been idle for a while, e.g. a cpu_relax
+ * loop, wfe, or yielding to the scheduler
+ *
+ * @param cookie    Cookie from the config
+ * @param backoff   Suggested amount to back off by. Starts at 1 and doubles
+ *                  for every further idle iteration up to max_backoff
+ */
+typedef void (*ethif_busy_poll_idle_fn_t)(void *cookie, unsigned int backoff);
+
+typedef struct ethif_busy_poll_config {
+    /* Called after the driver has been polled, may be NULL */
+    ethif_busy_poll_stack_fn_t stack_poll;
+    void *stack_cookie;
+    /* Called once idle_threshold consecutive iterations did no work. If NULL
+     * the loop spins without backing off */
+    ethif_busy_poll_idle_fn_t idle;
+    void *idle_cookie;
+    unsigned int idle_threshold;
+    unsigned int max_backoff;
+} ethif_busy_poll_config_t;
+
+typedef struct ethif_busy_poll_stats {
+    uint64_t iterations;
+    /* iterations that completed at least one receive or transmit */
+    uint64_t busy_iterations;
+    uint64_t rx_frames;
+    uint64_t tx_completions;
+    /* calls to the idle function */
+    uint64_t backoffs;
+    /* duration of busy iterations, in ticks of the interface statistics
+     * clock. Only collected if a clock was set with ethif_stats_set_clock */
+    uint64_t latency[ETHIF_STATS_HIST_BUCKETS];
+    uint64_t max_latency;
+} ethif_busy_poll_stats_t;
+
+/* State of a busy poll loop. Should not be modified directly */
+typedef struct ethif_busy_poll {
+    struct eth_driver *driver;
+    ethif_busy_poll_config_t config;
+    /* callbacks and cookie of the glue layer that we forward to */
+    struct raw_iface_callbacks i_cb;
+    void *cb_cookie;
+    unsigned int work;
+    unsigned int idle_iterations;
+    unsigned int backoff;
+    ethif_busy_poll_stats_t stats;
+} ethif_busy_poll_t;
+
+/**
+ * Put an interface into busy poll mode. This interposes on the callbacks the
+ * glue layer gave the driver to count completed work, so it must be called
+ * after the glue layer has initialized the driver
+ *
+ * @param bp        Busy poll state to initialize
+ * @param driver    Pointer to ethernet driver
+ * @param config    Configuration, copied into bp
+ *
+ * @return          0 on success
+ */
+int ethif_busy_poll_init(ethif_busy_poll_t *bp, struct eth_driver *driver, ethif_busy_poll_config_t *config);
+
+/* Take an interface out of busy poll mode, restoring the glue layer callbacks */
+void ethif_busy_poll_destroy(ethif_busy_poll_t *bp);
+
+/**
+ * Run a single iteration of the busy poll loop, backing off if the interface
+ * has been idle
+ *
+ * @param bp        Busy poll state
+ *
+ * @return          Number of receive frames and transmit completions handled
+ */
+unsigned int ethif_busy_poll_once(ethif_busy_poll_t *bp);
+
+/**
+ * Busy poll until *stop becomes non zero
+ *
+ * @param bp        Busy poll state
+ * @param stop      Flag to poll for termination
+ */
+void ethif_busy_poll_run(ethif_busy_poll_t *bp, volatile int *stop);
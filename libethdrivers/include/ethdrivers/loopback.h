@@ -0,0 +1,81 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the GNU General Public License version 2. Note that NO WARRANTY is provided.
+ * See "LICENSE_GPLv2.txt" for details.
+ *
+ * @TAG(DATA61_GPL)
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <platsupport/io.h>
+#include <ethdrivers/raw.h>
+
+/* A software ethernet device. Descriptor rings live in normal memory and the
+ * 'DMA engine' runs whenever the driver is polled or given an IRQ, at which point
+ * every enqueued transmit is completed and any frames on the simulated wire are
+ * written into the posted receive buffers. This allows the glue layers and the
+ * stacks above them to be exercised and benchmarked without any hardware. */
+
+/**
+ * Translate a physical address handed to the driver into a virtual address
+ *
+ * @param cookie    Cookie from the config
+ * @param phys      Physical address as returned by allocate_rx_buf or given to raw_tx
+ *
+ * @return          Virtual address of the same memory
+ */
+typedef void *(*ethif_loopback_phys_to_virt_fn_t)(void *cookie, uintptr_t phys);
+
+/**
+ * Consume a chunk of a pcap file being written by the driver
+ *
+ * @param cookie    Cookie from the config
+ * @param data      Next bytes of the pcap file
+ * @param len       Number of bytes in data
+ */
+typedef void (*ethif_loopback_pcap_write_fn_t)(void *cookie, const void *data, size_t len);
+
+typedef struct ethif_loopback_config {
+    uint8_t mac[6];
+    /* MTU to report to the stack, 0 for the standard 1500 bytes. Frames larger
+     * than a receive buffer are split over several buffers */
+    int mtu;
+    /* If set every transmitted frame is received back on the same interface */
+    int loopback;
+    /* Address translation for the DMA buffers. If NULL physical addresses are
+     * assumed to be the same as virtual addresses */
+    ethif_loopback_phys_to_virt_fn_t phys_to_virt;
+    void *phys_to_virt_cookie;
+    /* If set a pcap file (with zeroed timestamps) of every transmitted frame is
+     * written through this function */
+    ethif_loopback_pcap_write_fn_t pcap_write;
+    void *pcap_write_cookie;
+    /* Optional pcap file in memory whose frames are received from the wire as
+     * receive buffers become available. If pcap_in_repeat is set the file is
+     * replayed forever */
+    const void *pcap_in;
+    size_t pcap_in_len;
+    int pcap_in_repeat;
+} ethif_loopback_config_t;
+
+int ethif_loopback_init(struct eth_driver *eth_driver, ps_io_ops_t io_ops, void *config);
+
+/**
+ * Put a frame on the simulated wire. It is written into the receive ring
+ * immediately and handed to the rx_complete callback on the next poll or IRQ
+ *
+ * @param driver    Pointer to a loopback ethernet driver
+ * @param frame     Frame to receive
+ * @param len       Length of the frame
+ *
+ * @return          0 on success, -1 if there were not enough receive buffers
+ *                  posted, in which case the frame is counted as missed
+ */
+int ethif_loopback_inject(struct eth_driver *driver, const void *frame, size_t len);
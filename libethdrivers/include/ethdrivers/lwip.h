@@ -35,6 +35,9 @@ typedef struct lwip_iface {
 
     int num_free_bufs;
     dma_addr_t **bufs;
+    /* backing array of bufs, and when each buffer was handed to the driver */
+    dma_addr_t *dma_bufs;
+    uint64_t *buf_stamps;
 } lwip_iface_t;
 
 /**
@@ -76,6 +79,7 @@ lwip_iface_t *ethif_new_lwip_driver_no_malloc(ps_io_ops_t io_ops, ps_dma_man_t *
 /* Wrapper function for an LWIP driver for asking the underlying
  * eth driver to handle an IRQ */
 static inline void ethif_lwip_handle_irq(lwip_iface_t *iface, int irq) {
+    ETHIF_STATS_INC(&iface->driver.stats, irqs);
     iface->driver.i_fn.raw_handleIRQ(&iface->driver, irq);
 }
 
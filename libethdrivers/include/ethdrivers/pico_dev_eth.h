@@ -44,6 +44,8 @@ typedef struct pico_device_eth {
     int *rx_queue;
     int *rx_lens;
     int rx_count;
+    /* when each buffer was handed to the driver */
+    uint64_t *buf_stamps;
 
 } pico_device_eth;
 
@@ -57,6 +59,7 @@ struct pico_device *pico_eth_create_no_malloc(char *name, ethif_driver_init driv
 /* Wrapper function for a picotcp driver for asking the underlying
  * eth driver to handle an IRQ */
 static inline void ethif_pico_handle_irq(pico_device_eth *iface, int irq) {
+    ETHIF_STATS_INC(&iface->driver.stats, irqs);
     iface->driver.i_fn.raw_handleIRQ(&iface->driver, irq);
 }
 
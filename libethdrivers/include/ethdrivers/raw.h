@@ -15,6 +15,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <platsupport/io.h>
+#include <ethdrivers/stats.h>
 
 struct eth_driver;
 
@@ -148,6 +149,7 @@ struct eth_driver {
     void *cb_cookie;
     ps_io_ops_t io_ops;
     int dma_alignment;
+    struct eth_driver_stats stats;
 };
 
 struct dma_buf_cookie {
@@ -0,0 +1,149 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the GNU General Public License version 2. Note that NO WARRANTY is provided.
+ * See "LICENSE_GPLv2.txt" for details.
+ *
+ * @TAG(DATA61_GPL)
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <ethdrivers/gen_config.h>
+
+struct eth_driver;
+
+/* Number of buckets in the descriptor turnaround histograms. Bucket 0 counts
+ * turnarounds of 0 ticks, bucket i counts turnarounds in [2^(i-1), 2^i) ticks
+ * and the last bucket also absorbs anything larger than that */
+#define ETHIF_STATS_HIST_BUCKETS 32
+
+/**
+ * Clock used to timestamp buffers as they are given to the driver and
+ * when they are handed back. The unit is whatever the clock counts in
+ * (cycles, ns, ...) and the histograms are reported in the same unit.
+ *
+ * @param cookie    Cookie given to ethif_stats_set_clock
+ *
+ * @return          Current time. Must never return 0
+ */
+typedef uint64_t (*ethif_stats_clock_fn_t)(void *cookie);
+
+/* Per interface statistics. The counters are updated by the lwip and picotcp
+ * glue layers, which see every buffer going in and out of the driver. None of
+ * the counters are updated atomically, they are owned by whoever is driving
+ * the interface */
+struct eth_driver_stats {
+    /* frames delivered to the network stack, and their total size. Frames
+     * counted in rx_dropped are not counted here */
+    uint64_t rx_packets;
+    uint64_t rx_bytes;
+    /* frames accepted by raw_tx, and their total size */
+    uint64_t tx_packets;
+    uint64_t tx_bytes;
+    /* raw_tx refused a frame as there were no free transmit descriptors */
+    uint64_t tx_ring_full;
+    /* no buffer was available to copy an outgoing frame into */
+    uint64_t tx_pool_exhausted;
+    /* the driver asked for a receive buffer and none was available */
+    uint64_t rx_pool_exhausted;
+    /* outgoing frames dropped by the glue layer, e.g. frames larger than a buffer */
+    uint64_t tx_dropped;
+    /* received frames dropped by the glue layer, e.g. pbuf_alloc failed, the
+     * frame was not of a type the stack handles or the stack refused it */
+    uint64_t rx_dropped;
+    /* interrupts delivered to the driver */
+    uint64_t irqs;
+    /* histogram of time between a buffer being posted to the receive ring
+     * and it being returned full */
+    uint64_t rx_turnaround[ETHIF_STATS_HIST_BUCKETS];
+    /* histogram of time between a frame being enqueued with raw_tx and
+     * the driver completing it */
+    uint64_t tx_turnaround[ETHIF_STATS_HIST_BUCKETS];
+
+    /* optional clock, turnaround histograms are only collected if set */
+    ethif_stats_clock_fn_t clock;
+    void *clock_cookie;
+};
+
+/* Account a duration in a log2 histogram of ETHIF_STATS_HIST_BUCKETS buckets */
+static inline void ethif_stats_hist_add(uint64_t *hist, uint64_t delta)
+{
+    unsigned int bucket = delta == 0 ? 0 : 64 - __builtin_clzll(delta);
+    if (bucket >= ETHIF_STATS_HIST_BUCKETS) {
+        bucket = ETHIF_STATS_HIST_BUCKETS - 1;
+    }
+    hist[bucket]++;
+}
+
+#ifdef CONFIG_LIB_ETHDRIVER_STATS
+
+#define ETHIF_STATS_ADD(stats, field, n) do { (stats)->field += (n); } while (0)
+
+/* Timestamp a buffer, 0 means it is not being tracked */
+static inline uint64_t ethif_stats_stamp(struct eth_driver_stats *stats)
+{
+    if (stats->clock == NULL) {
+        return 0;
+    }
+    return stats->clock(stats->clock_cookie);
+}
+
+/* Account the time since 'stamp' in the given histogram */
+static inline void ethif_stats_turnaround(struct eth_driver_stats *stats, uint64_t *hist, uint64_t stamp)
+{
+    if (stamp == 0 || stats->clock == NULL) {
+        return;
+    }
+    uint64_t now = stats->clock(stats->clock_cookie);
+    ethif_stats_hist_add(hist, now > stamp ? now - stamp : 0);
+}
+
+#else
+
+#define ETHIF_STATS_ADD(stats, field, n) do { (void)(stats); } while (0)
+
+static inline uint64_t ethif_stats_stamp(struct eth_driver_stats *stats)
+{
+    return 0;
+}
+
+static inline void ethif_stats_turnaround(struct eth_driver_stats *stats, uint64_t *hist, uint64_t stamp)
+{
+}
+
+#endif /* CONFIG_LIB_ETHDRIVER_STATS */
+
+#define ETHIF_STATS_INC(stats, field) ETHIF_STATS_ADD(stats, field, 1)
+
+/**
+ * Take a snapshot of the statistics of an interface
+ *
+ * @param driver    Pointer to ethernet driver
+ * @param stats     Structure to copy the current statistics into
+ */
+void ethif_stats_get(struct eth_driver *driver, struct eth_driver_stats *stats);
+
+/**
+ * Zero all counters and histograms of an interface. The clock is retained
+ *
+ * @param driver    Pointer to ethernet driver
+ */
+void ethif_stats_reset(struct eth_driver *driver);
+
+/**
+ * Set the clock used to collect the turnaround histograms. Passing a
+ * NULL clock disables collection of the histograms
+ *
+ * @param driver    Pointer to ethernet driver
+ * @param clock     Clock function, or NULL
+ * @param cookie    Cookie to pass to the clock function
+ */
+void ethif_stats_set_clock(struct eth_driver *driver, ethif_stats_clock_fn_t clock, void *cookie);
+
+/* Print the statistics of an interface */
+void ethif_stats_print(struct eth_driver *driver);
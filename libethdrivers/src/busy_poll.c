@@ -0,0 +1,121 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the GNU General Public License version 2. Note that NO WARRANTY is provided.
+ * See "LICENSE_GPLv2.txt" for details.
+ *
+ * @TAG(DATA61_GPL)
+ */
+
+#include <ethdrivers/busy_poll.h>
+#include <string.h>
+#include <utils/util.h>
+
+static void
+busy_poll_tx_complete(void *cb_cookie, void *cookie)
+{
+    ethif_busy_poll_t *bp = (ethif_busy_poll_t*)cb_cookie;
+    bp->work++;
+    bp->stats.tx_completions++;
+    bp->i_cb.tx_complete(bp->cb_cookie, cookie);
+}
+
+static void
+busy_poll_rx_complete(void *cb_cookie, unsigned int num_bufs, void **cookies, unsigned int *lens)
+{
+    ethif_busy_poll_t *bp = (ethif_busy_poll_t*)cb_cookie;
+    bp->work++;
+    bp->stats.rx_frames++;
+    bp->i_cb.rx_complete(bp->cb_cookie, num_bufs, cookies, lens);
+}
+
+static uintptr_t
+busy_poll_allocate_rx_buf(void *cb_cookie, size_t buf_size, void **cookie)
+{
+    ethif_busy_poll_t *bp = (ethif_busy_poll_t*)cb_cookie;
+    return bp->i_cb.allocate_rx_buf(bp->cb_cookie, buf_size, cookie);
+}
+
+int
+ethif_busy_poll_init(ethif_busy_poll_t *bp, struct eth_driver *driver, ethif_busy_poll_config_t *config)
+{
+    if (!bp || !driver || !config) {
+        ZF_LOGE("Invalid arguments");
+        return -1;
+    }
+    if (!driver->i_fn.raw_poll) {
+        ZF_LOGE("Driver does not support polling");
+        return -1;
+    }
+    memset(bp, 0, sizeof(*bp));
+    bp->driver = driver;
+    bp->config = *config;
+    bp->backoff = 1;
+    if (bp->config.max_backoff == 0) {
+        bp->config.max_backoff = 1;
+    }
+
+    bp->i_cb = driver->i_cb;
+    bp->cb_cookie = driver->cb_cookie;
+    driver->i_cb = (struct raw_iface_callbacks) {
+        .tx_complete = busy_poll_tx_complete,
+        .rx_complete = busy_poll_rx_complete,
+        .allocate_rx_buf = busy_poll_allocate_rx_buf
+    };
+    driver->cb_cookie = bp;
+    return 0;
+}
+
+void
+ethif_busy_poll_destroy(ethif_busy_poll_t *bp)
+{
+    bp->driver->i_cb = bp->i_cb;
+    bp->driver->cb_cookie = bp->cb_cookie;
+}
+
+unsigned int
+ethif_busy_poll_once(ethif_busy_poll_t *bp)
+{
+    struct eth_driver_stats *stats = &bp->driver->stats;
+    uint64_t start = stats->clock ? stats->clock(stats->clock_cookie) : 0;
+
+    bp->work = 0;
+    bp->driver->i_fn.raw_poll(bp->driver);
+    if (bp->config.stack_poll) {
+        bp->config.stack_poll(bp->config.stack_cookie);
+    }
+    bp->stats.iterations++;
+
+    unsigned int work = bp->work;
+    if (work) {
+        bp->stats.busy_iterations++;
+        bp->idle_iterations = 0;
+        bp->backoff = 1;
+        if (stats->clock) {
+            uint64_t end = stats->clock(stats->clock_cookie);
+            uint64_t latency = end > start ? end - start : 0;
+            ethif_stats_hist_add(bp->stats.latency, latency);
+            bp->stats.max_latency = MAX(bp->stats.max_latency, latency);
+        }
+        return work;
+    }
+
+    bp->idle_iterations++;
+    if (bp->config.idle && bp->idle_iterations >= bp->config.idle_threshold) {
+        bp->stats.backoffs++;
+        bp->config.idle(bp->config.idle_cookie, bp->backoff);
+        bp->backoff = MIN(bp->backoff * 2, bp->config.max_backoff);
+    }
+    return 0;
+}
+
+void
+ethif_busy_poll_run(ethif_busy_poll_t *bp, volatile int *stop)
+{
+    while (!*stop) {
+        ethif_busy_poll_once(bp);
+    }
+}
@@ -0,0 +1,457 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the GNU General Public License version 2. Note that NO WARRANTY is provided.
+ * See "LICENSE_GPLv2.txt" for details.
+ *
+ * @TAG(DATA61_GPL)
+ */
+
+#include <ethdrivers/gen_config.h>
+#include <ethdrivers/loopback.h>
+#include <ethdrivers/raw.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <utils/util.h>
+
+#define BUF_SIZE CONFIG_LIB_ETHDRIVER_PREALLOCATED_BUF_SIZE
+#define DEFAULT_MTU 1500
+/* ethernet header plus a VLAN tag */
+#define FRAME_OVERHEAD 18
+
+#define DESC_DONE BIT(0) /* Descriptor has been processed by the 'DMA engine' */
+#define DESC_EOP  BIT(1) /* Last descriptor of a received frame */
+
+#define PCAP_MAGIC 0xa1b2c3d4
+#define PCAP_MAGIC_SWAPPED 0xd4c3b2a1
+#define PCAP_MAGIC_NS 0xa1b23c4d
+#define PCAP_MAGIC_NS_SWAPPED 0x4d3cb2a1
+#define PCAP_LINKTYPE_ETHERNET 1
+
+struct pcap_file_header {
+    uint32_t magic;
+    uint16_t version_major;
+    uint16_t version_minor;
+    int32_t thiszone;
+    uint32_t sigfigs;
+    uint32_t snaplen;
+    uint32_t linktype;
+};
+
+struct pcap_record_header {
+    uint32_t ts_sec;
+    uint32_t ts_usec;
+    uint32_t incl_len;
+    uint32_t orig_len;
+};
+
+struct descriptor {
+    uintptr_t phys;
+    unsigned int len;
+    unsigned int stat;
+};
+
+struct loopback_eth_data {
+    ethif_loopback_config_t config;
+    int mtu;
+    struct descriptor *rx_ring;
+    struct descriptor *tx_ring;
+    unsigned int rx_size;
+    unsigned int tx_size;
+    void **rx_cookies;
+    unsigned int rx_remain;
+    unsigned int tx_remain;
+    void **tx_cookies;
+    unsigned int *tx_lengths;
+    /* track where the head and tail of the queues are for
+     * enqueueing buffers / checking for completions */
+    unsigned int rdt, rdh, tdt, tdh;
+    /* where the 'DMA engine' is up to in each ring */
+    unsigned int rx_dma, tx_dma;
+    /* scratch space for gathering a transmitted frame */
+    uint8_t *frame;
+    size_t frame_size;
+    /* position in pcap_in of the next record to receive */
+    size_t pcap_in_pos;
+    int pcap_in_swapped;
+    /* frames that arrived when there were not enough receive buffers */
+    uint64_t rx_missed;
+};
+
+static void *
+desc_virt(struct loopback_eth_data *dev, uintptr_t phys)
+{
+    if (dev->config.phys_to_virt) {
+        return dev->config.phys_to_virt(dev->config.phys_to_virt_cookie, phys);
+    }
+    return (void*)phys;
+}
+
+static unsigned int
+rx_bufs_available(struct loopback_eth_data *dev)
+{
+    return (dev->rdt + dev->rx_size - dev->rx_dma) % dev->rx_size;
+}
+
+/* Write a frame from the wire into the posted receive buffers */
+static int
+wire_receive(struct loopback_eth_data *dev, const void *frame, size_t len)
+{
+    unsigned int needed = MAX(1, DIV_ROUND_UP(len, BUF_SIZE));
+    if (rx_bufs_available(dev) < needed) {
+        dev->rx_missed++;
+        return -1;
+    }
+    const uint8_t *src = frame;
+    for (unsigned int i = 0; i < needed; i++) {
+        struct descriptor *desc = &dev->rx_ring[dev->rx_dma];
+        unsigned int chunk = MIN(len, BUF_SIZE);
+        memcpy(desc_virt(dev, desc->phys), src, chunk);
+        desc->len = chunk;
+        desc->stat = DESC_DONE | (i + 1 == needed ? DESC_EOP : 0);
+        src += chunk;
+        len -= chunk;
+        dev->rx_dma = (dev->rx_dma + 1) % dev->rx_size;
+    }
+    return 0;
+}
+
+static uint32_t
+pcap_word(struct loopback_eth_data *dev, uint32_t val)
+{
+    return dev->pcap_in_swapped ? __builtin_bswap32(val) : val;
+}
+
+static int
+pcap_in_init(struct loopback_eth_data *dev)
+{
+    struct pcap_file_header hdr;
+    if (dev->config.pcap_in_len < sizeof(hdr)) {
+        LOG_ERROR("pcap input too short for a header");
+        return -1;
+    }
+    memcpy(&hdr, dev->config.pcap_in, sizeof(hdr));
+    switch (hdr.magic) {
+    case PCAP_MAGIC:
+    case PCAP_MAGIC_NS:
+        dev->pcap_in_swapped = 0;
+        break;
+    case PCAP_MAGIC_SWAPPED:
+    case PCAP_MAGIC_NS_SWAPPED:
+        dev->pcap_in_swapped = 1;
+        break;
+    default:
+        LOG_ERROR("pcap input has unknown magic 0x%"PRIx32, hdr.magic);
+        return -1;
+    }
+    if (pcap_word(dev, hdr.linktype) != PCAP_LINKTYPE_ETHERNET) {
+        LOG_ERROR("pcap input is not an ethernet capture");
+        return -1;
+    }
+    dev->pcap_in_pos = sizeof(hdr);
+    return 0;
+}
+
+/* Receive as many frames from the pcap input as there are buffers for */
+static void
+pcap_in_replay(struct loopback_eth_data *dev)
+{
+    const uint8_t *pcap = dev->config.pcap_in;
+    /* whether any frame was received since starting or last wrapping around */
+    int received = 0;
+    while (pcap) {
+        struct pcap_record_header rec;
+        if (dev->pcap_in_pos + sizeof(rec) > dev->config.pcap_in_len) {
+            if (!dev->config.pcap_in_repeat || dev->pcap_in_pos == sizeof(struct pcap_file_header)) {
+                return;
+            }
+            dev->pcap_in_pos = sizeof(struct pcap_file_header);
+            if (!received) {
+                /* every record was skipped, repeating would spin forever */
+                return;
+            }
+            received = 0;
+            continue;
+        }
+        memcpy(&rec, pcap + dev->pcap_in_pos, sizeof(rec));
+        uint32_t len = pcap_word(dev, rec.incl_len);
+        if (dev->pcap_in_pos + sizeof(rec) + len > dev->config.pcap_in_len) {
+            /* truncated file, ignore everything from this record on */
+            dev->config.pcap_in_len = dev->pcap_in_pos;
+            continue;
+        }
+        unsigned int needed = MAX(1, DIV_ROUND_UP(len, BUF_SIZE));
+        if (needed > dev->rx_size - 2) {
+            /* more buffers than can ever be posted at once, it will never fit */
+            dev->rx_missed++;
+        } else if (rx_bufs_available(dev) < needed) {
+            /* leave it on the wire until the driver posts more buffers */
+            return;
+        } else {
+            wire_receive(dev, pcap + dev->pcap_in_pos + sizeof(rec), len);
+            received = 1;
+        }
+        dev->pcap_in_pos += sizeof(rec) + len;
+    }
+}
+
+static void
+pcap_out_header(struct loopback_eth_data *dev)
+{
+    struct pcap_file_header hdr = {
+        .magic = PCAP_MAGIC,
+        .version_major = 2,
+        .version_minor = 4,
+        .thiszone = 0,
+        .sigfigs = 0,
+        .snaplen = dev->frame_size,
+        .linktype = PCAP_LINKTYPE_ETHERNET
+    };
+    dev->config.pcap_write(dev->config.pcap_write_cookie, &hdr, sizeof(hdr));
+}
+
+static void
+pcap_out_record(struct loopback_eth_data *dev, const void *frame, size_t len)
+{
+    struct pcap_record_header rec = {
+        .ts_sec = 0,
+        .ts_usec = 0,
+        .incl_len = len,
+        .orig_len = len
+    };
+    dev->config.pcap_write(dev->config.pcap_write_cookie, &rec, sizeof(rec));
+    dev->config.pcap_write(dev->config.pcap_write_cookie, frame, len);
+}
+
+/* Perform everything the hardware would have done since we last looked */
+static void
+simulate_dma(struct loopback_eth_data *dev)
+{
+    while (dev->tx_dma != dev->tdt) {
+        unsigned int num = dev->tx_lengths[dev->tx_dma];
+        size_t len = 0;
+        int oversize = 0;
+        for (unsigned int i = 0; i < num; i++) {
+            struct descriptor *desc = &dev->tx_ring[(dev->tx_dma + i) % dev->tx_size];
+            if (len + desc->len > dev->frame_size) {
+                oversize = 1;
+            } else {
+                memcpy(dev->frame + len, desc_virt(dev, desc->phys), desc->len);
+                len += desc->len;
+            }
+            desc->stat = DESC_DONE;
+        }
+        dev->tx_dma = (dev->tx_dma + num) % dev->tx_size;
+        if (oversize) {
+            /* real hardware would put a runt or garbage on the wire, just drop it */
+            continue;
+        }
+        if (dev->config.pcap_write) {
+            pcap_out_record(dev, dev->frame, len);
+        }
+        if (dev->config.loopback) {
+            wire_receive(dev, dev->frame, len);
+        }
+    }
+    pcap_in_replay(dev);
+}
+
+static void
+low_level_init(struct eth_driver *driver, uint8_t *mac, int *mtu)
+{
+    struct loopback_eth_data *dev = (struct loopback_eth_data*)driver->eth_data;
+    memcpy(mac, dev->config.mac, 6);
+    *mtu = dev->mtu;
+}
+
+static void
+fill_rx_bufs(struct eth_driver *driver)
+{
+    struct loopback_eth_data *dev = (struct loopback_eth_data*)driver->eth_data;
+    while (dev->rx_remain > 0) {
+        void *cookie = NULL;
+        uintptr_t phys = driver->i_cb.allocate_rx_buf(driver->cb_cookie, BUF_SIZE, &cookie);
+        if (!phys) {
+            break;
+        }
+        dev->rx_cookies[dev->rdt] = cookie;
+        dev->rx_ring[dev->rdt] = (struct descriptor) {
+            .phys = phys,
+            .len = 0,
+            .stat = 0
+        };
+        dev->rdt = (dev->rdt + 1) % dev->rx_size;
+        dev->rx_remain--;
+    }
+}
+
+static void
+complete_rx(struct eth_driver *driver)
+{
+    struct loopback_eth_data *dev = (struct loopback_eth_data*)driver->eth_data;
+    unsigned int count = 1;
+    for (unsigned int i = dev->rdh; i != dev->rdt; i = (i + 1) % dev->rx_size, count++) {
+        if (!(dev->rx_ring[i].stat & DESC_DONE)) {
+            /* not complete yet */
+            break;
+        }
+        if (dev->rx_ring[i].stat & DESC_EOP) {
+            void *cookies[count];
+            unsigned int lens[count];
+            for (unsigned int j = 0; j < count; j++) {
+                cookies[j] = dev->rx_cookies[(dev->rdh + j) % dev->rx_size];
+                lens[j] = dev->rx_ring[(dev->rdh + j) % dev->rx_size].len;
+            }
+            /* update rdh */
+            dev->rdh = (dev->rdh + count) % dev->rx_size;
+            dev->rx_remain += count;
+            /* Give the buffers back */
+            driver->i_cb.rx_complete(driver->cb_cookie, count, cookies, lens);
+            count = 0;
+        }
+    }
+}
+
+static void
+complete_tx(struct eth_driver *driver)
+{
+    struct loopback_eth_data *dev = (struct loopback_eth_data*)driver->eth_data;
+    while (dev->tdh != dev->tx_dma) {
+        void *cookie = dev->tx_cookies[dev->tdh];
+        dev->tx_remain += dev->tx_lengths[dev->tdh];
+        dev->tdh = (dev->tdh + dev->tx_lengths[dev->tdh]) % dev->tx_size;
+        /* give the buffer back */
+        driver->i_cb.tx_complete(driver->cb_cookie, cookie);
+    }
+}
+
+static int
+raw_tx(struct eth_driver *driver, unsigned int num, uintptr_t *phys, unsigned int *len, void *cookie)
+{
+    struct loopback_eth_data *dev = (struct loopback_eth_data*)driver->eth_data;
+    /* Ensure we have room */
+    if (dev->tx_remain < num) {
+        /* try and complete some */
+        complete_tx(driver);
+        if (dev->tx_remain < num) {
+            return ETHIF_TX_FAILED;
+        }
+    }
+    for (unsigned int i = 0; i < num; i++) {
+        dev->tx_ring[(dev->tdt + i) % dev->tx_size] = (struct descriptor) {
+            .phys = phys[i],
+            .len = len[i],
+            .stat = 0
+        };
+    }
+    dev->tx_cookies[dev->tdt] = cookie;
+    dev->tx_lengths[dev->tdt] = num;
+    dev->tdt = (dev->tdt + num) % dev->tx_size;
+    dev->tx_remain -= num;
+    return ETHIF_TX_ENQUEUED;
+}
+
+static void
+raw_poll(struct eth_driver *driver)
+{
+    simulate_dma(driver->eth_data);
+    complete_rx(driver);
+    complete_tx(driver);
+    fill_rx_bufs(driver);
+}
+
+static void
+handle_irq(struct eth_driver *driver, int irq)
+{
+    /* there is no interrupt source, treat it as a request to poll */
+    raw_poll(driver);
+}
+
+static void
+print_state(struct eth_driver *driver)
+{
+    struct loopback_eth_data *dev = (struct loopback_eth_data*)driver->eth_data;
+    printf("loopback: rx %u/%u posted, tx %u/%u in flight, %"PRIu64" frames missed\n",
+           dev->rx_size - 2 - dev->rx_remain, dev->rx_size - 2,
+           dev->tx_size - 2 - dev->tx_remain, dev->tx_size - 2, dev->rx_missed);
+}
+
+static struct raw_iface_funcs iface_fns = {
+    .raw_handleIRQ = handle_irq,
+    .print_state = print_state,
+    .low_level_init = low_level_init,
+    .raw_tx = raw_tx,
+    .raw_poll = raw_poll
+};
+
+static void
+free_loopback(struct loopback_eth_data *dev)
+{
+    free(dev->rx_ring);
+    free(dev->tx_ring);
+    free(dev->rx_cookies);
+    free(dev->tx_cookies);
+    free(dev->tx_lengths);
+    free(dev->frame);
+    free(dev);
+}
+
+int
+ethif_loopback_init(struct eth_driver *eth_driver, ps_io_ops_t io_ops, void *config)
+{
+    if (config == NULL) {
+        LOG_ERROR("Loopback driver requires a config");
+        return -1;
+    }
+    struct loopback_eth_data *dev = calloc(1, sizeof(*dev));
+    if (!dev) {
+        LOG_ERROR("Failed to allocate eth data struct");
+        return -1;
+    }
+    dev->config = *(ethif_loopback_config_t*)config;
+    dev->mtu = dev->config.mtu ? dev->config.mtu : DEFAULT_MTU;
+    dev->frame_size = dev->mtu + FRAME_OVERHEAD;
+    dev->rx_size = CONFIG_LIB_ETHDRIVER_RX_DESC_COUNT;
+    dev->tx_size = CONFIG_LIB_ETHDRIVER_TX_DESC_COUNT;
+    dev->rx_ring = calloc(dev->rx_size, sizeof(struct descriptor));
+    dev->tx_ring = calloc(dev->tx_size, sizeof(struct descriptor));
+    dev->rx_cookies = calloc(dev->rx_size, sizeof(void*));
+    dev->tx_cookies = calloc(dev->tx_size, sizeof(void*));
+    dev->tx_lengths = calloc(dev->tx_size, sizeof(unsigned int));
+    dev->frame = malloc(dev->frame_size);
+    if (!dev->rx_ring || !dev->tx_ring || !dev->rx_cookies || !dev->tx_cookies ||
+            !dev->tx_lengths || !dev->frame) {
+        LOG_ERROR("Failed to malloc");
+        free_loopback(dev);
+        return -1;
+    }
+    /* Remaining needs to be 2 less than size as we cannot actually enqueue size many descriptors,
+     * since then the head and tail pointers would be equal, indicating empty. */
+    dev->rx_remain = dev->rx_size - 2;
+    dev->tx_remain = dev->tx_size - 2;
+
+    if (dev->config.pcap_in && pcap_in_init(dev)) {
+        free_loopback(dev);
+        return -1;
+    }
+
+    eth_driver->eth_data = dev;
+    eth_driver->dma_alignment = sizeof(uintptr_t);
+    eth_driver->i_fn = iface_fns;
+
+    if (dev->config.pcap_write) {
+        pcap_out_header(dev);
+    }
+    fill_rx_bufs(eth_driver);
+    return 0;
+}
+
+int
+ethif_loopback_inject(struct eth_driver *driver, const void *frame, size_t len)
+{
+    return wire_receive(driver->eth_data, frame, len);
+}
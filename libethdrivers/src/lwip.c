@@ -43,6 +43,11 @@ static void initialize_free_bufs(lwip_iface_t *iface) {
         ps_dma_cache_clean_invalidate(&iface->dma_man, dma_bufs[i].virt, CONFIG_LIB_ETHDRIVER_PREALLOCATED_BUF_SIZE);
         iface->bufs[i] = &dma_bufs[i];
     }
+    iface->dma_bufs = dma_bufs;
+#ifdef CONFIG_LIB_ETHDRIVER_STATS
+    /* failing to allocate the timestamps only costs us the turnaround histograms */
+    iface->buf_stamps = calloc(CONFIG_LIB_ETHDRIVER_NUM_PREALLOCATED_BUFFERS, sizeof(uint64_t));
+#endif
     iface->num_free_bufs = CONFIG_LIB_ETHDRIVER_NUM_PREALLOCATED_BUFFERS;
     return;
 error:
@@ -60,6 +65,14 @@ error:
     iface->bufs = NULL;
 }
 
+/* Timestamp slot of a preallocated buffer, or NULL if we are not tracking turnaround */
+static uint64_t *buf_stamp(lwip_iface_t *iface, void *cookie) {
+    if (!iface->buf_stamps) {
+        return NULL;
+    }
+    return &iface->buf_stamps[(dma_addr_t*)cookie - iface->dma_bufs];
+}
+
 static uintptr_t lwip_allocate_rx_buf(void *iface, size_t buf_size, void **cookie) {
     lwip_iface_t *lwip_iface = (lwip_iface_t*)iface;
     if (buf_size > CONFIG_LIB_ETHDRIVER_PREALLOCATED_BUF_SIZE) {
@@ -74,18 +87,28 @@ static uintptr_t lwip_allocate_rx_buf(void *iface, size_t buf_size, void **cooki
                 return 0;
             }
         } else {
+            ETHIF_STATS_INC(&lwip_iface->driver.stats, rx_pool_exhausted);
             return 0;
         }
     }
     lwip_iface->num_free_bufs--;
     dma_addr_t *buf = lwip_iface->bufs[lwip_iface->num_free_bufs];
     ps_dma_cache_invalidate(&lwip_iface->dma_man, buf->virt, buf_size);
+    uint64_t *stamp = buf_stamp(lwip_iface, buf);
+    if (stamp) {
+        *stamp = ethif_stats_stamp(&lwip_iface->driver.stats);
+    }
     *cookie = (void*)buf;
     return buf->phys;
 }
 
 static void lwip_tx_complete(void *iface, void *cookie) {
     lwip_iface_t *lwip_iface = (lwip_iface_t*)iface;
+    uint64_t *stamp = buf_stamp(lwip_iface, cookie);
+    if (stamp) {
+        ethif_stats_turnaround(&lwip_iface->driver.stats, lwip_iface->driver.stats.tx_turnaround, *stamp);
+        *stamp = 0;
+    }
     lwip_iface->bufs[lwip_iface->num_free_bufs] = cookie;
     lwip_iface->num_free_bufs++;
 }
@@ -99,6 +122,13 @@ static void lwip_rx_complete(void *iface, unsigned int num_bufs, void **cookies,
     for (i = 0; i < num_bufs; i++) {
         ps_dma_cache_invalidate(&lwip_iface->dma_man, ((dma_addr_t*)cookies[i])->virt, lens[i]);
         len += lens[i];
+        uint64_t *stamp = buf_stamp(lwip_iface, cookies[i]);
+        if (stamp) {
+            /* account the turnaround now so that recycling the buffer below
+             * does not count it as a transmit */
+            ethif_stats_turnaround(&lwip_iface->driver.stats, lwip_iface->driver.stats.rx_turnaround, *stamp);
+            *stamp = 0;
+        }
     }
 #if ETH_PAD_SIZE
     len += ETH_PAD_SIZE; /* allow room for Ethernet padding */
@@ -106,6 +136,7 @@ static void lwip_rx_complete(void *iface, unsigned int num_bufs, void **cookies,
     /* Get a buffer from the pool */
     p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
     if (p == NULL) {
+        ETHIF_STATS_INC(&lwip_iface->driver.stats, rx_dropped);
         for (i = 0; i < num_bufs; i++) {
             lwip_tx_complete(iface, cookies[i]);
         }
@@ -166,12 +197,17 @@ static void lwip_rx_complete(void *iface, unsigned int num_bufs, void **cookies,
     /* full packet send to tcpip_thread to process */
         if (lwip_iface->netif->input(p, lwip_iface->netif) != ERR_OK) {
             LWIP_DEBUGF(NETIF_DEBUG, ("ethernetif_input: IP input error\n"));
+            ETHIF_STATS_INC(&lwip_iface->driver.stats, rx_dropped);
             pbuf_free(p);
             p = NULL;
+        } else {
+            ETHIF_STATS_INC(&lwip_iface->driver.stats, rx_packets);
+            ETHIF_STATS_ADD(&lwip_iface->driver.stats, rx_bytes, len);
         }
     break;
 
     default:
+        ETHIF_STATS_INC(&lwip_iface->driver.stats, rx_dropped);
         pbuf_free(p);
     break;
     }
@@ -190,9 +226,11 @@ ethif_link_output(struct netif *netif, struct pbuf *p)
 #endif
 
     if (p->tot_len > CONFIG_LIB_ETHDRIVER_PREALLOCATED_BUF_SIZE) {
+        ETHIF_STATS_INC(&iface->driver.stats, tx_dropped);
         return ERR_MEM;
     }
     if (iface->num_free_bufs == 0) {
+        ETHIF_STATS_INC(&iface->driver.stats, tx_pool_exhausted);
         return ERR_MEM;
     }
     iface->num_free_bufs--;
@@ -213,9 +251,17 @@ ethif_link_output(struct netif *netif, struct pbuf *p)
 #endif
 
     unsigned int length = p->tot_len;
+    uint64_t *stamp = buf_stamp(iface, orig_buf);
+    if (stamp) {
+        *stamp = ethif_stats_stamp(&iface->driver.stats);
+    }
     status = iface->driver.i_fn.raw_tx(&iface->driver, 1, &buf.phys, &length, orig_buf);
     switch(status) {
     case ETHIF_TX_FAILED:
+        ETHIF_STATS_INC(&iface->driver.stats, tx_ring_full);
+        if (stamp) {
+            *stamp = 0;
+        }
         lwip_tx_complete(iface, orig_buf);
         return ERR_WOULDBLOCK;
     case ETHIF_TX_COMPLETE:
@@ -224,6 +270,8 @@ ethif_link_output(struct netif *netif, struct pbuf *p)
         break;
     }
 
+    ETHIF_STATS_INC(&iface->driver.stats, tx_packets);
+    ETHIF_STATS_ADD(&iface->driver.stats, tx_bytes, length);
     LINK_STATS_INC(link.xmit);
 
     return ERR_OK;
@@ -238,6 +286,7 @@ static uintptr_t lwip_pbuf_allocate_rx_buf(void *iface, size_t buf_size, void **
     buf_size += lwip_iface->driver.dma_alignment;
     struct pbuf *p = pbuf_alloc(PBUF_RAW, buf_size, PBUF_RAM);
     if (!p) {
+        ETHIF_STATS_INC(&lwip_iface->driver.stats, rx_pool_exhausted);
         return 0;
     }
     /* we cannot support chained pbufs when doing this */
@@ -283,6 +332,7 @@ static void lwip_pbuf_tx_complete(void *iface, void *cookie) {
 static void lwip_pbuf_rx_complete(void *iface, unsigned int num_bufs, void **cookies, unsigned int *lens) {
     struct pbuf *p = NULL;
     int i;
+    int len;
     lwip_iface_t *lwip_iface = (lwip_iface_t*)iface;
 
     assert(num_bufs > 0);
@@ -297,6 +347,7 @@ static void lwip_pbuf_rx_complete(void *iface, unsigned int num_bufs, void **coo
         }
         p = q;
     }
+    len = p->tot_len;
 
 #if ETH_PAD_SIZE
     pbuf_header(p, ETH_PAD_SIZE); /* reclaim the padding word */
@@ -320,11 +371,16 @@ static void lwip_pbuf_rx_complete(void *iface, unsigned int num_bufs, void **coo
         if (lwip_iface->netif->input(p, lwip_iface->netif) != ERR_OK) {
             LWIP_DEBUGF(NETIF_DEBUG, ("ethernetif_input: IP input error\n"));
             LOG_INFO("failed to input\n");
+            ETHIF_STATS_INC(&lwip_iface->driver.stats, rx_dropped);
             pbuf_free(p);
+        } else {
+            ETHIF_STATS_INC(&lwip_iface->driver.stats, rx_packets);
+            ETHIF_STATS_ADD(&lwip_iface->driver.stats, rx_bytes, len);
         }
     break;
 
     default:
+        ETHIF_STATS_INC(&lwip_iface->driver.stats, rx_dropped);
         pbuf_free(p);
     break;
     }
@@ -378,6 +434,7 @@ ethif_pbuf_link_output(struct netif *netif, struct pbuf *p)
     status = iface->driver.i_fn.raw_tx(&iface->driver, num_frames, phys, lengths, p);
     switch(status) {
     case ETHIF_TX_FAILED:
+        ETHIF_STATS_INC(&iface->driver.stats, tx_ring_full);
         lwip_pbuf_tx_complete(iface, p);
         return ERR_WOULDBLOCK;
     case ETHIF_TX_COMPLETE:
@@ -386,6 +443,9 @@ ethif_pbuf_link_output(struct netif *netif, struct pbuf *p)
         break;
     }
 
+    ETHIF_STATS_INC(&iface->driver.stats, tx_packets);
+    ETHIF_STATS_ADD(&iface->driver.stats, tx_bytes, p->tot_len);
+
     LINK_STATS_INC(link.xmit);
 
     return ERR_OK;
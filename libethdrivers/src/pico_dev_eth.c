@@ -38,11 +38,11 @@ static int alloc_buf_pool(pico_device_eth *pico_iface) {
 
 static void free_buf_pool(pico_device_eth *pico_iface, int buf_no) {
     /* Return back into the buffer pool */
-    if (buf_no < 0 || buf_no > CONFIG_LIB_ETHDRIVER_NUM_PREALLOCATED_BUFFERS) {
+    if (buf_no < 0 || buf_no >= CONFIG_LIB_ETHDRIVER_NUM_PREALLOCATED_BUFFERS) {
         ZF_LOGE("Attempted to return a buffer outside of the pool %d.", buf_no);
         return;
     }
-    pico_iface->buf_pool[pico_iface->next_free_buf] = pico_iface->next_free_buf;
+    pico_iface->buf_pool[buf_no] = pico_iface->next_free_buf;
     pico_iface->next_free_buf = buf_no;
 }
 
@@ -70,6 +70,11 @@ static void destroy_free_bufs(pico_device_eth *pico_iface) {
         free(pico_iface->rx_lens);
     }
 
+    if (pico_iface->buf_stamps) {
+        free(pico_iface->buf_stamps);
+        pico_iface->buf_stamps = NULL;
+    }
+
     pico_iface->bufs = NULL;
 }
 
@@ -129,6 +134,11 @@ static void initialize_free_bufs(pico_device_eth *pico_iface) {
         return;
     }
 
+#ifdef CONFIG_LIB_ETHDRIVER_STATS
+    /* failing to allocate the timestamps only costs us the turnaround histograms */
+    pico_iface->buf_stamps = calloc(CONFIG_LIB_ETHDRIVER_NUM_PREALLOCATED_BUFFERS, sizeof(uint64_t));
+#endif
+
     return;
 
 }
@@ -153,25 +163,46 @@ static uintptr_t pico_allocate_rx_buf(void *iface, size_t buf_size, void **cooki
     int buf_no = alloc_buf_pool(pico_iface);
     if (buf_no < 0) {
         /* No buffers available */
+        ETHIF_STATS_INC(&pico_iface->driver.stats, rx_pool_exhausted);
         return 0;
     }
 
     dma_addr_t *buf = pico_iface->bufs[buf_no];
     ps_dma_cache_invalidate(&pico_iface->dma_man, buf->virt, buf_size);
+    if (pico_iface->buf_stamps) {
+        pico_iface->buf_stamps[buf_no] = ethif_stats_stamp(&pico_iface->driver.stats);
+    }
     *(long *) cookie = buf_no;
     return buf->phys;
 }
 
 static void pico_tx_complete(void *iface, void *cookie) {
-    free_buf_pool(iface, (long) cookie);
+    pico_device_eth *pico_iface = (pico_device_eth*)iface;
+    long buf_no = (long) cookie;
+    if (pico_iface->buf_stamps) {
+        ethif_stats_turnaround(&pico_iface->driver.stats, pico_iface->driver.stats.tx_turnaround,
+                               pico_iface->buf_stamps[buf_no]);
+        pico_iface->buf_stamps[buf_no] = 0;
+    }
+    free_buf_pool(iface, buf_no);
 }
 
 static void pico_rx_complete(void *iface, unsigned int num_bufs, void **cookies, unsigned int *lens) {
     /* A buffer has been filled. Put it into the receive queue to be collected. */
     pico_device_eth *pico_iface = (pico_device_eth*)iface;
 
+    if (pico_iface->buf_stamps) {
+        for (int i=0; i<num_bufs; i++) {
+            long buf_no = (long) cookies[i];
+            ethif_stats_turnaround(&pico_iface->driver.stats, pico_iface->driver.stats.rx_turnaround,
+                                   pico_iface->buf_stamps[buf_no]);
+            pico_iface->buf_stamps[buf_no] = 0;
+        }
+    }
+
     if (num_bufs > 1) {
         ZF_LOGE("RX buffer of size is smaller than MTU. Frame splitting unhandled.\n");
+        ETHIF_STATS_INC(&pico_iface->driver.stats, rx_dropped);
         /* Frame splitting is not handled. Warn and return bufs to pool. */
         for (int i=0; i<num_bufs; i++) {
             free_buf_pool(pico_iface, (long) cookies[i]);
@@ -201,11 +232,13 @@ static int pico_eth_send(struct pico_device *dev, void *input_buf, int len) {
     struct pico_device_eth *eth_device = (struct pico_device_eth *)dev;
 
     if (len > CONFIG_LIB_ETHDRIVER_PREALLOCATED_BUF_SIZE) {
+        ETHIF_STATS_INC(&eth_device->driver.stats, tx_dropped);
         return 0;
     }
 
     long buf_no = alloc_buf_pool(eth_device);
     if (buf_no < 0) {
+        ETHIF_STATS_INC(&eth_device->driver.stats, tx_pool_exhausted);
         return 0;
     }
 
@@ -215,10 +248,17 @@ static int pico_eth_send(struct pico_device *dev, void *input_buf, int len) {
     ps_dma_cache_clean(&eth_device->dma_man, buf.virt, len);
 
     unsigned int length = len;
+    if (eth_device->buf_stamps) {
+        eth_device->buf_stamps[buf_no] = ethif_stats_stamp(&eth_device->driver.stats);
+    }
     status = eth_device->driver.i_fn.raw_tx(&eth_device->driver, 1, &buf.phys, &length, (void *) buf_no);
 
     switch(status) {
     case ETHIF_TX_FAILED:
+        ETHIF_STATS_INC(&eth_device->driver.stats, tx_ring_full);
+        if (eth_device->buf_stamps) {
+            eth_device->buf_stamps[buf_no] = 0;
+        }
         pico_tx_complete(dev, (void *) buf_no);
         ZF_LOGE("Failed tx\n");
         return 0; // Error for PICO
@@ -228,6 +268,8 @@ static int pico_eth_send(struct pico_device *dev, void *input_buf, int len) {
         break;
     }
 
+    ETHIF_STATS_INC(&eth_device->driver.stats, tx_packets);
+    ETHIF_STATS_ADD(&eth_device->driver.stats, tx_bytes, length);
     return length;
 
 }
@@ -251,7 +293,12 @@ static int pico_eth_poll(struct pico_device *dev, int loop_score) {
 
         int len = eth_device->rx_lens[buf_no];
         ps_dma_cache_invalidate(&eth_device->dma_man, buf->virt, len);
-        pico_stack_recv(dev, buf->virt, len);
+        if (pico_stack_recv(dev, buf->virt, len) < 0) {
+            ETHIF_STATS_INC(&eth_device->driver.stats, rx_dropped);
+        } else {
+            ETHIF_STATS_INC(&eth_device->driver.stats, rx_packets);
+            ETHIF_STATS_ADD(&eth_device->driver.stats, rx_bytes, len);
+        }
 
         free_buf_pool(eth_device, buf_no);
         loop_score--;
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the GNU General Public License version 2. Note that NO WARRANTY is provided.
+ * See "LICENSE_GPLv2.txt" for details.
+ *
+ * @TAG(DATA61_GPL)
+ */
+
+#include <ethdrivers/raw.h>
+#include <ethdrivers/stats.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+void
+ethif_stats_get(struct eth_driver *driver, struct eth_driver_stats *stats)
+{
+    *stats = driver->stats;
+}
+
+void
+ethif_stats_reset(struct eth_driver *driver)
+{
+    ethif_stats_clock_fn_t clock = driver->stats.clock;
+    void *clock_cookie = driver->stats.clock_cookie;
+    memset(&driver->stats, 0, sizeof(driver->stats));
+    driver->stats.clock = clock;
+    driver->stats.clock_cookie = clock_cookie;
+}
+
+void
+ethif_stats_set_clock(struct eth_driver *driver, ethif_stats_clock_fn_t clock, void *cookie)
+{
+    driver->stats.clock = clock;
+    driver->stats.clock_cookie = cookie;
+}
+
+static void
+print_histogram(const char *name, uint64_t *hist)
+{
+    printf("%s:", name);
+    for (int i = 0; i < ETHIF_STATS_HIST_BUCKETS; i++) {
+        if (hist[i]) {
+            printf(" <2^%d:%"PRIu64, i, hist[i]);
+        }
+    }
+    printf("\n");
+}
+
+void
+ethif_stats_print(struct eth_driver *driver)
+{
+    struct eth_driver_stats *stats = &driver->stats;
+    printf("rx: %"PRIu64" packets %"PRIu64" bytes %"PRIu64" dropped %"PRIu64" pool exhausted\n",
+           stats->rx_packets, stats->rx_bytes, stats->rx_dropped, stats->rx_pool_exhausted);
+    printf("tx: %"PRIu64" packets %"PRIu64" bytes %"PRIu64" dropped %"PRIu64" pool exhausted %"PRIu64" ring full\n",
+           stats->tx_packets, stats->tx_bytes, stats->tx_dropped, stats->tx_pool_exhausted, stats->tx_ring_full);
+    printf("irqs: %"PRIu64"\n", stats->irqs);
+    if (stats->clock) {
+        print_histogram("rx turnaround", stats->rx_turnaround);
+        print_histogram("tx turnaround", stats->tx_turnaround);
+    }
+}
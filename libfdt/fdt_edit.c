@@ -0,0 +1,662 @@
+/*
+ * libfdt - Flat Device Tree manipulation
+ * Copyright (C) 2017, Data61
+ *
+ * libfdt is dual licensed: you can use it either under the terms of
+ * the GPL, or the BSD license, at your option.
+ *
+ *  a) This library is free software; you can redistribute it and/or
+ *     modify it under the terms of the GNU General Public License as
+ *     published by the Free Software Foundation; either version 2 of the
+ *     License, or (at your option) any later version.
+ *
+ *     This library is distributed in the hope that it will be useful,
+ *     but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *     GNU General Public License for more details.
+ *
+ *     You should have received a copy of the GNU General Public
+ *     License along with this library; if not, write to the Free
+ *     Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+ *     MA 02110-1301 USA
+ *
+ * Alternatively,
+ *
+ *  b) Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *     2. Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ *     THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *     CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *     INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *     MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *     DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *     CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *     SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ *     NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *     LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *     HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *     CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *     OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *     EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "libfdt_env.h"
+
+#include <fdt.h>
+#include <libfdt.h>
+
+#include "libfdt_internal.h"
+
+#define FDT_EDIT_MAGIC		0x65646974	/* "edit" */
+
+struct fdt_edit_prop_ {
+	struct fdt_edit_prop_ *next;
+	uint32_t hash;
+	const char *name;
+	char *val;
+	int len;
+	int deleted;
+	int existing;	/* the original node has this property */
+};
+
+struct fdt_edit_node_ {
+	int offset;		/* in the original tree, -1 for a new node */
+	int parent;		/* handle of the parent of a new node */
+	int hash_next;		/* next original node in the bucket, or -1 */
+	int deleted;
+	/* subnodes added by the transaction, as node numbers */
+	int first_child;
+	int last_child;
+	int next_sibling;
+	const char *name;	/* name of a new node */
+	struct fdt_edit_prop_ *props;
+	struct fdt_edit_prop_ *last_prop;
+};
+
+/* The workspace starts with this header and the bucket table, followed by
+ * the node table growing up.  Property records and copies of names and
+ * values are allocated downwards from the end of the workspace. */
+struct fdt_edit_ {
+	uint32_t magic;
+	const void *fdt;
+	int base;		/* handle of node number 0 */
+	int num_nodes;
+	uint32_t bucket_mask;
+	int *buckets;		/* node number + 1, or 0 if empty */
+	struct fdt_edit_node_ *nodes;
+	char *free_end;
+};
+
+static int fdt_edit_probe_(void *ws, struct fdt_edit_ **edp)
+{
+	struct fdt_edit_ *ed = ws;
+
+	if (ed->magic != FDT_EDIT_MAGIC)
+		return -FDT_ERR_BADSTATE;
+	*edp = ed;
+	return 0;
+}
+
+#define FDT_EDIT_PROBE(ws, ed) \
+	{ \
+		int err_; \
+		if ((err_ = fdt_edit_probe_(ws, &ed)) != 0) \
+			return err_; \
+	}
+
+static void *fdt_edit_alloc_(struct fdt_edit_ *ed, int len, int align)
+{
+	uintptr_t p = (uintptr_t)ed->free_end - len;
+
+	p &= ~(uintptr_t)(align - 1);
+	if ((len < 0) || (p > (uintptr_t)ed->free_end)
+	    || (p < (uintptr_t)(ed->nodes + ed->num_nodes)))
+		return NULL;
+	ed->free_end = (char *)p;
+	return ed->free_end;
+}
+
+static const char *fdt_edit_strdup_(struct fdt_edit_ *ed,
+				    const char *s, int len)
+{
+	char *p = fdt_edit_alloc_(ed, len + 1, 1);
+
+	if (!p)
+		return NULL;
+	memcpy(p, s, len);
+	p[len] = '\0';
+	return p;
+}
+
+static uint32_t fdt_edit_bucket_(const struct fdt_edit_ *ed, int offset)
+{
+	return ((uint32_t)offset / FDT_TAGSIZE) & ed->bucket_mask;
+}
+
+static struct fdt_edit_node_ *fdt_edit_new_node_(struct fdt_edit_ *ed)
+{
+	struct fdt_edit_node_ *n = &ed->nodes[ed->num_nodes];
+
+	if ((char *)(n + 1) > ed->free_end)
+		return NULL;
+	memset(n, 0, sizeof(*n));
+	n->offset = -1;
+	n->parent = -1;
+	n->hash_next = -1;
+	n->first_child = -1;
+	n->last_child = -1;
+	n->next_sibling = -1;
+	ed->num_nodes++;
+	return n;
+}
+
+/* Find the record for a node handle.  Nodes of the original tree only get
+ * a record once they are edited: without create, *np is set to NULL for an
+ * original node that has not been. */
+static int fdt_edit_node_(struct fdt_edit_ *ed, int handle, int create,
+			  struct fdt_edit_node_ **np)
+{
+	struct fdt_edit_node_ *n;
+	uint32_t bucket;
+	int i, err;
+
+	*np = NULL;
+
+	if (handle >= ed->base) {
+		i = handle - ed->base;
+		if ((i >= ed->num_nodes) || (ed->nodes[i].offset >= 0))
+			return -FDT_ERR_BADOFFSET;
+		*np = &ed->nodes[i];
+		return 0;
+	}
+
+	err = fdt_check_node_offset_(ed->fdt, handle);
+	if (err < 0)
+		return err;
+
+	bucket = fdt_edit_bucket_(ed, handle);
+	for (i = ed->buckets[bucket] - 1; i >= 0; i = ed->nodes[i].hash_next) {
+		if (ed->nodes[i].offset == handle) {
+			*np = &ed->nodes[i];
+			return 0;
+		}
+	}
+
+	if (!create)
+		return 0;
+
+	n = fdt_edit_new_node_(ed);
+	if (!n)
+		return -FDT_ERR_NOSPACE;
+	n->offset = handle;
+	n->hash_next = ed->buckets[bucket] - 1;
+	ed->buckets[bucket] = ed->num_nodes;
+	*np = n;
+	return 0;
+}
+
+static struct fdt_edit_prop_ *fdt_edit_find_prop_(struct fdt_edit_node_ *n,
+						  const char *name, int namelen,
+						  uint32_t hash)
+{
+	struct fdt_edit_prop_ *p;
+
+	for (p = n ? n->props : NULL; p; p = p->next)
+		if ((p->hash == hash) && (memcmp(p->name, name, namelen) == 0)
+		    && (p->name[namelen] == '\0'))
+			return p;
+	return NULL;
+}
+
+/* Same rules as fdt_nodename_eq_(): a name without a unit address also
+ * matches a node name that has one */
+static int fdt_edit_name_eq_(const char *p, const char *s, int len)
+{
+	if (strncmp(p, s, len) != 0)
+		return 0;
+	if (p[len] == '\0')
+		return 1;
+	return !memchr(s, '@', len) && (p[len] == '@');
+}
+
+int fdt_edit_open(const void *fdt, void *ws, int wssize)
+{
+	struct fdt_edit_ *ed = ws;
+	uint32_t buckets = 1;
+	int offset, nodes = 0;
+	char *p;
+
+	FDT_RO_PROBE(fdt);
+
+	if ((uintptr_t)ws & (sizeof(uint64_t) - 1))
+		return -FDT_ERR_BADVALUE;
+	if (wssize < (int)sizeof(*ed))
+		return -FDT_ERR_NOSPACE;
+
+	for (offset = fdt_next_node(fdt, -1, NULL);
+	     offset >= 0;
+	     offset = fdt_next_node(fdt, offset, NULL))
+		nodes++;
+	if (offset != -FDT_ERR_NOTFOUND)
+		return offset;
+
+	/* Only edited nodes go in the table, so don't let it take more
+	 * than a small part of the workspace */
+	while ((buckets < (uint32_t)nodes)
+	       && (buckets * 2 * sizeof(int) <= (size_t)wssize / 8))
+		buckets *= 2;
+
+	p = (char *)ws + FDT_ALIGN(sizeof(*ed), sizeof(uint64_t));
+	ed->buckets = (int *)p;
+	p += FDT_ALIGN(buckets * sizeof(int), sizeof(uint64_t));
+	if (p > (char *)ws + wssize)
+		return -FDT_ERR_NOSPACE;
+
+	ed->magic = FDT_EDIT_MAGIC;
+	ed->fdt = fdt;
+	ed->base = FDT_TAGALIGN(fdt_size_dt_struct(fdt));
+	ed->num_nodes = 0;
+	ed->bucket_mask = buckets - 1;
+	memset(ed->buckets, 0, buckets * sizeof(int));
+	ed->nodes = (struct fdt_edit_node_ *)p;
+	ed->free_end = (char *)ws + wssize;
+	return 0;
+}
+
+/* Find the record for a property of an edited node, adding one if there is
+ * none yet */
+static int fdt_edit_prop_(struct fdt_edit_ *ed, struct fdt_edit_node_ *n,
+			  const char *name, struct fdt_edit_prop_ **pp)
+{
+	struct fdt_edit_prop_ *p;
+	int namelen = strlen(name);
+	uint32_t hash = fdt_hash_(name, namelen);
+
+	p = fdt_edit_find_prop_(n, name, namelen, hash);
+	if (!p) {
+		p = fdt_edit_alloc_(ed, sizeof(*p), sizeof(void *));
+		if (!p)
+			return -FDT_ERR_NOSPACE;
+		memset(p, 0, sizeof(*p));
+		p->hash = hash;
+		p->name = fdt_edit_strdup_(ed, name, namelen);
+		if (!p->name)
+			return -FDT_ERR_NOSPACE;
+		p->existing = (n->offset >= 0)
+			&& fdt_get_property(ed->fdt, n->offset, name, NULL);
+		if (n->last_prop)
+			n->last_prop->next = p;
+		else
+			n->props = p;
+		n->last_prop = p;
+	}
+
+	*pp = p;
+	return 0;
+}
+
+int fdt_edit_setprop_placeholder(void *ws, int nodeoffset, const char *name,
+				 int len, void **prop_data)
+{
+	struct fdt_edit_ *ed;
+	struct fdt_edit_node_ *n;
+	struct fdt_edit_prop_ *p;
+	int err;
+
+	FDT_EDIT_PROBE(ws, ed);
+
+	err = fdt_edit_node_(ed, nodeoffset, 1, &n);
+	if (err)
+		return err;
+	if (n->deleted)
+		return -FDT_ERR_BADOFFSET;
+
+	err = fdt_edit_prop_(ed, n, name, &p);
+	if (err)
+		return err;
+
+	/* A value that shrinks is overwritten in place */
+	if (!p->val || (len > p->len)) {
+		p->val = fdt_edit_alloc_(ed, len, 1);
+		if (!p->val)
+			return -FDT_ERR_NOSPACE;
+	}
+	p->len = len;
+	p->deleted = 0;
+
+	*prop_data = p->val;
+	return 0;
+}
+
+int fdt_edit_setprop(void *ws, int nodeoffset, const char *name,
+		     const void *val, int len)
+{
+	void *prop_data;
+	int err;
+
+	err = fdt_edit_setprop_placeholder(ws, nodeoffset, name, len,
+					   &prop_data);
+	if (err)
+		return err;
+
+	if (len)
+		memcpy(prop_data, val, len);
+	return 0;
+}
+
+int fdt_edit_delprop(void *ws, int nodeoffset, const char *name)
+{
+	struct fdt_edit_ *ed;
+	struct fdt_edit_node_ *n;
+	struct fdt_edit_prop_ *p;
+	int namelen = strlen(name);
+	int err;
+
+	FDT_EDIT_PROBE(ws, ed);
+
+	err = fdt_edit_node_(ed, nodeoffset, 0, &n);
+	if (err)
+		return err;
+	if (n && n->deleted)
+		return -FDT_ERR_BADOFFSET;
+
+	p = fdt_edit_find_prop_(n, name, namelen, fdt_hash_(name, namelen));
+	if (!p) {
+		if ((nodeoffset >= ed->base)
+		    || !fdt_get_property(ed->fdt, nodeoffset, name, NULL))
+			return -FDT_ERR_NOTFOUND;
+
+		/* deleting an original property needs a record too */
+		err = fdt_edit_node_(ed, nodeoffset, 1, &n);
+		if (err)
+			return err;
+		err = fdt_edit_prop_(ed, n, name, &p);
+		if (err)
+			return err;
+	} else if (p->deleted) {
+		return -FDT_ERR_NOTFOUND;
+	}
+
+	p->deleted = 1;
+	return 0;
+}
+
+int fdt_edit_subnode_offset_namelen(void *ws, int parentoffset,
+				    const char *name, int namelen)
+{
+	struct fdt_edit_ *ed;
+	struct fdt_edit_node_ *n, *c;
+	int child, err, i;
+
+	FDT_EDIT_PROBE(ws, ed);
+
+	err = fdt_edit_node_(ed, parentoffset, 0, &n);
+	if (err)
+		return err;
+
+	if (parentoffset < ed->base) {
+		fdt_for_each_subnode(child, ed->fdt, parentoffset) {
+			if (!fdt_edit_name_eq_(fdt_get_name(ed->fdt, child,
+							    NULL),
+					       name, namelen))
+				continue;
+			err = fdt_edit_node_(ed, child, 0, &c);
+			if (err)
+				return err;
+			if (!c || !c->deleted)
+				return child;
+		}
+		if (child != -FDT_ERR_NOTFOUND)
+			return child;
+	}
+
+	for (i = n ? n->first_child : -1; i >= 0; i = c->next_sibling) {
+		c = &ed->nodes[i];
+		if (!c->deleted && fdt_edit_name_eq_(c->name, name, namelen))
+			return ed->base + i;
+	}
+
+	return -FDT_ERR_NOTFOUND;
+}
+
+int fdt_edit_subnode_offset(void *ws, int parentoffset, const char *name)
+{
+	return fdt_edit_subnode_offset_namelen(ws, parentoffset, name,
+					       strlen(name));
+}
+
+int fdt_edit_path_offset(void *ws, const char *path)
+{
+	struct fdt_edit_ *ed;
+	const char *end = path + strlen(path);
+	const char *p = path;
+	int offset = 0;
+
+	FDT_EDIT_PROBE(ws, ed);
+
+	/* aliases are resolved in the original tree */
+	if (*path != '/') {
+		const char *q = strchr(path, '/');
+
+		if (!q)
+			q = end;
+
+		p = fdt_get_alias_namelen(ed->fdt, p, q - p);
+		if (!p)
+			return -FDT_ERR_BADPATH;
+		offset = fdt_edit_path_offset(ws, p);
+
+		p = q;
+	}
+
+	while ((p < end) && (offset >= 0)) {
+		const char *q;
+
+		while (*p == '/') {
+			p++;
+			if (p == end)
+				return offset;
+		}
+		q = strchr(p, '/');
+		if (!q)
+			q = end;
+
+		offset = fdt_edit_subnode_offset_namelen(ws, offset, p, q - p);
+		p = q;
+	}
+
+	return offset;
+}
+
+int fdt_edit_add_subnode_namelen(void *ws, int parentoffset,
+				 const char *name, int namelen)
+{
+	struct fdt_edit_ *ed;
+	struct fdt_edit_node_ *parent, *n;
+	int err;
+
+	FDT_EDIT_PROBE(ws, ed);
+
+	err = fdt_edit_subnode_offset_namelen(ws, parentoffset, name, namelen);
+	if (err >= 0)
+		return -FDT_ERR_EXISTS;
+	else if (err != -FDT_ERR_NOTFOUND)
+		return err;
+
+	err = fdt_edit_node_(ed, parentoffset, 1, &parent);
+	if (err)
+		return err;
+	if (parent->deleted)
+		return -FDT_ERR_BADOFFSET;
+
+	n = fdt_edit_new_node_(ed);
+	if (!n)
+		return -FDT_ERR_NOSPACE;
+	n->parent = parentoffset;
+	n->name = fdt_edit_strdup_(ed, name, namelen);
+	if (!n->name) {
+		ed->num_nodes--;
+		return -FDT_ERR_NOSPACE;
+	}
+
+	if (parent->last_child >= 0)
+		ed->nodes[parent->last_child].next_sibling = ed->num_nodes - 1;
+	else
+		parent->first_child = ed->num_nodes - 1;
+	parent->last_child = ed->num_nodes - 1;
+
+	return ed->base + ed->num_nodes - 1;
+}
+
+int fdt_edit_add_subnode(void *ws, int parentoffset, const char *name)
+{
+	return fdt_edit_add_subnode_namelen(ws, parentoffset, name,
+					    strlen(name));
+}
+
+int fdt_edit_del_node(void *ws, int nodeoffset)
+{
+	struct fdt_edit_ *ed;
+	struct fdt_edit_node_ *n;
+	int err;
+
+	FDT_EDIT_PROBE(ws, ed);
+
+	if (nodeoffset == 0)
+		return -FDT_ERR_BADOFFSET;
+
+	err = fdt_edit_node_(ed, nodeoffset, 1, &n);
+	if (err)
+		return err;
+	if (n->deleted)
+		return -FDT_ERR_BADOFFSET;
+
+	n->deleted = 1;
+	return 0;
+}
+
+static int fdt_edit_emit_(struct fdt_edit_ *ed, void *sw, int nodeoffset)
+{
+	const void *fdt = ed->fdt;
+	struct fdt_edit_node_ *n;
+	struct fdt_edit_prop_ *p;
+	int offset, err, i;
+
+	err = fdt_edit_node_(ed, nodeoffset, 0, &n);
+	if (err)
+		return err;
+	if (n && n->deleted)
+		return 0;
+
+	if (nodeoffset < ed->base) {
+		const char *name = fdt_get_name(fdt, nodeoffset, &err);
+
+		if (!name)
+			return err;
+		err = fdt_begin_node(sw, name);
+		if (err)
+			return err;
+
+		/* original properties keep their place, edited or not */
+		fdt_for_each_property_offset(offset, fdt, nodeoffset) {
+			const char *pname;
+			const void *val;
+			int len;
+
+			val = fdt_getprop_by_offset(fdt, offset, &pname, &len);
+			if (!val)
+				return len;
+
+			p = fdt_edit_find_prop_(n, pname, strlen(pname),
+						fdt_hash_(pname, strlen(pname)));
+			if (p && p->deleted)
+				continue;
+			if (p) {
+				val = p->val;
+				len = p->len;
+			}
+
+			err = fdt_property(sw, pname, val, len);
+			if (err)
+				return err;
+		}
+		if (offset != -FDT_ERR_NOTFOUND)
+			return offset;
+	} else {
+		err = fdt_begin_node(sw, n->name);
+		if (err)
+			return err;
+	}
+
+	/* then the new properties, in the order they were first set */
+	for (p = n ? n->props : NULL; p; p = p->next) {
+		if (p->existing || p->deleted)
+			continue;
+		err = fdt_property(sw, p->name, p->val, p->len);
+		if (err)
+			return err;
+	}
+
+	if (nodeoffset < ed->base) {
+		fdt_for_each_subnode(offset, fdt, nodeoffset) {
+			err = fdt_edit_emit_(ed, sw, offset);
+			if (err)
+				return err;
+		}
+		if (offset != -FDT_ERR_NOTFOUND)
+			return offset;
+	}
+
+	for (i = n ? n->first_child : -1; i >= 0; i = ed->nodes[i].next_sibling) {
+		err = fdt_edit_emit_(ed, sw, ed->base + i);
+		if (err)
+			return err;
+	}
+
+	return fdt_end_node(sw);
+}
+
+int fdt_edit_finish(void *ws, void *buf, int bufsize)
+{
+	struct fdt_edit_ *ed;
+	uint64_t address, size;
+	int err, i;
+
+	FDT_EDIT_PROBE(ws, ed);
+	FDT_RO_PROBE(ed->fdt);
+
+	err = fdt_create(buf, bufsize);
+	if (err)
+		return err;
+
+	for (i = 0; i < fdt_num_mem_rsv(ed->fdt); i++) {
+		err = fdt_get_mem_rsv(ed->fdt, i, &address, &size);
+		if (err)
+			return err;
+		err = fdt_add_reservemap_entry(buf, address, size);
+		if (err)
+			return err;
+	}
+	err = fdt_finish_reservemap(buf);
+	if (err)
+		return err;
+
+	err = fdt_edit_emit_(ed, buf, 0);
+	if (err)
+		return err;
+
+	err = fdt_finish(buf);
+	if (err)
+		return err;
+
+	fdt_set_boot_cpuid_phys(buf, fdt_boot_cpuid_phys(ed->fdt));
+	return 0;
+}
@@ -0,0 +1,487 @@
+/*
+ * libfdt - Flat Device Tree manipulation
+ * Copyright (C) 2017, Data61
+ *
+ * libfdt is dual licensed: you can use it either under the terms of
+ * the GPL, or the BSD license, at your option.
+ *
+ *  a) This library is free software; you can redistribute it and/or
+ *     modify it under the terms of the GNU General Public License as
+ *     published by the Free Software Foundation; either version 2 of the
+ *     License, or (at your option) any later version.
+ *
+ *     This library is distributed in the hope that it will be useful,
+ *     but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *     GNU General Public License for more details.
+ *
+ *     You should have received a copy of the GNU General Public
+ *     License along with this library; if not, write to the Free
+ *     Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,
+ *     MA 02110-1301 USA
+ *
+ * Alternatively,
+ *
+ *  b) Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *     2. Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ *     THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *     CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *     INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *     MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *     DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ *     CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *     SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ *     NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *     LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ *     HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *     CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *     OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ *     EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "libfdt_env.h"
+
+#include <fdt.h>
+#include <libfdt.h>
+
+#include "libfdt_internal.h"
+
+/* Number of blobs that may have an index attached at the same time */
+#define FDT_INDEX_SLOTS		4
+
+struct fdt_index_node_ {
+	int offset;
+	int parent;
+	int first_child;
+	int next_sibling;
+	int depth;
+	uint32_t phandle;
+	uint32_t name_hash;
+	uint32_t base_hash;	/* hash of the name without unit address */
+};
+
+struct fdt_index_compat_ {
+	uint32_t hash;
+	int node;
+};
+
+struct fdt_index_ {
+	const void *fdt;
+	/* header fields at the time the index was built, used to notice a
+	 * blob that has been rewritten behind our back */
+	uint32_t totalsize;
+	uint32_t off_dt_struct;
+	uint32_t size_dt_struct;
+	int num_nodes;
+	int num_compat;
+	uint32_t phandle_mask;
+	struct fdt_index_node_ *nodes;
+	struct fdt_index_compat_ *compat;
+	uint32_t *phandles;	/* node number + 1, or 0 if empty */
+};
+
+static struct fdt_index_ *fdt_indexes_[FDT_INDEX_SLOTS];
+
+/* Whether the blob's header no longer matches the one the index was built
+ * from */
+static int fdt_index_stale_(const struct fdt_index_ *idx)
+{
+	const void *fdt = idx->fdt;
+
+	return (idx->totalsize != fdt_totalsize(fdt))
+		|| (idx->off_dt_struct != fdt_off_dt_struct(fdt))
+		|| (idx->size_dt_struct != fdt_size_dt_struct(fdt));
+}
+
+static uint32_t fdt_index_phandle_slot_(const struct fdt_index_ *idx,
+					uint32_t phandle)
+{
+	return (phandle * 2654435761u) & idx->phandle_mask;
+}
+
+static int fdt_index_count_(const void *fdt, int *nodes, int *phandles,
+			    int *compat)
+{
+	const char *prop;
+	int offset, len, i;
+
+	*nodes = *phandles = *compat = 0;
+	for (offset = fdt_next_node(fdt, -1, NULL);
+	     offset >= 0;
+	     offset = fdt_next_node(fdt, offset, NULL)) {
+		(*nodes)++;
+		if (fdt_get_phandle(fdt, offset))
+			(*phandles)++;
+		prop = fdt_getprop(fdt, offset, "compatible", &len);
+		for (i = 0; prop && i < len; i++)
+			if (prop[i] == '\0')
+				(*compat)++;
+	}
+	if (offset != -FDT_ERR_NOTFOUND)
+		return offset;
+	return 0;
+}
+
+static uint32_t fdt_index_phandle_slots_(int phandles)
+{
+	uint32_t slots = 1;
+
+	while (slots < 2 * (uint32_t)phandles)
+		slots <<= 1;
+	return slots;
+}
+
+static int fdt_index_layout_(int nodes, int phandles, int compat)
+{
+	return FDT_ALIGN(sizeof(struct fdt_index_), sizeof(uint64_t))
+		+ nodes * sizeof(struct fdt_index_node_)
+		+ compat * sizeof(struct fdt_index_compat_)
+		+ fdt_index_phandle_slots_(phandles) * sizeof(uint32_t);
+}
+
+int fdt_index_size(const void *fdt)
+{
+	int nodes, phandles, compat, err;
+
+	FDT_RO_PROBE(fdt);
+
+	err = fdt_index_count_(fdt, &nodes, &phandles, &compat);
+	if (err)
+		return err;
+	return fdt_index_layout_(nodes, phandles, compat);
+}
+
+static int fdt_index_compat_less_(const struct fdt_index_compat_ *a,
+				  const struct fdt_index_compat_ *b)
+{
+	return (a->hash < b->hash)
+		|| ((a->hash == b->hash) && (a->node < b->node));
+}
+
+static void fdt_index_sift_(struct fdt_index_compat_ *c, int root, int n)
+{
+	struct fdt_index_compat_ tmp;
+	int child;
+
+	while ((child = 2 * root + 1) < n) {
+		if ((child + 1 < n) && fdt_index_compat_less_(&c[child],
+							     &c[child + 1]))
+			child++;
+		if (!fdt_index_compat_less_(&c[root], &c[child]))
+			return;
+		tmp = c[root];
+		c[root] = c[child];
+		c[child] = tmp;
+		root = child;
+	}
+}
+
+/* Heapsort, so that building the index needs no memory beyond the caller's
+ * buffer and is not quadratic on trees with many compatible strings */
+static void fdt_index_sort_compat_(struct fdt_index_compat_ *c, int n)
+{
+	struct fdt_index_compat_ tmp;
+	int i;
+
+	for (i = n / 2 - 1; i >= 0; i--)
+		fdt_index_sift_(c, i, n);
+	for (i = n - 1; i > 0; i--) {
+		tmp = c[0];
+		c[0] = c[i];
+		c[i] = tmp;
+		fdt_index_sift_(c, 0, i);
+	}
+}
+
+static void fdt_index_add_node_(const void *fdt, struct fdt_index_ *idx,
+				int offset, int depth)
+{
+	struct fdt_index_node_ *node = &idx->nodes[idx->num_nodes];
+	const char *name, *at, *prop;
+	int len, parent, i, slot;
+	uint32_t phandle;
+
+	node->offset = offset;
+	node->depth = depth;
+	node->first_child = -1;
+	node->next_sibling = -1;
+
+	/* Nodes are visited in tree order, so the parent is the closest
+	 * preceding node one level up */
+	parent = idx->num_nodes - 1;
+	while ((parent >= 0) && (idx->nodes[parent].depth >= depth))
+		parent = idx->nodes[parent].parent;
+	node->parent = parent;
+
+	name = fdt_get_name(fdt, offset, &len);
+	at = memchr(name, '@', len);
+	node->name_hash = fdt_hash_(name, len);
+	node->base_hash = at ? fdt_hash_(name, at - name) : node->name_hash;
+
+	/* The linear search returns the first node carrying a phandle, so
+	 * a duplicate must not replace an earlier entry */
+	phandle = fdt_get_phandle(fdt, offset);
+	node->phandle = phandle;
+	if (phandle) {
+		slot = fdt_index_phandle_slot_(idx, phandle);
+		while (idx->phandles[slot]
+		       && (idx->nodes[idx->phandles[slot] - 1].phandle
+			   != phandle))
+			slot = (slot + 1) & idx->phandle_mask;
+		if (!idx->phandles[slot])
+			idx->phandles[slot] = idx->num_nodes + 1;
+	}
+
+	prop = fdt_getprop(fdt, offset, "compatible", &len);
+	for (i = 0; prop && i < len; i++) {
+		const char *end = memchr(prop + i, '\0', len - i);
+
+		if (!end)
+			break;
+		idx->compat[idx->num_compat].hash = fdt_hash_(prop + i,
+							      end - (prop + i));
+		idx->compat[idx->num_compat].node = idx->num_nodes;
+		idx->num_compat++;
+		i = end - prop;
+	}
+
+	idx->num_nodes++;
+}
+
+int fdt_index_init(const void *fdt, void *buf, int bufsize)
+{
+	struct fdt_index_ *idx = buf;
+	int nodes, phandles, compat, offset, depth, i, slot, err;
+	char *p;
+
+	FDT_RO_PROBE(fdt);
+
+	if ((uintptr_t)buf & (sizeof(uint64_t) - 1))
+		return -FDT_ERR_BADVALUE;
+
+	err = fdt_index_count_(fdt, &nodes, &phandles, &compat);
+	if (err)
+		return err;
+	if (bufsize < fdt_index_layout_(nodes, phandles, compat))
+		return -FDT_ERR_NOSPACE;
+
+	/* Rebuilding replaces any index already attached to this blob */
+	fdt_index_detach(fdt);
+	slot = -1;
+	for (i = 0; i < FDT_INDEX_SLOTS; i++) {
+		if (!fdt_indexes_[i]) {
+			slot = i;
+			break;
+		}
+	}
+	/* Reuse the slot of an index whose blob has changed under it, as
+	 * lookups ignore it anyway */
+	for (i = 0; (slot < 0) && (i < FDT_INDEX_SLOTS); i++)
+		if (fdt_index_stale_(fdt_indexes_[i]))
+			slot = i;
+	if (slot < 0)
+		return -FDT_ERR_NOSPACE;
+
+	p = (char *)buf + FDT_ALIGN(sizeof(*idx), sizeof(uint64_t));
+	idx->fdt = fdt;
+	idx->totalsize = fdt_totalsize(fdt);
+	idx->off_dt_struct = fdt_off_dt_struct(fdt);
+	idx->size_dt_struct = fdt_size_dt_struct(fdt);
+	idx->num_nodes = 0;
+	idx->num_compat = 0;
+	idx->nodes = (struct fdt_index_node_ *)p;
+	p += nodes * sizeof(struct fdt_index_node_);
+	idx->compat = (struct fdt_index_compat_ *)p;
+	p += compat * sizeof(struct fdt_index_compat_);
+	idx->phandles = (uint32_t *)p;
+	idx->phandle_mask = fdt_index_phandle_slots_(phandles) - 1;
+	memset(idx->phandles, 0, (idx->phandle_mask + 1) * sizeof(uint32_t));
+
+	depth = 0;
+	for (offset = 0; (offset >= 0) && (depth >= 0);
+	     offset = fdt_next_node(fdt, offset, &depth))
+		fdt_index_add_node_(fdt, idx, offset, depth);
+	if ((idx->num_nodes != nodes) || (idx->num_compat != compat))
+		return -FDT_ERR_INTERNAL;
+
+	/* Link the children of each node in tree order */
+	for (i = idx->num_nodes - 1; i > 0; i--) {
+		struct fdt_index_node_ *parent =
+			&idx->nodes[idx->nodes[i].parent];
+
+		idx->nodes[i].next_sibling = parent->first_child;
+		parent->first_child = i;
+	}
+
+	fdt_index_sort_compat_(idx->compat, idx->num_compat);
+
+	fdt_indexes_[slot] = idx;
+	return 0;
+}
+
+void fdt_index_detach(const void *fdt)
+{
+	int i;
+
+	for (i = 0; i < FDT_INDEX_SLOTS; i++)
+		if (fdt_indexes_[i] && (fdt_indexes_[i]->fdt == fdt))
+			fdt_indexes_[i] = NULL;
+}
+
+static const struct fdt_index_ *fdt_index_get_(const void *fdt)
+{
+	struct fdt_index_ *idx;
+	int i;
+
+	for (i = 0; i < FDT_INDEX_SLOTS; i++) {
+		idx = fdt_indexes_[i];
+		if (!idx || (idx->fdt != fdt))
+			continue;
+		if (fdt_index_stale_(idx))
+			/* Leave freeing the slot to fdt_index_init() so
+			 * that lookups never write to the slots */
+			return NULL;
+		return idx;
+	}
+
+	return NULL;
+}
+
+/* Find the node number of a structure block offset, or -1 if the offset is
+ * not the start of a node */
+static int fdt_index_node_(const struct fdt_index_ *idx, int offset)
+{
+	int lo = 0, hi = idx->num_nodes;
+
+	while (lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+
+		if (idx->nodes[mid].offset == offset)
+			return mid;
+		if (idx->nodes[mid].offset < offset)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return -1;
+}
+
+int fdt_index_subnode_(const void *fdt, int parentoffset,
+		       const char *name, int namelen)
+{
+	const struct fdt_index_ *idx = fdt_index_get_(fdt);
+	const struct fdt_index_node_ *child;
+	const char *cname;
+	uint32_t hash;
+	int unit, n, clen;
+
+	if (!idx || ((n = fdt_index_node_(idx, parentoffset)) < 0))
+		return FDT_INDEX_MISS_;
+
+	/* Same rules as fdt_nodename_eq_(): a name without a unit address
+	 * also matches nodes that have one */
+	hash = fdt_hash_(name, namelen);
+	unit = memchr(name, '@', namelen) != NULL;
+	for (n = idx->nodes[n].first_child; n >= 0; n = child->next_sibling) {
+		child = &idx->nodes[n];
+		if ((child->name_hash != hash)
+		    && (unit || (child->base_hash != hash)))
+			continue;
+		cname = fdt_get_name(fdt, child->offset, &clen);
+		if (!cname || (clen < namelen)
+		    || (memcmp(cname, name, namelen) != 0))
+			continue;
+		if ((cname[namelen] == '\0')
+		    || (!unit && (cname[namelen] == '@')))
+			return child->offset;
+	}
+
+	return -FDT_ERR_NOTFOUND;
+}
+
+int fdt_index_parent_(const void *fdt, int nodeoffset)
+{
+	const struct fdt_index_ *idx = fdt_index_get_(fdt);
+	int n;
+
+	if (!idx || ((n = fdt_index_node_(idx, nodeoffset)) < 0))
+		return FDT_INDEX_MISS_;
+
+	n = idx->nodes[n].parent;
+	return (n < 0) ? -FDT_ERR_NOTFOUND : idx->nodes[n].offset;
+}
+
+int fdt_index_by_phandle_(const void *fdt, uint32_t phandle)
+{
+	const struct fdt_index_ *idx = fdt_index_get_(fdt);
+	uint32_t slot, n;
+
+	if (!idx)
+		return FDT_INDEX_MISS_;
+
+	slot = fdt_index_phandle_slot_(idx, phandle);
+	while ((n = idx->phandles[slot]) != 0) {
+		if (idx->nodes[n - 1].phandle == phandle)
+			return idx->nodes[n - 1].offset;
+		slot = (slot + 1) & idx->phandle_mask;
+	}
+
+	return -FDT_ERR_NOTFOUND;
+}
+
+int fdt_index_by_compatible_(const void *fdt, int startoffset,
+			     const char *compatible)
+{
+	const struct fdt_index_ *idx = fdt_index_get_(fdt);
+	const struct fdt_index_compat_ *c;
+	uint32_t hash;
+	int first, lo, hi;
+
+	/* fdt_stringlist_contains() has its own idea of where an empty
+	 * string matches, leave that to the tree walk */
+	if (!idx || !*compatible)
+		return FDT_INDEX_MISS_;
+
+	/* Like fdt_next_node(), a negative start offset begins at the root */
+	if (startoffset < 0) {
+		first = 0;
+	} else {
+		first = fdt_index_node_(idx, startoffset);
+		if (first < 0)
+			return FDT_INDEX_MISS_;
+		first++;
+	}
+
+	/* Entries are sorted by hash and then by node, so the candidates
+	 * after startoffset are a contiguous run starting at the lower
+	 * bound of (hash, first) */
+	hash = fdt_hash_(compatible, strlen(compatible));
+	lo = 0;
+	hi = idx->num_compat;
+	while (lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+
+		c = &idx->compat[mid];
+		if ((c->hash < hash) || ((c->hash == hash) && (c->node < first)))
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	for (c = &idx->compat[lo];
+	     (c < idx->compat + idx->num_compat) && (c->hash == hash); c++)
+		if (fdt_node_check_compatible(fdt, idx->nodes[c->node].offset,
+					      compatible) == 0)
+			return idx->nodes[c->node].offset;
+
+	return -FDT_ERR_NOTFOUND;
+}
@@ -85,9 +85,56 @@ static uint32_t overlay_get_target_phandle(const void *fdto, int fragment)
 	return fdt32_to_cpu(*val);
 }
 
+/*
+ * The merge either changes the base tree directly or records the
+ * changes in an edit transaction (edit is non-NULL), in which case node
+ * offsets are those of the transaction.
+ */
+static int overlay_path_offset(const void *fdt, void *edit, const char *path)
+{
+	if (edit)
+		return fdt_edit_path_offset(edit, path);
+	return fdt_path_offset(fdt, path);
+}
+
+static int overlay_subnode_offset(const void *fdt, void *edit, int parent,
+				  const char *name)
+{
+	if (edit)
+		return fdt_edit_subnode_offset(edit, parent, name);
+	return fdt_subnode_offset(fdt, parent, name);
+}
+
+static int overlay_add_subnode(void *fdt, void *edit, int parent,
+			       const char *name)
+{
+	if (edit)
+		return fdt_edit_add_subnode(edit, parent, name);
+	return fdt_add_subnode(fdt, parent, name);
+}
+
+static int overlay_setprop_placeholder(void *fdt, void *edit, int node,
+				       const char *name, int len,
+				       void **prop_data)
+{
+	if (edit)
+		return fdt_edit_setprop_placeholder(edit, node, name, len,
+						    prop_data);
+	return fdt_setprop_placeholder(fdt, node, name, len, prop_data);
+}
+
+static int overlay_setprop(void *fdt, void *edit, int node,
+			   const char *name, const void *val, int len)
+{
+	if (edit)
+		return fdt_edit_setprop(edit, node, name, val, len);
+	return fdt_setprop(fdt, node, name, val, len);
+}
+
 /**
  * overlay_get_target - retrieves the offset of a fragment's target
  * @fdt: Base device tree blob
+ * @edit: Edit transaction on the base device tree, or NULL
  * @fdto: Device tree overlay blob
  * @fragment: node offset of the fragment in the overlay
  * @pathp: pointer which receives the path of the target (or NULL)
@@ -100,7 +147,7 @@ static uint32_t overlay_get_target_phandle(const void *fdto, int fragment)
  *      the targetted node offset in the base device tree
  *      Negative error code on error
  */
-static int overlay_get_target(const void *fdt, const void *fdto,
+static int overlay_get_target(const void *fdt, void *edit, const void *fdto,
 			      int fragment, char const **pathp)
 {
 	uint32_t phandle;
@@ -117,7 +164,7 @@ static int overlay_get_target(const void *fdt, const void *fdto,
 		/* And then a path based lookup */
 		path = fdt_getprop(fdto, fragment, "target-path", &path_len);
 		if (path)
-			ret = fdt_path_offset(fdt, path);
+			ret = overlay_path_offset(fdt, edit, path);
 		else
 			ret = path_len;
 	} else
@@ -582,6 +629,7 @@ static int overlay_fixup_phandles(void *fdt, void *fdto)
 /**
  * overlay_apply_node - Merges a node into the base device tree
  * @fdt: Base Device Tree blob
+ * @edit: Edit transaction on the base device tree, or NULL
  * @target: Node offset in the base device tree to apply the fragment to
  * @fdto: Device tree overlay blob
  * @node: Node offset in the overlay holding the changes to merge
@@ -598,7 +646,7 @@ static int overlay_fixup_phandles(void *fdt, void *fdto)
  *      0 on success
  *      Negative error code on failure
  */
-static int overlay_apply_node(void *fdt, int target,
+static int overlay_apply_node(void *fdt, void *edit, int target,
 			      void *fdto, int node)
 {
 	int property;
@@ -617,7 +665,7 @@ static int overlay_apply_node(void *fdt, int target,
 		if (prop_len < 0)
 			return prop_len;
 
-		ret = fdt_setprop(fdt, target, name, prop, prop_len);
+		ret = overlay_setprop(fdt, edit, target, name, prop, prop_len);
 		if (ret)
 			return ret;
 	}
@@ -627,9 +675,9 @@ static int overlay_apply_node(void *fdt, int target,
 		int nnode;
 		int ret;
 
-		nnode = fdt_add_subnode(fdt, target, name);
+		nnode = overlay_add_subnode(fdt, edit, target, name);
 		if (nnode == -FDT_ERR_EXISTS) {
-			nnode = fdt_subnode_offset(fdt, target, name);
+			nnode = overlay_subnode_offset(fdt, edit, target, name);
 			if (nnode == -FDT_ERR_NOTFOUND)
 				return -FDT_ERR_INTERNAL;
 		}
@@ -637,7 +685,7 @@ static int overlay_apply_node(void *fdt, int target,
 		if (nnode < 0)
 			return nnode;
 
-		ret = overlay_apply_node(fdt, nnode, fdto, subnode);
+		ret = overlay_apply_node(fdt, edit, nnode, fdto, subnode);
 		if (ret)
 			return ret;
 	}
@@ -648,6 +696,7 @@ static int overlay_apply_node(void *fdt, int target,
 /**
  * overlay_merge - Merge an overlay into its base device tree
  * @fdt: Base Device Tree blob
+ * @edit: Edit transaction on the base device tree, or NULL
  * @fdto: Device tree overlay blob
  *
  * overlay_merge() merges an overlay into its base device tree.
@@ -660,7 +709,7 @@ static int overlay_apply_node(void *fdt, int target,
  *      0 on success
  *      Negative error code on failure
  */
-static int overlay_merge(void *fdt, void *fdto)
+static int overlay_merge(void *fdt, void *edit, void *fdto)
 {
 	int fragment;
 
@@ -680,11 +729,11 @@ static int overlay_merge(void *fdt, void *fdto)
 		if (overlay < 0)
 			return overlay;
 
-		target = overlay_get_target(fdt, fdto, fragment, NULL);
+		target = overlay_get_target(fdt, edit, fdto, fragment, NULL);
 		if (target < 0)
 			return target;
 
-		ret = overlay_apply_node(fdt, target, fdto, overlay);
+		ret = overlay_apply_node(fdt, edit, target, fdto, overlay);
 		if (ret)
 			return ret;
 	}
@@ -723,6 +772,7 @@ static int get_path_len(const void *fdt, int nodeoffset)
 /**
  * overlay_symbol_update - Update the symbols of base tree after a merge
  * @fdt: Base Device Tree blob
+ * @edit: Edit transaction on the base device tree, or NULL
  * @fdto: Device tree overlay blob
  *
  * overlay_symbol_update() updates the symbols of the base tree with the
@@ -736,7 +786,7 @@ static int get_path_len(const void *fdt, int nodeoffset)
  *      0 on success
  *      Negative error code on failure
  */
-static int overlay_symbol_update(void *fdt, void *fdto)
+static int overlay_symbol_update(void *fdt, void *edit, void *fdto)
 {
 	int root_sym, ov_sym, prop, path_len, fragment, target;
 	int len, frag_name_len, ret, rel_path_len;
@@ -755,11 +805,11 @@ static int overlay_symbol_update(void *fdt, void *fdto)
 	if (ov_sym < 0)
 		return 0;
 
-	root_sym = fdt_subnode_offset(fdt, 0, "__symbols__");
+	root_sym = overlay_subnode_offset(fdt, edit, 0, "__symbols__");
 
 	/* it no root symbols exist we should create them */
 	if (root_sym == -FDT_ERR_NOTFOUND)
-		root_sym = fdt_add_subnode(fdt, 0, "__symbols__");
+		root_sym = overlay_add_subnode(fdt, edit, 0, "__symbols__");
 
 	/* any error is fatal now */
 	if (root_sym < 0)
@@ -813,7 +863,8 @@ static int overlay_symbol_update(void *fdt, void *fdto)
 			return -FDT_ERR_BADOVERLAY;
 
 		/* get the target of the fragment */
-		ret = overlay_get_target(fdt, fdto, fragment, &target_path);
+		ret = overlay_get_target(fdt, edit, fdto, fragment,
+					 &target_path);
 		if (ret < 0)
 			return ret;
 		target = ret;
@@ -828,14 +879,15 @@ static int overlay_symbol_update(void *fdt, void *fdto)
 			len = strlen(target_path);
 		}
 
-		ret = fdt_setprop_placeholder(fdt, root_sym, name,
+		ret = overlay_setprop_placeholder(fdt, edit, root_sym, name,
 				len + (len > 1) + rel_path_len + 1, &p);
 		if (ret < 0)
 			return ret;
 
 		if (!target_path) {
 			/* again in case setprop_placeholder changed it */
-			ret = overlay_get_target(fdt, fdto, fragment, &target_path);
+			ret = overlay_get_target(fdt, edit, fdto, fragment,
+						 &target_path);
 			if (ret < 0)
 				return ret;
 			target = ret;
@@ -861,6 +913,66 @@ static int overlay_symbol_update(void *fdt, void *fdto)
 	return 0;
 }
 
+/**
+ * overlay_apply_batched - Merge an overlay with a single rewrite of the base
+ * @fdt: Base Device Tree blob
+ * @fdto: Device tree overlay blob
+ *
+ * overlay_apply_batched() records the merge and the symbol update in an
+ * edit transaction and then writes out the merged tree once, instead
+ * of moving the rest of the base tree for every property added.  The
+ * transaction and the merged tree both live in the free space at the
+ * end of the base tree, so the base tree is left untouched if this
+ * fails.
+ *
+ * returns:
+ *      0 on success
+ *      Negative error code if the overlay could not be applied this way
+ */
+static int overlay_apply_batched(void *fdt, void *fdto)
+{
+	char *start = fdt;
+	char *end = start + fdt_totalsize(fdt);
+	char *out, *ws;
+	int used, outsize, ret;
+
+	/* Same layout as required by the read-write functions, with the
+	 * strings block last */
+	if (fdt_version(fdt) < 17)
+		return -FDT_ERR_BADVERSION;
+	if ((fdt_off_mem_rsvmap(fdt) > fdt_off_dt_struct(fdt))
+	    || (fdt_off_dt_struct(fdt) + fdt_size_dt_struct(fdt)
+		> fdt_off_dt_strings(fdt)))
+		return -FDT_ERR_BADLAYOUT;
+
+	/* The merged tree is no bigger than the base tree plus the
+	 * overlay, and the symbols with their target paths prefixed */
+	used = fdt_off_dt_strings(fdt) + fdt_size_dt_strings(fdt);
+	outsize = FDT_ALIGN(used + 2 * fdt_totalsize(fdto), sizeof(uint64_t));
+	if (fdt_totalsize(fdt) < FDT_ALIGN(used, sizeof(uint64_t)) + outsize)
+		return -FDT_ERR_NOSPACE;
+	out = start + FDT_ALIGN(used, sizeof(uint64_t));
+	ws = out + outsize;
+
+	ret = fdt_edit_open(fdt, ws, end - ws);
+	if (ret)
+		return ret;
+
+	ret = overlay_merge(fdt, ws, fdto);
+	if (ret)
+		return ret;
+
+	ret = overlay_symbol_update(fdt, ws, fdto);
+	if (ret)
+		return ret;
+
+	ret = fdt_edit_finish(ws, out, outsize);
+	if (ret)
+		return ret;
+
+	return fdt_open_into(out, fdt, fdt_totalsize(fdt));
+}
+
 int fdt_overlay_apply(void *fdt, void *fdto)
 {
 	uint32_t delta = fdt_get_max_phandle(fdt);
@@ -881,13 +993,19 @@ int fdt_overlay_apply(void *fdt, void *fdto)
 	if (ret)
 		goto err;
 
-	ret = overlay_merge(fdt, fdto);
-	if (ret)
-		goto err;
+	/*
+	 * Without enough free space for that, or if anything about the
+	 * overlay gets in the way, merge into the base tree in place.
+	 */
+	if (overlay_apply_batched(fdt, fdto) != 0) {
+		ret = overlay_merge(fdt, NULL, fdto);
+		if (ret)
+			goto err;
 
-	ret = overlay_symbol_update(fdt, fdto);
-	if (ret)
-		goto err;
+		ret = overlay_symbol_update(fdt, NULL, fdto);
+		if (ret)
+			goto err;
+	}
 
 	/*
 	 * The overlay has been damaged, erase its magic.
@@ -235,10 +235,14 @@ static int nextprop_(const void *fdt, int offset)
 int fdt_subnode_offset_namelen(const void *fdt, int offset,
 			       const char *name, int namelen)
 {
-	int depth;
+	int depth, err;
 
 	FDT_RO_PROBE(fdt);
 
+	err = fdt_index_subnode_(fdt, offset, name, namelen);
+	if (err != FDT_INDEX_MISS_)
+		return err;
+
 	for (depth = 0;
 	     (offset >= 0) && (depth >= 0);
 	     offset = fdt_next_node(fdt, offset, &depth))
@@ -643,8 +647,13 @@ int fdt_node_depth(const void *fdt, int nodeoffset)
 
 int fdt_parent_offset(const void *fdt, int nodeoffset)
 {
-	int nodedepth = fdt_node_depth(fdt, nodeoffset);
+	int offset = fdt_index_parent_(fdt, nodeoffset);
+	int nodedepth;
+
+	if (offset != FDT_INDEX_MISS_)
+		return offset;
 
+	nodedepth = fdt_node_depth(fdt, nodeoffset);
 	if (nodedepth < 0)
 		return nodedepth;
 	return fdt_supernode_atdepth_offset(fdt, nodeoffset,
@@ -687,12 +696,17 @@ int fdt_node_offset_by_phandle(const void *fdt, uint32_t phandle)
 
 	FDT_RO_PROBE(fdt);
 
+	offset = fdt_index_by_phandle_(fdt, phandle);
+	if (offset != FDT_INDEX_MISS_)
+		return offset;
+
 	/* FIXME: The algorithm here is pretty horrible: we
 	 * potentially scan each property of a node in
 	 * fdt_get_phandle(), then if that didn't find what
 	 * we want, we scan over them again making our way to the next
 	 * node.  Still it's the easiest to implement approach;
-	 * performance can come later. */
+	 * performance can come later.  Build an index with
+	 * fdt_index_init() to avoid it. */
 	for (offset = fdt_next_node(fdt, -1, NULL);
 	     offset >= 0;
 	     offset = fdt_next_node(fdt, offset, NULL)) {
@@ -840,11 +854,16 @@ int fdt_node_offset_by_compatible(const void *fdt, int startoffset,
 
 	FDT_RO_PROBE(fdt);
 
+	offset = fdt_index_by_compatible_(fdt, startoffset, compatible);
+	if (offset != FDT_INDEX_MISS_)
+		return offset;
+
 	/* FIXME: The algorithm here is pretty horrible: we scan each
 	 * property of a node in fdt_node_check_compatible(), then if
 	 * that didn't find what we want, we scan over them again
 	 * making our way to the next node.  Still it's the easiest to
-	 * implement approach; performance can come later. */
+	 * implement approach; performance can come later.  Build an
+	 * index with fdt_index_init() to avoid it. */
 	for (offset = fdt_next_node(fdt, startoffset, NULL);
 	     offset >= 0;
 	     offset = fdt_next_node(fdt, offset, NULL)) {
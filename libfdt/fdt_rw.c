@@ -71,6 +71,9 @@ static int fdt_rw_probe_(void *fdt)
 {
 	FDT_RO_PROBE(fdt);
 
+	/* Every edit may move nodes around */
+	fdt_index_detach(fdt);
+
 	if (fdt_version(fdt) < 17)
 		return -FDT_ERR_BADVERSION;
 	if (fdt_blocks_misordered_(fdt, sizeof(struct fdt_reserve_entry),
@@ -437,6 +440,8 @@ int fdt_open_into(const void *fdt, void *buf, int bufsize)
 
 	FDT_RO_PROBE(fdt);
 
+	fdt_index_detach(buf);
+
 	mem_rsv_size = (fdt_num_mem_rsv(fdt)+1)
 		* sizeof(struct fdt_reserve_entry);
 
@@ -71,6 +71,10 @@ int fdt_setprop_inplace_namelen_partial(void *fdt, int nodeoffset,
 	if (proplen < (len + idx))
 		return -FDT_ERR_NOSPACE;
 
+	/* Offsets don't move, but the phandles and compatible strings
+	 * recorded in an index might change */
+	fdt_index_detach(fdt);
+
 	memcpy((char *)propval + idx, val, len);
 	return 0;
 }
@@ -110,6 +114,7 @@ int fdt_nop_property(void *fdt, int nodeoffset, const char *name)
 	if (!prop)
 		return len;
 
+	fdt_index_detach(fdt);
 	fdt_nop_region_(prop, len + sizeof(*prop));
 
 	return 0;
@@ -133,6 +138,7 @@ int fdt_nop_node(void *fdt, int nodeoffset)
 	if (endoffset < 0)
 		return endoffset;
 
+	fdt_index_detach(fdt);
 	fdt_nop_region_(fdt_offset_ptr_w(fdt, nodeoffset, 0),
 			endoffset - nodeoffset);
 	return 0;
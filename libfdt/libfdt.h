@@ -1169,6 +1169,74 @@ int fdt_address_cells(const void *fdt, int nodeoffset);
  */
 int fdt_size_cells(const void *fdt, int nodeoffset);
 
+/**********************************************************************/
+/* Lookup index                                                       */
+/**********************************************************************/
+
+/**
+ * fdt_index_size - size of the lookup index for a device tree
+ * @fdt: pointer to the device tree blob
+ *
+ * fdt_index_size() returns the number of bytes of memory that
+ * fdt_index_init() needs to build an index over the given tree.
+ *
+ * returns:
+ *	the index size in bytes, on success
+ *	-FDT_ERR_BADMAGIC,
+ *	-FDT_ERR_BADVERSION,
+ *	-FDT_ERR_BADSTATE,
+ *	-FDT_ERR_BADSTRUCTURE,
+ *	-FDT_ERR_TRUNCATED, standard meanings
+ */
+int fdt_index_size(const void *fdt);
+
+/**
+ * fdt_index_init - build a lookup index and attach it to a device tree
+ * @fdt: pointer to the device tree blob
+ * @buf: memory for the index, aligned to 8 bytes
+ * @bufsize: size of buf, at least fdt_index_size(fdt)
+ *
+ * fdt_index_init() walks the tree once, recording every node along
+ * with its phandle and compatible strings, and attaches the result to
+ * fdt.  From then on fdt_path_offset(), fdt_subnode_offset(),
+ * fdt_parent_offset(), fdt_node_offset_by_phandle() and
+ * fdt_node_offset_by_compatible() answer from the index instead of
+ * scanning the whole tree, with the same results.
+ *
+ * Only a few blobs may have an index at the same time, though an
+ * index whose blob header has changed since it was built is replaced
+ * when room is needed.  Any libfdt function that modifies the tree
+ * detaches its index, as does fdt_index_detach().  A tree modified by
+ * other means must be detached by the caller, as must one whose memory
+ * is about to be reused.  buf must stay valid for as long as the index
+ * is attached.
+ *
+ * Lookups only read the index, so they may run concurrently with each
+ * other, but not with fdt_index_init() or fdt_index_detach().
+ *
+ * returns:
+ *	0, on success
+ *	-FDT_ERR_NOSPACE, bufsize is too small, or too many blobs
+ *		already have an index attached
+ *	-FDT_ERR_BADVALUE, buf is not suitably aligned
+ *	-FDT_ERR_BADMAGIC,
+ *	-FDT_ERR_BADVERSION,
+ *	-FDT_ERR_BADSTATE,
+ *	-FDT_ERR_BADSTRUCTURE,
+ *	-FDT_ERR_TRUNCATED, standard meanings
+ */
+int fdt_index_init(const void *fdt, void *buf, int bufsize);
+
+/**
+ * fdt_index_detach - stop using the lookup index of a device tree
+ * @fdt: pointer to the device tree blob
+ *
+ * fdt_index_detach() detaches the index built by fdt_index_init(), if
+ * any, after which lookups walk the tree again and the index memory
+ * may be freed.
+ */
+void fdt_index_detach(const void *fdt);
+
 
 /**********************************************************************/
 /* Write-in-place functions                                           */
@@ -1944,6 +2012,12 @@ int fdt_del_node(void *fdt, int nodeoffset);
  * Expect the base device tree to be modified, even if the function
  * returns an error.
  *
+ * When the base device tree has enough free space at its end, a bit
+ * more than its own size plus twice the size of the overlay, the
+ * overlay is merged with an edit transaction (see fdt_edit_open()) in
+ * that space and the base tree rewritten once.  Otherwise it is merged
+ * in place one property at a time.
+ *
  * returns:
  *	0, on success
  *	-FDT_ERR_NOSPACE, there's not enough space in the base device tree
@@ -1964,6 +2038,219 @@ int fdt_del_node(void *fdt, int nodeoffset);
  */
 int fdt_overlay_apply(void *fdt, void *fdto);
 
+/**********************************************************************/
+/* Batched edit functions                                             */
+/**********************************************************************/
+
+/*
+ * The read-write functions above move the rest of the blob on every
+ * change, so building up a tree with many of them is quadratic in its
+ * size.  An edit transaction instead records the changes against an
+ * unmodified tree in a separate workspace and writes out the edited
+ * tree in a single pass when it is finished.
+ *
+ * Nodes of the original tree are named by their offsets in it, which
+ * stay valid for the whole transaction.  Nodes added by the transaction
+ * get offsets of their own that are only meaningful to the fdt_edit_*
+ * functions.  Properties and subnodes added to an existing node are
+ * written after the existing ones.
+ */
+
+/**
+ * fdt_edit_open - start an edit transaction
+ * @fdt: pointer to the device tree blob to edit
+ * @ws: workspace for the transaction, aligned to 8 bytes
+ * @wssize: size of the workspace
+ *
+ * fdt_edit_open() starts recording edits to fdt in ws.  fdt must not
+ * change until the transaction is finished.  The workspace holds a
+ * record for every edited node and property, along with copies of the
+ * new names and values.
+ *
+ * returns:
+ *	0, on success
+ *	-FDT_ERR_NOSPACE, the workspace is too small
+ *	-FDT_ERR_BADVALUE, ws is not suitably aligned
+ *	-FDT_ERR_BADMAGIC,
+ *	-FDT_ERR_BADVERSION,
+ *	-FDT_ERR_BADSTATE,
+ *	-FDT_ERR_BADSTRUCTURE,
+ *	-FDT_ERR_TRUNCATED, standard meanings
+ */
+int fdt_edit_open(const void *fdt, void *ws, int wssize);
+
+/**
+ * fdt_edit_setprop - record a change to a property
+ * @ws: workspace of an open transaction
+ * @nodeoffset: offset of the node whose property to change
+ * @name: name of the property to change
+ * @val: pointer to data to set the property value to
+ * @len: length of the property value
+ *
+ * Transaction counterpart of fdt_setprop(), the value is copied into
+ * the workspace.
+ *
+ * returns:
+ *	0, on success
+ *	-FDT_ERR_NOSPACE, the workspace is full
+ *	-FDT_ERR_BADOFFSET, nodeoffset is not a node of the transaction,
+ *		or the node has been deleted
+ *	-FDT_ERR_BADSTATE, ws is not an open transaction
+ */
+int fdt_edit_setprop(void *ws, int nodeoffset, const char *name,
+		     const void *val, int len);
+
+/**
+ * fdt_edit_setprop_placeholder - record a change to a property, leaving
+ * the value to be filled in
+ * @ws: workspace of an open transaction
+ * @nodeoffset: offset of the node whose property to change
+ * @name: name of the property to change
+ * @len: length of the property value
+ * @prop_data: return pointer to the property data in the workspace
+ *
+ * Transaction counterpart of fdt_setprop_placeholder().  The data
+ * pointer stays valid until the transaction is finished.
+ *
+ * returns:
+ *	as for fdt_edit_setprop()
+ */
+int fdt_edit_setprop_placeholder(void *ws, int nodeoffset, const char *name,
+				 int len, void **prop_data);
+
+static inline int fdt_edit_setprop_u32(void *ws, int nodeoffset,
+				       const char *name, uint32_t val)
+{
+	fdt32_t tmp = cpu_to_fdt32(val);
+	return fdt_edit_setprop(ws, nodeoffset, name, &tmp, sizeof(tmp));
+}
+
+static inline int fdt_edit_setprop_u64(void *ws, int nodeoffset,
+				       const char *name, uint64_t val)
+{
+	fdt64_t tmp = cpu_to_fdt64(val);
+	return fdt_edit_setprop(ws, nodeoffset, name, &tmp, sizeof(tmp));
+}
+
+#define fdt_edit_setprop_string(ws, nodeoffset, name, str) \
+	fdt_edit_setprop((ws), (nodeoffset), (name), (str), strlen(str)+1)
+
+/**
+ * fdt_edit_delprop - record the deletion of a property
+ * @ws: workspace of an open transaction
+ * @nodeoffset: offset of the node whose property to nop
+ * @name: name of the property to nop
+ *
+ * Transaction counterpart of fdt_delprop().
+ *
+ * returns:
+ *	0, on success
+ *	-FDT_ERR_NOTFOUND, node does not have the named property
+ *	-FDT_ERR_NOSPACE, the workspace is full
+ *	-FDT_ERR_BADOFFSET, nodeoffset is not a node of the transaction,
+ *		or the node has been deleted
+ *	-FDT_ERR_BADSTATE, ws is not an open transaction
+ */
+int fdt_edit_delprop(void *ws, int nodeoffset, const char *name);
+
+/**
+ * fdt_edit_subnode_offset - find a subnode as seen by a transaction
+ * @ws: workspace of an open transaction
+ * @parentoffset: offset of the parent node
+ * @name: name of the subnode to locate
+ *
+ * Transaction counterpart of fdt_subnode_offset(), which finds nodes
+ * added by the transaction and skips deleted ones.
+ *
+ * returns:
+ *	offset of the subnode, on success
+ *	-FDT_ERR_NOTFOUND, if the requested subnode does not exist
+ *	-FDT_ERR_BADOFFSET, parentoffset is not a node of the transaction
+ *	-FDT_ERR_BADSTATE, ws is not an open transaction
+ */
+int fdt_edit_subnode_offset_namelen(void *ws, int parentoffset,
+				    const char *name, int namelen);
+int fdt_edit_subnode_offset(void *ws, int parentoffset, const char *name);
+
+/**
+ * fdt_edit_path_offset - find a node by path as seen by a transaction
+ * @ws: workspace of an open transaction
+ * @path: full path of the node to locate
+ *
+ * Transaction counterpart of fdt_path_offset().  Aliases are looked up
+ * in the original tree.
+ *
+ * returns:
+ *	offset of the node, on success
+ *	-FDT_ERR_BADPATH, given path does not begin with '/' or is invalid
+ *	-FDT_ERR_NOTFOUND, if the requested node does not exist
+ *	-FDT_ERR_BADSTATE, ws is not an open transaction
+ */
+int fdt_edit_path_offset(void *ws, const char *path);
+
+/**
+ * fdt_edit_add_subnode - record the addition of a subnode
+ * @ws: workspace of an open transaction
+ * @parentoffset: offset of the node to add a subnode to
+ * @name: name of the subnode to add
+ *
+ * Transaction counterpart of fdt_add_subnode().
+ *
+ * returns:
+ *	offset of the new node, on success
+ *	-FDT_ERR_EXISTS, if the node at parentoffset already has a subnode
+ *		of the given name
+ *	-FDT_ERR_NOSPACE, the workspace is full
+ *	-FDT_ERR_BADOFFSET, parentoffset is not a node of the transaction,
+ *		or the node has been deleted
+ *	-FDT_ERR_BADSTATE, ws is not an open transaction
+ */
+int fdt_edit_add_subnode_namelen(void *ws, int parentoffset,
+				 const char *name, int namelen);
+int fdt_edit_add_subnode(void *ws, int parentoffset, const char *name);
+
+/**
+ * fdt_edit_del_node - record the deletion of a node
+ * @ws: workspace of an open transaction
+ * @nodeoffset: offset of the node to delete
+ *
+ * Transaction counterpart of fdt_del_node(), the node and all its
+ * subnodes are left out of the edited tree.  The root node cannot be
+ * deleted.
+ *
+ * returns:
+ *	0, on success
+ *	-FDT_ERR_NOSPACE, the workspace is full
+ *	-FDT_ERR_BADOFFSET, nodeoffset is not a node of the transaction,
+ *		has already been deleted, or is the root
+ *	-FDT_ERR_BADSTATE, ws is not an open transaction
+ */
+int fdt_edit_del_node(void *ws, int nodeoffset);
+
+/**
+ * fdt_edit_finish - write out the edited tree
+ * @ws: workspace of an open transaction
+ * @buf: buffer for the edited tree
+ * @bufsize: size of buf
+ *
+ * fdt_edit_finish() writes the original tree with all recorded edits
+ * applied to buf, with the sequential write functions, as a packed
+ * blob.  buf must not overlap the original tree or the workspace.  Use
+ * fdt_open_into() to make room for further read-write changes.  The
+ * transaction stays open, so on -FDT_ERR_NOSPACE it may be finished
+ * again into a larger buffer.
+ *
+ * returns:
+ *	0, on success
+ *	-FDT_ERR_NOSPACE, buf is too small for the edited tree
+ *	-FDT_ERR_BADSTATE, ws is not an open transaction
+ *	-FDT_ERR_BADMAGIC,
+ *	-FDT_ERR_BADVERSION,
+ *	-FDT_ERR_BADSTRUCTURE,
+ *	-FDT_ERR_TRUNCATED, standard meanings
+ */
+int fdt_edit_finish(void *ws, void *buf, int bufsize);
+
 /**********************************************************************/
 /* Debugging / informational functions                                */
 /**********************************************************************/
@@ -68,6 +68,17 @@ int fdt_check_prop_offset_(const void *fdt, int offset);
 const char *fdt_find_string_(const char *strtab, int tabsize, const char *s);
 int fdt_node_end_offset_(void *fdt, int nodeoffset);
 
+/* Lookups through an attached index, see fdt_index_init(). These return
+ * FDT_INDEX_MISS_ if the blob has no index or the index cannot answer, in
+ * which case the caller falls back to walking the tree */
+#define FDT_INDEX_MISS_		(-FDT_ERR_MAX - 1)
+int fdt_index_subnode_(const void *fdt, int parentoffset,
+		       const char *name, int namelen);
+int fdt_index_parent_(const void *fdt, int nodeoffset);
+int fdt_index_by_phandle_(const void *fdt, uint32_t phandle);
+int fdt_index_by_compatible_(const void *fdt, int startoffset,
+			     const char *compatible);
+
 static inline const void *fdt_offset_ptr_(const void *fdt, int offset)
 {
 	return (const char *)fdt + fdt_off_dt_struct(fdt) + offset;
@@ -93,4 +104,15 @@ static inline struct fdt_reserve_entry *fdt_mem_rsv_w_(void *fdt, int n)
 
 #define FDT_SW_MAGIC		(~FDT_MAGIC)
 
+/* FNV-1a hash of a name, used by the lookup index and batched edits */
+static inline uint32_t fdt_hash_(const char *s, int len)
+{
+	uint32_t h = 2166136261u;
+	int i;
+
+	for (i = 0; i < len; i++)
+		h = (h ^ (uint8_t)s[i]) * 16777619u;
+	return h;
+}
+
 #endif /* LIBFDT_INTERNAL_H */
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the BSD 2-Clause license. Note that NO WARRANTY is provided.
+ * See "LICENSE_BSD2.txt" for details.
+ *
+ * @TAG(DATA61_BSD)
+ */
+#pragma once
+
+#include <autoconf.h>
+#include <stdint.h>
+#include <platsupport/io.h>
+#ifdef CONFIG_PLAT_PC99
+#include <platsupport/plat/acpi/acpi.h>
+#endif
+
+/* PCI Express enhanced configuration access mechanism (ECAM, also known as MMCONFIG).
+ * Every function has 4K of memory mapped configuration space, at offset
+ * (bus << 20 | dev << 15 | fun << 12) from the base of the segment. Once a region covering a
+ * bus has been added all config space accesses to that bus, including those made through
+ * libpci_read_reg and friends, become loads and stores to the mapping instead of going
+ * through the 0xCF8/0xCFC port pair, and the extended config space above 256 bytes becomes
+ * reachable. Regions should be added before calling libpci_scan. */
+
+#define PCI_ECAM_MAX_REGIONS 16
+#define PCI_CONF_SPACE_SIZE 256
+#define PCI_EXT_CONF_SPACE_SIZE 4096
+
+/**
+ * Add a memory mapped configuration region
+ *
+ * @param segment   PCI segment group the region belongs to
+ * @param bus_start First bus decoded by the region
+ * @param bus_end   Last bus decoded by the region
+ * @param vaddr     Mapping of the configuration space of bus_start. Must be mapped uncached
+ *                  and cover (bus_end - bus_start + 1) MiB
+ *
+ * @return          0 on success
+ */
+int libpci_ecam_add_region(uint16_t segment, uint8_t bus_start, uint8_t bus_end, void *vaddr);
+
+/* Return the memory mapped address of a config space register, or NULL if there is no
+ * region covering the bus. */
+volatile void *libpci_ecam_addr(uint16_t segment, uint8_t bus, uint8_t dev, uint8_t fun, uint16_t reg);
+
+#ifdef CONFIG_PLAT_PC99
+/**
+ * Map and add every configuration region described by the ACPI MCFG table
+ *
+ * @param acpi      ACPI handle returned by acpi_init
+ * @param io_mapper Mapper used to map the configuration regions
+ *
+ * @return          Number of regions added, or -1 if there is no MCFG table, in which case
+ *                  config space keeps being accessed through the IO ports
+ */
+int libpci_ecam_init_acpi(acpi_t *acpi, ps_io_mapper_t *io_mapper);
+#endif
+
+/* Extended config space access. Registers 0 to PCI_EXT_CONF_SPACE_SIZE - 1 can be accessed
+ * on buses with an ECAM region. Elsewhere only the first PCI_CONF_SPACE_SIZE bytes of segment 0
+ * are reachable, reads outside of these return all ones and writes are dropped, as they
+ * would be for a function that is not present. */
+uint32_t libpci_read_ext_reg(uint16_t segment, uint8_t bus, uint8_t dev, uint8_t fun, uint16_t reg,
+                             uint8_t size);
+void libpci_write_ext_reg(uint16_t segment, uint8_t bus, uint8_t dev, uint8_t fun, uint16_t reg,
+                          uint32_t val, uint8_t size);
@@ -3829,5 +3829,5 @@
 
 #define PCI_VENDOR_ID_INVALID   0xffff
 
-char* libpci_vendorID_str(int vid);
-char* libpci_deviceID_str(int vid, int did);
+const char* libpci_vendorID_str(int vid);
+const char* libpci_deviceID_str(int vid, int did);
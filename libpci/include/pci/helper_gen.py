@@ -9,45 +9,121 @@
 # @TAG(DATA61_BSD)
 #
 
+# Generates src/helper.c from the ID definitions in helper.h. Vendor and device
+# names are emitted as tables sorted by (vendor ID << 16 | device ID), indexing
+# a single string pool, which are binary searched at run time. Run from this
+# directory.
+
 import re, os;
 
 helper_lines = open("helper.h", "r").readlines();
 helper_out = open("../../src/helper.c", "w");
 
+# Parse the IDs. Devices belong to the most recently defined vendor. Where an ID
+# is defined more than once the first definition wins.
+vendors = {}; devices = {};
+vendor = ""; vval = 0;
+for line in helper_lines:
+    line = line.strip();
+
+    rv = re.search(r'^#define PCI_VENDOR_ID_([A-Z0-9_]+)\s+(\w+)', line);
+    if rv:
+        (vendor, vval) = (rv.group(1).lower(), int(rv.group(2), 16));
+        vendors.setdefault(vval, vendor);
+        continue;
+
+    r = re.search(r'^#define PCI_DEVICE_ID_([A-Z0-9]+_[A-Z0-9_]+)\s+(\w+)', line);
+    if not r: continue;
+
+    (device, val) = (r.group(1).lower(), int(r.group(2), 16));
+    devices.setdefault((vval << 16) | val, device);
+
+# Build the string pool, sharing identical names.
+pool = []; offsets = {}; pool_len = 0;
+def pool_add(name):
+    global pool_len;
+    if name not in offsets:
+        offsets[name] = pool_len;
+        pool.append(name);
+        pool_len += len(name) + 1;
+    return offsets[name];
+
+def print_table(name, table):
+    print ( "static const libpci_name_entry_t %s[] = {" % name, file=helper_out );
+    for key in sorted(table):
+        print ( "    { 0x%08x, %d }," % (key, pool_add(table[key])), file=helper_out );
+    print ( "};\n", file=helper_out );
+
 # Generate header.
+print ( """/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the BSD 2-Clause license. Note that NO WARRANTY is provided.
+ * See "LICENSE_BSD2.txt" for details.
+ *
+ * @TAG(DATA61_BSD)
+ */
+""", file=helper_out );
 print ( "// WARNING: This file is generated. DO NOT EDIT.", file=helper_out );
-print ( "// Look in include/pci/helper_gen.y instead.\n", file=helper_out );
-print ( "#include <pci/helper.h>\n", file=helper_out );
+print ( "// Look in include/pci/helper_gen.py instead.\n", file=helper_out );
+print ( "#include <stddef.h>", file=helper_out );
+print ( "#include <stdint.h>", file=helper_out );
+print ( "#include <pci/gen_config.h>", file=helper_out );
+print ( "#include <pci/helper.h>", file=helper_out );
+print ( "#include <utils/arith.h>\n", file=helper_out );
+print ( "#ifdef CONFIG_LIB_PCI_NAMES\n", file=helper_out );
 
-# Generate vendor IDs.
-print ( "char* libpci_vendorID_str(int vid) {", file=helper_out );
+print ( "typedef struct libpci_name_entry {", file=helper_out );
+print ( "    uint32_t key;", file=helper_out );
+print ( "    uint32_t name;", file=helper_out );
+print ( "} libpci_name_entry_t;\n", file=helper_out );
 
-for line in helper_lines:
-    line = line.strip();
-    r = re.search(r'^#define PCI_VENDOR_ID_([A-Z0-9_]+)\s+(\w+)', line);
-    if not r: continue;
+print_table("vendor_names", vendors);
+print_table("device_names", devices);
 
-    (vendor, val) = (r.group(1).lower(), r.group(2));
-    print ( "    if (vid == %s) return \"%s\";" % (val, vendor), file=helper_out );
+print ( "static const char name_pool[] =", file=helper_out );
+for name in pool:
+    print ( "    \"%s\\0\"" % name, file=helper_out );
+print ( "    ;\n", file=helper_out );
 
-print ( "    return \"Unknown vendor ID.\"; ", file=helper_out );
-print ( "}\n", file=helper_out );
+print ( """static const char* lookup(const libpci_name_entry_t *table, size_t n, uint32_t key) {
+    size_t lo = 0, hi = n;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (table[mid].key == key) {
+            return &name_pool[table[mid].name];
+        }
+        if (table[mid].key < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return NULL;
+}
 
-# Generate device IDs.
-print ( "char* libpci_deviceID_str(int vid, int did) {", file=helper_out );
-vendor = ""; vval = "";
-for line in helper_lines:
-    line = line.strip();
+const char* libpci_vendorID_str(int vid) {
+    const char *name = lookup(vendor_names, ARRAY_SIZE(vendor_names), (uint16_t)vid);
+    return name ? name : "Unknown vendor ID.";
+}
 
-    rv = re.search(r'^#define PCI_VENDOR_ID_([A-Z0-9_]+)\s+(\w+)', line);
-    if rv:
-        (vendor, vval) = (rv.group(1).lower(), rv.group(2));
+const char* libpci_deviceID_str(int vid, int did) {
+    const char *name = lookup(device_names, ARRAY_SIZE(device_names),
+                              ((uint32_t)(uint16_t)vid << 16) | (uint16_t)did);
+    return name ? name : "Unknown device ID.";
+}
 
-    r = re.search(r'^#define PCI_DEVICE_ID_([A-Z0-9]+_[A-Z0-9_]+)\s+(\w+)', line);
-    if not r: continue;
+#else
+
+const char* libpci_vendorID_str(int vid) {
+    return "Unknown vendor ID.";
+}
 
-    (device, val) = (r.group(1).lower(), r.group(2));
-    print ( "    if (vid == %s && did == %s) return \"%s\";" % (vval, val, device), file=helper_out );
+const char* libpci_deviceID_str(int vid, int did) {
+    return "Unknown device ID.";
+}
 
-print ( "    return \"Unknown device ID.\"; ", file=helper_out );
-print ( "}\n", file=helper_out );
+#endif /* CONFIG_LIB_PCI_NAMES */""", file=helper_out );
@@ -21,11 +21,14 @@
 #define PCI_CONF_PORT_DATA     0x0CFC
 #define PCI_CONF_PORT_ADDR_END (PCI_CONF_PORT_ADDR + 4)
 #define PCI_CONF_PORT_DATA_END (PCI_CONF_PORT_DATA + 4)
+/* Historic bound on the number of devices. The device list is no longer limited in size,
+ * this only remains as the bound for libpci_find_device_all. */
 #define PCI_MAX_DEVICES 128
 
 /* Structure containing information about a device. When a device is found during scanning,
  * one of these structs is populated from the information read off the device. */
 typedef struct libpci_device {
+    uint16_t segment;
     uint8_t bus;
     uint8_t dev;
     uint8_t fun;
@@ -44,8 +47,9 @@ typedef struct libpci_device {
 uint32_t libpci_ioread(uint32_t port_no, uint32_t* val, uint32_t size);
 uint32_t libpci_iowrite(uint32_t port_no, uint32_t val, uint32_t size);
 
-/* The global list of devices that have been found in the last PCI scan. */
-extern libpci_device_t libpci_device_list[PCI_MAX_DEVICES];
+/* The global list of devices that have been found in the last PCI scan. The list is
+ * grown as devices are found, so pointers into it are only stable once scanning is done. */
+extern libpci_device_t *libpci_device_list;
 extern uint32_t libpci_num_devices;
 
 /* Return the first device found matching given vendor and device ID. */
@@ -55,14 +59,38 @@ libpci_device_t* libpci_find_device(uint16_t vendor_id, uint16_t device_id);
  * be of at least size PCI_MAX_DEVICES to be safe. */
 int libpci_find_device_all(uint16_t vendor_id, uint16_t device_id, libpci_device_t** out);
 
+/* Same as libpci_find_device_all but returns at most 'max' devices. */
+int libpci_find_device_all_n(uint16_t vendor_id, uint16_t device_id, libpci_device_t** out, int max);
+
 /* Return the first device matching the bus, dev, fun, vendor and device id of given device struct. */
 libpci_device_t* libpci_find_device_matching(libpci_device_t *device);
 
 /* Return a device, if one exists, on the given bus, dev and fun */
 libpci_device_t* libpci_find_device_bdf(uint8_t bus, uint8_t dev, uint8_t fun);
 
-/* Scan the entire PCI space, find every device and popular device structures. */
+/* Return a device, if one exists, on the given segment (PCI domain), bus, dev and fun */
+libpci_device_t* libpci_find_device_sbdf(uint16_t segment, uint8_t bus, uint8_t dev, uint8_t fun);
+
+/* Scan the entire PCI space, find every device and popular device structures. Config space
+ * is read through any ECAM regions added beforehand (see pci/ecam.h), and through the IO
+ * ports in port_ops otherwise. */
 void libpci_scan(ps_io_port_ops_t port_ops);
 
+/* Scan like libpci_scan, but take the BAR information of each device from a snapshot saved
+ * by libpci_snapshot_save on an earlier boot instead of sizing the BARs, which needs a write,
+ * read and restore of each one. A device is only taken from the snapshot if it is found at the
+ * same position in the scan with the same IDs and its BARs still hold the same addresses.
+ * Otherwise, or if the snapshot is corrupt or from an incompatible build, the remaining devices
+ * are probed as normal. The snapshot must be suitably aligned for a uint32_t.
+ * Returns 0 if every device was taken from the snapshot and -1 if any had to be probed. */
+int libpci_scan_snapshot(ps_io_port_ops_t port_ops, const void *snapshot, size_t len);
+
+/* Size of the snapshot of the current device list that libpci_snapshot_save would write. */
+size_t libpci_snapshot_size(void);
+
+/* Save a snapshot of the current device list, to be given to libpci_scan_snapshot on later
+ * boots. Returns the number of bytes written, or -1 if len is less than libpci_snapshot_size. */
+int libpci_snapshot_save(void *buf, size_t len);
+
 /* Read base addr info from give device, and populate a base addr info structure. */
 void libpci_read_ioconfig(libpci_device_iocfg_t *cfg, uint8_t bus, uint8_t dev, uint8_t fun);
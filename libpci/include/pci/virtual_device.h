@@ -40,6 +40,7 @@
 
 struct libpci_vdevice;
 typedef struct libpci_vdevice libpci_vdevice_t;
+struct libpci_virtual_pci;
 
 typedef struct libpci_vdevice_mode {
     int mode; /* PCI_VDEVICE_MODE_* */
@@ -55,8 +56,15 @@ struct libpci_vdevice {
     uint8_t location_dev;
     uint8_t location_fun;
 
-    /* Per-byte device config space virtualisation mode. */
+    /* Virtual PCI space this device was assigned from, if any, whose dispatch table needs
+     * rebuilding when the device is enabled or disabled. */
+    struct libpci_virtual_pci* owner;
+
+    /* Per-byte device config space virtualisation mode. Only change through set_mode. */
     libpci_vdevice_mode_t mode[PCI_CONFIG_HEADER_SIZE_BYTES];
+    /* Number of consecutive passthrough bytes starting at each offset, kept up to date
+     * by set_mode. */
+    uint8_t passthrough_run[PCI_CONFIG_HEADER_SIZE_BYTES];
     /* Which physical device to pass through. */
     libpci_device_t* physical_device_passthrough;
 
@@ -115,3 +123,6 @@ struct libpci_vdevice {
 };
 
 void libpci_vdevice_init(libpci_vdevice_t* vd);
+
+/* The default match callback: matches the device's location while it is enabled. */
+bool libpci_vdevice_match(libpci_vdevice_t* self, uint8_t bus, uint8_t dev, uint8_t fun);
@@ -13,12 +13,19 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <utils/arith.h>
+#include <utils/compile_time.h>
 #include <pci/pci.h>
 #include <pci/virtual_device.h>
 
 #define PCI_HOST_BUS_INVALID 0xFFFF
 #define PCI_INVALID_READ_VALUE 0xFFFFFFFF
 #define PCI_MAX_VDEVICES 64
+/* Slots in the dispatch table, enough to keep it at most half full with every allowed
+ * and virtual device present. Must be a power of two. */
+#define PCI_VPCI_DISPATCH_BITS 8
+#define PCI_VPCI_DISPATCH_SIZE BIT(PCI_VPCI_DISPATCH_BITS)
+compile_time_assert(vpci_dispatch_size, PCI_VPCI_DISPATCH_SIZE >= 4 * PCI_MAX_VDEVICES);
 
 /* A virtual device slot */
 typedef struct libpci_virtual_device {
@@ -27,6 +34,15 @@ typedef struct libpci_virtual_device {
     uint8_t host_fun;
 } libpci_passthrough_vdevice_t;
 
+/* Dispatch table entry for a bus/dev/fun, found by open addressing. An entry with neither a
+ * virtual device nor allowed set is empty. */
+typedef struct libpci_vpci_dispatch {
+    uint16_t bdf;
+    /* index + 1 of the first enabled virtual device at this location, or 0 */
+    uint8_t vdevice;
+    bool allowed;
+} libpci_vpci_dispatch_t;
+
 struct libpci_virtual_pci;
 typedef struct libpci_virtual_pci libpci_virtual_pci_t;
 
@@ -40,6 +56,13 @@ struct libpci_virtual_pci {
     uint32_t num_virtual_devices;
     uint32_t current_addr;
 
+    /* Locations of the allowed and enabled virtual devices, rebuilt whenever either changes
+     * so that each trapped config space access is resolved in constant time. */
+    libpci_vpci_dispatch_t dispatch[PCI_VPCI_DISPATCH_SIZE];
+    /* Set when a virtual device has a match callback other than libpci_vdevice_match, in which
+     * case vdevice_check asks each device's callback in turn instead of using the table. */
+    bool custom_match;
+
     bool (*device_allow) (libpci_virtual_pci_t* self, libpci_device_t *device);
     bool (*device_allow_id) (libpci_virtual_pci_t* self, uint16_t vendor_id, uint16_t device_id);
     bool (*device_disallow) (libpci_virtual_pci_t* self, const libpci_device_t *device);
@@ -55,3 +78,8 @@ struct libpci_virtual_pci {
 };
 
 void libpci_virtual_pci_init(libpci_virtual_pci_t* vp);
+
+/* Rebuild the dispatch table. This is done automatically when devices are allowed, disallowed,
+ * resigned, enabled or disabled, and only needs calling after modifying allowed_devices, a
+ * virtual device's location or its match callback directly, other than just before enabling it. */
+void libpci_virtual_pci_rebuild(libpci_virtual_pci_t* vp);
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the BSD 2-Clause license. Note that NO WARRANTY is provided.
+ * See "LICENSE_BSD2.txt" for details.
+ *
+ * @TAG(DATA61_BSD)
+ */
+#include <assert.h>
+#include <stddef.h>
+#include <pci/ecam.h>
+#include <pci/ioreg.h>
+#include <utils/zf_log.h>
+
+#define ECAM_BUS_SHIFT 20
+#define ECAM_DEV_SHIFT 15
+#define ECAM_FUN_SHIFT 12
+
+typedef struct libpci_ecam_region {
+    uint16_t segment;
+    uint8_t bus_start;
+    uint8_t bus_end;
+    volatile uint8_t *vaddr;
+} libpci_ecam_region_t;
+
+static libpci_ecam_region_t ecam_regions[PCI_ECAM_MAX_REGIONS];
+static int ecam_num_regions = 0;
+
+/* Config space of each bus of segment 0, the segment libpci_read_reg and friends access,
+ * so that the common case is a single table lookup. */
+static volatile uint8_t *ecam_bus_base[256];
+
+int libpci_ecam_add_region(uint16_t segment, uint8_t bus_start, uint8_t bus_end, void *vaddr) {
+    if (vaddr == NULL || bus_end < bus_start) {
+        ZF_LOGE("PCI :: Invalid ECAM region for segment %d bus %d - %d", segment, bus_start, bus_end);
+        return -1;
+    }
+    if (ecam_num_regions == PCI_ECAM_MAX_REGIONS) {
+        ZF_LOGE("PCI :: Too many ECAM regions, increase PCI_ECAM_MAX_REGIONS");
+        return -1;
+    }
+    ecam_regions[ecam_num_regions++] = (libpci_ecam_region_t) {
+        .segment = segment, .bus_start = bus_start, .bus_end = bus_end, .vaddr = vaddr
+    };
+    if (segment == 0) {
+        for (int bus = bus_start; bus <= bus_end; bus++) {
+            ecam_bus_base[bus] = (volatile uint8_t*)vaddr + ((uintptr_t)(bus - bus_start) << ECAM_BUS_SHIFT);
+        }
+    }
+    return 0;
+}
+
+volatile void *libpci_ecam_addr(uint16_t segment, uint8_t bus, uint8_t dev, uint8_t fun, uint16_t reg) {
+    volatile uint8_t *base = NULL;
+    if (segment == 0) {
+        base = ecam_bus_base[bus];
+    } else {
+        for (int i = 0; i < ecam_num_regions; i++) {
+            libpci_ecam_region_t *r = &ecam_regions[i];
+            if (r->segment == segment && bus >= r->bus_start && bus <= r->bus_end) {
+                base = r->vaddr + ((uintptr_t)(bus - r->bus_start) << ECAM_BUS_SHIFT);
+                break;
+            }
+        }
+    }
+    if (base == NULL) {
+        return NULL;
+    }
+    return base + ((dev & MASK(5)) << ECAM_DEV_SHIFT | (fun & MASK(3)) << ECAM_FUN_SHIFT |
+                   (reg & MASK(12)));
+}
+
+#ifdef CONFIG_PLAT_PC99
+int libpci_ecam_init_acpi(acpi_t *acpi, ps_io_mapper_t *io_mapper) {
+    acpi_mcfg_t *mcfg = (acpi_mcfg_t*)acpi_find_region(acpi, ACPI_MCFG);
+    if (mcfg == NULL) {
+        return -1;
+    }
+    if (mcfg->header.length < sizeof(*mcfg) + sizeof(acpi_mcfg_desc_t)) {
+        return 0;
+    }
+    int added = 0;
+    for (acpi_mcfg_desc_t *desc = acpi_mcfg_desc_first(mcfg); desc != NULL;
+         desc = acpi_mcfg_desc_next(mcfg, desc)) {
+        if (desc->address == 0 || desc->bus_end < desc->bus_start) {
+            ZF_LOGW("PCI :: Ignoring invalid MCFG entry for segment %d", desc->segment);
+            continue;
+        }
+        /* The base address is that of bus 0 even if the region starts at a later bus */
+        uintptr_t paddr = desc->address + ((uintptr_t)desc->bus_start << ECAM_BUS_SHIFT);
+        size_t size = (size_t)(desc->bus_end - desc->bus_start + 1) << ECAM_BUS_SHIFT;
+        void *vaddr = ps_io_map(io_mapper, paddr, size, 0, PS_MEM_NORMAL);
+        if (vaddr == NULL) {
+            ZF_LOGE("PCI :: Failed to map ECAM region for segment %d bus %d - %d",
+                    desc->segment, desc->bus_start, desc->bus_end);
+            continue;
+        }
+        if (libpci_ecam_add_region(desc->segment, desc->bus_start, desc->bus_end, vaddr)) {
+            ps_io_unmap(io_mapper, vaddr, size);
+            continue;
+        }
+        added++;
+    }
+    return added;
+}
+#endif
+
+uint32_t libpci_read_ext_reg(uint16_t segment, uint8_t bus, uint8_t dev, uint8_t fun, uint16_t reg,
+                             uint8_t size) {
+    assert(size == 1 || size == 2 || size == 4);
+    reg &= ~(size - 1);
+    volatile void *cfg = libpci_ecam_addr(segment, bus, dev, fun, reg);
+    if (cfg) {
+        switch (size) {
+        case 1: return *(volatile uint8_t*)cfg;
+        case 2: return *(volatile uint16_t*)cfg;
+        default: return *(volatile uint32_t*)cfg;
+        }
+    }
+    if (segment != 0 || reg >= PCI_CONF_SPACE_SIZE) {
+        return 0xFFFFFFFF >> ((4 - size) * 8);
+    }
+    return libpci_read_reg(bus, dev, fun, reg, size);
+}
+
+void libpci_write_ext_reg(uint16_t segment, uint8_t bus, uint8_t dev, uint8_t fun, uint16_t reg,
+                          uint32_t val, uint8_t size) {
+    assert(size == 1 || size == 2 || size == 4);
+    reg &= ~(size - 1);
+    volatile void *cfg = libpci_ecam_addr(segment, bus, dev, fun, reg);
+    if (cfg) {
+        switch (size) {
+        case 1: *(volatile uint8_t*)cfg = val; return;
+        case 2: *(volatile uint16_t*)cfg = val; return;
+        default: *(volatile uint32_t*)cfg = val; return;
+        }
+    }
+    if (segment != 0 || reg >= PCI_CONF_SPACE_SIZE) {
+        return;
+    }
+    libpci_write_reg(bus, dev, fun, reg, val, size);
+}
@@ -11,2286 +11,4599 @@
  */
 
 // WARNING: This file is generated. DO NOT EDIT.
-// Look in include/pci/helper_gen.y instead.
+// Look in include/pci/helper_gen.py instead.
 
+#include <stddef.h>
+#include <stdint.h>
+#include <pci/gen_config.h>
 #include <pci/helper.h>
+#include <utils/arith.h>
 
-char* libpci_vendorID_str(int vid) {
-    if (vid == 0x0357) return "tttech";
-    if (vid == 0x0675) return "dynalink";
-    if (vid == 0x0871) return "berkom";
-    if (vid == 0x0e11) return "compaq";
-    if (vid == 0x1000) return "ncr";
-    if (vid == 0x1000) return "lsi_logic";
-    if (vid == 0x1002) return "ati";
-    if (vid == 0x1004) return "vlsi";
-    if (vid == 0x1005) return "adl";
-    if (vid == 0x100b) return "ns";
-    if (vid == 0x100c) return "tseng";
-    if (vid == 0x100e) return "weitek";
-    if (vid == 0x1011) return "dec";
-    if (vid == 0x1013) return "cirrus";
-    if (vid == 0x1014) return "ibm";
-    if (vid == 0x1018) return "unisys";
-    if (vid == 0x101a) return "compex2";
-    if (vid == 0x101c) return "wd";
-    if (vid == 0x101e) return "ami";
-    if (vid == 0x1022) return "amd";
-    if (vid == 0x1023) return "trident";
-    if (vid == 0x1025) return "ai";
-    if (vid == 0x1028) return "dell";
-    if (vid == 0x102B) return "matrox";
-    if (vid == 0x14f2) return "mobility_electronics";
-    if (vid == 0x102c) return "ct";
-    if (vid == 0x1031) return "miro";
-    if (vid == 0x1033) return "nec";
-    if (vid == 0x1036) return "fd";
-    if (vid == 0x1039) return "si";
-    if (vid == 0x103c) return "hp";
-    if (vid == 0x1042) return "pctech";
-    if (vid == 0x1043) return "asustek";
-    if (vid == 0x1044) return "dpt";
-    if (vid == 0x1045) return "opti";
-    if (vid == 0x1048) return "elsa";
-    if (vid == 0x104A) return "stmicro";
-    if (vid == 0x104B) return "buslogic";
-    if (vid == 0x104c) return "ti";
-    if (vid == 0x104d) return "sony";
-    if (vid == 0x1050) return "winbond2";
-    if (vid == 0x1051) return "anigma";
-    if (vid == 0x1055) return "efar";
-    if (vid == 0x1057) return "motorola";
-    if (vid == 0x105a) return "promise";
-    if (vid == 0x105b) return "foxconn";
-    if (vid == 0x1060) return "umc";
-    if (vid == 0x1066) return "picopower";
-    if (vid == 0x1069) return "mylex";
-    if (vid == 0x106b) return "apple";
-    if (vid == 0x1073) return "yamaha";
-    if (vid == 0x1077) return "qlogic";
-    if (vid == 0x1078) return "cyrix";
-    if (vid == 0x1080) return "contaq";
-    if (vid == 0x108d) return "olicom";
-    if (vid == 0x108e) return "sun";
-    if (vid == 0x1093) return "ni";
-    if (vid == 0x1095) return "cmd";
-    if (vid == 0x109e) return "brooktree";
-    if (vid == 0x10a9) return "sgi";
-    if (vid == 0x10ad) return "winbond";
-    if (vid == 0x10b5) return "plx";
-    if (vid == 0x10b6) return "madge";
-    if (vid == 0x10b7) return "3com";
-    if (vid == 0x10b9) return "al";
-    if (vid == 0x10c8) return "neomagic";
-    if (vid == 0x10da) return "tconrad";
-    if (vid == 0x10de) return "nvidia";
-    if (vid == 0x10e0) return "ims";
-    if (vid == 0x10ea) return "interg";
-    if (vid == 0x10ec) return "realtek";
-    if (vid == 0x10ee) return "xilinx";
-    if (vid == 0x1101) return "init";
-    if (vid == 0x1102) return "creative";
-    if (vid == 0x1102) return "ectiva";
-    if (vid == 0x1103) return "tti";
-    if (vid == 0x1106) return "via";
-    if (vid == 0x110A) return "siemens";
-    if (vid == 0x1119) return "vortex";
-    if (vid == 0x111a) return "ef";
-    if (vid == 0x111d) return "idt";
-    if (vid == 0x1127) return "fore";
-    if (vid == 0x1131) return "philips";
-    if (vid == 0x1133) return "eicon";
-    if (vid == 0x1137) return "cisco";
-    if (vid == 0x1138) return "ziatech";
-    if (vid == 0x1148) return "syskonnect";
-    if (vid == 0x114f) return "digi";
-    if (vid == 0x115d) return "xircom";
-    if (vid == 0x1166) return "serverworks";
-    if (vid == 0x1176) return "sbe";
-    if (vid == 0x1179) return "toshiba";
-    if (vid == 0x102f) return "toshiba_2";
-    if (vid == 0x117c) return "atto";
-    if (vid == 0x1180) return "ricoh";
-    if (vid == 0x1186) return "dlink";
-    if (vid == 0x1191) return "artop";
-    if (vid == 0x1193) return "zeitnet";
-    if (vid == 0x119e) return "fujitsu_me";
-    if (vid == 0x11ab) return "marvell";
-    if (vid == 0x1b4b) return "marvell_ext";
-    if (vid == 0x11b0) return "v3";
-    if (vid == 0x11c1) return "att";
-    if (vid == 0x11cb) return "specialix";
-    if (vid == 0x11d4) return "analog_devices";
-    if (vid == 0x11de) return "zoran";
-    if (vid == 0x11f6) return "compex";
-    if (vid == 0x11fe) return "rp";
-    if (vid == 0x120e) return "cyclades";
-    if (vid == 0x120f) return "essential";
-    if (vid == 0x1217) return "o2";
-    if (vid == 0x121a) return "3dfx";
-    if (vid == 0x1244) return "avm";
-    if (vid == 0x124d) return "stallion";
-    if (vid == 0x1259) return "at";
-    if (vid == 0x125d) return "ess";
-    if (vid == 0x1267) return "satsagem";
-    if (vid == 0x1274) return "ensoniq";
-    if (vid == 0x1279) return "transmeta";
-    if (vid == 0x127A) return "rockwell";
-    if (vid == 0x1283) return "ite";
-    if (vid == 0x12ae) return "alteon";
-    if (vid == 0x12d2) return "nvidia_sgs";
-    if (vid == 0x12eb) return "aureal";
-    if (vid == 0x12f8) return "electronicdesigngmbh";
-    if (vid == 0x12fe) return "esdgmbh";
-    if (vid == 0x1307) return "cb";
-    if (vid == 0x131f) return "siig";
-    if (vid == 0x1331) return "radisys";
-    if (vid == 0x1332) return "micro_memory";
-    if (vid == 0x134a) return "domex";
-    if (vid == 0x135a) return "intashield";
-    if (vid == 0x135C) return "quatech";
-    if (vid == 0x135e) return "sealevel";
-    if (vid == 0x1365) return "hypercope";
-    if (vid == 0x1369) return "digigram";
-    if (vid == 0x136b) return "kawasaki";
-    if (vid == 0x1371) return "cnet";
-    if (vid == 0x1376) return "lmc";
-    if (vid == 0x1385) return "netgear";
-    if (vid == 0x1389) return "applicom";
-    if (vid == 0x1393) return "moxa";
-    if (vid == 0x1397) return "ccd";
-    if (vid == 0x13a8) return "exar";
-    if (vid == 0x13c0) return "microgate";
-    if (vid == 0x13C1) return "3ware";
-    if (vid == 0x13ca) return "iomega";
-    if (vid == 0x13D1) return "abocom";
-    if (vid == 0x13f0) return "sundance";
-    if (vid == 0x13f6) return "cmedia";
-    if (vid == 0x13fe) return "advantech";
-    if (vid == 0x1402) return "meilhaus";
-    if (vid == 0x1407) return "lava";
-    if (vid == 0x1409) return "timedia";
-    if (vid == 0x1412) return "ice";
-    if (vid == 0x1415) return "oxsemi";
-    if (vid == 0x1425) return "chelsio";
-    if (vid == 0x144a) return "adlink";
-    if (vid == 0x144d) return "samsung";
-    if (vid == 0x1458) return "gigabyte";
-    if (vid == 0x1468) return "ambit";
-    if (vid == 0x14c1) return "myricom";
-    if (vid == 0x14D2) return "titan";
-    if (vid == 0x14d4) return "panacom";
-    if (vid == 0x14d9) return "sipackets";
-    if (vid == 0x14db) return "afavlab";
-    if (vid == 0x14dc) return "amplicon";
-    if (vid == 0x14a4) return "bcm_gvc";
-    if (vid == 0x14e4) return "broadcom";
-    if (vid == 0x151f) return "topic";
-    if (vid == 0x1522) return "mainpine";
-    if (vid == 0x1524) return "ene";
-    if (vid == 0x1592) return "syba";
-    if (vid == 0x15aa) return "moreton";
-    if (vid == 0x15b0) return "zoltrix";
-    if (vid == 0x15b3) return "mellanox";
-    if (vid == 0x15bd) return "dfi";
-    if (vid == 0x15e2) return "quicknet";
-    if (vid == 0x10E8) return "addidata_old";
-    if (vid == 0x15B8) return "addidata";
-    if (vid == 0x15e9) return "pdc";
-    if (vid == 0x1619) return "farsite";
-    if (vid == 0x161f) return "arima";
-    if (vid == 0x1657) return "brocade";
-    if (vid == 0x166d) return "sibyte";
-    if (vid == 0x168c) return "atheros";
-    if (vid == 0x169c) return "netcell";
-    if (vid == 0x16CA) return "cenatek";
-    if (vid == 0x1725) return "vitesse";
-    if (vid == 0x1737) return "linksys";
-    if (vid == 0x173b) return "altima";
-    if (vid == 0x1799) return "belkin";
-    if (vid == 0x17f3) return "rdc";
-    if (vid == 0x17aa) return "lenovo";
-    if (vid == 0x17d3) return "areca";
-    if (vid == 0x17d5) return "s2io";
-    if (vid == 0x182d) return "sitecom";
-    if (vid == 0x1867) return "topspin";
-    if (vid == 0x18f7) return "commtech";
-    if (vid == 0x1904) return "silan";
-    if (vid == 0x1912) return "renesas";
-    if (vid == 0x1924) return "solarflare";
-    if (vid == 0x192E) return "tdi";
-    if (vid == 0x1957) return "freescale";
-    if (vid == 0x1959) return "pasemi";
-    if (vid == 0x1969) return "attansic";
-    if (vid == 0x197B) return "jmicron";
-    if (vid == 0x1982) return "korenix";
-    if (vid == 0x1a32) return "qmi";
-    if (vid == 0x1a3b) return "azwave";
-    if (vid == 0x1b21) return "asmedia";
-    if (vid == 0x1cc8) return "circuitco";
-    if (vid == 0x1de1) return "tekram";
-    if (vid == 0x1fc9) return "tehuti";
-    if (vid == 0x3388) return "hint";
-    if (vid == 0x3d3d) return "3dlabs";
-    if (vid == 0x4040) return "netxen";
-    if (vid == 0x416c) return "aks";
-    if (vid == 0x494f) return "accessio";
-    if (vid == 0x5333) return "s3";
-    if (vid == 0x5544) return "dunord";
-    if (vid == 0x6666) return "dci";
-    if (vid == 0x8086) return "intel";
-    if (vid == 0x8686) return "scalemp";
-    if (vid == 0x8e0e) return "computone";
-    if (vid == 0x8e2e) return "kti";
-    if (vid == 0x9004) return "adaptec";
-    if (vid == 0x9005) return "adaptec2";
-    if (vid == 0x9412) return "holtek";
-    if (vid == 0x9710) return "netmos";
-    if (vid == 0xa727) return "3com_2";
-    if (vid == 0xd161) return "digium";
-    if (vid == 0xe159) return "tigerjet";
-    if (vid == 0xea60) return "xilinx_rme";
-    if (vid == 0x5853) return "xen";
-    if (vid == 0x1b85) return "ocz";
-    if (vid == 0x15ad) return "vmware";
-    if (vid == 0xffff) return "invalid";
+#ifdef CONFIG_LIB_PCI_NAMES
+
+typedef struct libpci_name_entry {
+    uint32_t key;
+    uint32_t name;
+} libpci_name_entry_t;
+
+static const libpci_name_entry_t vendor_names[] = {
+    { 0x00000357, 0 },
+    { 0x00000675, 7 },
+    { 0x00000871, 16 },
+    { 0x00000e11, 23 },
+    { 0x00001000, 30 },
+    { 0x00001002, 34 },
+    { 0x00001004, 38 },
+    { 0x00001005, 43 },
+    { 0x0000100b, 47 },
+    { 0x0000100c, 50 },
+    { 0x0000100e, 56 },
+    { 0x00001011, 63 },
+    { 0x00001013, 67 },
+    { 0x00001014, 74 },
+    { 0x00001018, 78 },
+    { 0x0000101a, 85 },
+    { 0x0000101c, 93 },
+    { 0x0000101e, 96 },
+    { 0x00001022, 100 },
+    { 0x00001023, 104 },
+    { 0x00001025, 112 },
+    { 0x00001028, 115 },
+    { 0x0000102b, 120 },
+    { 0x0000102c, 127 },
+    { 0x0000102f, 130 },
+    { 0x00001031, 140 },
+    { 0x00001033, 145 },
+    { 0x00001036, 149 },
+    { 0x00001039, 152 },
+    { 0x0000103c, 155 },
+    { 0x00001042, 158 },
+    { 0x00001043, 165 },
+    { 0x00001044, 173 },
+    { 0x00001045, 177 },
+    { 0x00001048, 182 },
+    { 0x0000104a, 187 },
+    { 0x0000104b, 195 },
+    { 0x0000104c, 204 },
+    { 0x0000104d, 207 },
+    { 0x00001050, 212 },
+    { 0x00001051, 221 },
+    { 0x00001055, 228 },
+    { 0x00001057, 233 },
+    { 0x0000105a, 242 },
+    { 0x0000105b, 250 },
+    { 0x00001060, 258 },
+    { 0x00001066, 262 },
+    { 0x00001069, 272 },
+    { 0x0000106b, 278 },
+    { 0x00001073, 284 },
+    { 0x00001077, 291 },
+    { 0x00001078, 298 },
+    { 0x00001080, 304 },
+    { 0x0000108d, 311 },
+    { 0x0000108e, 318 },
+    { 0x00001093, 322 },
+    { 0x00001095, 325 },
+    { 0x0000109e, 329 },
+    { 0x000010a9, 339 },
+    { 0x000010ad, 343 },
+    { 0x000010b5, 351 },
+    { 0x000010b6, 355 },
+    { 0x000010b7, 361 },
+    { 0x000010b9, 366 },
+    { 0x000010c8, 369 },
+    { 0x000010da, 378 },
+    { 0x000010de, 386 },
+    { 0x000010e0, 393 },
+    { 0x000010e8, 397 },
+    { 0x000010ea, 410 },
+    { 0x000010ec, 417 },
+    { 0x000010ee, 425 },
+    { 0x00001101, 432 },
+    { 0x00001102, 437 },
+    { 0x00001103, 446 },
+    { 0x00001106, 450 },
+    { 0x0000110a, 454 },
+    { 0x00001119, 462 },
+    { 0x0000111a, 469 },
+    { 0x0000111d, 472 },
+    { 0x00001127, 476 },
+    { 0x00001131, 481 },
+    { 0x00001133, 489 },
+    { 0x00001137, 495 },
+    { 0x00001138, 501 },
+    { 0x00001148, 509 },
+    { 0x0000114f, 520 },
+    { 0x0000115d, 525 },
+    { 0x00001166, 532 },
+    { 0x00001176, 544 },
+    { 0x00001179, 548 },
+    { 0x0000117c, 556 },
+    { 0x00001180, 561 },
+    { 0x00001186, 567 },
+    { 0x00001191, 573 },
+    { 0x00001193, 579 },
+    { 0x0000119e, 587 },
+    { 0x000011ab, 598 },
+    { 0x000011b0, 606 },
+    { 0x000011c1, 609 },
+    { 0x000011cb, 613 },
+    { 0x000011d4, 623 },
+    { 0x000011de, 638 },
+    { 0x000011f6, 644 },
+    { 0x000011fe, 651 },
+    { 0x0000120e, 654 },
+    { 0x0000120f, 663 },
+    { 0x00001217, 673 },
+    { 0x0000121a, 676 },
+    { 0x00001244, 681 },
+    { 0x0000124d, 685 },
+    { 0x00001259, 694 },
+    { 0x0000125d, 697 },
+    { 0x00001267, 701 },
+    { 0x00001274, 710 },
+    { 0x00001279, 718 },
+    { 0x0000127a, 728 },
+    { 0x00001283, 737 },
+    { 0x000012ae, 741 },
+    { 0x000012d2, 748 },
+    { 0x000012eb, 759 },
+    { 0x000012f8, 766 },
+    { 0x000012fe, 787 },
+    { 0x00001307, 795 },
+    { 0x0000131f, 798 },
+    { 0x00001331, 803 },
+    { 0x00001332, 811 },
+    { 0x0000134a, 824 },
+    { 0x0000135a, 830 },
+    { 0x0000135c, 841 },
+    { 0x0000135e, 849 },
+    { 0x00001365, 858 },
+    { 0x00001369, 868 },
+    { 0x0000136b, 877 },
+    { 0x00001371, 886 },
+    { 0x00001376, 891 },
+    { 0x00001385, 895 },
+    { 0x00001389, 903 },
+    { 0x00001393, 912 },
+    { 0x00001397, 917 },
+    { 0x000013a8, 921 },
+    { 0x000013c0, 926 },
+    { 0x000013c1, 936 },
+    { 0x000013ca, 942 },
+    { 0x000013d1, 949 },
+    { 0x000013f0, 956 },
+    { 0x000013f6, 965 },
+    { 0x000013fe, 972 },
+    { 0x00001402, 982 },
+    { 0x00001407, 991 },
+    { 0x00001409, 996 },
+    { 0x00001412, 1004 },
+    { 0x00001415, 1008 },
+    { 0x00001425, 1015 },
+    { 0x0000144a, 1023 },
+    { 0x0000144d, 1030 },
+    { 0x00001458, 1038 },
+    { 0x00001468, 1047 },
+    { 0x000014a4, 1053 },
+    { 0x000014c1, 1061 },
+    { 0x000014d2, 1069 },
+    { 0x000014d4, 1075 },
+    { 0x000014d9, 1083 },
+    { 0x000014db, 1093 },
+    { 0x000014dc, 1101 },
+    { 0x000014e4, 1110 },
+    { 0x000014f2, 1119 },
+    { 0x0000151f, 1140 },
+    { 0x00001522, 1146 },
+    { 0x00001524, 1155 },
+    { 0x00001592, 1159 },
+    { 0x000015aa, 1164 },
+    { 0x000015ad, 1172 },
+    { 0x000015b0, 1179 },
+    { 0x000015b3, 1187 },
+    { 0x000015b8, 1196 },
+    { 0x000015bd, 1205 },
+    { 0x000015e2, 1209 },
+    { 0x000015e9, 1218 },
+    { 0x00001619, 1222 },
+    { 0x0000161f, 1230 },
+    { 0x00001657, 1236 },
+    { 0x0000166d, 1244 },
+    { 0x0000168c, 1251 },
+    { 0x0000169c, 1259 },
+    { 0x000016ca, 1267 },
+    { 0x00001725, 1275 },
+    { 0x00001737, 1283 },
+    { 0x0000173b, 1291 },
+    { 0x00001799, 1298 },
+    { 0x000017aa, 1305 },
+    { 0x000017d3, 1312 },
+    { 0x000017d5, 1318 },
+    { 0x000017f3, 1323 },
+    { 0x0000182d, 1327 },
+    { 0x00001867, 1335 },
+    { 0x000018f7, 1343 },
+    { 0x00001904, 1352 },
+    { 0x00001912, 1358 },
+    { 0x00001924, 1366 },
+    { 0x0000192e, 1377 },
+    { 0x00001957, 1381 },
+    { 0x00001959, 1391 },
+    { 0x00001969, 1398 },
+    { 0x0000197b, 1407 },
+    { 0x00001982, 1415 },
+    { 0x00001a32, 1423 },
+    { 0x00001a3b, 1427 },
+    { 0x00001b21, 1434 },
+    { 0x00001b4b, 1442 },
+    { 0x00001b85, 1454 },
+    { 0x00001cc8, 1458 },
+    { 0x00001de1, 1468 },
+    { 0x00001fc9, 1475 },
+    { 0x00003388, 1482 },
+    { 0x00003d3d, 1487 },
+    { 0x00004040, 1494 },
+    { 0x0000416c, 1501 },
+    { 0x0000494f, 1505 },
+    { 0x00005333, 1514 },
+    { 0x00005544, 1517 },
+    { 0x00005853, 1524 },
+    { 0x00006666, 1528 },
+    { 0x00008086, 1532 },
+    { 0x00008686, 1538 },
+    { 0x00008e0e, 1546 },
+    { 0x00008e2e, 1556 },
+    { 0x00009004, 1560 },
+    { 0x00009005, 1568 },
+    { 0x00009412, 1577 },
+    { 0x00009710, 1584 },
+    { 0x0000a727, 1591 },
+    { 0x0000d161, 1598 },
+    { 0x0000e159, 1605 },
+    { 0x0000ea60, 1614 },
+    { 0x0000ffff, 1625 },
+};
+
+static const libpci_name_entry_t device_names[] = {
+    { 0x0357000a, 1633 },
+    { 0x06751702, 1646 },
+    { 0x0871ffa1, 1662 },
+    { 0x0871ffa2, 1673 },
+    { 0x0871ffa4, 1690 },
+    { 0x0871ffa8, 1701 },
+    { 0x0e110046, 1722 },
+    { 0x0e110508, 1735 },
+    { 0x0e11a0fc, 1752 },
+    { 0x0e11ae10, 1767 },
+    { 0x0e11ae32, 1782 },
+    { 0x0e11ae33, 1798 },
+    { 0x0e11ae34, 1817 },
+    { 0x0e11ae35, 1832 },
+    { 0x0e11ae40, 1849 },
+    { 0x0e11ae43, 1866 },
+    { 0x0e11b011, 1884 },
+    { 0x0e11b060, 1901 },
+    { 0x0e11b178, 1913 },
+    { 0x0e11f130, 1926 },
+    { 0x0e11f150, 1941 },
+    { 0x10000001, 1958 },
+    { 0x10000002, 1969 },
+    { 0x10000003, 1980 },
+    { 0x10000004, 1991 },
+    { 0x10000005, 2002 },
+    { 0x10000006, 2015 },
+    { 0x1000000a, 2026 },
+    { 0x1000000b, 2038 },
+    { 0x1000000c, 2049 },
+    { 0x1000000d, 2060 },
+    { 0x1000000f, 2071 },
+    { 0x10000010, 2082 },
+    { 0x10000012, 2094 },
+    { 0x10000013, 2106 },
+    { 0x10000020, 2118 },
+    { 0x10000021, 2133 },
+    { 0x10000030, 2148 },
+    { 0x10000032, 2160 },
+    { 0x10000040, 2177 },
+    { 0x10000050, 2189 },
+    { 0x10000054, 2201 },
+    { 0x10000056, 2213 },
+    { 0x10000058, 2226 },
+    { 0x1000005a, 2239 },
+    { 0x1000005c, 2252 },
+    { 0x1000005e, 2265 },
+    { 0x10000060, 2277 },
+    { 0x1000008f, 2289 },
+    { 0x10000411, 2301 },
+    { 0x10000621, 2314 },
+    { 0x10000622, 2324 },
+    { 0x10000623, 2334 },
+    { 0x10000624, 2348 },
+    { 0x10000625, 2358 },
+    { 0x10000626, 2372 },
+    { 0x10000628, 2383 },
+    { 0x10000640, 2394 },
+    { 0x10000642, 2405 },
+    { 0x10000646, 2416 },
+    { 0x10000701, 2428 },
+    { 0x10000901, 2442 },
+    { 0x10001000, 2453 },
+    { 0x10024158, 2464 },
+    { 0x10024242, 2474 },
+    { 0x10024349, 2488 },
+    { 0x10024353, 2503 },
+    { 0x10024354, 2520 },
+    { 0x10024358, 2533 },
+    { 0x10024363, 2546 },
+    { 0x10024369, 2563 },
+    { 0x1002436e, 2578 },
+    { 0x10024372, 2594 },
+    { 0x10024376, 2611 },
+    { 0x10024379, 2626 },
+    { 0x1002437a, 2642 },
+    { 0x10024380, 2659 },
+    { 0x10024385, 2675 },
+    { 0x1002438c, 2691 },
+    { 0x10024390, 2706 },
+    { 0x1002439c, 2722 },
+    { 0x10024554, 2737 },
+    { 0x10024742, 2750 },
+    { 0x10024744, 2760 },
+    { 0x10024749, 2770 },
+    { 0x10024750, 2780 },
+    { 0x10024751, 2790 },
+    { 0x10024752, 2800 },
+    { 0x10024754, 2810 },
+    { 0x10024755, 2820 },
+    { 0x10024756, 2831 },
+    { 0x10024757, 2842 },
+    { 0x10024758, 2853 },
+    { 0x1002475a, 2866 },
+    { 0x10024c42, 2877 },
+    { 0x10024c44, 2888 },
+    { 0x10024c45, 2899 },
+    { 0x10024c46, 2914 },
+    { 0x10024c47, 2929 },
+    { 0x10024c49, 2940 },
+    { 0x10024c4d, 2951 },
+    { 0x10024c4e, 2962 },
+    { 0x10024c52, 2973 },
+    { 0x10024c53, 2984 },
+    { 0x10024c54, 2995 },
+    { 0x10024c57, 3006 },
+    { 0x10024c58, 3020 },
+    { 0x10024c59, 3034 },
+    { 0x10024c5a, 3048 },
+    { 0x10024d46, 3062 },
+    { 0x10024d4c, 3077 },
+    { 0x10024e44, 3092 },
+    { 0x10024e45, 3106 },
+    { 0x10024e46, 3120 },
+    { 0x10024e47, 3134 },
+    { 0x10025041, 3148 },
+    { 0x10025042, 3163 },
+    { 0x10025043, 3178 },
+    { 0x10025044, 3193 },
+    { 0x10025045, 3208 },
+    { 0x10025046, 3223 },
+    { 0x10025047, 3238 },
+    { 0x10025048, 3253 },
+    { 0x10025049, 3268 },
+    { 0x1002504a, 3283 },
+    { 0x1002504b, 3298 },
+    { 0x1002504c, 3313 },
+    { 0x1002504d, 3328 },
+    { 0x1002504e, 3343 },
+    { 0x1002504f, 3358 },
+    { 0x10025050, 3373 },
+    { 0x10025051, 3388 },
+    { 0x10025052, 3403 },
+    { 0x10025053, 3418 },
+    { 0x10025054, 3433 },
+    { 0x10025055, 3448 },
+    { 0x10025056, 3463 },
+    { 0x10025057, 3478 },
+    { 0x10025058, 3493 },
+    { 0x10025144, 3508 },
+    { 0x10025145, 3522 },
+    { 0x10025146, 3536 },
+    { 0x10025147, 3550 },
+    { 0x1002514c, 3564 },
+    { 0x1002514d, 3578 },
+    { 0x1002514e, 3592 },
+    { 0x1002514f, 3606 },
+    { 0x10025157, 3620 },
+    { 0x10025158, 3634 },
+    { 0x10025159, 3648 },
+    { 0x1002515a, 3662 },
+    { 0x10025245, 3676 },
+    { 0x10025246, 3691 },
+    { 0x10025247, 3706 },
+    { 0x1002524b, 3721 },
+    { 0x1002524c, 3736 },
+    { 0x10025345, 3751 },
+    { 0x10025346, 3766 },
+    { 0x10025347, 3781 },
+    { 0x10025348, 3796 },
+    { 0x1002534b, 3811 },
+    { 0x1002534c, 3826 },
+    { 0x1002534d, 3841 },
+    { 0x1002534e, 3856 },
+    { 0x10025446, 3871 },
+    { 0x1002544c, 3886 },
+    { 0x10025452, 3901 },
+    { 0x10025453, 3916 },
+    { 0x10025454, 3931 },
+    { 0x10025455, 3946 },
+    { 0x10025654, 3961 },
+    { 0x10025655, 3971 },
+    { 0x10025656, 3981 },
+    { 0x10025830, 3991 },
+    { 0x10025831, 4005 },
+    { 0x10025832, 4019 },
+    { 0x10025833, 4033 },
+    { 0x10025950, 4047 },
+    { 0x10025a30, 4057 },
+    { 0x10025a31, 4071 },
+    { 0x10025a32, 4085 },
+    { 0x10025a33, 4099 },
+    { 0x10027830, 4113 },
+    { 0x10027831, 4127 },
+    { 0x10027832, 4141 },
+    { 0x10027833, 4155 },
+    { 0x1002cab0, 4169 },
+    { 0x1002cab2, 4179 },
+    { 0x1002cab3, 4189 },
+    { 0x1002cbb2, 4199 },
+    { 0x10040005, 4211 },
+    { 0x10040006, 4223 },
+    { 0x10040007, 4235 },
+    { 0x10040009, 4247 },
+    { 0x1004000c, 4259 },
+    { 0x1004000d, 4271 },
+    { 0x10040101, 4283 },
+    { 0x10040102, 4295 },
+    { 0x10040104, 4307 },
+    { 0x10040105, 4319 },
+    { 0x10040702, 4331 },
+    { 0x10045a23, 4345 },
+    { 0x10052301, 4357 },
+    { 0x100b0002, 4366 },
+    { 0x100b000e, 4375 },
+    { 0x100b0012, 4388 },
+    { 0x100b0020, 4401 },
+    { 0x100b0022, 4410 },
+    { 0x100b0028, 4419 },
+    { 0x100b002b, 4437 },
+    { 0x100b002d, 4451 },
+    { 0x100b002e, 4465 },
+    { 0x100b002f, 4481 },
+    { 0x100b0030, 4495 },
+    { 0x100b0035, 4507 },
+    { 0x100b0510, 4517 },
+    { 0x100b0511, 4534 },
+    { 0x100b0515, 4548 },
+    { 0x100bd001, 4563 },
+    { 0x100c3202, 4572 },
+    { 0x100c3208, 4585 },
+    { 0x100e9001, 4598 },
+    { 0x100e9100, 4611 },
+    { 0x10110001, 4624 },
+    { 0x10110002, 4632 },
+    { 0x10110004, 4642 },
+    { 0x10110009, 4650 },
+    { 0x1011000d, 4665 },
+    { 0x1011000f, 4674 },
+    { 0x10110014, 4683 },
+    { 0x10110019, 4698 },
+    { 0x10110021, 4708 },
+    { 0x10110022, 4718 },
+    { 0x10110024, 4728 },
+    { 0x10110025, 4738 },
+    { 0x10110026, 4748 },
+    { 0x10110046, 4758 },
+    { 0x10111065, 4770 },
+    { 0x10130038, 4780 },
+    { 0x101300a0, 4792 },
+    { 0x101300a4, 4804 },
+    { 0x101300a8, 4818 },
+    { 0x101300ac, 4832 },
+    { 0x101300b8, 4844 },
+    { 0x101300bc, 4856 },
+    { 0x101300d0, 4868 },
+    { 0x101300d4, 4880 },
+    { 0x101300d6, 4892 },
+    { 0x10131100, 4904 },
+    { 0x10131110, 4916 },
+    { 0x10131202, 4928 },
+    { 0x10136001, 4940 },
+    { 0x10136003, 4952 },
+    { 0x10136004, 4964 },
+    { 0x10140018, 4976 },
+    { 0x10140031, 4983 },
+    { 0x1014003e, 5001 },
+    { 0x101400fc, 5013 },
+    { 0x10140180, 5030 },
+    { 0x10140219, 5040 },
+    { 0x1014021a, 5058 },
+    { 0x10140251, 5084 },
+    { 0x10140252, 5122 },
+    { 0x1014028c, 5147 },
+    { 0x101402bd, 5159 },
+    { 0x10140361, 5172 },
+    { 0x1014b166, 5215 },
+    { 0x1018001c, 5228 },
+    { 0x101a0005, 5248 },
+    { 0x101cc24a, 5262 },
+    { 0x101e1960, 5269 },
+    { 0x101e9010, 5283 },
+    { 0x101e9060, 5296 },
+    { 0x10221100, 5310 },
+    { 0x10221101, 5320 },
+    { 0x10221102, 5338 },
+    { 0x10221103, 5355 },
+    { 0x10221200, 5370 },
+    { 0x10221201, 5384 },
+    { 0x10221202, 5399 },
+    { 0x10221203, 5415 },
+    { 0x10221204, 5431 },
+    { 0x10221300, 5447 },
+    { 0x10221301, 5461 },
+    { 0x10221302, 5476 },
+    { 0x10221303, 5492 },
+    { 0x10221304, 5508 },
+    { 0x10221403, 5524 },
+    { 0x10221533, 5540 },
+    { 0x10221534, 5554 },
+    { 0x10221600, 5568 },
+    { 0x10221601, 5582 },
+    { 0x10221602, 5596 },
+    { 0x10221603, 5610 },
+    { 0x10221604, 5624 },
+    { 0x10221605, 5638 },
+    { 0x10221703, 5652 },
+    { 0x10222000, 5666 },
+    { 0x10222001, 5676 },
+    { 0x10222020, 5691 },
+    { 0x10222081, 5700 },
+    { 0x10222082, 5713 },
+    { 0x1022208f, 5724 },
+    { 0x10222090, 5739 },
+    { 0x10222091, 5754 },
+    { 0x10222093, 5771 },
+    { 0x10222094, 5788 },
+    { 0x10222095, 5803 },
+    { 0x10222096, 5818 },
+    { 0x10222097, 5833 },
+    { 0x1022209a, 5848 },
+    { 0x102236c0, 5863 },
+    { 0x10227006, 5876 },
+    { 0x10227007, 5893 },
+    { 0x1022700c, 5910 },
+    { 0x1022700e, 5927 },
+    { 0x10227401, 5944 },
+    { 0x10227409, 5959 },
+    { 0x1022740b, 5974 },
+    { 0x10227410, 5989 },
+    { 0x10227411, 6004 },
+    { 0x10227413, 6019 },
+    { 0x10227440, 6034 },
+    { 0x10227441, 6049 },
+    { 0x10227443, 6063 },
+    { 0x10227445, 6077 },
+    { 0x10227450, 6091 },
+    { 0x10227451, 6107 },
+    { 0x10227454, 6121 },
+    { 0x10227458, 6132 },
+    { 0x10227460, 6148 },
+    { 0x10227468, 6161 },
+    { 0x10227469, 6174 },
+    { 0x1022746a, 6187 },
+    { 0x1022746b, 6203 },
+    { 0x1022746d, 6218 },
+    { 0x10227800, 6233 },
+    { 0x1022780b, 6254 },
+    { 0x1022780c, 6272 },
+    { 0x10232000, 6288 },
+    { 0x10232001, 6306 },
+    { 0x10238400, 6324 },
+    { 0x10238420, 6337 },
+    { 0x10238500, 6350 },
+    { 0x10239320, 6363 },
+    { 0x10239388, 6376 },
+    { 0x10239397, 6389 },
+    { 0x1023939a, 6402 },
+    { 0x10239420, 6415 },
+    { 0x10239440, 6428 },
+    { 0x10239520, 6441 },
+    { 0x10239525, 6454 },
+    { 0x10239660, 6467 },
+    { 0x10239750, 6480 },
+    { 0x10239850, 6493 },
+    { 0x10239880, 6506 },
+    { 0x10251435, 6519 },
+    { 0x10280008, 6528 },
+    { 0x10280012, 6540 },
+    { 0x10280015, 6550 },
+    { 0x102b0518, 6561 },
+    { 0x102b0519, 6574 },
+    { 0x102b051a, 6585 },
+    { 0x102b051b, 6596 },
+    { 0x102b051e, 6609 },
+    { 0x102b051f, 6624 },
+    { 0x102b0520, 6641 },
+    { 0x102b0521, 6657 },
+    { 0x102b0525, 6673 },
+    { 0x102b0530, 6685 },
+    { 0x102b0d10, 6703 },
+    { 0x102b1000, 6718 },
+    { 0x102b1001, 6733 },
+    { 0x102b2527, 6749 },
+    { 0x102b4536, 6761 },
+    { 0x102c00c0, 6772 },
+    { 0x102c00d8, 6781 },
+    { 0x102c00dc, 6790 },
+    { 0x102c00e0, 6799 },
+    { 0x102c00e4, 6808 },
+    { 0x102c00e5, 6817 },
+    { 0x102f0030, 6826 },
+    { 0x102f0031, 6844 },
+    { 0x102f0032, 6864 },
+    { 0x102f0105, 6887 },
+    { 0x102f0108, 6908 },
+    { 0x102f01b3, 6930 },
+    { 0x10315601, 6949 },
+    { 0x10317efe, 6960 },
+    { 0x1031d801, 6974 },
+    { 0x10330001, 6988 },
+    { 0x10330002, 6999 },
+    { 0x10330003, 7009 },
+    { 0x10330004, 7017 },
+    { 0x10330005, 7027 },
+    { 0x10330006, 7035 },
+    { 0x10330007, 7047 },
+    { 0x10330008, 7057 },
+    { 0x10330009, 7069 },
+    { 0x10330016, 7079 },
+    { 0x1033002c, 7086 },
+    { 0x1033002d, 7101 },
+    { 0x10330035, 7112 },
+    { 0x1033003b, 7120 },
+    { 0x1033003e, 7131 },
+    { 0x10330046, 7144 },
+    { 0x1033009b, 7153 },
+    { 0x103300a5, 7165 },
+    { 0x103300a6, 7177 },
+    { 0x1033800c, 7194 },
+    { 0x1033800d, 7209 },
+    { 0x10360000, 7225 },
+    { 0x10390001, 7234 },
+    { 0x10390002, 7246 },
+    { 0x10390008, 7254 },
+    { 0x10390009, 7261 },
+    { 0x10390016, 7269 },
+    { 0x10390018, 7278 },
+    { 0x10390200, 7285 },
+    { 0x10390205, 7297 },
+    { 0x10390300, 7305 },
+    { 0x10390310, 7312 },
+    { 0x10390315, 7320 },
+    { 0x10390325, 7327 },
+    { 0x10390406, 7337 },
+    { 0x10390496, 7344 },
+    { 0x10390530, 7351 },
+    { 0x10390540, 7358 },
+    { 0x10390550, 7365 },
+    { 0x10390620, 7372 },
+    { 0x10390630, 7379 },
+    { 0x10390633, 7386 },
+    { 0x10390635, 7393 },
+    { 0x10390640, 7400 },
+    { 0x10390645, 7407 },
+    { 0x10390646, 7414 },
+    { 0x10390648, 7421 },
+    { 0x10390650, 7428 },
+    { 0x10390651, 7435 },
+    { 0x10390655, 7442 },
+    { 0x10390661, 7449 },
+    { 0x10390730, 7456 },
+    { 0x10390733, 7463 },
+    { 0x10390735, 7470 },
+    { 0x10390740, 7477 },
+    { 0x10390741, 7484 },
+    { 0x10390745, 7491 },
+    { 0x10390746, 7498 },
+    { 0x10390755, 7505 },
+    { 0x10390760, 7512 },
+    { 0x10390900, 7519 },
+    { 0x10390961, 7526 },
+    { 0x10390962, 7533 },
+    { 0x10390963, 7540 },
+    { 0x10390965, 7547 },
+    { 0x10390966, 7554 },
+    { 0x10390968, 7561 },
+    { 0x10391180, 7568 },
+    { 0x10395300, 7576 },
+    { 0x10395315, 7587 },
+    { 0x10395511, 7598 },
+    { 0x10395513, 7606 },
+    { 0x10395517, 7614 },
+    { 0x10395518, 7622 },
+    { 0x10395571, 7630 },
+    { 0x10395581, 7638 },
+    { 0x10395582, 7646 },
+    { 0x10395591, 7654 },
+    { 0x10395596, 7662 },
+    { 0x10395597, 7670 },
+    { 0x10395598, 7678 },
+    { 0x10395600, 7686 },
+    { 0x10396300, 7694 },
+    { 0x10397012, 7705 },
+    { 0x10397013, 7713 },
+    { 0x10397016, 7721 },
+    { 0x10397018, 7729 },
+    { 0x103c1005, 7737 },
+    { 0x103c1006, 7753 },
+    { 0x103c1008, 7770 },
+    { 0x103c100a, 7787 },
+    { 0x103c1028, 7804 },
+    { 0x103c1029, 7815 },
+    { 0x103c1030, 7827 },
+    { 0x103c1031, 7837 },
+    { 0x103c1040, 7847 },
+    { 0x103c1042, 7857 },
+    { 0x103c1048, 7867 },
+    { 0x103c1049, 7875 },
+    { 0x103c104a, 7890 },
+    { 0x103c104b, 7905 },
+    { 0x103c108b, 7921 },
+    { 0x103c10f1, 7938 },
+    { 0x103c1223, 7949 },
+    { 0x103c1226, 7966 },
+    { 0x103c1227, 7983 },
+    { 0x103c122a, 8000 },
+    { 0x103c122e, 8011 },
+    { 0x103c127c, 8023 },
+    { 0x103c1282, 8037 },
+    { 0x103c1290, 8053 },
+    { 0x103c1301, 8065 },
+    { 0x103c132a, 8078 },
+    { 0x103c3220, 8096 },
+    { 0x103c3230, 8105 },
+    { 0x103c3238, 8114 },
+    { 0x103c323a, 8123 },
+    { 0x103c323b, 8132 },
+    { 0x103c323c, 8141 },
+    { 0x103c4031, 8150 },
+    { 0x10421000, 8161 },
+    { 0x10421001, 8175 },
+    { 0x10423020, 8189 },
+    { 0x10430675, 8208 },
+    { 0x1045c558, 8221 },
+    { 0x1045c621, 8233 },
+    { 0x1045c700, 8245 },
+    { 0x1045d568, 8257 },
+    { 0x10481000, 8269 },
+    { 0x10483000, 8284 },
+    { 0x104acc00, 8296 },
+    { 0x104acc01, 8313 },
+    { 0x104acc02, 8330 },
+    { 0x104acc03, 8346 },
+    { 0x104acc04, 8364 },
+    { 0x104acc05, 8385 },
+    { 0x104acc06, 8401 },
+    { 0x104acc07, 8414 },
+    { 0x104acc08, 8426 },
+    { 0x104acc09, 8441 },
+    { 0x104acc0a, 8453 },
+    { 0x104acc0b, 8471 },
+    { 0x104acc0c, 8484 },
+    { 0x104acc0d, 8497 },
+    { 0x104acc0e, 8509 },
+    { 0x104acc0f, 8534 },
+    { 0x104acc10, 8560 },
+    { 0x104acc11, 8586 },
+    { 0x104acc12, 8598 },
+    { 0x104acc13, 8610 },
+    { 0x104acc14, 8622 },
+    { 0x104acc15, 8639 },
+    { 0x104acc16, 8653 },
+    { 0x104b0140, 8665 },
+    { 0x104b1040, 8689 },
+    { 0x104b8130, 8710 },
+    { 0x104c3d07, 8730 },
+    { 0x104c8011, 8741 },
+    { 0x104c8031, 8749 },
+    { 0x104c8033, 8762 },
+    { 0x104c8034, 8778 },
+    { 0x104c8036, 8794 },
+    { 0x104c8039, 8802 },
+    { 0x104c803b, 8810 },
+    { 0x104c8231, 8821 },
+    { 0x104cac12, 8833 },
+    { 0x104cac13, 8841 },
+    { 0x104cac15, 8849 },
+    { 0x104cac16, 8857 },
+    { 0x104cac17, 8865 },
+    { 0x104cac19, 8873 },
+    { 0x104cac1a, 8881 },
+    { 0x104cac1b, 8889 },
+    { 0x104cac1c, 8897 },
+    { 0x104cac1d, 8905 },
+    { 0x104cac1e, 8914 },
+    { 0x104cac1f, 8922 },
+    { 0x104cac41, 8931 },
+    { 0x104cac42, 8939 },
+    { 0x104cac44, 8947 },
+    { 0x104cac46, 8955 },
+    { 0x104cac47, 8963 },
+    { 0x104cac48, 8971 },
+    { 0x104cac49, 8979 },
+    { 0x104cac50, 8987 },
+    { 0x104cac51, 8995 },
+    { 0x104cac52, 9003 },
+    { 0x104cac54, 9012 },
+    { 0x104cac55, 9020 },
+    { 0x104cac56, 9028 },
+    { 0x104cac8d, 9036 },
+    { 0x104cac8e, 9044 },
+    { 0x104cac8f, 9052 },
+    { 0x10505a5a, 9063 },
+    { 0x10506692, 9080 },
+    { 0x10510100, 9094 },
+    { 0x10559130, 9110 },
+    { 0x10559463, 9126 },
+    { 0x10570001, 9142 },
+    { 0x10570002, 9158 },
+    { 0x10570004, 9174 },
+    { 0x10574801, 9190 },
+    { 0x10574802, 9205 },
+    { 0x10574803, 9221 },
+    { 0x1057480b, 9235 },
+    { 0x10575803, 9252 },
+    { 0x10575809, 9269 },
+    { 0x105a0d30, 9287 },
+    { 0x105a0d38, 9301 },
+    { 0x105a1275, 9315 },
+    { 0x105a4d30, 9329 },
+    { 0x105a4d33, 9343 },
+    { 0x105a4d38, 9357 },
+    { 0x105a4d68, 9371 },
+    { 0x105a4d69, 9385 },
+    { 0x105a5275, 9399 },
+    { 0x105a6268, 9413 },
+    { 0x105a6269, 9427 },
+    { 0x105a7275, 9441 },
+    { 0x10600101, 9455 },
+    { 0x1060673a, 9467 },
+    { 0x1060886a, 9480 },
+    { 0x10660002, 9492 },
+    { 0x10668002, 9511 },
+    { 0x10690001, 9533 },
+    { 0x10690002, 9548 },
+    { 0x10690010, 9564 },
+    { 0x10690020, 9580 },
+    { 0x10690050, 9596 },
+    { 0x1069b166, 9612 },
+    { 0x1069ba56, 9629 },
+    { 0x106b0001, 9645 },
+    { 0x106b000e, 9658 },
+    { 0x106b0018, 9670 },
+    { 0x106b0020, 9685 },
+    { 0x106b0021, 9701 },
+    { 0x106b0024, 9718 },
+    { 0x106b0027, 9736 },
+    { 0x106b002d, 9754 },
+    { 0x106b002e, 9772 },
+    { 0x106b0032, 9790 },
+    { 0x106b0033, 9808 },
+    { 0x106b0034, 9824 },
+    { 0x106b003b, 9841 },
+    { 0x106b0043, 9859 },
+    { 0x106b004b, 9875 },
+    { 0x106b004c, 9888 },
+    { 0x106b0050, 9902 },
+    { 0x106b0051, 9915 },
+    { 0x106b0058, 9931 },
+    { 0x106b0059, 9945 },
+    { 0x106b005b, 9959 },
+    { 0x106b0066, 9973 },
+    { 0x106b0069, 9989 },
+    { 0x106b006a, 10005 },
+    { 0x106b006b, 10020 },
+    { 0x106b1645, 10037 },
+    { 0x10730004, 10050 },
+    { 0x1073000a, 10061 },
+    { 0x1073000c, 10072 },
+    { 0x1073000d, 10084 },
+    { 0x10730010, 10096 },
+    { 0x10730012, 10107 },
+    { 0x10771016, 10118 },
+    { 0x10771020, 10134 },
+    { 0x10771080, 10149 },
+    { 0x10771216, 10164 },
+    { 0x10771240, 10180 },
+    { 0x10771280, 10195 },
+    { 0x10772100, 10210 },
+    { 0x10772200, 10225 },
+    { 0x10772300, 10240 },
+    { 0x10772312, 10255 },
+    { 0x10772322, 10270 },
+    { 0x10772422, 10285 },
+    { 0x10772432, 10300 },
+    { 0x10772512, 10315 },
+    { 0x10772522, 10330 },
+    { 0x10775422, 10345 },
+    { 0x10775432, 10360 },
+    { 0x10776312, 10375 },
+    { 0x10776322, 10390 },
+    { 0x10780000, 10405 },
+    { 0x10780001, 10416 },
+    { 0x10780002, 10433 },
+    { 0x10780100, 10444 },
+    { 0x10780102, 10462 },
+    { 0x10780103, 10477 },
+    { 0x10780104, 10494 },
+    { 0x1080c693, 10511 },
+    { 0x108d0012, 10525 },
+    { 0x108d0013, 10539 },
+    { 0x108d0014, 10553 },
+    { 0x108e1000, 10567 },
+    { 0x108e1001, 10576 },
+    { 0x108e1100, 10590 },
+    { 0x108e1101, 10603 },
+    { 0x108e1102, 10615 },
+    { 0x108e1103, 10628 },
+    { 0x108e2bad, 10640 },
+    { 0x108e5000, 10648 },
+    { 0x108e8000, 10658 },
+    { 0x108e8001, 10666 },
+    { 0x108ea000, 10677 },
+    { 0x108ea001, 10687 },
+    { 0x108ea801, 10703 },
+    { 0x108eabba, 10717 },
+    { 0x10937080, 10729 },
+    { 0x109370db, 10745 },
+    { 0x109370dd, 10761 },
+    { 0x109370df, 10777 },
+    { 0x109370e2, 10793 },
+    { 0x109370e4, 10809 },
+    { 0x109370e6, 10825 },
+    { 0x109370e7, 10842 },
+    { 0x109370e8, 10859 },
+    { 0x109370ea, 10875 },
+    { 0x109370ec, 10891 },
+    { 0x109370ee, 10907 },
+    { 0x1093d130, 10923 },
+    { 0x1093d140, 10934 },
+    { 0x1093d150, 10945 },
+    { 0x1093d190, 10956 },
+    { 0x1093d1a0, 10972 },
+    { 0x1093d1d0, 10988 },
+    { 0x1093d1e0, 11004 },
+    { 0x1093d1f0, 11020 },
+    { 0x1093d1f1, 11036 },
+    { 0x1093d250, 11053 },
+    { 0x1093d270, 11065 },
+    { 0x1093d2b0, 11077 },
+    { 0x10950240, 11089 },
+    { 0x10950643, 11100 },
+    { 0x10950646, 11108 },
+    { 0x10950648, 11116 },
+    { 0x10950649, 11124 },
+    { 0x10950680, 11132 },
+    { 0x10953112, 11140 },
+    { 0x109e0878, 11149 },
+    { 0x109e0879, 11163 },
+    { 0x10a90003, 11177 },
+    { 0x10a91002, 11186 },
+    { 0x10a9100a, 11198 },
+    { 0x10ad0105, 11207 },
+    { 0x10ad0565, 11222 },
+    { 0x10b51030, 11237 },
+    { 0x10b5106a, 11246 },
+    { 0x10b51076, 11258 },
+    { 0x10b51077, 11271 },
+    { 0x10b51103, 11280 },
+    { 0x10b51151, 11293 },
+    { 0x10b51152, 11308 },
+    { 0x10b51187, 11317 },
+    { 0x10b53196, 11328 },
+    { 0x10b59030, 11342 },
+    { 0x10b59050, 11351 },
+    { 0x10b59056, 11360 },
+    { 0x10b59080, 11369 },
+    { 0x10b5a001, 11378 },
+    { 0x10b60002, 11395 },
+    { 0x10b70001, 11405 },
+    { 0x10b71700, 11416 },
+    { 0x10b73390, 11427 },
+    { 0x10b73590, 11438 },
+    { 0x10b780eb, 11449 },
+    { 0x10b79900, 11461 },
+    { 0x10b79902, 11473 },
+    { 0x10b79903, 11491 },
+    { 0x10b79904, 11509 },
+    { 0x10b79905, 11522 },
+    { 0x10b79908, 11537 },
+    { 0x10b79909, 11554 },
+    { 0x10b7990a, 11571 },
+    { 0x10b91533, 11586 },
+    { 0x10b91535, 11595 },
+    { 0x10b91541, 11604 },
+    { 0x10b91563, 11613 },
+    { 0x10b91621, 11622 },
+    { 0x10b91631, 11631 },
+    { 0x10b91632, 11640 },
+    { 0x10b91641, 11649 },
+    { 0x10b91644, 11658 },
+    { 0x10b91647, 11667 },
+    { 0x10b91651, 11676 },
+    { 0x10b91671, 11685 },
+    { 0x10b91681, 11694 },
+    { 0x10b91683, 11703 },
+    { 0x10b91689, 11712 },
+    { 0x10b95219, 11721 },
+    { 0x10b95228, 11730 },
+    { 0x10b95229, 11739 },
+    { 0x10b95451, 11748 },
+    { 0x10b97101, 11757 },
+    { 0x10c88005, 11766 },
+    { 0x10c88006, 11789 },
+    { 0x10c88016, 11812 },
+    { 0x10da0508, 11840 },
+    { 0x10de0020, 11858 },
+    { 0x10de0028, 11869 },
+    { 0x10de0029, 11881 },
+    { 0x10de002a, 11894 },
+    { 0x10de002c, 11913 },
+    { 0x10de002d, 11926 },
+    { 0x10de0034, 11940 },
+    { 0x10de0035, 11966 },
+    { 0x10de0036, 11990 },
+    { 0x10de003e, 12015 },
+    { 0x10de0040, 12041 },
+    { 0x10de0041, 12067 },
+    { 0x10de0042, 12087 },
+    { 0x10de0045, 12110 },
+    { 0x10de004e, 12133 },
+    { 0x10de0052, 12155 },
+    { 0x10de0053, 12176 },
+    { 0x10de0054, 12200 },
+    { 0x10de0055, 12225 },
+    { 0x10de0059, 12251 },
+    { 0x10de005d, 12270 },
+    { 0x10de0064, 12288 },
+    { 0x10de0065, 12309 },
+    { 0x10de0069, 12328 },
+    { 0x10de006a, 12346 },
+    { 0x10de0084, 12364 },
+    { 0x10de0085, 12386 },
+    { 0x10de0089, 12406 },
+    { 0x10de008a, 12425 },
+    { 0x10de008e, 12442 },
+    { 0x10de0090, 12463 },
+    { 0x10de0091, 12486 },
+    { 0x10de0098, 12510 },
+    { 0x10de0099, 12533 },
+    { 0x10de00a0, 12560 },
+    { 0x10de00c1, 12573 },
+    { 0x10de00c2, 12587 },
+    { 0x10de00c8, 12604 },
+    { 0x10de00c9, 12620 },
+    { 0x10de00cc, 12642 },
+    { 0x10de00ce, 12659 },
+    { 0x10de00d1, 12674 },
+    { 0x10de00d4, 12689 },
+    { 0x10de00d5, 12710 },
+    { 0x10de00d9, 12729 },
+    { 0x10de00da, 12747 },
+    { 0x10de00e1, 12765 },
+    { 0x10de00e3, 12781 },
+    { 0x10de00e4, 12802 },
+    { 0x10de00e5, 12824 },
+    { 0x10de00ea, 12844 },
+    { 0x10de00ee, 12862 },
+    { 0x10de0100, 12884 },
+    { 0x10de0101, 12903 },
+    { 0x10de0103, 12922 },
+    { 0x10de0110, 12936 },
+    { 0x10de0111, 12955 },
+    { 0x10de0112, 12975 },
+    { 0x10de0113, 12994 },
+    { 0x10de0140, 13013 },
+    { 0x10de0141, 13036 },
+    { 0x10de0145, 13056 },
+    { 0x10de014e, 13079 },
+    { 0x10de014f, 13100 },
+    { 0x10de0150, 13120 },
+    { 0x10de0151, 13140 },
+    { 0x10de0152, 13161 },
+    { 0x10de0153, 13183 },
+    { 0x10de0161, 13202 },
+    { 0x10de0164, 13233 },
+    { 0x10de0166, 13256 },
+    { 0x10de0167, 13279 },
+    { 0x10de0168, 13304 },
+    { 0x10de0170, 13329 },
+    { 0x10de0171, 13352 },
+    { 0x10de0172, 13375 },
+    { 0x10de0173, 13398 },
+    { 0x10de0174, 13424 },
+    { 0x10de0175, 13447 },
+    { 0x10de0176, 13470 },
+    { 0x10de0177, 13497 },
+    { 0x10de0178, 13520 },
+    { 0x10de0179, 13542 },
+    { 0x10de017a, 13569 },
+    { 0x10de017b, 13588 },
+    { 0x10de017c, 13610 },
+    { 0x10de017d, 13634 },
+    { 0x10de0181, 13661 },
+    { 0x10de0182, 13687 },
+    { 0x10de0183, 13715 },
+    { 0x10de0185, 13741 },
+    { 0x10de0186, 13765 },
+    { 0x10de0187, 13788 },
+    { 0x10de0188, 13811 },
+    { 0x10de0189, 13834 },
+    { 0x10de018a, 13857 },
+    { 0x10de018b, 13880 },
+    { 0x10de01a0, 13903 },
+    { 0x10de01a4, 13920 },
+    { 0x10de01b1, 13934 },
+    { 0x10de01b4, 13952 },
+    { 0x10de01bc, 13972 },
+    { 0x10de01c1, 13990 },
+    { 0x10de01e0, 14008 },
+    { 0x10de0200, 14023 },
+    { 0x10de0201, 14039 },
+    { 0x10de0202, 14057 },
+    { 0x10de0203, 14075 },
+    { 0x10de0211, 14093 },
+    { 0x10de0212, 14114 },
+    { 0x10de0215, 14138 },
+    { 0x10de0250, 14162 },
+    { 0x10de0251, 14186 },
+    { 0x10de0253, 14210 },
+    { 0x10de0258, 14234 },
+    { 0x10de0259, 14256 },
+    { 0x10de025b, 14278 },
+    { 0x10de0264, 14300 },
+    { 0x10de0265, 14326 },
+    { 0x10de0266, 14350 },
+    { 0x10de0267, 14375 },
+    { 0x10de0280, 14401 },
+    { 0x10de0281, 14425 },
+    { 0x10de0282, 14452 },
+    { 0x10de0286, 14478 },
+    { 0x10de0288, 14502 },
+    { 0x10de0289, 14525 },
+    { 0x10de028c, 14548 },
+    { 0x10de0301, 14572 },
+    { 0x10de0302, 14601 },
+    { 0x10de0308, 14624 },
+    { 0x10de0309, 14646 },
+    { 0x10de0311, 14668 },
+    { 0x10de0312, 14697 },
+    { 0x10de0314, 14720 },
+    { 0x10de031a, 14745 },
+    { 0x10de031b, 14770 },
+    { 0x10de031c, 14795 },
+    { 0x10de0320, 14818 },
+    { 0x10de0321, 14841 },
+    { 0x10de0322, 14870 },
+    { 0x10de0323, 14895 },
+    { 0x10de0324, 14920 },
+    { 0x10de0325, 14945 },
+    { 0x10de0326, 14970 },
+    { 0x10de0327, 14993 },
+    { 0x10de0328, 15016 },
+    { 0x10de0329, 15044 },
+    { 0x10de032a, 15070 },
+    { 0x10de032b, 15096 },
+    { 0x10de032c, 15117 },
+    { 0x10de032d, 15142 },
+    { 0x10de0330, 15167 },
+    { 0x10de0331, 15196 },
+    { 0x10de0332, 15219 },
+    { 0x10de0333, 15244 },
+    { 0x10de0334, 15273 },
+    { 0x10de0338, 15298 },
+    { 0x10de033f, 15320 },
+    { 0x10de0341, 15341 },
+    { 0x10de0342, 15370 },
+    { 0x10de0343, 15393 },
+    { 0x10de0344, 15418 },
+    { 0x10de0347, 15443 },
+    { 0x10de0348, 15470 },
+    { 0x10de034c, 15497 },
+    { 0x10de034e, 15521 },
+    { 0x10de0360, 15543 },
+    { 0x10de0364, 15566 },
+    { 0x10de0368, 15589 },
+    { 0x10de036e, 15615 },
+    { 0x10de0373, 15639 },
+    { 0x10de037e, 15656 },
+    { 0x10de037f, 15681 },
+    { 0x10de03e7, 15707 },
+    { 0x10de03eb, 15732 },
+    { 0x10de03ec, 15758 },
+    { 0x10de03f6, 15782 },
+    { 0x10de03f7, 15808 },
+    { 0x10de0446, 15834 },
+    { 0x10de0448, 15860 },
+    { 0x10de0542, 15884 },
+    { 0x10de0560, 15910 },
+    { 0x10de056c, 15934 },
+    { 0x10de0752, 15958 },
+    { 0x10de0759, 15985 },
+    { 0x10de07d8, 16009 },
+    { 0x10de0aa2, 16035 },
+    { 0x10de0d85, 16061 },
+    { 0x10e09128, 16086 },
+    { 0x10e09135, 16096 },
+    { 0x10ea1682, 16105 },
+    { 0x10ea2000, 16117 },
+    { 0x10ea2010, 16129 },
+    { 0x10ea5000, 16141 },
+    { 0x10ea5050, 16153 },
+    { 0x10ec8139, 16165 },
+    { 0x10ee3fc0, 16178 },
+    { 0x10ee3fc1, 16189 },
+    { 0x10ee3fc2, 16202 },
+    { 0x10ee3fc3, 16219 },
+    { 0x10ee3fc5, 16243 },
+    { 0x10ee3fc6, 16265 },
+    { 0x11020002, 16292 },
+    { 0x11020005, 16309 },
+    { 0x1102000b, 16323 },
+    { 0x11028938, 16337 },
+    { 0x11030003, 16351 },
+    { 0x11030004, 16362 },
+    { 0x11030005, 16373 },
+    { 0x11030006, 16384 },
+    { 0x11030007, 16395 },
+    { 0x11030008, 16406 },
+    { 0x11030009, 16417 },
+    { 0x11060198, 16429 },
+    { 0x11060204, 16440 },
+    { 0x11060238, 16451 },
+    { 0x11060258, 16462 },
+    { 0x11060259, 16472 },
+    { 0x11060269, 16484 },
+    { 0x11060282, 16495 },
+    { 0x11060296, 16511 },
+    { 0x11060305, 16522 },
+    { 0x11060308, 16533 },
+    { 0x11060314, 16548 },
+    { 0x11060324, 16561 },
+    { 0x11060327, 16572 },
+    { 0x11060336, 16583 },
+    { 0x11060351, 16594 },
+    { 0x11060364, 16605 },
+    { 0x11060391, 16616 },
+    { 0x11060415, 16627 },
+    { 0x11060501, 16636 },
+    { 0x11060561, 16647 },
+    { 0x11060571, 16658 },
+    { 0x11060576, 16671 },
+    { 0x11060581, 16682 },
+    { 0x11060586, 16696 },
+    { 0x11060596, 16709 },
+    { 0x11060597, 16720 },
+    { 0x11060598, 16733 },
+    { 0x11060601, 16746 },
+    { 0x11060605, 16757 },
+    { 0x11060686, 16768 },
+    { 0x11060691, 16779 },
+    { 0x11061571, 16792 },
+    { 0x11063038, 16805 },
+    { 0x11063040, 16818 },
+    { 0x11063050, 16831 },
+    { 0x11063051, 16844 },
+    { 0x11063057, 16858 },
+    { 0x11063058, 16871 },
+    { 0x11063059, 16884 },
+    { 0x11063074, 16895 },
+    { 0x11063091, 16906 },
+    { 0x11063099, 16917 },
+    { 0x11063101, 16928 },
+    { 0x11063102, 16939 },
+    { 0x11063104, 16948 },
+    { 0x11063109, 16963 },
+    { 0x11063112, 16975 },
+    { 0x11063116, 16984 },
+    { 0x11063119, 16994 },
+    { 0x11063123, 17003 },
+    { 0x11063128, 17014 },
+    { 0x11063147, 17025 },
+    { 0x11063148, 17035 },
+    { 0x11063149, 17049 },
+    { 0x11063156, 17063 },
+    { 0x11063164, 17073 },
+    { 0x11063168, 17082 },
+    { 0x11063177, 17094 },
+    { 0x11063188, 17103 },
+    { 0x11063189, 17114 },
+    { 0x11063205, 17125 },
+    { 0x11063208, 17136 },
+    { 0x11063227, 17147 },
+    { 0x11063287, 17156 },
+    { 0x11063337, 17165 },
+    { 0x11063372, 17175 },
+    { 0x11063402, 17185 },
+    { 0x11065324, 17194 },
+    { 0x11068231, 17208 },
+    { 0x11068235, 17217 },
+    { 0x11068305, 17228 },
+    { 0x11068324, 17239 },
+    { 0x11068353, 17249 },
+    { 0x11068391, 17259 },
+    { 0x11068409, 17270 },
+    { 0x11068410, 17280 },
+    { 0x11068598, 17290 },
+    { 0x1106b188, 17303 },
+    { 0x1106b198, 17314 },
+    { 0x1106c409, 17328 },
+    { 0x1106ffff, 17342 },
+    { 0x110a2102, 17351 },
+    { 0x11190001, 17365 },
+    { 0x11190004, 17381 },
+    { 0x11190005, 17396 },
+    { 0x11190008, 17411 },
+    { 0x11190009, 17426 },
+    { 0x1119000c, 17441 },
+    { 0x1119000d, 17456 },
+    { 0x11190102, 17471 },
+    { 0x11190103, 17488 },
+    { 0x111a0000, 17505 },
+    { 0x111a0002, 17517 },
+    { 0x111a0003, 17529 },
+    { 0x111a0005, 17543 },
+    { 0x111d0001, 17558 },
+    { 0x11270300, 17571 },
+    { 0x11317146, 17584 },
+    { 0x11319730, 17600 },
+    { 0x1133e002, 17616 },
+    { 0x1133e004, 17629 },
+    { 0x1133e005, 17644 },
+    { 0x1133e00b, 17658 },
+    { 0x1133e010, 17672 },
+    { 0x1133e012, 17686 },
+    { 0x1133e013, 17701 },
+    { 0x1133e014, 17718 },
+    { 0x11385550, 17733 },
+    { 0x11484200, 17749 },
+    { 0x11484300, 17763 },
+    { 0x11484320, 17777 },
+    { 0x11484400, 17791 },
+    { 0x11484500, 17807 },
+    { 0x114f0070, 17823 },
+    { 0x114f0071, 17840 },
+    { 0x114f0072, 17852 },
+    { 0x114f0073, 17869 },
+    { 0x114f00b1, 17881 },
+    { 0x114f00c8, 17892 },
+    { 0x114f00c9, 17901 },
+    { 0x114f00ca, 17913 },
+    { 0x114f00cb, 17923 },
+    { 0x115d0101, 17936 },
+    { 0x115d0103, 17950 },
+    { 0x11660008, 17967 },
+    { 0x11660009, 17982 },
+    { 0x11660017, 17997 },
+    { 0x11660036, 18017 },
+    { 0x11660103, 18040 },
+    { 0x11660132, 18056 },
+    { 0x11660200, 18080 },
+    { 0x11660201, 18097 },
+    { 0x11660203, 18114 },
+    { 0x11660205, 18131 },
+    { 0x11660211, 18152 },
+    { 0x11660212, 18172 },
+    { 0x11660213, 18192 },
+    { 0x11660214, 18212 },
+    { 0x11660217, 18234 },
+    { 0x11660227, 18255 },
+    { 0x11660408, 18275 },
+    { 0x11760104, 18296 },
+    { 0x11760301, 18309 },
+    { 0x11760302, 18322 },
+    { 0x11790101, 18335 },
+    { 0x11790102, 18353 },
+    { 0x11790103, 18371 },
+    { 0x11790105, 18389 },
+    { 0x1179060a, 18407 },
+    { 0x1179060f, 18423 },
+    { 0x11790617, 18439 },
+    { 0x11800465, 18456 },
+    { 0x11800466, 18470 },
+    { 0x11800475, 18484 },
+    { 0x11800476, 18498 },
+    { 0x11800478, 18512 },
+    { 0x11800822, 18526 },
+    { 0x11800832, 18539 },
+    { 0x11800843, 18552 },
+    { 0x1180e822, 18565 },
+    { 0x1180e823, 18579 },
+    { 0x11864c00, 18593 },
+    { 0x11910005, 18607 },
+    { 0x11910006, 18622 },
+    { 0x11910007, 18635 },
+    { 0x11910008, 18649 },
+    { 0x11910009, 18662 },
+    { 0x1191000a, 18676 },
+    { 0x1191000b, 18690 },
+    { 0x11918002, 18704 },
+    { 0x11918010, 18718 },
+    { 0x11918020, 18734 },
+    { 0x11918030, 18749 },
+    { 0x11918040, 18764 },
+    { 0x11918050, 18779 },
+    { 0x11918060, 18796 },
+    { 0x11930001, 18807 },
+    { 0x11930002, 18820 },
+    { 0x119e0001, 18833 },
+    { 0x119e0003, 18847 },
+    { 0x11b00001, 18860 },
+    { 0x11b00002, 18868 },
+    { 0x11c10480, 18876 },
+    { 0x11cb2000, 18892 },
+    { 0x11cb8000, 18906 },
+    { 0x11d41234, 18920 },
+    { 0x11de6057, 18929 },
+    { 0x11de6120, 18941 },
+    { 0x11f60112, 18953 },
+    { 0x11fe000e, 18971 },
+    { 0x11fe000f, 18979 },
+    { 0x11fe080c, 18987 },
+    { 0x11fe080d, 19002 },
+    { 0x120e0300, 19017 },
+    { 0x120e0301, 19028 },
+    { 0x120e0310, 19039 },
+    { 0x120e0311, 19050 },
+    { 0x120e0320, 19061 },
+    { 0x120e0321, 19074 },
+    { 0x120f0001, 19087 },
+    { 0x12176729, 19108 },
+    { 0x1217673a, 19116 },
+    { 0x12176832, 19124 },
+    { 0x12176836, 19132 },
+    { 0x12176872, 19140 },
+    { 0x12176933, 19148 },
+    { 0x12178120, 19156 },
+    { 0x12178220, 19164 },
+    { 0x12178221, 19172 },
+    { 0x12178320, 19180 },
+    { 0x12178321, 19188 },
+    { 0x121a0001, 19196 },
+    { 0x121a0002, 19208 },
+    { 0x121a0003, 19221 },
+    { 0x121a0005, 19234 },
+    { 0x121a0009, 19247 },
+    { 0x12440700, 19260 },
+    { 0x12440800, 19267 },
+    { 0x12440a00, 19274 },
+    { 0x12440e00, 19281 },
+    { 0x12441100, 19291 },
+    { 0x12441200, 19298 },
+    { 0x125d1968, 19305 },
+    { 0x125d1978, 19317 },
+    { 0x125d1988, 19329 },
+    { 0x125d1989, 19343 },
+    { 0x125d1990, 19355 },
+    { 0x125d1992, 19372 },
+    { 0x125d1998, 19387 },
+    { 0x125d1999, 19400 },
+    { 0x125d199a, 19415 },
+    { 0x125d199b, 19431 },
+    { 0x12671016, 19446 },
+    { 0x12741371, 19461 },
+    { 0x12745000, 19476 },
+    { 0x12745880, 19491 },
+    { 0x12830100, 19506 },
+    { 0x12838152, 19518 },
+    { 0x12838172, 19527 },
+    { 0x12838211, 19536 },
+    { 0x12838212, 19545 },
+    { 0x12838213, 19554 },
+    { 0x12838872, 19563 },
+    { 0x1283e886, 19572 },
+    { 0x12d20018, 19586 },
+    { 0x12eb0001, 19605 },
+    { 0x12eb0002, 19621 },
+    { 0x12eb0003, 19637 },
+    { 0x12f88a02, 19654 },
+    { 0x12fe0111, 19664 },
+    { 0x13325415, 19682 },
+    { 0x13325425, 19702 },
+    { 0x13326155, 19722 },
+    { 0x134a0001, 19740 },
+    { 0x135a0d80, 19755 },
+    { 0x135a0dc0, 19772 },
+    { 0x135c0010, 19789 },
+    { 0x135c0020, 19804 },
+    { 0x135c0030, 19819 },
+    { 0x135c0040, 19834 },
+    { 0x135c0050, 19849 },
+    { 0x135c0060, 19865 },
+    { 0x135c0120, 19881 },
+    { 0x135c0130, 19897 },
+    { 0x135c0140, 19913 },
+    { 0x135c0150, 19929 },
+    { 0x135c0170, 19945 },
+    { 0x135c0180, 19962 },
+    { 0x135c0181, 19979 },
+    { 0x135c0190, 19995 },
+    { 0x135c01a0, 20012 },
+    { 0x135c01b0, 20029 },
+    { 0x135c01b1, 20046 },
+    { 0x135c01c0, 20062 },
+    { 0x135c01e0, 20079 },
+    { 0x135c0278, 20096 },
+    { 0x135e7101, 20114 },
+    { 0x135e7201, 20128 },
+    { 0x135e7202, 20144 },
+    { 0x135e7401, 20162 },
+    { 0x135e7402, 20177 },
+    { 0x135e7801, 20195 },
+    { 0x135e7803, 20210 },
+    { 0x135e7804, 20224 },
+    { 0x13659050, 20240 },
+    { 0x136bff01, 20254 },
+    { 0x1371434e, 20270 },
+    { 0x13760003, 20284 },
+    { 0x13760004, 20293 },
+    { 0x13760005, 20301 },
+    { 0x13760006, 20309 },
+    { 0x1385620a, 20316 },
+    { 0x13890001, 20330 },
+    { 0x13890002, 20350 },
+    { 0x13890003, 20374 },
+    { 0x13930001, 20394 },
+    { 0x13931020, 20406 },
+    { 0x13931021, 20417 },
+    { 0x13931022, 20430 },
+    { 0x13931040, 20442 },
+    { 0x13931041, 20452 },
+    { 0x13931042, 20464 },
+    { 0x13931043, 20477 },
+    { 0x13931140, 20490 },
+    { 0x13931141, 20501 },
+    { 0x13931180, 20512 },
+    { 0x13931181, 20524 },
+    { 0x13931320, 20537 },
+    { 0x13931321, 20548 },
+    { 0x13931340, 20560 },
+    { 0x13931680, 20572 },
+    { 0x13931681, 20582 },
+    { 0x13931682, 20594 },
+    { 0x13932040, 20607 },
+    { 0x13932180, 20619 },
+    { 0x13933200, 20629 },
+    { 0x139708b4, 20639 },
+    { 0x139716b8, 20649 },
+    { 0x13972bd0, 20659 },
+    { 0x139730b1, 20668 },
+    { 0x1397b000, 20678 },
+    { 0x1397b006, 20687 },
+    { 0x1397b007, 20696 },
+    { 0x1397b008, 20705 },
+    { 0x1397b009, 20714 },
+    { 0x1397b00a, 20723 },
+    { 0x1397b00b, 20732 },
+    { 0x1397b00c, 20741 },
+    { 0x1397b100, 20750 },
+    { 0x1397b700, 20759 },
+    { 0x1397b701, 20768 },
+    { 0x13a80152, 20777 },
+    { 0x13a80154, 20791 },
+    { 0x13a80158, 20805 },
+    { 0x13a80352, 20819 },
+    { 0x13a80354, 20833 },
+    { 0x13a80358, 20847 },
+    { 0x13c00010, 20861 },
+    { 0x13c00030, 20875 },
+    { 0x13c11000, 20889 },
+    { 0x13c11001, 20900 },
+    { 0x13c11002, 20911 },
+    { 0x13ca4231, 20922 },
+    { 0x13d12bd1, 20933 },
+    { 0x13f60100, 20945 },
+    { 0x13f60101, 20960 },
+    { 0x13f60111, 20975 },
+    { 0x13f60112, 20989 },
+    { 0x14070100, 21004 },
+    { 0x14070101, 21017 },
+    { 0x14070102, 21031 },
+    { 0x14070120, 21045 },
+    { 0x14070121, 21060 },
+    { 0x14070180, 21075 },
+    { 0x14070181, 21087 },
+    { 0x14070200, 21099 },
+    { 0x14070201, 21114 },
+    { 0x14070202, 21126 },
+    { 0x14070500, 21138 },
+    { 0x14070600, 21151 },
+    { 0x14078000, 21165 },
+    { 0x14078002, 21179 },
+    { 0x14078003, 21195 },
+    { 0x14078800, 21211 },
+    { 0x14097168, 21228 },
+    { 0x14121712, 21241 },
+    { 0x14158403, 21250 },
+    { 0x14159501, 21266 },
+    { 0x1415950b, 21282 },
+    { 0x14159511, 21294 },
+    { 0x14159513, 21310 },
+    { 0x14159521, 21328 },
+    { 0x14159523, 21344 },
+    { 0x14d28001, 21362 },
+    { 0x14d28010, 21373 },
+    { 0x14d28011, 21384 },
+    { 0x14d28020, 21395 },
+    { 0x14d28021, 21406 },
+    { 0x14d28040, 21417 },
+    { 0x14d28080, 21428 },
+    { 0x14d2a001, 21439 },
+    { 0x14d2a003, 21449 },
+    { 0x14d2a004, 21459 },
+    { 0x14d2a005, 21470 },
+    { 0x14d40400, 21480 },
+    { 0x14d40402, 21498 },
+    { 0x14db2180, 21516 },
+    { 0x14db2182, 21529 },
+    { 0x14e41600, 21542 },
+    { 0x14e41601, 21554 },
+    { 0x14e41639, 21567 },
+    { 0x14e4163a, 21576 },
+    { 0x14e41644, 21586 },
+    { 0x14e41645, 21598 },
+    { 0x14e41646, 21610 },
+    { 0x14e41647, 21622 },
+    { 0x14e41648, 21634 },
+    { 0x14e41649, 21646 },
+    { 0x14e4164a, 21661 },
+    { 0x14e4164c, 21670 },
+    { 0x14e4164d, 21679 },
+    { 0x14e4164e, 21693 },
+    { 0x14e4164f, 21703 },
+    { 0x14e41650, 21713 },
+    { 0x14e41653, 21724 },
+    { 0x14e41654, 21736 },
+    { 0x14e41657, 21750 },
+    { 0x14e41659, 21762 },
+    { 0x14e4165a, 21774 },
+    { 0x14e4165b, 21786 },
+    { 0x14e4165d, 21798 },
+    { 0x14e4165e, 21811 },
+    { 0x14e41662, 21826 },
+    { 0x14e41663, 21836 },
+    { 0x14e41668, 21847 },
+    { 0x14e41669, 21859 },
+    { 0x14e4166a, 21872 },
+    { 0x14e4166b, 21884 },
+    { 0x14e4166e, 21897 },
+    { 0x14e4166f, 21910 },
+    { 0x14e41672, 21923 },
+    { 0x14e41673, 21936 },
+    { 0x14e41674, 21949 },
+    { 0x14e41676, 21961 },
+    { 0x14e41677, 21973 },
+    { 0x14e41678, 21985 },
+    { 0x14e41679, 21997 },
+    { 0x14e4167a, 22010 },
+    { 0x14e4167b, 22022 },
+    { 0x14e4167d, 22034 },
+    { 0x14e4167e, 22047 },
+    { 0x14e4167f, 22060 },
+    { 0x14e41680, 22073 },
+    { 0x14e41681, 22086 },
+    { 0x14e41684, 22098 },
+    { 0x14e4168a, 22110 },
+    { 0x14e4168d, 22120 },
+    { 0x14e4168e, 22130 },
+    { 0x14e41693, 22140 },
+    { 0x14e41696, 22153 },
+    { 0x14e41698, 22165 },
+    { 0x14e4169a, 22177 },
+    { 0x14e4169b, 22189 },
+    { 0x14e4169c, 22201 },
+    { 0x14e4169d, 22213 },
+    { 0x14e416a1, 22225 },
+    { 0x14e416a2, 22240 },
+    { 0x14e416a4, 22255 },
+    { 0x14e416a5, 22268 },
+    { 0x14e416a6, 22281 },
+    { 0x14e416a7, 22294 },
+    { 0x14e416a8, 22307 },
+    { 0x14e416a9, 22320 },
+    { 0x14e416aa, 22333 },
+    { 0x14e416ac, 22343 },
+    { 0x14e416ad, 22353 },
+    { 0x14e416ae, 22366 },
+    { 0x14e416af, 22379 },
+    { 0x14e416c6, 22392 },
+    { 0x14e416c7, 22406 },
+    { 0x14e416dd, 22420 },
+    { 0x14e416f7, 22432 },
+    { 0x14e416fd, 22444 },
+    { 0x14e416fe, 22457 },
+    { 0x14e4170d, 22470 },
+    { 0x14e4170e, 22482 },
+    { 0x14e41712, 22496 },
+    { 0x14e41713, 22508 },
+    { 0x151f0000, 22521 },
+    { 0x15220100, 22533 },
+    { 0x15240510, 22550 },
+    { 0x15240550, 22566 },
+    { 0x15240551, 22579 },
+    { 0x15240750, 22594 },
+    { 0x15240751, 22607 },
+    { 0x15241211, 22622 },
+    { 0x15241225, 22631 },
+    { 0x15241410, 22640 },
+    { 0x15241411, 22649 },
+    { 0x15241412, 22657 },
+    { 0x15241420, 22665 },
+    { 0x15241421, 22674 },
+    { 0x15241422, 22682 },
+    { 0x15920782, 22690 },
+    { 0x15920783, 22702 },
+    { 0x15aa2000, 22714 },
+    { 0x15ad0405, 22727 },
+    { 0x15ad0710, 22741 },
+    { 0x15ad0720, 22754 },
+    { 0x15ad0740, 22768 },
+    { 0x15ad0770, 22784 },
+    { 0x15ad0778, 22802 },
+    { 0x15ad0790, 22820 },
+    { 0x15ad07a0, 22838 },
+    { 0x15ad07b0, 22856 },
+    { 0x15ad0801, 22871 },
+    { 0x15ad1975, 22887 },
+    { 0x15ad1977, 22905 },
+    { 0x15b02bd0, 22923 },
+    { 0x15b35a44, 22936 },
+    { 0x15b35a46, 22951 },
+    { 0x15b35e8c, 22973 },
+    { 0x15b36274, 22992 },
+    { 0x15b36278, 23007 },
+    { 0x15b36282, 23029 },
+    { 0x15b87000, 23044 },
+    { 0x15b87001, 23062 },
+    { 0x15b87002, 23080 },
+    { 0x15b87009, 23098 },
+    { 0x15b8700a, 23118 },
+    { 0x15b8700b, 23138 },
+    { 0x15b8700c, 23158 },
+    { 0x15b8700d, 23178 },
+    { 0x15b8700e, 23198 },
+    { 0x15b8700f, 23218 },
+    { 0x15b8818e, 23238 },
+    { 0x15e20500, 23256 },
+    { 0x16190400, 23268 },
+    { 0x16190440, 23280 },
+    { 0x16190610, 23292 },
+    { 0x16190620, 23304 },
+    { 0x16190640, 23316 },
+    { 0x16191610, 23328 },
+    { 0x16191612, 23340 },
+    { 0x16570014, 23353 },
+    { 0x16570017, 23364 },
+    { 0x16570021, 23380 },
+    { 0x166d0001, 23394 },
+    { 0x166d0002, 23406 },
+    { 0x16ca0001, 23417 },
+    { 0x17257174, 23429 },
+    { 0x17371064, 23445 },
+    { 0x173b03e8, 23460 },
+    { 0x173b03e9, 23474 },
+    { 0x173b03ea, 23488 },
+    { 0x173b03eb, 23502 },
+    { 0x1799701f, 23516 },
+    { 0x17d31110, 23533 },
+    { 0x17d31120, 23544 },
+    { 0x17d31130, 23555 },
+    { 0x17d31160, 23566 },
+    { 0x17d31170, 23577 },
+    { 0x17d31200, 23588 },
+    { 0x17d31201, 23599 },
+    { 0x17d31202, 23610 },
+    { 0x17d31210, 23621 },
+    { 0x17d31220, 23632 },
+    { 0x17d31230, 23643 },
+    { 0x17d31260, 23654 },
+    { 0x17d31270, 23665 },
+    { 0x17d31280, 23676 },
+    { 0x17d31380, 23687 },
+    { 0x17d31381, 23698 },
+    { 0x17d31680, 23709 },
+    { 0x17d31681, 23720 },
+    { 0x17d55731, 23731 },
+    { 0x17d55732, 23740 },
+    { 0x17d55831, 23749 },
+    { 0x17d55832, 23758 },
+    { 0x17f31010, 23767 },
+    { 0x17f36020, 23777 },
+    { 0x17f36030, 23787 },
+    { 0x17f36040, 23797 },
+    { 0x17f36060, 23807 },
+    { 0x17f36061, 23817 },
+    { 0x182d3069, 23827 },
+    { 0x19120001, 23843 },
+    { 0x19120002, 23858 },
+    { 0x19120004, 23873 },
+    { 0x19120007, 23888 },
+    { 0x19120010, 23903 },
+    { 0x19240703, 23918 },
+    { 0x19240710, 23940 },
+    { 0x19246703, 23960 },
+    { 0x192e0101, 23982 },
+    { 0x19691048, 23991 },
+    { 0x19692048, 24003 },
+    { 0x197b2360, 24015 },
+    { 0x197b2361, 24030 },
+    { 0x197b2362, 24045 },
+    { 0x197b2363, 24060 },
+    { 0x197b2364, 24075 },
+    { 0x197b2365, 24090 },
+    { 0x197b2366, 24105 },
+    { 0x197b2368, 24120 },
+    { 0x197b2369, 24135 },
+    { 0x197b2381, 24150 },
+    { 0x197b2382, 24168 },
+    { 0x197b2383, 24187 },
+    { 0x197b2388, 24205 },
+    { 0x197b2391, 24223 },
+    { 0x197b2392, 24241 },
+    { 0x197b2393, 24260 },
+    { 0x19821600, 24278 },
+    { 0x198216ff, 24296 },
+    { 0x19821700, 24314 },
+    { 0x198217ff, 24332 },
+    { 0x1b4b4100, 24350 },
+    { 0x1b4b4101, 24371 },
+    { 0x1b4b4102, 24390 },
+    { 0x1b4b4146, 24411 },
+    { 0x1b4b6430, 24427 },
+    { 0x1b4b6460, 24443 },
+    { 0x1b4b6480, 24459 },
+    { 0x1de1dc29, 24475 },
+    { 0x1fc93009, 24488 },
+    { 0x1fc93010, 24500 },
+    { 0x1fc93014, 24512 },
+    { 0x33888013, 24524 },
+    { 0x3d3d0007, 24541 },
+    { 0x3d3d0009, 24558 },
+    { 0x40400001, 24576 },
+    { 0x40400002, 24590 },
+    { 0x40400003, 24604 },
+    { 0x40400004, 24616 },
+    { 0x40400005, 24628 },
+    { 0x40400024, 24640 },
+    { 0x40400025, 24655 },
+    { 0x416c0100, 24671 },
+    { 0x494f22c0, 24687 },
+    { 0x53338811, 24704 },
+    { 0x53338880, 24712 },
+    { 0x533388f0, 24719 },
+    { 0x53338a25, 24726 },
+    { 0x53338d04, 24737 },
+    { 0x5333ca00, 24751 },
+    { 0x55440001, 24765 },
+    { 0x58530001, 24778 },
+    { 0x66660001, 24791 },
+    { 0x66660002, 24802 },
+    { 0x66660004, 24813 },
+    { 0x80860008, 24824 },
+    { 0x80860320, 24836 },
+    { 0x80860321, 24849 },
+    { 0x80860329, 24862 },
+    { 0x8086032a, 24874 },
+    { 0x8086032c, 24886 },
+    { 0x80860330, 24897 },
+    { 0x80860332, 24911 },
+    { 0x80860370, 24925 },
+    { 0x80860372, 24939 },
+    { 0x80860482, 24953 },
+    { 0x80860483, 24965 },
+    { 0x80860484, 24977 },
+    { 0x80860807, 24989 },
+    { 0x80860808, 25004 },
+    { 0x80860820, 25019 },
+    { 0x80860821, 25032 },
+    { 0x80860822, 25048 },
+    { 0x80860823, 25064 },
+    { 0x80860824, 25080 },
+    { 0x8086084f, 25096 },
+    { 0x80860960, 25111 },
+    { 0x80860962, 25122 },
+    { 0x80860c60, 25135 },
+    { 0x80861062, 25155 },
+    { 0x80861085, 25171 },
+    { 0x8086108f, 25188 },
+    { 0x80861130, 25205 },
+    { 0x80861132, 25220 },
+    { 0x80861221, 25236 },
+    { 0x8086122d, 25252 },
+    { 0x8086122e, 25264 },
+    { 0x80861230, 25280 },
+    { 0x80861234, 25296 },
+    { 0x80861237, 25310 },
+    { 0x8086124b, 25322 },
+    { 0x80861250, 25336 },
+    { 0x80861960, 25348 },
+    { 0x80861a21, 25363 },
+    { 0x80861a30, 25378 },
+    { 0x80861a38, 25393 },
+    { 0x80861c41, 25404 },
+    { 0x80861c5f, 25430 },
+    { 0x80861d40, 25456 },
+    { 0x80861d41, 25477 },
+    { 0x80861e31, 25498 },
+    { 0x80861e40, 25522 },
+    { 0x80861e5f, 25549 },
+    { 0x80862310, 25576 },
+    { 0x8086231f, 25599 },
+    { 0x80862410, 25622 },
+    { 0x80862411, 25638 },
+    { 0x80862413, 25654 },
+    { 0x80862415, 25670 },
+    { 0x80862416, 25686 },
+    { 0x80862418, 25702 },
+    { 0x80862420, 25718 },
+    { 0x80862421, 25734 },
+    { 0x80862423, 25750 },
+    { 0x80862425, 25766 },
+    { 0x80862426, 25782 },
+    { 0x80862428, 25798 },
+    { 0x80862440, 25814 },
+    { 0x80862443, 25830 },
+    { 0x80862445, 25846 },
+    { 0x80862448, 25862 },
+    { 0x8086244a, 25878 },
+    { 0x8086244b, 25894 },
+    { 0x8086244c, 25910 },
+    { 0x8086244e, 25927 },
+    { 0x80862450, 25944 },
+    { 0x8086245b, 25959 },
+    { 0x80862480, 25975 },
+    { 0x80862483, 25991 },
+    { 0x80862485, 26007 },
+    { 0x80862486, 26023 },
+    { 0x8086248a, 26039 },
+    { 0x8086248b, 26056 },
+    { 0x8086248c, 26073 },
+    { 0x808624c0, 26090 },
+    { 0x808624c1, 26106 },
+    { 0x808624c2, 26122 },
+    { 0x808624c3, 26138 },
+    { 0x808624c5, 26154 },
+    { 0x808624c6, 26170 },
+    { 0x808624c9, 26186 },
+    { 0x808624ca, 26202 },
+    { 0x808624cb, 26219 },
+    { 0x808624cc, 26236 },
+    { 0x808624d0, 26253 },
+    { 0x808624d1, 26269 },
+    { 0x808624d3, 26285 },
+    { 0x808624d5, 26301 },
+    { 0x808624d6, 26317 },
+    { 0x808624db, 26333 },
+    { 0x808624dc, 26350 },
+    { 0x808624dd, 26367 },
+    { 0x80862500, 26384 },
+    { 0x80862501, 26399 },
+    { 0x80862530, 26417 },
+    { 0x80862531, 26432 },
+    { 0x8086254c, 26447 },
+    { 0x80862550, 26463 },
+    { 0x8086255d, 26476 },
+    { 0x80862560, 26489 },
+    { 0x80862562, 26505 },
+    { 0x80862570, 26521 },
+    { 0x80862572, 26536 },
+    { 0x80862578, 26551 },
+    { 0x80862580, 26566 },
+    { 0x80862582, 26582 },
+    { 0x80862590, 26598 },
+    { 0x80862592, 26615 },
+    { 0x808625a1, 26632 },
+    { 0x808625a2, 26644 },
+    { 0x808625a4, 26656 },
+    { 0x808625a6, 26668 },
+    { 0x808625ab, 26680 },
+    { 0x808625ac, 26692 },
+    { 0x808625f0, 26705 },
+    { 0x808625f5, 26720 },
+    { 0x808625f6, 26736 },
+    { 0x80862640, 26752 },
+    { 0x80862641, 26765 },
+    { 0x80862642, 26778 },
+    { 0x8086266a, 26791 },
+    { 0x8086266d, 26805 },
+    { 0x8086266e, 26819 },
+    { 0x8086266f, 26833 },
+    { 0x80862670, 26847 },
+    { 0x80862698, 26860 },
+    { 0x8086269b, 26874 },
+    { 0x8086269e, 26888 },
+    { 0x80862770, 26902 },
+    { 0x80862772, 26918 },
+    { 0x80862778, 26934 },
+    { 0x808627a0, 26948 },
+    { 0x808627a2, 26965 },
+    { 0x808627b0, 26982 },
+    { 0x808627b8, 26996 },
+    { 0x808627b9, 27009 },
+    { 0x808627bc, 27022 },
+    { 0x808627bd, 27036 },
+    { 0x808627da, 27050 },
+    { 0x808627dd, 27064 },
+    { 0x808627de, 27078 },
+    { 0x808627df, 27092 },
+    { 0x80862810, 27106 },
+    { 0x80862811, 27119 },
+    { 0x80862812, 27132 },
+    { 0x80862814, 27145 },
+    { 0x80862815, 27158 },
+    { 0x8086283e, 27171 },
+    { 0x80862850, 27184 },
+    { 0x80862910, 27197 },
+    { 0x80862912, 27210 },
+    { 0x80862913, 27223 },
+    { 0x80862914, 27236 },
+    { 0x80862916, 27249 },
+    { 0x80862917, 27262 },
+    { 0x80862918, 27275 },
+    { 0x80862919, 27288 },
+    { 0x80862930, 27301 },
+    { 0x80862c18, 27314 },
+    { 0x80862c19, 27327 },
+    { 0x80862c1a, 27343 },
+    { 0x80862c1c, 27359 },
+    { 0x80862c20, 27376 },
+    { 0x80862c21, 27397 },
+    { 0x80862c22, 27418 },
+    { 0x80862c23, 27439 },
+    { 0x80862c28, 27458 },
+    { 0x80862c29, 27479 },
+    { 0x80862c2a, 27500 },
+    { 0x80862c2b, 27521 },
+    { 0x80862c30, 27540 },
+    { 0x80862c31, 27561 },
+    { 0x80862c32, 27582 },
+    { 0x80862c33, 27603 },
+    { 0x80862c40, 27622 },
+    { 0x80862c41, 27643 },
+    { 0x80862c50, 27660 },
+    { 0x80862c51, 27684 },
+    { 0x80862c70, 27712 },
+    { 0x80862c81, 27741 },
+    { 0x80862c90, 27761 },
+    { 0x80862c91, 27787 },
+    { 0x80862c98, 27812 },
+    { 0x80862c99, 27832 },
+    { 0x80862c9c, 27855 },
+    { 0x80862ca0, 27879 },
+    { 0x80862ca1, 27907 },
+    { 0x80862ca2, 27935 },
+    { 0x80862ca3, 27963 },
+    { 0x80862ca8, 27989 },
+    { 0x80862ca9, 28017 },
+    { 0x80862caa, 28045 },
+    { 0x80862cab, 28073 },
+    { 0x80862d98, 28099 },
+    { 0x80862d99, 28124 },
+    { 0x80862d9a, 28152 },
+    { 0x80862d9c, 28180 },
+    { 0x80862da0, 28209 },
+    { 0x80862da1, 28242 },
+    { 0x80862da2, 28275 },
+    { 0x80862da3, 28308 },
+    { 0x80862da8, 28339 },
+    { 0x80862da9, 28372 },
+    { 0x80862daa, 28405 },
+    { 0x80862dab, 28438 },
+    { 0x80862db0, 28469 },
+    { 0x80862db1, 28502 },
+    { 0x80862db2, 28535 },
+    { 0x80862db3, 28568 },
+    { 0x80863340, 28599 },
+    { 0x80863429, 28616 },
+    { 0x8086342a, 28632 },
+    { 0x8086342b, 28648 },
+    { 0x8086342c, 28664 },
+    { 0x8086342e, 28680 },
+    { 0x80863430, 28699 },
+    { 0x80863431, 28715 },
+    { 0x80863432, 28731 },
+    { 0x80863433, 28747 },
+    { 0x80863575, 28763 },
+    { 0x80863577, 28778 },
+    { 0x80863580, 28794 },
+    { 0x80863582, 28811 },
+    { 0x8086358c, 28828 },
+    { 0x8086358e, 28843 },
+    { 0x80863590, 28858 },
+    { 0x80863592, 28874 },
+    { 0x80863595, 28890 },
+    { 0x80863596, 28903 },
+    { 0x80863597, 28917 },
+    { 0x80863598, 28930 },
+    { 0x80863599, 28944 },
+    { 0x8086359a, 28957 },
+    { 0x8086359e, 28971 },
+    { 0x8086360b, 28987 },
+    { 0x8086360c, 29002 },
+    { 0x8086360f, 29022 },
+    { 0x80863610, 29042 },
+    { 0x80863710, 29062 },
+    { 0x80863711, 29078 },
+    { 0x80863712, 29094 },
+    { 0x80863713, 29110 },
+    { 0x80863714, 29126 },
+    { 0x80863715, 29142 },
+    { 0x80863716, 29158 },
+    { 0x80863717, 29174 },
+    { 0x80863718, 29190 },
+    { 0x80863719, 29206 },
+    { 0x80863a14, 29222 },
+    { 0x80863a16, 29236 },
+    { 0x80863a18, 29250 },
+    { 0x80863a1a, 29264 },
+    { 0x80863a30, 29278 },
+    { 0x80863a60, 29292 },
+    { 0x80863b00, 29306 },
+    { 0x80863b1f, 29334 },
+    { 0x80863c20, 29362 },
+    { 0x80863c21, 29378 },
+    { 0x80863c22, 29394 },
+    { 0x80863c23, 29410 },
+    { 0x80863c24, 29426 },
+    { 0x80863c25, 29442 },
+    { 0x80863c26, 29458 },
+    { 0x80863c27, 29474 },
+    { 0x80863c2e, 29490 },
+    { 0x80863c2f, 29506 },
+    { 0x80863c41, 29522 },
+    { 0x80863c42, 29537 },
+    { 0x80863c43, 29552 },
+    { 0x80863c44, 29569 },
+    { 0x80863c45, 29586 },
+    { 0x80863c46, 29603 },
+    { 0x80863cb0, 29616 },
+    { 0x80863cb1, 29631 },
+    { 0x80863cb4, 29646 },
+    { 0x80863cb5, 29661 },
+    { 0x80863ce0, 29676 },
+    { 0x8086402f, 29696 },
+    { 0x80864030, 29711 },
+    { 0x80864035, 29726 },
+    { 0x80864036, 29742 },
+    { 0x80865031, 29758 },
+    { 0x80865032, 29774 },
+    { 0x808665f0, 29790 },
+    { 0x808665f3, 29804 },
+    { 0x808665f5, 29818 },
+    { 0x808665f6, 29832 },
+    { 0x808665ff, 29846 },
+    { 0x80867000, 29862 },
+    { 0x80867010, 29878 },
+    { 0x80867020, 29894 },
+    { 0x80867030, 29910 },
+    { 0x80867100, 29924 },
+    { 0x80867110, 29938 },
+    { 0x80867111, 29954 },
+    { 0x80867112, 29968 },
+    { 0x80867113, 29984 },
+    { 0x80867120, 30000 },
+    { 0x80867121, 30016 },
+    { 0x80867122, 30032 },
+    { 0x80867123, 30048 },
+    { 0x80867124, 30064 },
+    { 0x80867125, 30080 },
+    { 0x80867180, 30096 },
+    { 0x80867181, 30112 },
+    { 0x80867190, 30128 },
+    { 0x80867191, 30144 },
+    { 0x80867192, 30160 },
+    { 0x80867195, 30176 },
+    { 0x80867196, 30188 },
+    { 0x80867198, 30202 },
+    { 0x80867199, 30218 },
+    { 0x8086719b, 30234 },
+    { 0x808671a0, 30250 },
+    { 0x808671a2, 30266 },
+    { 0x80867601, 30282 },
+    { 0x80868119, 30298 },
+    { 0x8086811a, 30312 },
+    { 0x80868186, 30326 },
+    { 0x808684c4, 30340 },
+    { 0x808684c5, 30354 },
+    { 0x808684ca, 30368 },
+    { 0x808684cb, 30382 },
+    { 0x808684ea, 30396 },
+    { 0x80868500, 30410 },
+    { 0x80869004, 30423 },
+    { 0x8086b152, 30437 },
+    { 0x86861010, 30452 },
+    { 0x8e0e0291, 30469 },
+    { 0x8e0e0302, 30485 },
+    { 0x90041078, 30498 },
+    { 0x90042178, 30511 },
+    { 0x90043860, 30524 },
+    { 0x90045078, 30538 },
+    { 0x90045578, 30551 },
+    { 0x90046038, 30564 },
+    { 0x90046075, 30577 },
+    { 0x90046078, 30591 },
+    { 0x90046178, 30604 },
+    { 0x90047078, 30617 },
+    { 0x90047178, 30630 },
+    { 0x90047278, 30643 },
+    { 0x90047378, 30656 },
+    { 0x90047478, 30669 },
+    { 0x90047895, 30682 },
+    { 0x90048078, 30695 },
+    { 0x90048178, 30708 },
+    { 0x90048278, 30721 },
+    { 0x90048378, 30734 },
+    { 0x90048478, 30747 },
+    { 0x90048578, 30760 },
+    { 0x90048678, 30773 },
+    { 0x90048778, 30786 },
+    { 0x90048878, 30799 },
+    { 0x90050010, 30812 },
+    { 0x90050011, 30828 },
+    { 0x90050013, 30844 },
+    { 0x9005001f, 30859 },
+    { 0x90050050, 30873 },
+    { 0x90050051, 30889 },
+    { 0x9005005f, 30906 },
+    { 0x90050080, 30920 },
+    { 0x90050081, 30935 },
+    { 0x90050083, 30950 },
+    { 0x9005008f, 30965 },
+    { 0x900500c0, 30980 },
+    { 0x900500c1, 30995 },
+    { 0x900500c3, 31010 },
+    { 0x900500cf, 31025 },
+    { 0x90050500, 31040 },
+    { 0x90050503, 31058 },
+    { 0x94126565, 31073 },
+    { 0x97109705, 31085 },
+    { 0x97109715, 31097 },
+    { 0x97109735, 31109 },
+    { 0x97109745, 31121 },
+    { 0x97109755, 31133 },
+    { 0x97109805, 31145 },
+    { 0x97109815, 31157 },
+    { 0x97109835, 31169 },
+    { 0x97109845, 31181 },
+    { 0x97109855, 31193 },
+    { 0x97109865, 31205 },
+    { 0x97109900, 31217 },
+    { 0x97109901, 31229 },
+    { 0x97109904, 31241 },
+    { 0x97109912, 31253 },
+    { 0x97109922, 31265 },
+    { 0xd161b410, 31277 },
+    { 0xe1590001, 31290 },
+    { 0xe1590002, 31303 },
+    { 0xea609896, 31316 },
+    { 0xea609897, 31327 },
+    { 0xea609898, 31342 },
+};
+
+static const char name_pool[] =
+    "tttech\0"
+    "dynalink\0"
+    "berkom\0"
+    "compaq\0"
+    "ncr\0"
+    "ati\0"
+    "vlsi\0"
+    "adl\0"
+    "ns\0"
+    "tseng\0"
+    "weitek\0"
+    "dec\0"
+    "cirrus\0"
+    "ibm\0"
+    "unisys\0"
+    "compex2\0"
+    "wd\0"
+    "ami\0"
+    "amd\0"
+    "trident\0"
+    "ai\0"
+    "dell\0"
+    "matrox\0"
+    "ct\0"
+    "toshiba_2\0"
+    "miro\0"
+    "nec\0"
+    "fd\0"
+    "si\0"
+    "hp\0"
+    "pctech\0"
+    "asustek\0"
+    "dpt\0"
+    "opti\0"
+    "elsa\0"
+    "stmicro\0"
+    "buslogic\0"
+    "ti\0"
+    "sony\0"
+    "winbond2\0"
+    "anigma\0"
+    "efar\0"
+    "motorola\0"
+    "promise\0"
+    "foxconn\0"
+    "umc\0"
+    "picopower\0"
+    "mylex\0"
+    "apple\0"
+    "yamaha\0"
+    "qlogic\0"
+    "cyrix\0"
+    "contaq\0"
+    "olicom\0"
+    "sun\0"
+    "ni\0"
+    "cmd\0"
+    "brooktree\0"
+    "sgi\0"
+    "winbond\0"
+    "plx\0"
+    "madge\0"
+    "3com\0"
+    "al\0"
+    "neomagic\0"
+    "tconrad\0"
+    "nvidia\0"
+    "ims\0"
+    "addidata_old\0"
+    "interg\0"
+    "realtek\0"
+    "xilinx\0"
+    "init\0"
+    "creative\0"
+    "tti\0"
+    "via\0"
+    "siemens\0"
+    "vortex\0"
+    "ef\0"
+    "idt\0"
+    "fore\0"
+    "philips\0"
+    "eicon\0"
+    "cisco\0"
+    "ziatech\0"
+    "syskonnect\0"
+    "digi\0"
+    "xircom\0"
+    "serverworks\0"
+    "sbe\0"
+    "toshiba\0"
+    "atto\0"
+    "ricoh\0"
+    "dlink\0"
+    "artop\0"
+    "zeitnet\0"
+    "fujitsu_me\0"
+    "marvell\0"
+    "v3\0"
+    "att\0"
+    "specialix\0"
+    "analog_devices\0"
+    "zoran\0"
+    "compex\0"
+    "rp\0"
+    "cyclades\0"
+    "essential\0"
+    "o2\0"
+    "3dfx\0"
+    "avm\0"
+    "stallion\0"
+    "at\0"
+    "ess\0"
+    "satsagem\0"
+    "ensoniq\0"
+    "transmeta\0"
+    "rockwell\0"
+    "ite\0"
+    "alteon\0"
+    "nvidia_sgs\0"
+    "aureal\0"
+    "electronicdesigngmbh\0"
+    "esdgmbh\0"
+    "cb\0"
+    "siig\0"
+    "radisys\0"
+    "micro_memory\0"
+    "domex\0"
+    "intashield\0"
+    "quatech\0"
+    "sealevel\0"
+    "hypercope\0"
+    "digigram\0"
+    "kawasaki\0"
+    "cnet\0"
+    "lmc\0"
+    "netgear\0"
+    "applicom\0"
+    "moxa\0"
+    "ccd\0"
+    "exar\0"
+    "microgate\0"
+    "3ware\0"
+    "iomega\0"
+    "abocom\0"
+    "sundance\0"
+    "cmedia\0"
+    "advantech\0"
+    "meilhaus\0"
+    "lava\0"
+    "timedia\0"
+    "ice\0"
+    "oxsemi\0"
+    "chelsio\0"
+    "adlink\0"
+    "samsung\0"
+    "gigabyte\0"
+    "ambit\0"
+    "bcm_gvc\0"
+    "myricom\0"
+    "titan\0"
+    "panacom\0"
+    "sipackets\0"
+    "afavlab\0"
+    "amplicon\0"
+    "broadcom\0"
+    "mobility_electronics\0"
+    "topic\0"
+    "mainpine\0"
+    "ene\0"
+    "syba\0"
+    "moreton\0"
+    "vmware\0"
+    "zoltrix\0"
+    "mellanox\0"
+    "addidata\0"
+    "dfi\0"
+    "quicknet\0"
+    "pdc\0"
+    "farsite\0"
+    "arima\0"
+    "brocade\0"
+    "sibyte\0"
+    "atheros\0"
+    "netcell\0"
+    "cenatek\0"
+    "vitesse\0"
+    "linksys\0"
+    "altima\0"
+    "belkin\0"
+    "lenovo\0"
+    "areca\0"
+    "s2io\0"
+    "rdc\0"
+    "sitecom\0"
+    "topspin\0"
+    "commtech\0"
+    "silan\0"
+    "renesas\0"
+    "solarflare\0"
+    "tdi\0"
+    "freescale\0"
+    "pasemi\0"
+    "attansic\0"
+    "jmicron\0"
+    "korenix\0"
+    "qmi\0"
+    "azwave\0"
+    "asmedia\0"
+    "marvell_ext\0"
+    "ocz\0"
+    "circuitco\0"
+    "tekram\0"
+    "tehuti\0"
+    "hint\0"
+    "3dlabs\0"
+    "netxen\0"
+    "aks\0"
+    "accessio\0"
+    "s3\0"
+    "dunord\0"
+    "xen\0"
+    "dci\0"
+    "intel\0"
+    "scalemp\0"
+    "computone\0"
+    "kti\0"
+    "adaptec\0"
+    "adaptec2\0"
+    "holtek\0"
+    "netmos\0"
+    "3com_2\0"
+    "digium\0"
+    "tigerjet\0"
+    "xilinx_rme\0"
+    "invalid\0"
+    "tttech_mc322\0"
+    "dynalink_is64ph\0"
+    "berkom_a1t\0"
+    "berkom_t_concept\0"
+    "berkom_a4t\0"
+    "berkom_scitel_quadro\0"
+    "compaq_cissc\0"
+    "compaq_tokenring\0"
+    "compaq_tachyon\0"
+    "compaq_smart2p\0"
+    "compaq_netel100\0"
+    "compaq_triflex_ide\0"
+    "compaq_netel10\0"
+    "compaq_netflex3i\0"
+    "compaq_netel100d\0"
+    "compaq_netel100pi\0"
+    "compaq_netel100i\0"
+    "compaq_ciss\0"
+    "compaq_cissb\0"
+    "compaq_thunder\0"
+    "compaq_netflex3b\0"
+    "ncr_53c810\0"
+    "ncr_53c820\0"
+    "ncr_53c825\0"
+    "ncr_53c815\0"
+    "lsi_53c810ap\0"
+    "ncr_53c860\0"
+    "lsi_53c1510\0"
+    "ncr_53c896\0"
+    "ncr_53c895\0"
+    "ncr_53c885\0"
+    "ncr_53c875\0"
+    "ncr_53c1510\0"
+    "lsi_53c895a\0"
+    "lsi_53c875a\0"
+    "lsi_53c1010_33\0"
+    "lsi_53c1010_66\0"
+    "lsi_53c1030\0"
+    "lsi_1030_53c1035\0"
+    "lsi_53c1035\0"
+    "lsi_sas1064\0"
+    "lsi_sas1068\0"
+    "lsi_sas1064e\0"
+    "lsi_sas1068e\0"
+    "lsi_sas1066e\0"
+    "lsi_sas1064a\0"
+    "lsi_sas1066\0"
+    "lsi_sas1078\0"
+    "ncr_53c875j\0"
+    "lsi_sas1064r\0"
+    "lsi_fc909\0"
+    "lsi_fc929\0"
+    "lsi_fc929_lan\0"
+    "lsi_fc919\0"
+    "lsi_fc919_lan\0"
+    "lsi_fc929x\0"
+    "lsi_fc919x\0"
+    "lsi_fc949x\0"
+    "lsi_fc939x\0"
+    "lsi_fc949es\0"
+    "ncr_yellowfin\0"
+    "lsi_61c102\0"
+    "lsi_63c815\0"
+    "ati_68800\0"
+    "ati_radeon_bb\0"
+    "ati_ixp200_ide\0"
+    "ati_ixp200_smbus\0"
+    "ati_215ct222\0"
+    "ati_210888cx\0"
+    "ati_ixp300_smbus\0"
+    "ati_ixp300_ide\0"
+    "ati_ixp300_sata\0"
+    "ati_ixp400_smbus\0"
+    "ati_ixp400_ide\0"
+    "ati_ixp400_sata\0"
+    "ati_ixp400_sata2\0"
+    "ati_ixp600_sata\0"
+    "ati_sbx00_smbus\0"
+    "ati_ixp600_ide\0"
+    "ati_ixp700_sata\0"
+    "ati_ixp700_ide\0"
+    "ati_215et222\0"
+    "ati_215gb\0"
+    "ati_215gd\0"
+    "ati_215gi\0"
+    "ati_215gp\0"
+    "ati_215gq\0"
+    "ati_215xl\0"
+    "ati_215gt\0"
+    "ati_215gtb\0"
+    "ati_215_iv\0"
+    "ati_215_iw\0"
+    "ati_210888gx\0"
+    "ati_215_iz\0"
+    "ati_215_lb\0"
+    "ati_215_ld\0"
+    "ati_rage128_le\0"
+    "ati_rage128_lf\0"
+    "ati_215_lg\0"
+    "ati_215_li\0"
+    "ati_215_lm\0"
+    "ati_215_ln\0"
+    "ati_215_lr\0"
+    "ati_215_ls\0"
+    "ati_264_lt\0"
+    "ati_radeon_lw\0"
+    "ati_radeon_lx\0"
+    "ati_radeon_ly\0"
+    "ati_radeon_lz\0"
+    "ati_rage128_mf\0"
+    "ati_rage128_ml\0"
+    "ati_radeon_nd\0"
+    "ati_radeon_ne\0"
+    "ati_radeon_nf\0"
+    "ati_radeon_ng\0"
+    "ati_rage128_pa\0"
+    "ati_rage128_pb\0"
+    "ati_rage128_pc\0"
+    "ati_rage128_pd\0"
+    "ati_rage128_pe\0"
+    "ati_rage128_pf\0"
+    "ati_rage128_pg\0"
+    "ati_rage128_ph\0"
+    "ati_rage128_pi\0"
+    "ati_rage128_pj\0"
+    "ati_rage128_pk\0"
+    "ati_rage128_pl\0"
+    "ati_rage128_pm\0"
+    "ati_rage128_pn\0"
+    "ati_rage128_po\0"
+    "ati_rage128_pp\0"
+    "ati_rage128_pq\0"
+    "ati_rage128_pr\0"
+    "ati_rage128_ps\0"
+    "ati_rage128_pt\0"
+    "ati_rage128_pu\0"
+    "ati_rage128_pv\0"
+    "ati_rage128_pw\0"
+    "ati_rage128_px\0"
+    "ati_radeon_qd\0"
+    "ati_radeon_qe\0"
+    "ati_radeon_qf\0"
+    "ati_radeon_qg\0"
+    "ati_radeon_ql\0"
+    "ati_radeon_qm\0"
+    "ati_radeon_qn\0"
+    "ati_radeon_qo\0"
+    "ati_radeon_qw\0"
+    "ati_radeon_qx\0"
+    "ati_radeon_qy\0"
+    "ati_radeon_qz\0"
+    "ati_rage128_re\0"
+    "ati_rage128_rf\0"
+    "ati_rage128_rg\0"
+    "ati_rage128_rk\0"
+    "ati_rage128_rl\0"
+    "ati_rage128_se\0"
+    "ati_rage128_sf\0"
+    "ati_rage128_sg\0"
+    "ati_rage128_sh\0"
+    "ati_rage128_sk\0"
+    "ati_rage128_sl\0"
+    "ati_rage128_sm\0"
+    "ati_rage128_sn\0"
+    "ati_rage128_tf\0"
+    "ati_rage128_tl\0"
+    "ati_rage128_tr\0"
+    "ati_rage128_ts\0"
+    "ati_rage128_tt\0"
+    "ati_rage128_tu\0"
+    "ati_264vt\0"
+    "ati_264vu\0"
+    "ati_264vv\0"
+    "ati_rs300_100\0"
+    "ati_rs300_133\0"
+    "ati_rs300_166\0"
+    "ati_rs300_200\0"
+    "ati_rs480\0"
+    "ati_rs400_100\0"
+    "ati_rs400_133\0"
+    "ati_rs400_166\0"
+    "ati_rs400_200\0"
+    "ati_rs350_100\0"
+    "ati_rs350_133\0"
+    "ati_rs350_166\0"
+    "ati_rs350_200\0"
+    "ati_rs100\0"
+    "ati_rs200\0"
+    "ati_rs250\0"
+    "ati_rs200_b\0"
+    "vlsi_82c592\0"
+    "vlsi_82c593\0"
+    "vlsi_82c594\0"
+    "vlsi_82c597\0"
+    "vlsi_82c541\0"
+    "vlsi_82c543\0"
+    "vlsi_82c532\0"
+    "vlsi_82c534\0"
+    "vlsi_82c535\0"
+    "vlsi_82c147\0"
+    "vlsi_vas96011\0"
+    "rd890_iommu\0"
+    "adl_2301\0"
+    "ns_87415\0"
+    "ns_87560_lio\0"
+    "ns_87560_usb\0"
+    "ns_83815\0"
+    "ns_83820\0"
+    "ns_gx_host_bridge\0"
+    "ns_cs5535_isa\0"
+    "ns_cs5535_ide\0"
+    "ns_cs5535_audio\0"
+    "ns_cs5535_usb\0"
+    "ns_gx_video\0"
+    "ns_saturn\0"
+    "ns_sc1100_bridge\0"
+    "ns_sc1100_smi\0"
+    "ns_sc1100_xbus\0"
+    "ns_87410\0"
+    "tseng_w32p_2\0"
+    "tseng_et6000\0"
+    "weitek_p9000\0"
+    "weitek_p9100\0"
+    "dec_brd\0"
+    "dec_tulip\0"
+    "dec_tga\0"
+    "dec_tulip_fast\0"
+    "dec_tga2\0"
+    "dec_fddi\0"
+    "dec_tulip_plus\0"
+    "dec_21142\0"
+    "dec_21052\0"
+    "dec_21150\0"
+    "dec_21152\0"
+    "dec_21153\0"
+    "dec_21154\0"
+    "compaq_42xx\0"
+    "dec_21285\0"
+    "cirrus_7548\0"
+    "cirrus_5430\0"
+    "cirrus_5434_4\0"
+    "cirrus_5434_8\0"
+    "cirrus_5436\0"
+    "cirrus_5446\0"
+    "cirrus_5480\0"
+    "cirrus_5462\0"
+    "cirrus_5464\0"
+    "cirrus_5465\0"
+    "cirrus_6729\0"
+    "cirrus_6832\0"
+    "cirrus_7543\0"
+    "cirrus_4610\0"
+    "cirrus_4612\0"
+    "cirrus_4615\0"
+    "ibm_tr\0"
+    "ibm_icom_dev_id_1\0"
+    "ibm_tr_wake\0"
+    "ibm_cpc710_pci64\0"
+    "ibm_snipe\0"
+    "ibm_icom_dev_id_2\0"
+    "ibm_icom_v2_two_ports_rvx\0"
+    "ibm_icom_v2_one_port_rvx_one_port_mdm\0"
+    "ibm_icom_four_port_model\0"
+    "ibm_citrine\0"
+    "ibm_obsidian\0"
+    "ibm_icom_v2_one_port_rvx_one_port_mdm_pcie\0"
+    "ibm_gemstone\0"
+    "unisys_dma_director\0"
+    "compex2_100vg\0"
+    "wd_90c\0"
+    "ami_megaraid3\0"
+    "ami_megaraid\0"
+    "ami_megaraid2\0"
+    "amd_k8_nb\0"
+    "amd_k8_nb_addrmap\0"
+    "amd_k8_nb_memctl\0"
+    "amd_k8_nb_misc\0"
+    "amd_10h_nb_ht\0"
+    "amd_10h_nb_map\0"
+    "amd_10h_nb_dram\0"
+    "amd_10h_nb_misc\0"
+    "amd_10h_nb_link\0"
+    "amd_11h_nb_ht\0"
+    "amd_11h_nb_map\0"
+    "amd_11h_nb_dram\0"
+    "amd_11h_nb_misc\0"
+    "amd_11h_nb_link\0"
+    "amd_15h_m10h_f3\0"
+    "amd_16h_nb_f3\0"
+    "amd_16h_nb_f4\0"
+    "amd_15h_nb_f0\0"
+    "amd_15h_nb_f1\0"
+    "amd_15h_nb_f2\0"
+    "amd_15h_nb_f3\0"
+    "amd_15h_nb_f4\0"
+    "amd_15h_nb_f5\0"
+    "amd_cnb17h_f3\0"
+    "amd_lance\0"
+    "amd_lance_home\0"
+    "amd_scsi\0"
+    "amd_lx_video\0"
+    "amd_lx_aes\0"
+    "amd_cs5535_ide\0"
+    "amd_cs5536_isa\0"
+    "amd_cs5536_flash\0"
+    "amd_cs5536_audio\0"
+    "amd_cs5536_ohc\0"
+    "amd_cs5536_ehc\0"
+    "amd_cs5536_udc\0"
+    "amd_cs5536_uoc\0"
+    "amd_cs5536_ide\0"
+    "amd_serenade\0"
+    "amd_fe_gate_7006\0"
+    "amd_fe_gate_7007\0"
+    "amd_fe_gate_700c\0"
+    "amd_fe_gate_700e\0"
+    "amd_cobra_7401\0"
+    "amd_viper_7409\0"
+    "amd_viper_740b\0"
+    "amd_viper_7410\0"
+    "amd_viper_7411\0"
+    "amd_viper_7413\0"
+    "amd_viper_7440\0"
+    "amd_opus_7441\0"
+    "amd_opus_7443\0"
+    "amd_opus_7445\0"
+    "amd_8131_bridge\0"
+    "amd_8131_apic\0"
+    "amd_8151_0\0"
+    "amd_8132_bridge\0"
+    "amd_8111_pci\0"
+    "amd_8111_lpc\0"
+    "amd_8111_ide\0"
+    "amd_8111_smbus2\0"
+    "amd_8111_smbus\0"
+    "amd_8111_audio\0"
+    "amd_hudson2_sata_ide\0"
+    "amd_hudson2_smbus\0"
+    "amd_hudson2_ide\0"
+    "trident_4dwave_dx\0"
+    "trident_4dwave_nx\0"
+    "trident_8400\0"
+    "trident_8420\0"
+    "trident_8500\0"
+    "trident_9320\0"
+    "trident_9388\0"
+    "trident_9397\0"
+    "trident_939a\0"
+    "trident_9420\0"
+    "trident_9440\0"
+    "trident_9520\0"
+    "trident_9525\0"
+    "trident_9660\0"
+    "trident_9750\0"
+    "trident_9850\0"
+    "trident_9880\0"
+    "ai_m1435\0"
+    "dell_raciii\0"
+    "dell_rac4\0"
+    "dell_perc5\0"
+    "matrox_mga_2\0"
+    "matrox_mil\0"
+    "matrox_mys\0"
+    "matrox_mil_2\0"
+    "matrox_mys_agp\0"
+    "matrox_mil_2_agp\0"
+    "matrox_g200_pci\0"
+    "matrox_g200_agp\0"
+    "matrox_g400\0"
+    "matrox_g200ev_pci\0"
+    "matrox_mga_imp\0"
+    "matrox_g100_mm\0"
+    "matrox_g100_agp\0"
+    "matrox_g550\0"
+    "matrox_via\0"
+    "ct_69000\0"
+    "ct_65545\0"
+    "ct_65548\0"
+    "ct_65550\0"
+    "ct_65554\0"
+    "ct_65555\0"
+    "toshiba_tc35815cf\0"
+    "toshiba_tc35815_nwu\0"
+    "toshiba_tc35815_tx4939\0"
+    "toshiba_tc86c001_ide\0"
+    "toshiba_tc86c001_misc\0"
+    "toshiba_spider_net\0"
+    "miro_36050\0"
+    "miro_dc10plus\0"
+    "miro_dc30plus\0"
+    "nec_cbus_1\0"
+    "nec_local\0"
+    "nec_atm\0"
+    "nec_r4000\0"
+    "nec_486\0"
+    "nec_accel_1\0"
+    "nec_uxbus\0"
+    "nec_accel_2\0"
+    "nec_graph\0"
+    "nec_vl\0"
+    "nec_staralpha2\0"
+    "nec_cbus_2\0"
+    "nec_usb\0"
+    "nec_cbus_3\0"
+    "nec_napccard\0"
+    "nec_pcx2\0"
+    "nec_vrc5476\0"
+    "nec_vrc4173\0"
+    "nec_vrc5477_ac97\0"
+    "nec_pc9821cs01\0"
+    "nec_pc9821nrb06\0"
+    "fd_36c70\0"
+    "si_5591_agp\0"
+    "si_6202\0"
+    "si_503\0"
+    "si_acpi\0"
+    "si_smbus\0"
+    "si_lpc\0"
+    "si_5597_vga\0"
+    "si_6205\0"
+    "si_300\0"
+    "si_315h\0"
+    "si_315\0"
+    "si_315pro\0"
+    "si_501\0"
+    "si_496\0"
+    "si_530\0"
+    "si_540\0"
+    "si_550\0"
+    "si_620\0"
+    "si_630\0"
+    "si_633\0"
+    "si_635\0"
+    "si_640\0"
+    "si_645\0"
+    "si_646\0"
+    "si_648\0"
+    "si_650\0"
+    "si_651\0"
+    "si_655\0"
+    "si_661\0"
+    "si_730\0"
+    "si_733\0"
+    "si_735\0"
+    "si_740\0"
+    "si_741\0"
+    "si_745\0"
+    "si_746\0"
+    "si_755\0"
+    "si_760\0"
+    "si_900\0"
+    "si_961\0"
+    "si_962\0"
+    "si_963\0"
+    "si_965\0"
+    "si_966\0"
+    "si_968\0"
+    "si_1180\0"
+    "si_540_vga\0"
+    "si_550_vga\0"
+    "si_5511\0"
+    "si_5513\0"
+    "si_5517\0"
+    "si_5518\0"
+    "si_5571\0"
+    "si_5581\0"
+    "si_5582\0"
+    "si_5591\0"
+    "si_5596\0"
+    "si_5597\0"
+    "si_5598\0"
+    "si_5600\0"
+    "si_630_vga\0"
+    "si_7012\0"
+    "si_7013\0"
+    "si_7016\0"
+    "si_7018\0"
+    "hp_visualize_eg\0"
+    "hp_visualize_fx6\0"
+    "hp_visualize_fx4\0"
+    "hp_visualize_fx2\0"
+    "hp_tachyon\0"
+    "hp_tachlite\0"
+    "hp_j2585a\0"
+    "hp_j2585b\0"
+    "hp_j2973a\0"
+    "hp_j2970a\0"
+    "hp_diva\0"
+    "hp_diva_tosca1\0"
+    "hp_diva_tosca2\0"
+    "hp_diva_maestro\0"
+    "hp_visualize_fxe\0"
+    "hp_reo_ioc\0"
+    "hp_diva_halfdome\0"
+    "hp_diva_keystone\0"
+    "hp_diva_powerbar\0"
+    "hp_zx1_ioc\0"
+    "hp_pcix_lba\0"
+    "hp_sx1000_ioc\0"
+    "hp_diva_everest\0"
+    "hp_diva_aux\0"
+    "hp_diva_rmp3\0"
+    "hp_diva_hurricane\0"
+    "hp_cissa\0"
+    "hp_cissc\0"
+    "hp_cissd\0"
+    "hp_cisse\0"
+    "hp_cissf\0"
+    "hp_cissh\0"
+    "hp_zx2_ioc\0"
+    "pctech_rz1000\0"
+    "pctech_rz1001\0"
+    "pctech_samurai_ide\0"
+    "asustek_0675\0"
+    "opti_82c558\0"
+    "opti_82c621\0"
+    "opti_82c700\0"
+    "opti_82c825\0"
+    "elsa_microlink\0"
+    "elsa_qs3000\0"
+    "stmicro_usb_host\0"
+    "stmicro_usb_ohci\0"
+    "stmicro_usb_otg\0"
+    "stmicro_uart_hwfc\0"
+    "stmicro_uart_no_hwfc\0"
+    "stmicro_soc_dma\0"
+    "stmicro_sata\0"
+    "stmicro_i2c\0"
+    "stmicro_spi_hs\0"
+    "stmicro_mac\0"
+    "stmicro_sdio_emmc\0"
+    "stmicro_sdio\0"
+    "stmicro_gpio\0"
+    "stmicro_vip\0"
+    "stmicro_audio_router_dma\0"
+    "stmicro_audio_router_srcs\0"
+    "stmicro_audio_router_msps\0"
+    "stmicro_can\0"
+    "stmicro_mlb\0"
+    "stmicro_dbp\0"
+    "stmicro_sata_phy\0"
+    "stmicro_esram\0"
+    "stmicro_vic\0"
+    "buslogic_multimaster_nc\0"
+    "buslogic_multimaster\0"
+    "buslogic_flashpoint\0"
+    "ti_tvp4020\0"
+    "ti_4450\0"
+    "ti_xx21_xx11\0"
+    "ti_xx21_xx11_fm\0"
+    "ti_xx21_xx11_sd\0"
+    "ti_x515\0"
+    "ti_xx12\0"
+    "ti_xx12_fm\0"
+    "ti_xio2000a\0"
+    "ti_1130\0"
+    "ti_1031\0"
+    "ti_1131\0"
+    "ti_1250\0"
+    "ti_1220\0"
+    "ti_1221\0"
+    "ti_1210\0"
+    "ti_1450\0"
+    "ti_1225\0"
+    "ti_1251a\0"
+    "ti_1211\0"
+    "ti_1251b\0"
+    "ti_4410\0"
+    "ti_4451\0"
+    "ti_4510\0"
+    "ti_4520\0"
+    "ti_7510\0"
+    "ti_7610\0"
+    "ti_7410\0"
+    "ti_1410\0"
+    "ti_1420\0"
+    "ti_1451a\0"
+    "ti_1620\0"
+    "ti_1520\0"
+    "ti_1510\0"
+    "ti_x620\0"
+    "ti_x420\0"
+    "ti_xx20_fm\0"
+    "winbond2_89c940f\0"
+    "winbond2_6692\0"
+    "anigma_mc145575\0"
+    "efar_slc90e66_1\0"
+    "efar_slc90e66_3\0"
+    "motorola_mpc105\0"
+    "motorola_mpc106\0"
+    "motorola_mpc107\0"
+    "motorola_raven\0"
+    "motorola_falcon\0"
+    "motorola_hawk\0"
+    "motorola_harrier\0"
+    "motorola_mpc5200\0"
+    "motorola_mpc5200b\0"
+    "promise_20265\0"
+    "promise_20263\0"
+    "promise_20275\0"
+    "promise_20267\0"
+    "promise_20246\0"
+    "promise_20262\0"
+    "promise_20268\0"
+    "promise_20269\0"
+    "promise_20276\0"
+    "promise_20270\0"
+    "promise_20271\0"
+    "promise_20277\0"
+    "umc_um8673f\0"
+    "umc_um8886bf\0"
+    "umc_um8886a\0"
+    "picopower_pt86c523\0"
+    "picopower_pt86c523bbp\0"
+    "mylex_dac960_p\0"
+    "mylex_dac960_pd\0"
+    "mylex_dac960_pg\0"
+    "mylex_dac960_la\0"
+    "mylex_dac960_lp\0"
+    "mylex_dac960_gem\0"
+    "mylex_dac960_ba\0"
+    "apple_bandit\0"
+    "apple_hydra\0"
+    "apple_uni_n_fw\0"
+    "apple_uni_n_agp\0"
+    "apple_uni_n_gmac\0"
+    "apple_uni_n_gmacp\0"
+    "apple_uni_n_agp_p\0"
+    "apple_uni_n_agp15\0"
+    "apple_uni_n_pci15\0"
+    "apple_uni_n_gmac2\0"
+    "apple_uni_n_ata\0"
+    "apple_uni_n_agp2\0"
+    "apple_ipid_ata100\0"
+    "apple_k2_ata100\0"
+    "apple_u3_agp\0"
+    "apple_k2_gmac\0"
+    "apple_sh_ata\0"
+    "apple_sh_sungem\0"
+    "apple_u3l_agp\0"
+    "apple_u3h_agp\0"
+    "apple_u4_pcie\0"
+    "apple_ipid2_agp\0"
+    "apple_ipid2_ata\0"
+    "apple_ipid2_fw\0"
+    "apple_ipid2_gmac\0"
+    "apple_tigon3\0"
+    "yamaha_724\0"
+    "yamaha_740\0"
+    "yamaha_740c\0"
+    "yamaha_724f\0"
+    "yamaha_744\0"
+    "yamaha_754\0"
+    "qlogic_isp10160\0"
+    "qlogic_isp1020\0"
+    "qlogic_isp1080\0"
+    "qlogic_isp12160\0"
+    "qlogic_isp1240\0"
+    "qlogic_isp1280\0"
+    "qlogic_isp2100\0"
+    "qlogic_isp2200\0"
+    "qlogic_isp2300\0"
+    "qlogic_isp2312\0"
+    "qlogic_isp2322\0"
+    "qlogic_isp2422\0"
+    "qlogic_isp2432\0"
+    "qlogic_isp2512\0"
+    "qlogic_isp2522\0"
+    "qlogic_isp5422\0"
+    "qlogic_isp5432\0"
+    "qlogic_isp6312\0"
+    "qlogic_isp6322\0"
+    "cyrix_5510\0"
+    "cyrix_pci_master\0"
+    "cyrix_5520\0"
+    "cyrix_5530_legacy\0"
+    "cyrix_5530_ide\0"
+    "cyrix_5530_audio\0"
+    "cyrix_5530_video\0"
+    "contaq_82c693\0"
+    "olicom_oc2325\0"
+    "olicom_oc2183\0"
+    "olicom_oc2326\0"
+    "sun_ebus\0"
+    "sun_happymeal\0"
+    "sun_rio_ebus\0"
+    "sun_rio_gem\0"
+    "sun_rio_1394\0"
+    "sun_rio_usb\0"
+    "sun_gem\0"
+    "sun_simba\0"
+    "sun_pbm\0"
+    "sun_schizo\0"
+    "sun_sabre\0"
+    "sun_hummingbird\0"
+    "sun_tomatillo\0"
+    "sun_cassini\0"
+    "ni_pxi8430_2322\0"
+    "ni_pci8430_2322\0"
+    "ni_pxi8430_2324\0"
+    "ni_pci8430_2324\0"
+    "ni_pxi8430_2328\0"
+    "ni_pci8430_2328\0"
+    "ni_pxi8430_23216\0"
+    "ni_pci8430_23216\0"
+    "ni_pxi8432_2322\0"
+    "ni_pci8432_2322\0"
+    "ni_pxi8432_2324\0"
+    "ni_pci8432_2324\0"
+    "ni_pci2322\0"
+    "ni_pci2324\0"
+    "ni_pci2328\0"
+    "ni_pxi8422_2322\0"
+    "ni_pxi8422_2324\0"
+    "ni_pxi8420_2322\0"
+    "ni_pxi8420_2324\0"
+    "ni_pxi8420_2328\0"
+    "ni_pxi8420_23216\0"
+    "ni_pci2322i\0"
+    "ni_pci2324i\0"
+    "ni_pci23216\0"
+    "sii_1210sa\0"
+    "cmd_643\0"
+    "cmd_646\0"
+    "cmd_648\0"
+    "cmd_649\0"
+    "sii_680\0"
+    "sii_3112\0"
+    "brooktree_878\0"
+    "brooktree_879\0"
+    "sgi_ioc3\0"
+    "sgi_lithium\0"
+    "sgi_ioc4\0"
+    "winbond_82c105\0"
+    "winbond_83c553\0"
+    "plx_r685\0"
+    "plx_romulus\0"
+    "plx_spcom800\0"
+    "plx_1077\0"
+    "plx_spcom200\0"
+    "plx_djinn_itoo\0"
+    "plx_r753\0"
+    "plx_olitec\0"
+    "plx_pci200syn\0"
+    "plx_9030\0"
+    "plx_9050\0"
+    "plx_9056\0"
+    "plx_9080\0"
+    "plx_gtek_serial2\0"
+    "madge_mk2\0"
+    "3com_3c985\0"
+    "3com_3c940\0"
+    "3com_3c339\0"
+    "3com_3c359\0"
+    "3com_3c940b\0"
+    "3com_3cr990\0"
+    "3com_3cr990_tx_95\0"
+    "3com_3cr990_tx_97\0"
+    "3com_3cr990b\0"
+    "3com_3cr990_fx\0"
+    "3com_3cr990svr95\0"
+    "3com_3cr990svr97\0"
+    "3com_3cr990svr\0"
+    "al_m1533\0"
+    "al_m1535\0"
+    "al_m1541\0"
+    "al_m1563\0"
+    "al_m1621\0"
+    "al_m1631\0"
+    "al_m1632\0"
+    "al_m1641\0"
+    "al_m1644\0"
+    "al_m1647\0"
+    "al_m1651\0"
+    "al_m1671\0"
+    "al_m1681\0"
+    "al_m1683\0"
+    "al_m1689\0"
+    "al_m5219\0"
+    "al_m5228\0"
+    "al_m5229\0"
+    "al_m5451\0"
+    "al_m7101\0"
+    "neomagic_nm256av_audio\0"
+    "neomagic_nm256zx_audio\0"
+    "neomagic_nm256xl_plus_audio\0"
+    "tconrad_tokenring\0"
+    "nvidia_tnt\0"
+    "nvidia_tnt2\0"
+    "nvidia_utnt2\0"
+    "nvidia_tnt_unknown\0"
+    "nvidia_vtnt2\0"
+    "nvidia_uvtnt2\0"
+    "nvidia_nforce_mcp04_smbus\0"
+    "nvidia_nforce_mcp04_ide\0"
+    "nvidia_nforce_mcp04_sata\0"
+    "nvidia_nforce_mcp04_sata2\0"
+    "nvidia_geforce_6800_ultra\0"
+    "nvidia_geforce_6800\0"
+    "nvidia_geforce_6800_le\0"
+    "nvidia_geforce_6800_gt\0"
+    "nvidia_quadro_fx_4000\0"
+    "nvidia_nforce4_smbus\0"
+    "nvidia_nforce_ck804_ide\0"
+    "nvidia_nforce_ck804_sata\0"
+    "nvidia_nforce_ck804_sata2\0"
+    "nvidia_ck804_audio\0"
+    "nvidia_ck804_pcie\0"
+    "nvidia_nforce2_smbus\0"
+    "nvidia_nforce2_ide\0"
+    "nvidia_mcp2_modem\0"
+    "nvidia_mcp2_audio\0"
+    "nvidia_nforce2s_smbus\0"
+    "nvidia_nforce2s_ide\0"
+    "nvidia_mcp2s_modem\0"
+    "nvidia_ck8_audio\0"
+    "nvidia_nforce2s_sata\0"
+    "nvidia_geforce_7800_gt\0"
+    "nvidia_geforce_7800_gtx\0"
+    "nvidia_geforce_go_7800\0"
+    "nvidia_geforce_go_7800_gtx\0"
+    "nvidia_itnt2\0"
+    "geforce_6800a\0"
+    "geforce_6800a_le\0"
+    "geforce_go_6800\0"
+    "geforce_go_6800_ultra\0"
+    "quadro_fx_go1400\0"
+    "quadro_fx_1400\0"
+    "nvidia_nforce3\0"
+    "nvidia_nforce3_smbus\0"
+    "nvidia_nforce3_ide\0"
+    "nvidia_mcp3_modem\0"
+    "nvidia_mcp3_audio\0"
+    "nvidia_nforce3s\0"
+    "nvidia_nforce3s_sata\0"
+    "nvidia_nforce3s_smbus\0"
+    "nvidia_nforce3s_ide\0"
+    "nvidia_ck8s_audio\0"
+    "nvidia_nforce3s_sata2\0"
+    "nvidia_geforce_sdr\0"
+    "nvidia_geforce_ddr\0"
+    "nvidia_quadro\0"
+    "nvidia_geforce2_mx\0"
+    "nvidia_geforce2_mx2\0"
+    "nvidia_geforce2_go\0"
+    "nvidia_quadro2_mxr\0"
+    "nvidia_geforce_6600_gt\0"
+    "nvidia_geforce_6600\0"
+    "nvidia_geforce_6610_xl\0"
+    "nvidia_quadro_fx_540\0"
+    "nvidia_geforce_6200\0"
+    "nvidia_geforce2_gts\0"
+    "nvidia_geforce2_gts2\0"
+    "nvidia_geforce2_ultra\0"
+    "nvidia_quadro2_pro\0"
+    "nvidia_geforce_6200_turbocache\0"
+    "nvidia_geforce_go_6200\0"
+    "nvidia_geforce_go_6250\0"
+    "nvidia_geforce_go_6200_1\0"
+    "nvidia_geforce_go_6250_1\0"
+    "nvidia_geforce4_mx_460\0"
+    "nvidia_geforce4_mx_440\0"
+    "nvidia_geforce4_mx_420\0"
+    "nvidia_geforce4_mx_440_se\0"
+    "nvidia_geforce4_440_go\0"
+    "nvidia_geforce4_420_go\0"
+    "nvidia_geforce4_420_go_m32\0"
+    "nvidia_geforce4_460_go\0"
+    "nvidia_quadro4_500xgl\0"
+    "nvidia_geforce4_440_go_m64\0"
+    "nvidia_quadro4_200\0"
+    "nvidia_quadro4_550xgl\0"
+    "nvidia_quadro4_500_gogl\0"
+    "nvidia_geforce4_410_go_m16\0"
+    "nvidia_geforce4_mx_440_8x\0"
+    "nvidia_geforce4_mx_440se_8x\0"
+    "nvidia_geforce4_mx_420_8x\0"
+    "nvidia_geforce4_mx_4000\0"
+    "nvidia_geforce4_448_go\0"
+    "nvidia_geforce4_488_go\0"
+    "nvidia_quadro4_580_xgl\0"
+    "nvidia_geforce4_mx_mac\0"
+    "nvidia_quadro4_280_nvs\0"
+    "nvidia_quadro4_380_xgl\0"
+    "nvidia_igeforce2\0"
+    "nvidia_nforce\0"
+    "nvidia_mcp1_audio\0"
+    "nvidia_nforce_smbus\0"
+    "nvidia_nforce_ide\0"
+    "nvidia_mcp1_modem\0"
+    "nvidia_nforce2\0"
+    "nvidia_geforce3\0"
+    "nvidia_geforce3_1\0"
+    "nvidia_geforce3_2\0"
+    "nvidia_quadro_ddc\0"
+    "nvidia_geforce_6800b\0"
+    "nvidia_geforce_6800b_le\0"
+    "nvidia_geforce_6800b_gt\0"
+    "nvidia_geforce4_ti_4600\0"
+    "nvidia_geforce4_ti_4400\0"
+    "nvidia_geforce4_ti_4200\0"
+    "nvidia_quadro4_900xgl\0"
+    "nvidia_quadro4_750xgl\0"
+    "nvidia_quadro4_700xgl\0"
+    "nvidia_nforce_mcp51_smbus\0"
+    "nvidia_nforce_mcp51_ide\0"
+    "nvidia_nforce_mcp51_sata\0"
+    "nvidia_nforce_mcp51_sata2\0"
+    "nvidia_geforce4_ti_4800\0"
+    "nvidia_geforce4_ti_4800_8x\0"
+    "nvidia_geforce4_ti_4800se\0"
+    "nvidia_geforce4_4200_go\0"
+    "nvidia_quadro4_980_xgl\0"
+    "nvidia_quadro4_780_xgl\0"
+    "nvidia_quadro4_700_gogl\0"
+    "nvidia_geforce_fx_5800_ultra\0"
+    "nvidia_geforce_fx_5800\0"
+    "nvidia_quadro_fx_2000\0"
+    "nvidia_quadro_fx_1000\0"
+    "nvidia_geforce_fx_5600_ultra\0"
+    "nvidia_geforce_fx_5600\0"
+    "nvidia_geforce_fx_5600se\0"
+    "nvidia_geforce_fx_go5600\0"
+    "nvidia_geforce_fx_go5650\0"
+    "nvidia_quadro_fx_go700\0"
+    "nvidia_geforce_fx_5200\0"
+    "nvidia_geforce_fx_5200_ultra\0"
+    "nvidia_geforce_fx_5200_1\0"
+    "nvidia_geforce_fx_5200se\0"
+    "nvidia_geforce_fx_go5200\0"
+    "nvidia_geforce_fx_go5250\0"
+    "nvidia_geforce_fx_5500\0"
+    "nvidia_geforce_fx_5100\0"
+    "nvidia_geforce_fx_go5250_32\0"
+    "nvidia_geforce_fx_go_5200\0"
+    "nvidia_quadro_nvs_280_pci\0"
+    "nvidia_quadro_fx_500\0"
+    "nvidia_geforce_fx_go5300\0"
+    "nvidia_geforce_fx_go5100\0"
+    "nvidia_geforce_fx_5900_ultra\0"
+    "nvidia_geforce_fx_5900\0"
+    "nvidia_geforce_fx_5900xt\0"
+    "nvidia_geforce_fx_5950_ultra\0"
+    "nvidia_geforce_fx_5900zt\0"
+    "nvidia_quadro_fx_3000\0"
+    "nvidia_quadro_fx_700\0"
+    "nvidia_geforce_fx_5700_ultra\0"
+    "nvidia_geforce_fx_5700\0"
+    "nvidia_geforce_fx_5700le\0"
+    "nvidia_geforce_fx_5700ve\0"
+    "nvidia_geforce_fx_go5700_1\0"
+    "nvidia_geforce_fx_go5700_2\0"
+    "nvidia_quadro_fx_go1000\0"
+    "nvidia_quadro_fx_1100\0"
+    "nvidia_mcp55_bridge_v0\0"
+    "nvidia_mcp55_bridge_v4\0"
+    "nvidia_nforce_mcp55_smbus\0"
+    "nvidia_nforce_mcp55_ide\0"
+    "nvidia_nvenet_15\0"
+    "nvidia_nforce_mcp55_sata\0"
+    "nvidia_nforce_mcp55_sata2\0"
+    "nvidia_nforce_mcp61_sata\0"
+    "nvidia_nforce_mcp61_smbus\0"
+    "nvidia_nforce_mcp61_ide\0"
+    "nvidia_nforce_mcp61_sata2\0"
+    "nvidia_nforce_mcp61_sata3\0"
+    "nvidia_nforce_mcp65_smbus\0"
+    "nvidia_nforce_mcp65_ide\0"
+    "nvidia_nforce_mcp67_smbus\0"
+    "nvidia_nforce_mcp67_ide\0"
+    "nvidia_nforce_mcp73_ide\0"
+    "nvidia_nforce_mcp78s_smbus\0"
+    "nvidia_nforce_mcp77_ide\0"
+    "nvidia_nforce_mcp73_smbus\0"
+    "nvidia_nforce_mcp79_smbus\0"
+    "nvidia_nforce_mcp89_sata\0"
+    "ims_tt128\0"
+    "ims_tt3d\0"
+    "interg_1682\0"
+    "interg_2000\0"
+    "interg_2010\0"
+    "interg_5000\0"
+    "interg_5050\0"
+    "realtek_8139\0"
+    "rme_digi96\0"
+    "rme_digi96_8\0"
+    "rme_digi96_8_pro\0"
+    "rme_digi96_8_pad_or_pst\0"
+    "xilinx_hammerfall_dsp\0"
+    "xilinx_hammerfall_dsp_madi\0"
+    "creative_emu10k1\0"
+    "creative_20k1\0"
+    "creative_20k2\0"
+    "ectiva_ev1938\0"
+    "tti_hpt343\0"
+    "tti_hpt366\0"
+    "tti_hpt372\0"
+    "tti_hpt302\0"
+    "tti_hpt371\0"
+    "tti_hpt374\0"
+    "tti_hpt372n\0"
+    "via_8763_0\0"
+    "via_8380_0\0"
+    "via_3238_0\0"
+    "via_pt880\0"
+    "via_px8x0_0\0"
+    "via_3269_0\0"
+    "via_k8t800pro_0\0"
+    "via_3296_0\0"
+    "via_8363_0\0"
+    "via_pt880ultra\0"
+    "via_p4m800ce\0"
+    "via_vt3324\0"
+    "via_p4m890\0"
+    "via_vt3336\0"
+    "via_vt3351\0"
+    "via_vt3364\0"
+    "via_8371_0\0"
+    "via_6415\0"
+    "via_8501_0\0"
+    "via_82c561\0"
+    "via_82c586_1\0"
+    "via_82c576\0"
+    "via_cx700_ide\0"
+    "via_82c586_0\0"
+    "via_82c596\0"
+    "via_82c597_0\0"
+    "via_82c598_0\0"
+    "via_8601_0\0"
+    "via_8605_0\0"
+    "via_82c686\0"
+    "via_82c691_0\0"
+    "via_82c576_1\0"
+    "via_82c586_2\0"
+    "via_82c586_3\0"
+    "via_82c596_3\0"
+    "via_82c596b_3\0"
+    "via_82c686_4\0"
+    "via_82c686_5\0"
+    "via_8233_5\0"
+    "via_8233_0\0"
+    "via_8633_0\0"
+    "via_8367_0\0"
+    "via_8653_0\0"
+    "via_8622\0"
+    "via_8235_usb_2\0"
+    "via_8233c_0\0"
+    "via_8361\0"
+    "via_xm266\0"
+    "via_612x\0"
+    "via_862x_0\0"
+    "via_8753_0\0"
+    "via_8233a\0"
+    "via_8703_51_0\0"
+    "via_8237_sata\0"
+    "via_xn266\0"
+    "via_6410\0"
+    "via_8754c_0\0"
+    "via_8235\0"
+    "via_8385_0\0"
+    "via_8377_0\0"
+    "via_8378_0\0"
+    "via_8783_0\0"
+    "via_8237\0"
+    "via_8251\0"
+    "via_8237a\0"
+    "via_8237s\0"
+    "via_8261\0"
+    "via_sata_eide\0"
+    "via_8231\0"
+    "via_8231_4\0"
+    "via_8365_1\0"
+    "via_cx700\0"
+    "via_vx800\0"
+    "via_8371_1\0"
+    "via_vx855\0"
+    "via_vx900\0"
+    "via_82c598_1\0"
+    "via_838x_1\0"
+    "via_83_87xx_1\0"
+    "via_vx855_ide\0"
+    "via_anon\0"
+    "siemens_dscc4\0"
+    "vortex_gdt6000b\0"
+    "vortex_gdt6530\0"
+    "vortex_gdt6550\0"
+    "vortex_gdt6537\0"
+    "vortex_gdt6557\0"
+    "vortex_gdt6535\0"
+    "vortex_gdt6555\0"
+    "vortex_gdt6537rp\0"
+    "vortex_gdt6557rp\0"
+    "ef_atm_fpga\0"
+    "ef_atm_asic\0"
+    "ef_atm_lanai2\0"
+    "ef_atm_lanaihb\0"
+    "idt_idt77201\0"
+    "fore_pca200e\0"
+    "philips_saa7146\0"
+    "philips_saa9730\0"
+    "eicon_diva20\0"
+    "eicon_diva20_u\0"
+    "eicon_diva201\0"
+    "eicon_diva202\0"
+    "eicon_maestra\0"
+    "eicon_maestraq\0"
+    "eicon_maestraq_u\0"
+    "eicon_maestrap\0"
+    "ziatech_5550_hc\0"
+    "syskonnect_tr\0"
+    "syskonnect_ge\0"
+    "syskonnect_yu\0"
+    "syskonnect_9dxx\0"
+    "syskonnect_9mxx\0"
+    "digi_df_m_iom2_e\0"
+    "digi_df_m_e\0"
+    "digi_df_m_iom2_a\0"
+    "digi_df_m_a\0"
+    "digi_neo_8\0"
+    "neo_2db9\0"
+    "neo_2db9pri\0"
+    "neo_2rj45\0"
+    "neo_2rj45pri\0"
+    "xircom_rbm56g\0"
+    "xircom_x3201_mdm\0"
+    "serverworks_he\0"
+    "serverworks_le\0"
+    "serverworks_gcnb_le\0"
+    "serverworks_ht1000_pxb\0"
+    "serverworks_epb\0"
+    "serverworks_ht2000_pcie\0"
+    "serverworks_osb4\0"
+    "serverworks_csb5\0"
+    "serverworks_csb6\0"
+    "serverworks_ht1000sb\0"
+    "serverworks_osb4ide\0"
+    "serverworks_csb5ide\0"
+    "serverworks_csb6ide\0"
+    "serverworks_ht1000ide\0"
+    "serverworks_csb6ide2\0"
+    "serverworks_csb6lpc\0"
+    "serverworks_ht1100ld\0"
+    "sbe_wanxl400\0"
+    "sbe_wanxl100\0"
+    "sbe_wanxl200\0"
+    "toshiba_piccolo_1\0"
+    "toshiba_piccolo_2\0"
+    "toshiba_piccolo_3\0"
+    "toshiba_piccolo_5\0"
+    "toshiba_topic95\0"
+    "toshiba_topic97\0"
+    "toshiba_topic100\0"
+    "ricoh_rl5c465\0"
+    "ricoh_rl5c466\0"
+    "ricoh_rl5c475\0"
+    "ricoh_rl5c476\0"
+    "ricoh_rl5c478\0"
+    "ricoh_r5c822\0"
+    "ricoh_r5c832\0"
+    "ricoh_r5c843\0"
+    "ricoh_r5ce822\0"
+    "ricoh_r5ce823\0"
+    "dlink_dge510t\0"
+    "artop_atp850uf\0"
+    "artop_atp860\0"
+    "artop_atp860r\0"
+    "artop_atp865\0"
+    "artop_atp865r\0"
+    "artop_atp867a\0"
+    "artop_atp867b\0"
+    "artop_aec7610\0"
+    "artop_aec7612uw\0"
+    "artop_aec7612u\0"
+    "artop_aec7612s\0"
+    "artop_aec7612d\0"
+    "artop_aec7612suw\0"
+    "artop_8060\0"
+    "zeitnet_1221\0"
+    "zeitnet_1225\0"
+    "fujitsu_fs155\0"
+    "fujitsu_fs50\0"
+    "v3_v960\0"
+    "v3_v351\0"
+    "att_venus_modem\0"
+    "specialix_io8\0"
+    "specialix_rio\0"
+    "sega_bba\0"
+    "zoran_36057\0"
+    "zoran_36120\0"
+    "compex_enet100vg4\0"
+    "rp2_232\0"
+    "rp2_422\0"
+    "upci_rm3_8port\0"
+    "upci_rm3_4port\0"
+    "pc300_rx_2\0"
+    "pc300_rx_1\0"
+    "pc300_te_2\0"
+    "pc300_te_1\0"
+    "pc300_te_m_2\0"
+    "pc300_te_m_1\0"
+    "essential_roadrunner\0"
+    "o2_6729\0"
+    "o2_6730\0"
+    "o2_6832\0"
+    "o2_6836\0"
+    "o2_6812\0"
+    "o2_6933\0"
+    "o2_8120\0"
+    "o2_8220\0"
+    "o2_8221\0"
+    "o2_8320\0"
+    "o2_8321\0"
+    "3dfx_voodoo\0"
+    "3dfx_voodoo2\0"
+    "3dfx_banshee\0"
+    "3dfx_voodoo3\0"
+    "3dfx_voodoo5\0"
+    "avm_b1\0"
+    "avm_c4\0"
+    "avm_a1\0"
+    "avm_a1_v2\0"
+    "avm_c2\0"
+    "avm_t1\0"
+    "ess_ess1968\0"
+    "ess_ess1978\0"
+    "ess_allegro_1\0"
+    "ess_allegro\0"
+    "ess_canyon3d_2le\0"
+    "ess_canyon3d_2\0"
+    "ess_maestro3\0"
+    "ess_maestro3_1\0"
+    "ess_maestro3_hw\0"
+    "ess_maestro3_2\0"
+    "satsagem_niccy\0"
+    "ensoniq_es1371\0"
+    "ensoniq_es1370\0"
+    "ensoniq_ct5880\0"
+    "ess_ess0100\0"
+    "ite_8152\0"
+    "ite_8172\0"
+    "ite_8211\0"
+    "ite_8212\0"
+    "ite_8213\0"
+    "ite_8872\0"
+    "ite_it8330g_0\0"
+    "nvidia_sgs_riva128\0"
+    "aureal_vortex_1\0"
+    "aureal_vortex_2\0"
+    "aureal_advantage\0"
+    "lml_33r10\0"
+    "esdgmbh_cpciasio4\0"
+    "micro_memory_5415cn\0"
+    "micro_memory_5425cn\0"
+    "micro_memory_6155\0"
+    "domex_dmx3191d\0"
+    "intashield_is200\0"
+    "intashield_is400\0"
+    "quatech_qsc100\0"
+    "quatech_dsc100\0"
+    "quatech_dsc200\0"
+    "quatech_qsc200\0"
+    "quatech_esc100d\0"
+    "quatech_esc100m\0"
+    "quatech_qscp100\0"
+    "quatech_dscp100\0"
+    "quatech_qscp200\0"
+    "quatech_dscp200\0"
+    "quatech_qsclp100\0"
+    "quatech_dsclp100\0"
+    "quatech_dsc100e\0"
+    "quatech_ssclp100\0"
+    "quatech_qsclp200\0"
+    "quatech_dsclp200\0"
+    "quatech_dsc200e\0"
+    "quatech_ssclp200\0"
+    "quatech_esclp100\0"
+    "quatech_sppxp_100\0"
+    "sealevel_u530\0"
+    "sealevel_ucomm2\0"
+    "sealevel_ucomm232\0"
+    "sealevel_comm4\0"
+    "sealevel_ucomm422\0"
+    "sealevel_comm8\0"
+    "sealevel_7803\0"
+    "sealevel_ucomm8\0"
+    "hypercope_plx\0"
+    "mchip_kl5a72002\0"
+    "cnet_gigacard\0"
+    "lmc_hssi\0"
+    "lmc_ds3\0"
+    "lmc_ssi\0"
+    "lmc_t1\0"
+    "netgear_ga620\0"
+    "applicom_pcigeneric\0"
+    "applicom_pci2000ibs_can\0"
+    "applicom_pci2000pfb\0"
+    "moxa_rc7000\0"
+    "moxa_cp102\0"
+    "moxa_cp102ul\0"
+    "moxa_cp102u\0"
+    "moxa_c104\0"
+    "moxa_cp104u\0"
+    "moxa_cp104ju\0"
+    "moxa_cp104el\0"
+    "moxa_ct114\0"
+    "moxa_cp114\0"
+    "moxa_cp118u\0"
+    "moxa_cp118el\0"
+    "moxa_cp132\0"
+    "moxa_cp132u\0"
+    "moxa_cp134u\0"
+    "moxa_c168\0"
+    "moxa_cp168u\0"
+    "moxa_cp168el\0"
+    "moxa_cp204j\0"
+    "moxa_c218\0"
+    "moxa_c320\0"
+    "ccd_hfc4s\0"
+    "ccd_hfc8s\0"
+    "ccd_2bd0\0"
+    "ccd_hfce1\0"
+    "ccd_b000\0"
+    "ccd_b006\0"
+    "ccd_b007\0"
+    "ccd_b008\0"
+    "ccd_b009\0"
+    "ccd_b00a\0"
+    "ccd_b00b\0"
+    "ccd_b00c\0"
+    "ccd_b100\0"
+    "ccd_b700\0"
+    "ccd_b701\0"
+    "exar_xr17c152\0"
+    "exar_xr17c154\0"
+    "exar_xr17c158\0"
+    "exar_xr17v352\0"
+    "exar_xr17v354\0"
+    "exar_xr17v358\0"
+    "microgate_usc\0"
+    "microgate_sca\0"
+    "3ware_1000\0"
+    "3ware_7000\0"
+    "3ware_9000\0"
+    "iomega_buz\0"
+    "abocom_2bd1\0"
+    "cmedia_cm8338a\0"
+    "cmedia_cm8338b\0"
+    "cmedia_cm8738\0"
+    "cmedia_cm8738b\0"
+    "lava_dserial\0"
+    "lava_quatro_a\0"
+    "lava_quatro_b\0"
+    "lava_quattro_a\0"
+    "lava_quattro_b\0"
+    "lava_octo_a\0"
+    "lava_octo_b\0"
+    "lava_port_plus\0"
+    "lava_quad_a\0"
+    "lava_quad_b\0"
+    "lava_sserial\0"
+    "lava_port_650\0"
+    "lava_parallel\0"
+    "lava_dual_par_a\0"
+    "lava_dual_par_b\0"
+    "lava_boca_ioppar\0"
+    "timedia_1889\0"
+    "ice_1712\0"
+    "oxsemi_12pci840\0"
+    "oxsemi_16pci954\0"
+    "oxsemi_c950\0"
+    "oxsemi_16pci95n\0"
+    "oxsemi_16pci954pp\0"
+    "oxsemi_16pci952\0"
+    "oxsemi_16pci952pp\0"
+    "titan_010l\0"
+    "titan_100l\0"
+    "titan_110l\0"
+    "titan_200l\0"
+    "titan_210l\0"
+    "titan_400l\0"
+    "titan_800l\0"
+    "titan_100\0"
+    "titan_400\0"
+    "titan_800b\0"
+    "titan_200\0"
+    "panacom_quadmodem\0"
+    "panacom_dualmodem\0"
+    "afavlab_p028\0"
+    "afavlab_p030\0"
+    "tigon3_5752\0"
+    "tigon3_5752m\0"
+    "nx2_5709\0"
+    "nx2_5709s\0"
+    "tigon3_5700\0"
+    "tigon3_5701\0"
+    "tigon3_5702\0"
+    "tigon3_5703\0"
+    "tigon3_5704\0"
+    "tigon3_5704s_2\0"
+    "nx2_5706\0"
+    "nx2_5708\0"
+    "tigon3_5702fe\0"
+    "nx2_57710\0"
+    "nx2_57711\0"
+    "nx2_57711e\0"
+    "tigon3_5705\0"
+    "tigon3_5705_2\0"
+    "tigon3_5719\0"
+    "tigon3_5721\0"
+    "tigon3_5722\0"
+    "tigon3_5723\0"
+    "tigon3_5705m\0"
+    "tigon3_5705m_2\0"
+    "nx2_57712\0"
+    "nx2_57712e\0"
+    "tigon3_5714\0"
+    "tigon3_5714s\0"
+    "tigon3_5780\0"
+    "tigon3_5780s\0"
+    "tigon3_5705f\0"
+    "nx2_57712_vf\0"
+    "tigon3_5754m\0"
+    "tigon3_5755m\0"
+    "tigon3_5756\0"
+    "tigon3_5750\0"
+    "tigon3_5751\0"
+    "tigon3_5715\0"
+    "tigon3_5715s\0"
+    "tigon3_5754\0"
+    "tigon3_5755\0"
+    "tigon3_5751m\0"
+    "tigon3_5751f\0"
+    "tigon3_5787f\0"
+    "tigon3_5761e\0"
+    "tigon3_5761\0"
+    "tigon3_5764\0"
+    "nx2_57800\0"
+    "nx2_57840\0"
+    "nx2_57810\0"
+    "tigon3_5787m\0"
+    "tigon3_5782\0"
+    "tigon3_5784\0"
+    "tigon3_5786\0"
+    "tigon3_5787\0"
+    "tigon3_5788\0"
+    "tigon3_5789\0"
+    "nx2_57840_4_10\0"
+    "nx2_57840_2_20\0"
+    "nx2_57840_mf\0"
+    "nx2_57800_mf\0"
+    "tigon3_5702x\0"
+    "tigon3_5703x\0"
+    "tigon3_5704s\0"
+    "nx2_57800_vf\0"
+    "nx2_5706s\0"
+    "nx2_5708s\0"
+    "nx2_57840_vf\0"
+    "nx2_57810_mf\0"
+    "nx2_57810_vf\0"
+    "tigon3_5702a3\0"
+    "tigon3_5703a3\0"
+    "tigon3_5781\0"
+    "tigon3_5753\0"
+    "tigon3_5753m\0"
+    "tigon3_5753f\0"
+    "tigon3_5901\0"
+    "tigon3_5901_2\0"
+    "tigon3_5906\0"
+    "tigon3_5906m\0"
+    "topic_tp560\0"
+    "mainpine_pbridge\0"
+    "ene_cb710_flash\0"
+    "ene_cb712_sd\0"
+    "ene_cb712_sd_2\0"
+    "ene_cb714_sd\0"
+    "ene_cb714_sd_2\0"
+    "ene_1211\0"
+    "ene_1225\0"
+    "ene_1410\0"
+    "ene_710\0"
+    "ene_712\0"
+    "ene_1420\0"
+    "ene_720\0"
+    "ene_722\0"
+    "syba_2p_epp\0"
+    "syba_1p_ecp\0"
+    "rastel_2port\0"
+    "vmware_vsvga2\0"
+    "vmware_vsvga\0"
+    "vmware_vmxnet\0"
+    "vmware_vmci_bus\0"
+    "vmware_pci_to_usb\0"
+    "vmware_usb_to_pll\0"
+    "vmware_pci_bridge\0"
+    "vmware_pci_expres\0"
+    "vmware_vmxnet3\0"
+    "vmware_vmemctrl\0"
+    "vmware_vhda_codec\0"
+    "vmware_vhda_audio\0"
+    "zoltrix_2bd0\0"
+    "mellanox_tavor\0"
+    "mellanox_tavor_bridge\0"
+    "mellanox_sinai_old\0"
+    "mellanox_sinai\0"
+    "mellanox_arbel_compat\0"
+    "mellanox_arbel\0"
+    "addidata_apci7500\0"
+    "addidata_apci7420\0"
+    "addidata_apci7300\0"
+    "addidata_apci7500_2\0"
+    "addidata_apci7420_2\0"
+    "addidata_apci7300_2\0"
+    "addidata_apci7500_3\0"
+    "addidata_apci7420_3\0"
+    "addidata_apci7300_3\0"
+    "addidata_apci7800_3\0"
+    "addidata_apci7800\0"
+    "quicknet_xj\0"
+    "farsite_t2p\0"
+    "farsite_t4p\0"
+    "farsite_t1u\0"
+    "farsite_t2u\0"
+    "farsite_t4u\0"
+    "farsite_te1\0"
+    "farsite_te1c\0"
+    "brocade_ct\0"
+    "brocade_fc_8g1p\0"
+    "brocade_ct_fc\0"
+    "bcm1250_pci\0"
+    "bcm1250_ht\0"
+    "cenatek_ide\0"
+    "vitesse_vsc7174\0"
+    "linksys_eg1064\0"
+    "altima_ac1000\0"
+    "altima_ac1001\0"
+    "altima_ac9100\0"
+    "altima_ac1003\0"
+    "belkin_f5d7010v7\0"
+    "areca_1110\0"
+    "areca_1120\0"
+    "areca_1130\0"
+    "areca_1160\0"
+    "areca_1170\0"
+    "areca_1200\0"
+    "areca_1201\0"
+    "areca_1202\0"
+    "areca_1210\0"
+    "areca_1220\0"
+    "areca_1230\0"
+    "areca_1260\0"
+    "areca_1270\0"
+    "areca_1280\0"
+    "areca_1380\0"
+    "areca_1381\0"
+    "areca_1680\0"
+    "areca_1681\0"
+    "s2io_win\0"
+    "herc_win\0"
+    "s2io_uni\0"
+    "herc_uni\0"
+    "rdc_d1010\0"
+    "rdc_r6020\0"
+    "rdc_r6030\0"
+    "rdc_r6040\0"
+    "rdc_r6060\0"
+    "rdc_r6061\0"
+    "sitecom_dc105v2\0"
+    "renesas_sh7781\0"
+    "renesas_sh7780\0"
+    "renesas_sh7763\0"
+    "renesas_sh7785\0"
+    "renesas_sh7786\0"
+    "solarflare_sfc4000a_0\0"
+    "solarflare_sfc4000b\0"
+    "solarflare_sfc4000a_1\0"
+    "tdi_ehci\0"
+    "attansic_l1\0"
+    "attansic_l2\0"
+    "jmicron_jmb360\0"
+    "jmicron_jmb361\0"
+    "jmicron_jmb362\0"
+    "jmicron_jmb363\0"
+    "jmicron_jmb364\0"
+    "jmicron_jmb365\0"
+    "jmicron_jmb366\0"
+    "jmicron_jmb368\0"
+    "jmicron_jmb369\0"
+    "jmicron_jmb38x_sd\0"
+    "jmicron_jmb38x_mmc\0"
+    "jmicron_jmb38x_ms\0"
+    "jmicron_jmb385_ms\0"
+    "jmicron_jmb388_sd\0"
+    "jmicron_jmb388_esd\0"
+    "jmicron_jmb390_ms\0"
+    "korenix_jetcardf0\0"
+    "korenix_jetcardf1\0"
+    "korenix_jetcardf2\0"
+    "korenix_jetcardf3\0"
+    "marvell_88alp01_nand\0"
+    "marvell_88alp01_sd\0"
+    "marvell_88alp01_ccic\0"
+    "marvell_gt64111\0"
+    "marvell_gt64260\0"
+    "marvell_mv64360\0"
+    "marvell_mv64460\0"
+    "tekram_dc290\0"
+    "tehuti_3009\0"
+    "tehuti_3010\0"
+    "tehuti_3014\0"
+    "hint_vxproii_ide\0"
+    "3dlabs_permedia2\0"
+    "3dlabs_permedia2v\0"
+    "nx2031_10gxsr\0"
+    "nx2031_10gcx4\0"
+    "nx2031_4gcu\0"
+    "nx2031_imez\0"
+    "nx2031_hmez\0"
+    "nx2031_xg_mgmt\0"
+    "nx2031_xg_mgmt2\0"
+    "aks_aladdincard\0"
+    "accessio_wdg_csm\0"
+    "s3_trio\0"
+    "s3_868\0"
+    "s3_968\0"
+    "s3_savage4\0"
+    "s3_prosavage8\0"
+    "s3_sonicvibes\0"
+    "dunord_i3000\0"
+    "xen_platform\0"
+    "dci_pccom4\0"
+    "dci_pccom8\0"
+    "dci_pccom2\0"
+    "intel_eessc\0"
+    "intel_pxhd_0\0"
+    "intel_pxhd_1\0"
+    "intel_pxh_0\0"
+    "intel_pxh_1\0"
+    "intel_pxhv\0"
+    "intel_80332_0\0"
+    "intel_80332_1\0"
+    "intel_80333_0\0"
+    "intel_80333_1\0"
+    "intel_82375\0"
+    "intel_82424\0"
+    "intel_82378\0"
+    "intel_mrst_sd0\0"
+    "intel_mrst_sd1\0"
+    "intel_mfd_sd\0"
+    "intel_mfd_sdio1\0"
+    "intel_mfd_sdio2\0"
+    "intel_mfd_emmc0\0"
+    "intel_mfd_emmc1\0"
+    "intel_mrst_sd2\0"
+    "intel_i960\0"
+    "intel_i960rm\0"
+    "intel_centerton_ilb\0"
+    "intel_8257x_sol\0"
+    "intel_82573e_sol\0"
+    "intel_82573l_sol\0"
+    "intel_82815_mc\0"
+    "intel_82815_cgc\0"
+    "intel_82092aa_0\0"
+    "intel_82437\0"
+    "intel_82371fb_0\0"
+    "intel_82371fb_1\0"
+    "intel_82371mx\0"
+    "intel_82441\0"
+    "intel_82380fb\0"
+    "intel_82439\0"
+    "intel_80960_rp\0"
+    "intel_82840_hb\0"
+    "intel_82845_hb\0"
+    "intel_ioat\0"
+    "intel_cougarpoint_lpc_min\0"
+    "intel_cougarpoint_lpc_max\0"
+    "intel_patsburg_lpc_0\0"
+    "intel_patsburg_lpc_1\0"
+    "intel_pantherpoint_xhci\0"
+    "intel_pantherpoint_lpc_min\0"
+    "intel_pantherpoint_lpc_max\0"
+    "intel_dh89xxcc_lpc_min\0"
+    "intel_dh89xxcc_lpc_max\0"
+    "intel_82801aa_0\0"
+    "intel_82801aa_1\0"
+    "intel_82801aa_3\0"
+    "intel_82801aa_5\0"
+    "intel_82801aa_6\0"
+    "intel_82801aa_8\0"
+    "intel_82801ab_0\0"
+    "intel_82801ab_1\0"
+    "intel_82801ab_3\0"
+    "intel_82801ab_5\0"
+    "intel_82801ab_6\0"
+    "intel_82801ab_8\0"
+    "intel_82801ba_0\0"
+    "intel_82801ba_2\0"
+    "intel_82801ba_4\0"
+    "intel_82801ba_6\0"
+    "intel_82801ba_8\0"
+    "intel_82801ba_9\0"
+    "intel_82801ba_10\0"
+    "intel_82801ba_11\0"
+    "intel_82801e_0\0"
+    "intel_82801e_11\0"
+    "intel_82801ca_0\0"
+    "intel_82801ca_3\0"
+    "intel_82801ca_5\0"
+    "intel_82801ca_6\0"
+    "intel_82801ca_10\0"
+    "intel_82801ca_11\0"
+    "intel_82801ca_12\0"
+    "intel_82801db_0\0"
+    "intel_82801db_1\0"
+    "intel_82801db_2\0"
+    "intel_82801db_3\0"
+    "intel_82801db_5\0"
+    "intel_82801db_6\0"
+    "intel_82801db_9\0"
+    "intel_82801db_10\0"
+    "intel_82801db_11\0"
+    "intel_82801db_12\0"
+    "intel_82801eb_0\0"
+    "intel_82801eb_1\0"
+    "intel_82801eb_3\0"
+    "intel_82801eb_5\0"
+    "intel_82801eb_6\0"
+    "intel_82801eb_11\0"
+    "intel_82801eb_12\0"
+    "intel_82801eb_13\0"
+    "intel_82820_hb\0"
+    "intel_82820_up_hb\0"
+    "intel_82850_hb\0"
+    "intel_82860_hb\0"
+    "intel_e7501_mch\0"
+    "intel_7505_0\0"
+    "intel_7205_0\0"
+    "intel_82845g_hb\0"
+    "intel_82845g_ig\0"
+    "intel_82865_hb\0"
+    "intel_82865_ig\0"
+    "intel_82875_hb\0"
+    "intel_82915g_hb\0"
+    "intel_82915g_ig\0"
+    "intel_82915gm_hb\0"
+    "intel_82915gm_ig\0"
+    "intel_esb_1\0"
+    "intel_esb_2\0"
+    "intel_esb_4\0"
+    "intel_esb_5\0"
+    "intel_esb_9\0"
+    "intel_esb_10\0"
+    "intel_5000_err\0"
+    "intel_5000_fbd0\0"
+    "intel_5000_fbd1\0"
+    "intel_ich6_0\0"
+    "intel_ich6_1\0"
+    "intel_ich6_2\0"
+    "intel_ich6_16\0"
+    "intel_ich6_17\0"
+    "intel_ich6_18\0"
+    "intel_ich6_19\0"
+    "intel_esb2_0\0"
+    "intel_esb2_14\0"
+    "intel_esb2_17\0"
+    "intel_esb2_18\0"
+    "intel_82945g_hb\0"
+    "intel_82945g_ig\0"
+    "intel_3000_hb\0"
+    "intel_82945gm_hb\0"
+    "intel_82945gm_ig\0"
+    "intel_ich7_30\0"
+    "intel_ich7_0\0"
+    "intel_ich7_1\0"
+    "intel_tgp_lpc\0"
+    "intel_ich7_31\0"
+    "intel_ich7_17\0"
+    "intel_ich7_19\0"
+    "intel_ich7_20\0"
+    "intel_ich7_21\0"
+    "intel_ich8_0\0"
+    "intel_ich8_1\0"
+    "intel_ich8_2\0"
+    "intel_ich8_3\0"
+    "intel_ich8_4\0"
+    "intel_ich8_5\0"
+    "intel_ich8_6\0"
+    "intel_ich9_0\0"
+    "intel_ich9_2\0"
+    "intel_ich9_3\0"
+    "intel_ich9_4\0"
+    "intel_ich9_7\0"
+    "intel_ich9_1\0"
+    "intel_ich9_8\0"
+    "intel_ich9_5\0"
+    "intel_ich9_6\0"
+    "intel_i7_mcr\0"
+    "intel_i7_mc_tad\0"
+    "intel_i7_mc_ras\0"
+    "intel_i7_mc_test\0"
+    "intel_i7_mc_ch0_ctrl\0"
+    "intel_i7_mc_ch0_addr\0"
+    "intel_i7_mc_ch0_rank\0"
+    "intel_i7_mc_ch0_tc\0"
+    "intel_i7_mc_ch1_ctrl\0"
+    "intel_i7_mc_ch1_addr\0"
+    "intel_i7_mc_ch1_rank\0"
+    "intel_i7_mc_ch1_tc\0"
+    "intel_i7_mc_ch2_ctrl\0"
+    "intel_i7_mc_ch2_addr\0"
+    "intel_i7_mc_ch2_rank\0"
+    "intel_i7_mc_ch2_tc\0"
+    "intel_i7_noncore_alt\0"
+    "intel_i7_noncore\0"
+    "intel_lynnfield_noncore\0"
+    "intel_lynnfield_noncore_alt\0"
+    "intel_lynnfield_noncore_rev2\0"
+    "intel_lynnfield_sad\0"
+    "intel_lynnfield_qpi_link0\0"
+    "intel_lynnfield_qpi_phy0\0"
+    "intel_lynnfield_mcr\0"
+    "intel_lynnfield_mc_tad\0"
+    "intel_lynnfield_mc_test\0"
+    "intel_lynnfield_mc_ch0_ctrl\0"
+    "intel_lynnfield_mc_ch0_addr\0"
+    "intel_lynnfield_mc_ch0_rank\0"
+    "intel_lynnfield_mc_ch0_tc\0"
+    "intel_lynnfield_mc_ch1_ctrl\0"
+    "intel_lynnfield_mc_ch1_addr\0"
+    "intel_lynnfield_mc_ch1_rank\0"
+    "intel_lynnfield_mc_ch1_tc\0"
+    "intel_lynnfield_mcr_rev2\0"
+    "intel_lynnfield_mc_tad_rev2\0"
+    "intel_lynnfield_mc_ras_rev2\0"
+    "intel_lynnfield_mc_test_rev2\0"
+    "intel_lynnfield_mc_ch0_ctrl_rev2\0"
+    "intel_lynnfield_mc_ch0_addr_rev2\0"
+    "intel_lynnfield_mc_ch0_rank_rev2\0"
+    "intel_lynnfield_mc_ch0_tc_rev2\0"
+    "intel_lynnfield_mc_ch1_ctrl_rev2\0"
+    "intel_lynnfield_mc_ch1_addr_rev2\0"
+    "intel_lynnfield_mc_ch1_rank_rev2\0"
+    "intel_lynnfield_mc_ch1_tc_rev2\0"
+    "intel_lynnfield_mc_ch2_ctrl_rev2\0"
+    "intel_lynnfield_mc_ch2_addr_rev2\0"
+    "intel_lynnfield_mc_ch2_rank_rev2\0"
+    "intel_lynnfield_mc_ch2_tc_rev2\0"
+    "intel_82855pm_hb\0"
+    "intel_ioat_tbg4\0"
+    "intel_ioat_tbg5\0"
+    "intel_ioat_tbg6\0"
+    "intel_ioat_tbg7\0"
+    "intel_x58_hub_mgmt\0"
+    "intel_ioat_tbg0\0"
+    "intel_ioat_tbg1\0"
+    "intel_ioat_tbg2\0"
+    "intel_ioat_tbg3\0"
+    "intel_82830_hb\0"
+    "intel_82830_cgc\0"
+    "intel_82855gm_hb\0"
+    "intel_82855gm_ig\0"
+    "intel_82854_hb\0"
+    "intel_82854_ig\0"
+    "intel_e7520_mch\0"
+    "intel_e7320_mch\0"
+    "intel_mch_pa\0"
+    "intel_mch_pa1\0"
+    "intel_mch_pb\0"
+    "intel_mch_pb1\0"
+    "intel_mch_pc\0"
+    "intel_mch_pc1\0"
+    "intel_e7525_mch\0"
+    "intel_ioat_cnb\0"
+    "intel_i7300_mch_err\0"
+    "intel_i7300_mch_fb0\0"
+    "intel_i7300_mch_fb1\0"
+    "intel_ioat_jsf0\0"
+    "intel_ioat_jsf1\0"
+    "intel_ioat_jsf2\0"
+    "intel_ioat_jsf3\0"
+    "intel_ioat_jsf4\0"
+    "intel_ioat_jsf5\0"
+    "intel_ioat_jsf6\0"
+    "intel_ioat_jsf7\0"
+    "intel_ioat_jsf8\0"
+    "intel_ioat_jsf9\0"
+    "intel_ich10_0\0"
+    "intel_ich10_1\0"
+    "intel_ich10_2\0"
+    "intel_ich10_3\0"
+    "intel_ich10_4\0"
+    "intel_ich10_5\0"
+    "intel_5_3400_series_lpc_min\0"
+    "intel_5_3400_series_lpc_max\0"
+    "intel_ioat_snb0\0"
+    "intel_ioat_snb1\0"
+    "intel_ioat_snb2\0"
+    "intel_ioat_snb3\0"
+    "intel_ioat_snb4\0"
+    "intel_ioat_snb5\0"
+    "intel_ioat_snb6\0"
+    "intel_ioat_snb7\0"
+    "intel_ioat_snb8\0"
+    "intel_ioat_snb9\0"
+    "intel_unc_qpi0\0"
+    "intel_unc_qpi1\0"
+    "intel_unc_r2pcie\0"
+    "intel_unc_r3qpi0\0"
+    "intel_unc_r3qpi1\0"
+    "intel_unc_ha\0"
+    "intel_unc_imc0\0"
+    "intel_unc_imc1\0"
+    "intel_unc_imc2\0"
+    "intel_unc_imc3\0"
+    "intel_jaketown_ubox\0"
+    "intel_ioat_snb\0"
+    "intel_5400_err\0"
+    "intel_5400_fbd0\0"
+    "intel_5400_fbd1\0"
+    "intel_ep80579_0\0"
+    "intel_ep80579_1\0"
+    "intel_5100_16\0"
+    "intel_5100_19\0"
+    "intel_5100_21\0"
+    "intel_5100_22\0"
+    "intel_ioat_scnb\0"
+    "intel_82371sb_0\0"
+    "intel_82371sb_1\0"
+    "intel_82371sb_2\0"
+    "intel_82437vx\0"
+    "intel_82439tx\0"
+    "intel_82371ab_0\0"
+    "intel_82371ab\0"
+    "intel_82371ab_2\0"
+    "intel_82371ab_3\0"
+    "intel_82810_mc1\0"
+    "intel_82810_ig1\0"
+    "intel_82810_mc3\0"
+    "intel_82810_ig3\0"
+    "intel_82810e_mc\0"
+    "intel_82810e_ig\0"
+    "intel_82443lx_0\0"
+    "intel_82443lx_1\0"
+    "intel_82443bx_0\0"
+    "intel_82443bx_1\0"
+    "intel_82443bx_2\0"
+    "intel_440mx\0"
+    "intel_440mx_6\0"
+    "intel_82443mx_0\0"
+    "intel_82443mx_1\0"
+    "intel_82443mx_3\0"
+    "intel_82443gx_0\0"
+    "intel_82443gx_2\0"
+    "intel_82372fb_1\0"
+    "intel_sch_lpc\0"
+    "intel_sch_ide\0"
+    "intel_itc_lpc\0"
+    "intel_82454gx\0"
+    "intel_82450gx\0"
+    "intel_82451nx\0"
+    "intel_82454nx\0"
+    "intel_84460gx\0"
+    "intel_ixp4xx\0"
+    "intel_ixp2800\0"
+    "intel_s21152bb\0"
+    "scalemp_vsmp_ctl\0"
+    "computone_ip2ex\0"
+    "computone_pg\0"
+    "adaptec_7810\0"
+    "adaptec_7821\0"
+    "adaptec_38602\0"
+    "adaptec_7850\0"
+    "adaptec_7855\0"
+    "adaptec_3860\0"
+    "adaptec_1480a\0"
+    "adaptec_7860\0"
+    "adaptec_7861\0"
+    "adaptec_7870\0"
+    "adaptec_7871\0"
+    "adaptec_7872\0"
+    "adaptec_7873\0"
+    "adaptec_7874\0"
+    "adaptec_7895\0"
+    "adaptec_7880\0"
+    "adaptec_7881\0"
+    "adaptec_7882\0"
+    "adaptec_7883\0"
+    "adaptec_7884\0"
+    "adaptec_7885\0"
+    "adaptec_7886\0"
+    "adaptec_7887\0"
+    "adaptec_7888\0"
+    "adaptec2_2940u2\0"
+    "adaptec2_2930u2\0"
+    "adaptec2_7890b\0"
+    "adaptec2_7890\0"
+    "adaptec2_3940u2\0"
+    "adaptec2_3950u2d\0"
+    "adaptec2_7896\0"
+    "adaptec2_7892a\0"
+    "adaptec2_7892b\0"
+    "adaptec2_7892d\0"
+    "adaptec2_7892p\0"
+    "adaptec2_7899a\0"
+    "adaptec2_7899b\0"
+    "adaptec2_7899d\0"
+    "adaptec2_7899p\0"
+    "adaptec2_obsidian\0"
+    "adaptec2_scamp\0"
+    "holtek_6565\0"
+    "netmos_9705\0"
+    "netmos_9715\0"
+    "netmos_9735\0"
+    "netmos_9745\0"
+    "netmos_9755\0"
+    "netmos_9805\0"
+    "netmos_9815\0"
+    "netmos_9835\0"
+    "netmos_9845\0"
+    "netmos_9855\0"
+    "netmos_9865\0"
+    "netmos_9900\0"
+    "netmos_9901\0"
+    "netmos_9904\0"
+    "netmos_9912\0"
+    "netmos_9922\0"
+    "digium_hfc4s\0"
+    "tigerjet_300\0"
+    "tigerjet_100\0"
+    "rme_digi32\0"
+    "rme_digi32_pro\0"
+    "rme_digi32_8\0"
+    ;
+
+static const char* lookup(const libpci_name_entry_t *table, size_t n, uint32_t key) {
+    size_t lo = 0, hi = n;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (table[mid].key == key) {
+            return &name_pool[table[mid].name];
+        }
+        if (table[mid].key < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return NULL;
+}
+
+const char* libpci_vendorID_str(int vid) {
+    const char *name = lookup(vendor_names, ARRAY_SIZE(vendor_names), (uint16_t)vid);
+    return name ? name : "Unknown vendor ID.";
+}
+
+const char* libpci_deviceID_str(int vid, int did) {
+    const char *name = lookup(device_names, ARRAY_SIZE(device_names),
+                              ((uint32_t)(uint16_t)vid << 16) | (uint16_t)did);
+    return name ? name : "Unknown device ID.";
+}
+
+#else
+
+const char* libpci_vendorID_str(int vid) {
     return "Unknown vendor ID.";
 }
 
-char* libpci_deviceID_str(int vid, int did) {
-    if (vid == 0x0357 && did == 0x000a) return "tttech_mc322";
-    if (vid == 0x0675 && did == 0x1702) return "dynalink_is64ph";
-    if (vid == 0x0871 && did == 0xffa1) return "berkom_a1t";
-    if (vid == 0x0871 && did == 0xffa2) return "berkom_t_concept";
-    if (vid == 0x0871 && did == 0xffa4) return "berkom_a4t";
-    if (vid == 0x0871 && did == 0xffa8) return "berkom_scitel_quadro";
-    if (vid == 0x0e11 && did == 0x0508) return "compaq_tokenring";
-    if (vid == 0x0e11 && did == 0xa0fc) return "compaq_tachyon";
-    if (vid == 0x0e11 && did == 0xae10) return "compaq_smart2p";
-    if (vid == 0x0e11 && did == 0xae32) return "compaq_netel100";
-    if (vid == 0x0e11 && did == 0xae34) return "compaq_netel10";
-    if (vid == 0x0e11 && did == 0xae33) return "compaq_triflex_ide";
-    if (vid == 0x0e11 && did == 0xae35) return "compaq_netflex3i";
-    if (vid == 0x0e11 && did == 0xae40) return "compaq_netel100d";
-    if (vid == 0x0e11 && did == 0xae43) return "compaq_netel100pi";
-    if (vid == 0x0e11 && did == 0xb011) return "compaq_netel100i";
-    if (vid == 0x0e11 && did == 0xb060) return "compaq_ciss";
-    if (vid == 0x0e11 && did == 0xb178) return "compaq_cissb";
-    if (vid == 0x0e11 && did == 0x46) return "compaq_cissc";
-    if (vid == 0x0e11 && did == 0xf130) return "compaq_thunder";
-    if (vid == 0x0e11 && did == 0xf150) return "compaq_netflex3b";
-    if (vid == 0x1000 && did == 0x0001) return "ncr_53c810";
-    if (vid == 0x1000 && did == 0x0002) return "ncr_53c820";
-    if (vid == 0x1000 && did == 0x0003) return "ncr_53c825";
-    if (vid == 0x1000 && did == 0x0004) return "ncr_53c815";
-    if (vid == 0x1000 && did == 0x0005) return "lsi_53c810ap";
-    if (vid == 0x1000 && did == 0x0006) return "ncr_53c860";
-    if (vid == 0x1000 && did == 0x000a) return "lsi_53c1510";
-    if (vid == 0x1000 && did == 0x000b) return "ncr_53c896";
-    if (vid == 0x1000 && did == 0x000c) return "ncr_53c895";
-    if (vid == 0x1000 && did == 0x000d) return "ncr_53c885";
-    if (vid == 0x1000 && did == 0x000f) return "ncr_53c875";
-    if (vid == 0x1000 && did == 0x0010) return "ncr_53c1510";
-    if (vid == 0x1000 && did == 0x0012) return "lsi_53c895a";
-    if (vid == 0x1000 && did == 0x0013) return "lsi_53c875a";
-    if (vid == 0x1000 && did == 0x0020) return "lsi_53c1010_33";
-    if (vid == 0x1000 && did == 0x0021) return "lsi_53c1010_66";
-    if (vid == 0x1000 && did == 0x0030) return "lsi_53c1030";
-    if (vid == 0x1000 && did == 0x0032) return "lsi_1030_53c1035";
-    if (vid == 0x1000 && did == 0x0040) return "lsi_53c1035";
-    if (vid == 0x1000 && did == 0x008f) return "ncr_53c875j";
-    if (vid == 0x1000 && did == 0x0621) return "lsi_fc909";
-    if (vid == 0x1000 && did == 0x0622) return "lsi_fc929";
-    if (vid == 0x1000 && did == 0x0623) return "lsi_fc929_lan";
-    if (vid == 0x1000 && did == 0x0624) return "lsi_fc919";
-    if (vid == 0x1000 && did == 0x0625) return "lsi_fc919_lan";
-    if (vid == 0x1000 && did == 0x0626) return "lsi_fc929x";
-    if (vid == 0x1000 && did == 0x0642) return "lsi_fc939x";
-    if (vid == 0x1000 && did == 0x0640) return "lsi_fc949x";
-    if (vid == 0x1000 && did == 0x0646) return "lsi_fc949es";
-    if (vid == 0x1000 && did == 0x0628) return "lsi_fc919x";
-    if (vid == 0x1000 && did == 0x0701) return "ncr_yellowfin";
-    if (vid == 0x1000 && did == 0x0901) return "lsi_61c102";
-    if (vid == 0x1000 && did == 0x1000) return "lsi_63c815";
-    if (vid == 0x1000 && did == 0x0050) return "lsi_sas1064";
-    if (vid == 0x1000 && did == 0x0411) return "lsi_sas1064r";
-    if (vid == 0x1000 && did == 0x005E) return "lsi_sas1066";
-    if (vid == 0x1000 && did == 0x0054) return "lsi_sas1068";
-    if (vid == 0x1000 && did == 0x005C) return "lsi_sas1064a";
-    if (vid == 0x1000 && did == 0x0056) return "lsi_sas1064e";
-    if (vid == 0x1000 && did == 0x005A) return "lsi_sas1066e";
-    if (vid == 0x1000 && did == 0x0058) return "lsi_sas1068e";
-    if (vid == 0x1000 && did == 0x0060) return "lsi_sas1078";
-    if (vid == 0x1002 && did == 0x4158) return "ati_68800";
-    if (vid == 0x1002 && did == 0x4354) return "ati_215ct222";
-    if (vid == 0x1002 && did == 0x4358) return "ati_210888cx";
-    if (vid == 0x1002 && did == 0x4554) return "ati_215et222";
-    if (vid == 0x1002 && did == 0x4742) return "ati_215gb";
-    if (vid == 0x1002 && did == 0x4744) return "ati_215gd";
-    if (vid == 0x1002 && did == 0x4749) return "ati_215gi";
-    if (vid == 0x1002 && did == 0x4750) return "ati_215gp";
-    if (vid == 0x1002 && did == 0x4751) return "ati_215gq";
-    if (vid == 0x1002 && did == 0x4752) return "ati_215xl";
-    if (vid == 0x1002 && did == 0x4754) return "ati_215gt";
-    if (vid == 0x1002 && did == 0x4755) return "ati_215gtb";
-    if (vid == 0x1002 && did == 0x4756) return "ati_215_iv";
-    if (vid == 0x1002 && did == 0x4757) return "ati_215_iw";
-    if (vid == 0x1002 && did == 0x475A) return "ati_215_iz";
-    if (vid == 0x1002 && did == 0x4758) return "ati_210888gx";
-    if (vid == 0x1002 && did == 0x4c42) return "ati_215_lb";
-    if (vid == 0x1002 && did == 0x4c44) return "ati_215_ld";
-    if (vid == 0x1002 && did == 0x4c47) return "ati_215_lg";
-    if (vid == 0x1002 && did == 0x4c49) return "ati_215_li";
-    if (vid == 0x1002 && did == 0x4c4D) return "ati_215_lm";
-    if (vid == 0x1002 && did == 0x4c4E) return "ati_215_ln";
-    if (vid == 0x1002 && did == 0x4c52) return "ati_215_lr";
-    if (vid == 0x1002 && did == 0x4c53) return "ati_215_ls";
-    if (vid == 0x1002 && did == 0x4c54) return "ati_264_lt";
-    if (vid == 0x1002 && did == 0x5654) return "ati_264vt";
-    if (vid == 0x1002 && did == 0x5655) return "ati_264vu";
-    if (vid == 0x1002 && did == 0x5656) return "ati_264vv";
-    if (vid == 0x1002 && did == 0x5245) return "ati_rage128_re";
-    if (vid == 0x1002 && did == 0x5246) return "ati_rage128_rf";
-    if (vid == 0x1002 && did == 0x5247) return "ati_rage128_rg";
-    if (vid == 0x1002 && did == 0x524b) return "ati_rage128_rk";
-    if (vid == 0x1002 && did == 0x524c) return "ati_rage128_rl";
-    if (vid == 0x1002 && did == 0x5345) return "ati_rage128_se";
-    if (vid == 0x1002 && did == 0x5346) return "ati_rage128_sf";
-    if (vid == 0x1002 && did == 0x5347) return "ati_rage128_sg";
-    if (vid == 0x1002 && did == 0x5348) return "ati_rage128_sh";
-    if (vid == 0x1002 && did == 0x534b) return "ati_rage128_sk";
-    if (vid == 0x1002 && did == 0x534c) return "ati_rage128_sl";
-    if (vid == 0x1002 && did == 0x534d) return "ati_rage128_sm";
-    if (vid == 0x1002 && did == 0x534e) return "ati_rage128_sn";
-    if (vid == 0x1002 && did == 0x5446) return "ati_rage128_tf";
-    if (vid == 0x1002 && did == 0x544c) return "ati_rage128_tl";
-    if (vid == 0x1002 && did == 0x5452) return "ati_rage128_tr";
-    if (vid == 0x1002 && did == 0x5453) return "ati_rage128_ts";
-    if (vid == 0x1002 && did == 0x5454) return "ati_rage128_tt";
-    if (vid == 0x1002 && did == 0x5455) return "ati_rage128_tu";
-    if (vid == 0x1002 && did == 0x4c45) return "ati_rage128_le";
-    if (vid == 0x1002 && did == 0x4c46) return "ati_rage128_lf";
-    if (vid == 0x1002 && did == 0x4d46) return "ati_rage128_mf";
-    if (vid == 0x1002 && did == 0x4d4c) return "ati_rage128_ml";
-    if (vid == 0x1002 && did == 0x5041) return "ati_rage128_pa";
-    if (vid == 0x1002 && did == 0x5042) return "ati_rage128_pb";
-    if (vid == 0x1002 && did == 0x5043) return "ati_rage128_pc";
-    if (vid == 0x1002 && did == 0x5044) return "ati_rage128_pd";
-    if (vid == 0x1002 && did == 0x5045) return "ati_rage128_pe";
-    if (vid == 0x1002 && did == 0x5046) return "ati_rage128_pf";
-    if (vid == 0x1002 && did == 0x5047) return "ati_rage128_pg";
-    if (vid == 0x1002 && did == 0x5048) return "ati_rage128_ph";
-    if (vid == 0x1002 && did == 0x5049) return "ati_rage128_pi";
-    if (vid == 0x1002 && did == 0x504A) return "ati_rage128_pj";
-    if (vid == 0x1002 && did == 0x504B) return "ati_rage128_pk";
-    if (vid == 0x1002 && did == 0x504C) return "ati_rage128_pl";
-    if (vid == 0x1002 && did == 0x504D) return "ati_rage128_pm";
-    if (vid == 0x1002 && did == 0x504E) return "ati_rage128_pn";
-    if (vid == 0x1002 && did == 0x504F) return "ati_rage128_po";
-    if (vid == 0x1002 && did == 0x5050) return "ati_rage128_pp";
-    if (vid == 0x1002 && did == 0x5051) return "ati_rage128_pq";
-    if (vid == 0x1002 && did == 0x5052) return "ati_rage128_pr";
-    if (vid == 0x1002 && did == 0x5053) return "ati_rage128_ps";
-    if (vid == 0x1002 && did == 0x5054) return "ati_rage128_pt";
-    if (vid == 0x1002 && did == 0x5055) return "ati_rage128_pu";
-    if (vid == 0x1002 && did == 0x5056) return "ati_rage128_pv";
-    if (vid == 0x1002 && did == 0x5057) return "ati_rage128_pw";
-    if (vid == 0x1002 && did == 0x5058) return "ati_rage128_px";
-    if (vid == 0x1002 && did == 0x5144) return "ati_radeon_qd";
-    if (vid == 0x1002 && did == 0x5145) return "ati_radeon_qe";
-    if (vid == 0x1002 && did == 0x5146) return "ati_radeon_qf";
-    if (vid == 0x1002 && did == 0x5147) return "ati_radeon_qg";
-    if (vid == 0x1002 && did == 0x5159) return "ati_radeon_qy";
-    if (vid == 0x1002 && did == 0x515a) return "ati_radeon_qz";
-    if (vid == 0x1002 && did == 0x514c) return "ati_radeon_ql";
-    if (vid == 0x1002 && did == 0x514e) return "ati_radeon_qn";
-    if (vid == 0x1002 && did == 0x514f) return "ati_radeon_qo";
-    if (vid == 0x1002 && did == 0x4242) return "ati_radeon_bb";
-    if (vid == 0x1002 && did == 0x514d) return "ati_radeon_qm";
-    if (vid == 0x1002 && did == 0x5157) return "ati_radeon_qw";
-    if (vid == 0x1002 && did == 0x5158) return "ati_radeon_qx";
-    if (vid == 0x1002 && did == 0x4e44) return "ati_radeon_nd";
-    if (vid == 0x1002 && did == 0x4e45) return "ati_radeon_ne";
-    if (vid == 0x1002 && did == 0x4e46) return "ati_radeon_nf";
-    if (vid == 0x1002 && did == 0x4e47) return "ati_radeon_ng";
-    if (vid == 0x1002 && did == 0x4c59) return "ati_radeon_ly";
-    if (vid == 0x1002 && did == 0x4c5a) return "ati_radeon_lz";
-    if (vid == 0x1002 && did == 0x4c57) return "ati_radeon_lw";
-    if (vid == 0x1002 && did == 0x4c58) return "ati_radeon_lx";
-    if (vid == 0x1002 && did == 0xcab0) return "ati_rs100";
-    if (vid == 0x1002 && did == 0xcab2) return "ati_rs200";
-    if (vid == 0x1002 && did == 0xcbb2) return "ati_rs200_b";
-    if (vid == 0x1002 && did == 0xcab3) return "ati_rs250";
-    if (vid == 0x1002 && did == 0x5830) return "ati_rs300_100";
-    if (vid == 0x1002 && did == 0x5831) return "ati_rs300_133";
-    if (vid == 0x1002 && did == 0x5832) return "ati_rs300_166";
-    if (vid == 0x1002 && did == 0x5833) return "ati_rs300_200";
-    if (vid == 0x1002 && did == 0x7830) return "ati_rs350_100";
-    if (vid == 0x1002 && did == 0x7831) return "ati_rs350_133";
-    if (vid == 0x1002 && did == 0x7832) return "ati_rs350_166";
-    if (vid == 0x1002 && did == 0x7833) return "ati_rs350_200";
-    if (vid == 0x1002 && did == 0x5a30) return "ati_rs400_100";
-    if (vid == 0x1002 && did == 0x5a31) return "ati_rs400_133";
-    if (vid == 0x1002 && did == 0x5a32) return "ati_rs400_166";
-    if (vid == 0x1002 && did == 0x5a33) return "ati_rs400_200";
-    if (vid == 0x1002 && did == 0x5950) return "ati_rs480";
-    if (vid == 0x1002 && did == 0x4349) return "ati_ixp200_ide";
-    if (vid == 0x1002 && did == 0x4353) return "ati_ixp200_smbus";
-    if (vid == 0x1002 && did == 0x4363) return "ati_ixp300_smbus";
-    if (vid == 0x1002 && did == 0x4369) return "ati_ixp300_ide";
-    if (vid == 0x1002 && did == 0x436e) return "ati_ixp300_sata";
-    if (vid == 0x1002 && did == 0x4372) return "ati_ixp400_smbus";
-    if (vid == 0x1002 && did == 0x4376) return "ati_ixp400_ide";
-    if (vid == 0x1002 && did == 0x4379) return "ati_ixp400_sata";
-    if (vid == 0x1002 && did == 0x437a) return "ati_ixp400_sata2";
-    if (vid == 0x1002 && did == 0x4380) return "ati_ixp600_sata";
-    if (vid == 0x1002 && did == 0x4385) return "ati_sbx00_smbus";
-    if (vid == 0x1002 && did == 0x438c) return "ati_ixp600_ide";
-    if (vid == 0x1002 && did == 0x4390) return "ati_ixp700_sata";
-    if (vid == 0x1002 && did == 0x439c) return "ati_ixp700_ide";
-    if (vid == 0x1004 && did == 0x0005) return "vlsi_82c592";
-    if (vid == 0x1004 && did == 0x0006) return "vlsi_82c593";
-    if (vid == 0x1004 && did == 0x0007) return "vlsi_82c594";
-    if (vid == 0x1004 && did == 0x0009) return "vlsi_82c597";
-    if (vid == 0x1004 && did == 0x000c) return "vlsi_82c541";
-    if (vid == 0x1004 && did == 0x000d) return "vlsi_82c543";
-    if (vid == 0x1004 && did == 0x0101) return "vlsi_82c532";
-    if (vid == 0x1004 && did == 0x0102) return "vlsi_82c534";
-    if (vid == 0x1004 && did == 0x0104) return "vlsi_82c535";
-    if (vid == 0x1004 && did == 0x0105) return "vlsi_82c147";
-    if (vid == 0x1004 && did == 0x0702) return "vlsi_vas96011";
-    if (vid == 0x1004 && did == 0x5a23) return "rd890_iommu";
-    if (vid == 0x1005 && did == 0x2301) return "adl_2301";
-    if (vid == 0x100b && did == 0x0002) return "ns_87415";
-    if (vid == 0x100b && did == 0x000e) return "ns_87560_lio";
-    if (vid == 0x100b && did == 0x0012) return "ns_87560_usb";
-    if (vid == 0x100b && did == 0x0020) return "ns_83815";
-    if (vid == 0x100b && did == 0x0022) return "ns_83820";
-    if (vid == 0x100b && did == 0x002b) return "ns_cs5535_isa";
-    if (vid == 0x100b && did == 0x002d) return "ns_cs5535_ide";
-    if (vid == 0x100b && did == 0x002e) return "ns_cs5535_audio";
-    if (vid == 0x100b && did == 0x002f) return "ns_cs5535_usb";
-    if (vid == 0x100b && did == 0x0030) return "ns_gx_video";
-    if (vid == 0x100b && did == 0x0035) return "ns_saturn";
-    if (vid == 0x100b && did == 0x0510) return "ns_sc1100_bridge";
-    if (vid == 0x100b && did == 0x0511) return "ns_sc1100_smi";
-    if (vid == 0x100b && did == 0x0515) return "ns_sc1100_xbus";
-    if (vid == 0x100b && did == 0xd001) return "ns_87410";
-    if (vid == 0x100b && did == 0x0028) return "ns_gx_host_bridge";
-    if (vid == 0x100c && did == 0x3202) return "tseng_w32p_2";
-    if (vid == 0x100c && did == 0x3208) return "tseng_et6000";
-    if (vid == 0x100e && did == 0x9001) return "weitek_p9000";
-    if (vid == 0x100e && did == 0x9100) return "weitek_p9100";
-    if (vid == 0x1011 && did == 0x0001) return "dec_brd";
-    if (vid == 0x1011 && did == 0x0002) return "dec_tulip";
-    if (vid == 0x1011 && did == 0x0004) return "dec_tga";
-    if (vid == 0x1011 && did == 0x0009) return "dec_tulip_fast";
-    if (vid == 0x1011 && did == 0x000D) return "dec_tga2";
-    if (vid == 0x1011 && did == 0x000F) return "dec_fddi";
-    if (vid == 0x1011 && did == 0x0014) return "dec_tulip_plus";
-    if (vid == 0x1011 && did == 0x0019) return "dec_21142";
-    if (vid == 0x1011 && did == 0x0021) return "dec_21052";
-    if (vid == 0x1011 && did == 0x0022) return "dec_21150";
-    if (vid == 0x1011 && did == 0x0024) return "dec_21152";
-    if (vid == 0x1011 && did == 0x0025) return "dec_21153";
-    if (vid == 0x1011 && did == 0x0026) return "dec_21154";
-    if (vid == 0x1011 && did == 0x1065) return "dec_21285";
-    if (vid == 0x1011 && did == 0x0046) return "compaq_42xx";
-    if (vid == 0x1013 && did == 0x0038) return "cirrus_7548";
-    if (vid == 0x1013 && did == 0x00a0) return "cirrus_5430";
-    if (vid == 0x1013 && did == 0x00a4) return "cirrus_5434_4";
-    if (vid == 0x1013 && did == 0x00a8) return "cirrus_5434_8";
-    if (vid == 0x1013 && did == 0x00ac) return "cirrus_5436";
-    if (vid == 0x1013 && did == 0x00b8) return "cirrus_5446";
-    if (vid == 0x1013 && did == 0x00bc) return "cirrus_5480";
-    if (vid == 0x1013 && did == 0x00d0) return "cirrus_5462";
-    if (vid == 0x1013 && did == 0x00d4) return "cirrus_5464";
-    if (vid == 0x1013 && did == 0x00d6) return "cirrus_5465";
-    if (vid == 0x1013 && did == 0x1100) return "cirrus_6729";
-    if (vid == 0x1013 && did == 0x1110) return "cirrus_6832";
-    if (vid == 0x1013 && did == 0x1202) return "cirrus_7543";
-    if (vid == 0x1013 && did == 0x6001) return "cirrus_4610";
-    if (vid == 0x1013 && did == 0x6003) return "cirrus_4612";
-    if (vid == 0x1013 && did == 0x6004) return "cirrus_4615";
-    if (vid == 0x1014 && did == 0x0018) return "ibm_tr";
-    if (vid == 0x1014 && did == 0x003e) return "ibm_tr_wake";
-    if (vid == 0x1014 && did == 0x00fc) return "ibm_cpc710_pci64";
-    if (vid == 0x1014 && did == 0x0180) return "ibm_snipe";
-    if (vid == 0x1014 && did == 0x028C) return "ibm_citrine";
-    if (vid == 0x1014 && did == 0xB166) return "ibm_gemstone";
-    if (vid == 0x1014 && did == 0x02BD) return "ibm_obsidian";
-    if (vid == 0x1014 && did == 0x0031) return "ibm_icom_dev_id_1";
-    if (vid == 0x1014 && did == 0x0219) return "ibm_icom_dev_id_2";
-    if (vid == 0x1014 && did == 0x021A) return "ibm_icom_v2_two_ports_rvx";
-    if (vid == 0x1014 && did == 0x0251) return "ibm_icom_v2_one_port_rvx_one_port_mdm";
-    if (vid == 0x1014 && did == 0x0361) return "ibm_icom_v2_one_port_rvx_one_port_mdm_pcie";
-    if (vid == 0x1014 && did == 0x252) return "ibm_icom_four_port_model";
-    if (vid == 0x1018 && did == 0x001C) return "unisys_dma_director";
-    if (vid == 0x101a && did == 0x0005) return "compex2_100vg";
-    if (vid == 0x101c && did == 0xc24a) return "wd_90c";
-    if (vid == 0x101e && did == 0x1960) return "ami_megaraid3";
-    if (vid == 0x101e && did == 0x9010) return "ami_megaraid";
-    if (vid == 0x101e && did == 0x9060) return "ami_megaraid2";
-    if (vid == 0x1022 && did == 0x1100) return "amd_k8_nb";
-    if (vid == 0x1022 && did == 0x1101) return "amd_k8_nb_addrmap";
-    if (vid == 0x1022 && did == 0x1102) return "amd_k8_nb_memctl";
-    if (vid == 0x1022 && did == 0x1103) return "amd_k8_nb_misc";
-    if (vid == 0x1022 && did == 0x1200) return "amd_10h_nb_ht";
-    if (vid == 0x1022 && did == 0x1201) return "amd_10h_nb_map";
-    if (vid == 0x1022 && did == 0x1202) return "amd_10h_nb_dram";
-    if (vid == 0x1022 && did == 0x1203) return "amd_10h_nb_misc";
-    if (vid == 0x1022 && did == 0x1204) return "amd_10h_nb_link";
-    if (vid == 0x1022 && did == 0x1300) return "amd_11h_nb_ht";
-    if (vid == 0x1022 && did == 0x1301) return "amd_11h_nb_map";
-    if (vid == 0x1022 && did == 0x1302) return "amd_11h_nb_dram";
-    if (vid == 0x1022 && did == 0x1303) return "amd_11h_nb_misc";
-    if (vid == 0x1022 && did == 0x1304) return "amd_11h_nb_link";
-    if (vid == 0x1022 && did == 0x1403) return "amd_15h_m10h_f3";
-    if (vid == 0x1022 && did == 0x1600) return "amd_15h_nb_f0";
-    if (vid == 0x1022 && did == 0x1601) return "amd_15h_nb_f1";
-    if (vid == 0x1022 && did == 0x1602) return "amd_15h_nb_f2";
-    if (vid == 0x1022 && did == 0x1603) return "amd_15h_nb_f3";
-    if (vid == 0x1022 && did == 0x1604) return "amd_15h_nb_f4";
-    if (vid == 0x1022 && did == 0x1605) return "amd_15h_nb_f5";
-    if (vid == 0x1022 && did == 0x1533) return "amd_16h_nb_f3";
-    if (vid == 0x1022 && did == 0x1534) return "amd_16h_nb_f4";
-    if (vid == 0x1022 && did == 0x1703) return "amd_cnb17h_f3";
-    if (vid == 0x1022 && did == 0x2000) return "amd_lance";
-    if (vid == 0x1022 && did == 0x2001) return "amd_lance_home";
-    if (vid == 0x1022 && did == 0x2020) return "amd_scsi";
-    if (vid == 0x1022 && did == 0x36c0) return "amd_serenade";
-    if (vid == 0x1022 && did == 0x7006) return "amd_fe_gate_7006";
-    if (vid == 0x1022 && did == 0x7007) return "amd_fe_gate_7007";
-    if (vid == 0x1022 && did == 0x700C) return "amd_fe_gate_700c";
-    if (vid == 0x1022 && did == 0x700E) return "amd_fe_gate_700e";
-    if (vid == 0x1022 && did == 0x7401) return "amd_cobra_7401";
-    if (vid == 0x1022 && did == 0x7409) return "amd_viper_7409";
-    if (vid == 0x1022 && did == 0x740B) return "amd_viper_740b";
-    if (vid == 0x1022 && did == 0x7410) return "amd_viper_7410";
-    if (vid == 0x1022 && did == 0x7411) return "amd_viper_7411";
-    if (vid == 0x1022 && did == 0x7413) return "amd_viper_7413";
-    if (vid == 0x1022 && did == 0x7440) return "amd_viper_7440";
-    if (vid == 0x1022 && did == 0x7441) return "amd_opus_7441";
-    if (vid == 0x1022 && did == 0x7443) return "amd_opus_7443";
-    if (vid == 0x1022 && did == 0x7443) return "amd_viper_7443";
-    if (vid == 0x1022 && did == 0x7445) return "amd_opus_7445";
-    if (vid == 0x1022 && did == 0x7460) return "amd_8111_pci";
-    if (vid == 0x1022 && did == 0x7468) return "amd_8111_lpc";
-    if (vid == 0x1022 && did == 0x7469) return "amd_8111_ide";
-    if (vid == 0x1022 && did == 0x746a) return "amd_8111_smbus2";
-    if (vid == 0x1022 && did == 0x746b) return "amd_8111_smbus";
-    if (vid == 0x1022 && did == 0x746d) return "amd_8111_audio";
-    if (vid == 0x1022 && did == 0x7454) return "amd_8151_0";
-    if (vid == 0x1022 && did == 0x7450) return "amd_8131_bridge";
-    if (vid == 0x1022 && did == 0x7451) return "amd_8131_apic";
-    if (vid == 0x1022 && did == 0x7458) return "amd_8132_bridge";
-    if (vid == 0x1022 && did == 0x208F) return "amd_cs5535_ide";
-    if (vid == 0x1022 && did == 0x2090) return "amd_cs5536_isa";
-    if (vid == 0x1022 && did == 0x2091) return "amd_cs5536_flash";
-    if (vid == 0x1022 && did == 0x2093) return "amd_cs5536_audio";
-    if (vid == 0x1022 && did == 0x2094) return "amd_cs5536_ohc";
-    if (vid == 0x1022 && did == 0x2095) return "amd_cs5536_ehc";
-    if (vid == 0x1022 && did == 0x2096) return "amd_cs5536_udc";
-    if (vid == 0x1022 && did == 0x2097) return "amd_cs5536_uoc";
-    if (vid == 0x1022 && did == 0x209A) return "amd_cs5536_ide";
-    if (vid == 0x1022 && did == 0x2081) return "amd_lx_video";
-    if (vid == 0x1022 && did == 0x2082) return "amd_lx_aes";
-    if (vid == 0x1022 && did == 0x7800) return "amd_hudson2_sata_ide";
-    if (vid == 0x1022 && did == 0x780b) return "amd_hudson2_smbus";
-    if (vid == 0x1022 && did == 0x780c) return "amd_hudson2_ide";
-    if (vid == 0x1023 && did == 0x2000) return "trident_4dwave_dx";
-    if (vid == 0x1023 && did == 0x2001) return "trident_4dwave_nx";
-    if (vid == 0x1023 && did == 0x9320) return "trident_9320";
-    if (vid == 0x1023 && did == 0x9388) return "trident_9388";
-    if (vid == 0x1023 && did == 0x9397) return "trident_9397";
-    if (vid == 0x1023 && did == 0x939A) return "trident_939a";
-    if (vid == 0x1023 && did == 0x9520) return "trident_9520";
-    if (vid == 0x1023 && did == 0x9525) return "trident_9525";
-    if (vid == 0x1023 && did == 0x9420) return "trident_9420";
-    if (vid == 0x1023 && did == 0x9440) return "trident_9440";
-    if (vid == 0x1023 && did == 0x9660) return "trident_9660";
-    if (vid == 0x1023 && did == 0x9750) return "trident_9750";
-    if (vid == 0x1023 && did == 0x9850) return "trident_9850";
-    if (vid == 0x1023 && did == 0x9880) return "trident_9880";
-    if (vid == 0x1023 && did == 0x8400) return "trident_8400";
-    if (vid == 0x1023 && did == 0x8420) return "trident_8420";
-    if (vid == 0x1023 && did == 0x8500) return "trident_8500";
-    if (vid == 0x1025 && did == 0x1435) return "ai_m1435";
-    if (vid == 0x1028 && did == 0x0008) return "dell_raciii";
-    if (vid == 0x1028 && did == 0x0012) return "dell_rac4";
-    if (vid == 0x1028 && did == 0x0015) return "dell_perc5";
-    if (vid == 0x102B && did == 0x0518) return "matrox_mga_2";
-    if (vid == 0x102B && did == 0x0519) return "matrox_mil";
-    if (vid == 0x102B && did == 0x051A) return "matrox_mys";
-    if (vid == 0x102B && did == 0x051b) return "matrox_mil_2";
-    if (vid == 0x102B && did == 0x051e) return "matrox_mys_agp";
-    if (vid == 0x102B && did == 0x051f) return "matrox_mil_2_agp";
-    if (vid == 0x102B && did == 0x0d10) return "matrox_mga_imp";
-    if (vid == 0x102B && did == 0x1000) return "matrox_g100_mm";
-    if (vid == 0x102B && did == 0x1001) return "matrox_g100_agp";
-    if (vid == 0x102B && did == 0x0520) return "matrox_g200_pci";
-    if (vid == 0x102B && did == 0x0521) return "matrox_g200_agp";
-    if (vid == 0x102B && did == 0x0525) return "matrox_g400";
-    if (vid == 0x102B && did == 0x0530) return "matrox_g200ev_pci";
-    if (vid == 0x102B && did == 0x2527) return "matrox_g550";
-    if (vid == 0x102B && did == 0x4536) return "matrox_via";
-    if (vid == 0x102c && did == 0x00c0) return "ct_69000";
-    if (vid == 0x102c && did == 0x00d8) return "ct_65545";
-    if (vid == 0x102c && did == 0x00dc) return "ct_65548";
-    if (vid == 0x102c && did == 0x00e0) return "ct_65550";
-    if (vid == 0x102c && did == 0x00e4) return "ct_65554";
-    if (vid == 0x102c && did == 0x00e5) return "ct_65555";
-    if (vid == 0x1031 && did == 0x5601) return "miro_36050";
-    if (vid == 0x1031 && did == 0x7efe) return "miro_dc10plus";
-    if (vid == 0x1031 && did == 0xd801) return "miro_dc30plus";
-    if (vid == 0x1033 && did == 0x0001) return "nec_cbus_1";
-    if (vid == 0x1033 && did == 0x0002) return "nec_local";
-    if (vid == 0x1033 && did == 0x0003) return "nec_atm";
-    if (vid == 0x1033 && did == 0x0004) return "nec_r4000";
-    if (vid == 0x1033 && did == 0x0005) return "nec_486";
-    if (vid == 0x1033 && did == 0x0006) return "nec_accel_1";
-    if (vid == 0x1033 && did == 0x0007) return "nec_uxbus";
-    if (vid == 0x1033 && did == 0x0008) return "nec_accel_2";
-    if (vid == 0x1033 && did == 0x0009) return "nec_graph";
-    if (vid == 0x1033 && did == 0x0016) return "nec_vl";
-    if (vid == 0x1033 && did == 0x002c) return "nec_staralpha2";
-    if (vid == 0x1033 && did == 0x002d) return "nec_cbus_2";
-    if (vid == 0x1033 && did == 0x0035) return "nec_usb";
-    if (vid == 0x1033 && did == 0x003b) return "nec_cbus_3";
-    if (vid == 0x1033 && did == 0x003e) return "nec_napccard";
-    if (vid == 0x1033 && did == 0x0046) return "nec_pcx2";
-    if (vid == 0x1033 && did == 0x009b) return "nec_vrc5476";
-    if (vid == 0x1033 && did == 0x00a5) return "nec_vrc4173";
-    if (vid == 0x1033 && did == 0x00a6) return "nec_vrc5477_ac97";
-    if (vid == 0x1033 && did == 0x800c) return "nec_pc9821cs01";
-    if (vid == 0x1033 && did == 0x800d) return "nec_pc9821nrb06";
-    if (vid == 0x1036 && did == 0x0000) return "fd_36c70";
-    if (vid == 0x1039 && did == 0x0001) return "si_5591_agp";
-    if (vid == 0x1039 && did == 0x0002) return "si_6202";
-    if (vid == 0x1039 && did == 0x0008) return "si_503";
-    if (vid == 0x1039 && did == 0x0009) return "si_acpi";
-    if (vid == 0x1039 && did == 0x0016) return "si_smbus";
-    if (vid == 0x1039 && did == 0x0018) return "si_lpc";
-    if (vid == 0x1039 && did == 0x0200) return "si_5597_vga";
-    if (vid == 0x1039 && did == 0x0205) return "si_6205";
-    if (vid == 0x1039 && did == 0x0406) return "si_501";
-    if (vid == 0x1039 && did == 0x0496) return "si_496";
-    if (vid == 0x1039 && did == 0x0300) return "si_300";
-    if (vid == 0x1039 && did == 0x0310) return "si_315h";
-    if (vid == 0x1039 && did == 0x0315) return "si_315";
-    if (vid == 0x1039 && did == 0x0325) return "si_315pro";
-    if (vid == 0x1039 && did == 0x0530) return "si_530";
-    if (vid == 0x1039 && did == 0x0540) return "si_540";
-    if (vid == 0x1039 && did == 0x0550) return "si_550";
-    if (vid == 0x1039 && did == 0x5300) return "si_540_vga";
-    if (vid == 0x1039 && did == 0x5315) return "si_550_vga";
-    if (vid == 0x1039 && did == 0x0620) return "si_620";
-    if (vid == 0x1039 && did == 0x0630) return "si_630";
-    if (vid == 0x1039 && did == 0x0633) return "si_633";
-    if (vid == 0x1039 && did == 0x0635) return "si_635";
-    if (vid == 0x1039 && did == 0x0640) return "si_640";
-    if (vid == 0x1039 && did == 0x0645) return "si_645";
-    if (vid == 0x1039 && did == 0x0646) return "si_646";
-    if (vid == 0x1039 && did == 0x0648) return "si_648";
-    if (vid == 0x1039 && did == 0x0650) return "si_650";
-    if (vid == 0x1039 && did == 0x0651) return "si_651";
-    if (vid == 0x1039 && did == 0x0655) return "si_655";
-    if (vid == 0x1039 && did == 0x0661) return "si_661";
-    if (vid == 0x1039 && did == 0x0730) return "si_730";
-    if (vid == 0x1039 && did == 0x0733) return "si_733";
-    if (vid == 0x1039 && did == 0x6300) return "si_630_vga";
-    if (vid == 0x1039 && did == 0x0735) return "si_735";
-    if (vid == 0x1039 && did == 0x0740) return "si_740";
-    if (vid == 0x1039 && did == 0x0741) return "si_741";
-    if (vid == 0x1039 && did == 0x0745) return "si_745";
-    if (vid == 0x1039 && did == 0x0746) return "si_746";
-    if (vid == 0x1039 && did == 0x0755) return "si_755";
-    if (vid == 0x1039 && did == 0x0760) return "si_760";
-    if (vid == 0x1039 && did == 0x0900) return "si_900";
-    if (vid == 0x1039 && did == 0x0961) return "si_961";
-    if (vid == 0x1039 && did == 0x0962) return "si_962";
-    if (vid == 0x1039 && did == 0x0963) return "si_963";
-    if (vid == 0x1039 && did == 0x0965) return "si_965";
-    if (vid == 0x1039 && did == 0x0966) return "si_966";
-    if (vid == 0x1039 && did == 0x0968) return "si_968";
-    if (vid == 0x1039 && did == 0x1180) return "si_1180";
-    if (vid == 0x1039 && did == 0x5511) return "si_5511";
-    if (vid == 0x1039 && did == 0x5513) return "si_5513";
-    if (vid == 0x1039 && did == 0x5517) return "si_5517";
-    if (vid == 0x1039 && did == 0x5518) return "si_5518";
-    if (vid == 0x1039 && did == 0x5571) return "si_5571";
-    if (vid == 0x1039 && did == 0x5581) return "si_5581";
-    if (vid == 0x1039 && did == 0x5582) return "si_5582";
-    if (vid == 0x1039 && did == 0x5591) return "si_5591";
-    if (vid == 0x1039 && did == 0x5596) return "si_5596";
-    if (vid == 0x1039 && did == 0x5597) return "si_5597";
-    if (vid == 0x1039 && did == 0x5598) return "si_5598";
-    if (vid == 0x1039 && did == 0x5600) return "si_5600";
-    if (vid == 0x1039 && did == 0x7012) return "si_7012";
-    if (vid == 0x1039 && did == 0x7013) return "si_7013";
-    if (vid == 0x1039 && did == 0x7016) return "si_7016";
-    if (vid == 0x1039 && did == 0x7018) return "si_7018";
-    if (vid == 0x103c && did == 0x1005) return "hp_visualize_eg";
-    if (vid == 0x103c && did == 0x1006) return "hp_visualize_fx6";
-    if (vid == 0x103c && did == 0x1008) return "hp_visualize_fx4";
-    if (vid == 0x103c && did == 0x100a) return "hp_visualize_fx2";
-    if (vid == 0x103c && did == 0x1028) return "hp_tachyon";
-    if (vid == 0x103c && did == 0x1029) return "hp_tachlite";
-    if (vid == 0x103c && did == 0x1030) return "hp_j2585a";
-    if (vid == 0x103c && did == 0x1031) return "hp_j2585b";
-    if (vid == 0x103c && did == 0x1040) return "hp_j2973a";
-    if (vid == 0x103c && did == 0x1042) return "hp_j2970a";
-    if (vid == 0x103c && did == 0x1048) return "hp_diva";
-    if (vid == 0x103c && did == 0x1049) return "hp_diva_tosca1";
-    if (vid == 0x103c && did == 0x104A) return "hp_diva_tosca2";
-    if (vid == 0x103c && did == 0x104B) return "hp_diva_maestro";
-    if (vid == 0x103c && did == 0x10f1) return "hp_reo_ioc";
-    if (vid == 0x103c && did == 0x108b) return "hp_visualize_fxe";
-    if (vid == 0x103c && did == 0x1223) return "hp_diva_halfdome";
-    if (vid == 0x103c && did == 0x1226) return "hp_diva_keystone";
-    if (vid == 0x103c && did == 0x1227) return "hp_diva_powerbar";
-    if (vid == 0x103c && did == 0x122a) return "hp_zx1_ioc";
-    if (vid == 0x103c && did == 0x122e) return "hp_pcix_lba";
-    if (vid == 0x103c && did == 0x127c) return "hp_sx1000_ioc";
-    if (vid == 0x103c && did == 0x1282) return "hp_diva_everest";
-    if (vid == 0x103c && did == 0x1290) return "hp_diva_aux";
-    if (vid == 0x103c && did == 0x1301) return "hp_diva_rmp3";
-    if (vid == 0x103c && did == 0x132a) return "hp_diva_hurricane";
-    if (vid == 0x103c && did == 0x3220) return "hp_cissa";
-    if (vid == 0x103c && did == 0x3230) return "hp_cissc";
-    if (vid == 0x103c && did == 0x3238) return "hp_cissd";
-    if (vid == 0x103c && did == 0x323a) return "hp_cisse";
-    if (vid == 0x103c && did == 0x323b) return "hp_cissf";
-    if (vid == 0x103c && did == 0x323c) return "hp_cissh";
-    if (vid == 0x103c && did == 0x4031) return "hp_zx2_ioc";
-    if (vid == 0x1042 && did == 0x1000) return "pctech_rz1000";
-    if (vid == 0x1042 && did == 0x1001) return "pctech_rz1001";
-    if (vid == 0x1042 && did == 0x3020) return "pctech_samurai_ide";
-    if (vid == 0x1043 && did == 0x0675) return "asustek_0675";
-    if (vid == 0x1045 && did == 0xc558) return "opti_82c558";
-    if (vid == 0x1045 && did == 0xc621) return "opti_82c621";
-    if (vid == 0x1045 && did == 0xc700) return "opti_82c700";
-    if (vid == 0x1045 && did == 0xd568) return "opti_82c825";
-    if (vid == 0x1048 && did == 0x1000) return "elsa_microlink";
-    if (vid == 0x1048 && did == 0x3000) return "elsa_qs3000";
-    if (vid == 0x104A && did == 0xCC00) return "stmicro_usb_host";
-    if (vid == 0x104A && did == 0xCC01) return "stmicro_usb_ohci";
-    if (vid == 0x104A && did == 0xCC02) return "stmicro_usb_otg";
-    if (vid == 0x104A && did == 0xCC03) return "stmicro_uart_hwfc";
-    if (vid == 0x104A && did == 0xCC04) return "stmicro_uart_no_hwfc";
-    if (vid == 0x104A && did == 0xCC05) return "stmicro_soc_dma";
-    if (vid == 0x104A && did == 0xCC06) return "stmicro_sata";
-    if (vid == 0x104A && did == 0xCC07) return "stmicro_i2c";
-    if (vid == 0x104A && did == 0xCC08) return "stmicro_spi_hs";
-    if (vid == 0x104A && did == 0xCC09) return "stmicro_mac";
-    if (vid == 0x104A && did == 0xCC0A) return "stmicro_sdio_emmc";
-    if (vid == 0x104A && did == 0xCC0B) return "stmicro_sdio";
-    if (vid == 0x104A && did == 0xCC0C) return "stmicro_gpio";
-    if (vid == 0x104A && did == 0xCC0D) return "stmicro_vip";
-    if (vid == 0x104A && did == 0xCC0E) return "stmicro_audio_router_dma";
-    if (vid == 0x104A && did == 0xCC0F) return "stmicro_audio_router_srcs";
-    if (vid == 0x104A && did == 0xCC10) return "stmicro_audio_router_msps";
-    if (vid == 0x104A && did == 0xCC11) return "stmicro_can";
-    if (vid == 0x104A && did == 0xCC12) return "stmicro_mlb";
-    if (vid == 0x104A && did == 0xCC13) return "stmicro_dbp";
-    if (vid == 0x104A && did == 0xCC14) return "stmicro_sata_phy";
-    if (vid == 0x104A && did == 0xCC15) return "stmicro_esram";
-    if (vid == 0x104A && did == 0xCC16) return "stmicro_vic";
-    if (vid == 0x104B && did == 0x0140) return "buslogic_multimaster_nc";
-    if (vid == 0x104B && did == 0x1040) return "buslogic_multimaster";
-    if (vid == 0x104B && did == 0x8130) return "buslogic_flashpoint";
-    if (vid == 0x104c && did == 0x3d07) return "ti_tvp4020";
-    if (vid == 0x104c && did == 0x8011) return "ti_4450";
-    if (vid == 0x104c && did == 0x8031) return "ti_xx21_xx11";
-    if (vid == 0x104c && did == 0x8033) return "ti_xx21_xx11_fm";
-    if (vid == 0x104c && did == 0x8034) return "ti_xx21_xx11_sd";
-    if (vid == 0x104c && did == 0x8036) return "ti_x515";
-    if (vid == 0x104c && did == 0x8039) return "ti_xx12";
-    if (vid == 0x104c && did == 0x803b) return "ti_xx12_fm";
-    if (vid == 0x104c && did == 0x8231) return "ti_xio2000a";
-    if (vid == 0x104c && did == 0xac12) return "ti_1130";
-    if (vid == 0x104c && did == 0xac13) return "ti_1031";
-    if (vid == 0x104c && did == 0xac15) return "ti_1131";
-    if (vid == 0x104c && did == 0xac16) return "ti_1250";
-    if (vid == 0x104c && did == 0xac17) return "ti_1220";
-    if (vid == 0x104c && did == 0xac19) return "ti_1221";
-    if (vid == 0x104c && did == 0xac1a) return "ti_1210";
-    if (vid == 0x104c && did == 0xac1b) return "ti_1450";
-    if (vid == 0x104c && did == 0xac1c) return "ti_1225";
-    if (vid == 0x104c && did == 0xac1d) return "ti_1251a";
-    if (vid == 0x104c && did == 0xac1e) return "ti_1211";
-    if (vid == 0x104c && did == 0xac1f) return "ti_1251b";
-    if (vid == 0x104c && did == 0xac41) return "ti_4410";
-    if (vid == 0x104c && did == 0xac42) return "ti_4451";
-    if (vid == 0x104c && did == 0xac44) return "ti_4510";
-    if (vid == 0x104c && did == 0xac46) return "ti_4520";
-    if (vid == 0x104c && did == 0xac47) return "ti_7510";
-    if (vid == 0x104c && did == 0xac48) return "ti_7610";
-    if (vid == 0x104c && did == 0xac49) return "ti_7410";
-    if (vid == 0x104c && did == 0xac50) return "ti_1410";
-    if (vid == 0x104c && did == 0xac51) return "ti_1420";
-    if (vid == 0x104c && did == 0xac52) return "ti_1451a";
-    if (vid == 0x104c && did == 0xac54) return "ti_1620";
-    if (vid == 0x104c && did == 0xac55) return "ti_1520";
-    if (vid == 0x104c && did == 0xac56) return "ti_1510";
-    if (vid == 0x104c && did == 0xac8d) return "ti_x620";
-    if (vid == 0x104c && did == 0xac8e) return "ti_x420";
-    if (vid == 0x104c && did == 0xac8f) return "ti_xx20_fm";
-    if (vid == 0x1050 && did == 0x5a5a) return "winbond2_89c940f";
-    if (vid == 0x1050 && did == 0x6692) return "winbond2_6692";
-    if (vid == 0x1051 && did == 0x0100) return "anigma_mc145575";
-    if (vid == 0x1055 && did == 0x9130) return "efar_slc90e66_1";
-    if (vid == 0x1055 && did == 0x9463) return "efar_slc90e66_3";
-    if (vid == 0x1057 && did == 0x0001) return "motorola_mpc105";
-    if (vid == 0x1057 && did == 0x0002) return "motorola_mpc106";
-    if (vid == 0x1057 && did == 0x0004) return "motorola_mpc107";
-    if (vid == 0x1057 && did == 0x4801) return "motorola_raven";
-    if (vid == 0x1057 && did == 0x4802) return "motorola_falcon";
-    if (vid == 0x1057 && did == 0x4803) return "motorola_hawk";
-    if (vid == 0x1057 && did == 0x480b) return "motorola_harrier";
-    if (vid == 0x1057 && did == 0x5803) return "motorola_mpc5200";
-    if (vid == 0x1057 && did == 0x5809) return "motorola_mpc5200b";
-    if (vid == 0x105a && did == 0x0d30) return "promise_20265";
-    if (vid == 0x105a && did == 0x4d30) return "promise_20267";
-    if (vid == 0x105a && did == 0x4d33) return "promise_20246";
-    if (vid == 0x105a && did == 0x4d38) return "promise_20262";
-    if (vid == 0x105a && did == 0x0D38) return "promise_20263";
-    if (vid == 0x105a && did == 0x4d68) return "promise_20268";
-    if (vid == 0x105a && did == 0x4d69) return "promise_20269";
-    if (vid == 0x105a && did == 0x6268) return "promise_20270";
-    if (vid == 0x105a && did == 0x6269) return "promise_20271";
-    if (vid == 0x105a && did == 0x1275) return "promise_20275";
-    if (vid == 0x105a && did == 0x5275) return "promise_20276";
-    if (vid == 0x105a && did == 0x7275) return "promise_20277";
-    if (vid == 0x1060 && did == 0x0101) return "umc_um8673f";
-    if (vid == 0x1060 && did == 0x673a) return "umc_um8886bf";
-    if (vid == 0x1060 && did == 0x886a) return "umc_um8886a";
-    if (vid == 0x1066 && did == 0x0002) return "picopower_pt86c523";
-    if (vid == 0x1066 && did == 0x8002) return "picopower_pt86c523bbp";
-    if (vid == 0x1069 && did == 0x0001) return "mylex_dac960_p";
-    if (vid == 0x1069 && did == 0x0002) return "mylex_dac960_pd";
-    if (vid == 0x1069 && did == 0x0010) return "mylex_dac960_pg";
-    if (vid == 0x1069 && did == 0x0020) return "mylex_dac960_la";
-    if (vid == 0x1069 && did == 0x0050) return "mylex_dac960_lp";
-    if (vid == 0x1069 && did == 0xBA56) return "mylex_dac960_ba";
-    if (vid == 0x1069 && did == 0xB166) return "mylex_dac960_gem";
-    if (vid == 0x106b && did == 0x0001) return "apple_bandit";
-    if (vid == 0x106b && did == 0x000e) return "apple_hydra";
-    if (vid == 0x106b && did == 0x0018) return "apple_uni_n_fw";
-    if (vid == 0x106b && did == 0x0020) return "apple_uni_n_agp";
-    if (vid == 0x106b && did == 0x0021) return "apple_uni_n_gmac";
-    if (vid == 0x106b && did == 0x0024) return "apple_uni_n_gmacp";
-    if (vid == 0x106b && did == 0x0027) return "apple_uni_n_agp_p";
-    if (vid == 0x106b && did == 0x002d) return "apple_uni_n_agp15";
-    if (vid == 0x106b && did == 0x002e) return "apple_uni_n_pci15";
-    if (vid == 0x106b && did == 0x0032) return "apple_uni_n_gmac2";
-    if (vid == 0x106b && did == 0x0033) return "apple_uni_n_ata";
-    if (vid == 0x106b && did == 0x0034) return "apple_uni_n_agp2";
-    if (vid == 0x106b && did == 0x003b) return "apple_ipid_ata100";
-    if (vid == 0x106b && did == 0x0043) return "apple_k2_ata100";
-    if (vid == 0x106b && did == 0x004b) return "apple_u3_agp";
-    if (vid == 0x106b && did == 0x004c) return "apple_k2_gmac";
-    if (vid == 0x106b && did == 0x0050) return "apple_sh_ata";
-    if (vid == 0x106b && did == 0x0051) return "apple_sh_sungem";
-    if (vid == 0x106b && did == 0x0058) return "apple_u3l_agp";
-    if (vid == 0x106b && did == 0x0059) return "apple_u3h_agp";
-    if (vid == 0x106b && did == 0x005b) return "apple_u4_pcie";
-    if (vid == 0x106b && did == 0x0066) return "apple_ipid2_agp";
-    if (vid == 0x106b && did == 0x0069) return "apple_ipid2_ata";
-    if (vid == 0x106b && did == 0x006a) return "apple_ipid2_fw";
-    if (vid == 0x106b && did == 0x006b) return "apple_ipid2_gmac";
-    if (vid == 0x106b && did == 0x1645) return "apple_tigon3";
-    if (vid == 0x1073 && did == 0x0004) return "yamaha_724";
-    if (vid == 0x1073 && did == 0x000d) return "yamaha_724f";
-    if (vid == 0x1073 && did == 0x000a) return "yamaha_740";
-    if (vid == 0x1073 && did == 0x000c) return "yamaha_740c";
-    if (vid == 0x1073 && did == 0x0010) return "yamaha_744";
-    if (vid == 0x1073 && did == 0x0012) return "yamaha_754";
-    if (vid == 0x1077 && did == 0x1016) return "qlogic_isp10160";
-    if (vid == 0x1077 && did == 0x1020) return "qlogic_isp1020";
-    if (vid == 0x1077 && did == 0x1080) return "qlogic_isp1080";
-    if (vid == 0x1077 && did == 0x1216) return "qlogic_isp12160";
-    if (vid == 0x1077 && did == 0x1240) return "qlogic_isp1240";
-    if (vid == 0x1077 && did == 0x1280) return "qlogic_isp1280";
-    if (vid == 0x1077 && did == 0x2100) return "qlogic_isp2100";
-    if (vid == 0x1077 && did == 0x2200) return "qlogic_isp2200";
-    if (vid == 0x1077 && did == 0x2300) return "qlogic_isp2300";
-    if (vid == 0x1077 && did == 0x2312) return "qlogic_isp2312";
-    if (vid == 0x1077 && did == 0x2322) return "qlogic_isp2322";
-    if (vid == 0x1077 && did == 0x6312) return "qlogic_isp6312";
-    if (vid == 0x1077 && did == 0x6322) return "qlogic_isp6322";
-    if (vid == 0x1077 && did == 0x2422) return "qlogic_isp2422";
-    if (vid == 0x1077 && did == 0x2432) return "qlogic_isp2432";
-    if (vid == 0x1077 && did == 0x2512) return "qlogic_isp2512";
-    if (vid == 0x1077 && did == 0x2522) return "qlogic_isp2522";
-    if (vid == 0x1077 && did == 0x5422) return "qlogic_isp5422";
-    if (vid == 0x1077 && did == 0x5432) return "qlogic_isp5432";
-    if (vid == 0x1078 && did == 0x0000) return "cyrix_5510";
-    if (vid == 0x1078 && did == 0x0001) return "cyrix_pci_master";
-    if (vid == 0x1078 && did == 0x0002) return "cyrix_5520";
-    if (vid == 0x1078 && did == 0x0100) return "cyrix_5530_legacy";
-    if (vid == 0x1078 && did == 0x0102) return "cyrix_5530_ide";
-    if (vid == 0x1078 && did == 0x0103) return "cyrix_5530_audio";
-    if (vid == 0x1078 && did == 0x0104) return "cyrix_5530_video";
-    if (vid == 0x1080 && did == 0xc693) return "contaq_82c693";
-    if (vid == 0x108d && did == 0x0012) return "olicom_oc2325";
-    if (vid == 0x108d && did == 0x0013) return "olicom_oc2183";
-    if (vid == 0x108d && did == 0x0014) return "olicom_oc2326";
-    if (vid == 0x108e && did == 0x1000) return "sun_ebus";
-    if (vid == 0x108e && did == 0x1001) return "sun_happymeal";
-    if (vid == 0x108e && did == 0x1100) return "sun_rio_ebus";
-    if (vid == 0x108e && did == 0x1101) return "sun_rio_gem";
-    if (vid == 0x108e && did == 0x1102) return "sun_rio_1394";
-    if (vid == 0x108e && did == 0x1103) return "sun_rio_usb";
-    if (vid == 0x108e && did == 0x2bad) return "sun_gem";
-    if (vid == 0x108e && did == 0x5000) return "sun_simba";
-    if (vid == 0x108e && did == 0x8000) return "sun_pbm";
-    if (vid == 0x108e && did == 0x8001) return "sun_schizo";
-    if (vid == 0x108e && did == 0xa000) return "sun_sabre";
-    if (vid == 0x108e && did == 0xa001) return "sun_hummingbird";
-    if (vid == 0x108e && did == 0xa801) return "sun_tomatillo";
-    if (vid == 0x108e && did == 0xabba) return "sun_cassini";
-    if (vid == 0x1093 && did == 0xd130) return "ni_pci2322";
-    if (vid == 0x1093 && did == 0xd140) return "ni_pci2324";
-    if (vid == 0x1093 && did == 0xd150) return "ni_pci2328";
-    if (vid == 0x1093 && did == 0xd190) return "ni_pxi8422_2322";
-    if (vid == 0x1093 && did == 0xd1a0) return "ni_pxi8422_2324";
-    if (vid == 0x1093 && did == 0xd1d0) return "ni_pxi8420_2322";
-    if (vid == 0x1093 && did == 0xd1e0) return "ni_pxi8420_2324";
-    if (vid == 0x1093 && did == 0xd1f0) return "ni_pxi8420_2328";
-    if (vid == 0x1093 && did == 0xd1f1) return "ni_pxi8420_23216";
-    if (vid == 0x1093 && did == 0xd250) return "ni_pci2322i";
-    if (vid == 0x1093 && did == 0xd270) return "ni_pci2324i";
-    if (vid == 0x1093 && did == 0xd2b0) return "ni_pci23216";
-    if (vid == 0x1093 && did == 0x7080) return "ni_pxi8430_2322";
-    if (vid == 0x1093 && did == 0x70db) return "ni_pci8430_2322";
-    if (vid == 0x1093 && did == 0x70dd) return "ni_pxi8430_2324";
-    if (vid == 0x1093 && did == 0x70df) return "ni_pci8430_2324";
-    if (vid == 0x1093 && did == 0x70e2) return "ni_pxi8430_2328";
-    if (vid == 0x1093 && did == 0x70e4) return "ni_pci8430_2328";
-    if (vid == 0x1093 && did == 0x70e6) return "ni_pxi8430_23216";
-    if (vid == 0x1093 && did == 0x70e7) return "ni_pci8430_23216";
-    if (vid == 0x1093 && did == 0x70e8) return "ni_pxi8432_2322";
-    if (vid == 0x1093 && did == 0x70ea) return "ni_pci8432_2322";
-    if (vid == 0x1093 && did == 0x70ec) return "ni_pxi8432_2324";
-    if (vid == 0x1093 && did == 0x70ee) return "ni_pci8432_2324";
-    if (vid == 0x1095 && did == 0x0643) return "cmd_643";
-    if (vid == 0x1095 && did == 0x0646) return "cmd_646";
-    if (vid == 0x1095 && did == 0x0648) return "cmd_648";
-    if (vid == 0x1095 && did == 0x0649) return "cmd_649";
-    if (vid == 0x1095 && did == 0x0680) return "sii_680";
-    if (vid == 0x1095 && did == 0x3112) return "sii_3112";
-    if (vid == 0x1095 && did == 0x0240) return "sii_1210sa";
-    if (vid == 0x109e && did == 0x0878) return "brooktree_878";
-    if (vid == 0x109e && did == 0x0879) return "brooktree_879";
-    if (vid == 0x10a9 && did == 0x0003) return "sgi_ioc3";
-    if (vid == 0x10a9 && did == 0x1002) return "sgi_lithium";
-    if (vid == 0x10a9 && did == 0x100a) return "sgi_ioc4";
-    if (vid == 0x10ad && did == 0x0105) return "winbond_82c105";
-    if (vid == 0x10ad && did == 0x0565) return "winbond_83c553";
-    if (vid == 0x10b5 && did == 0x1030) return "plx_r685";
-    if (vid == 0x10b5 && did == 0x106a) return "plx_romulus";
-    if (vid == 0x10b5 && did == 0x1076) return "plx_spcom800";
-    if (vid == 0x10b5 && did == 0x1077) return "plx_1077";
-    if (vid == 0x10b5 && did == 0x1103) return "plx_spcom200";
-    if (vid == 0x10b5 && did == 0x1151) return "plx_djinn_itoo";
-    if (vid == 0x10b5 && did == 0x1152) return "plx_r753";
-    if (vid == 0x10b5 && did == 0x1187) return "plx_olitec";
-    if (vid == 0x10b5 && did == 0x3196) return "plx_pci200syn";
-    if (vid == 0x10b5 && did == 0x9030) return "plx_9030";
-    if (vid == 0x10b5 && did == 0x9050) return "plx_9050";
-    if (vid == 0x10b5 && did == 0x9056) return "plx_9056";
-    if (vid == 0x10b5 && did == 0x9080) return "plx_9080";
-    if (vid == 0x10b5 && did == 0xa001) return "plx_gtek_serial2";
-    if (vid == 0x10b6 && did == 0x0002) return "madge_mk2";
-    if (vid == 0x10b7 && did == 0x0001) return "3com_3c985";
-    if (vid == 0x10b7 && did == 0x1700) return "3com_3c940";
-    if (vid == 0x10b7 && did == 0x3390) return "3com_3c339";
-    if (vid == 0x10b7 && did == 0x3590) return "3com_3c359";
-    if (vid == 0x10b7 && did == 0x80eb) return "3com_3c940b";
-    if (vid == 0x10b7 && did == 0x9900) return "3com_3cr990";
-    if (vid == 0x10b7 && did == 0x9902) return "3com_3cr990_tx_95";
-    if (vid == 0x10b7 && did == 0x9903) return "3com_3cr990_tx_97";
-    if (vid == 0x10b7 && did == 0x9904) return "3com_3cr990b";
-    if (vid == 0x10b7 && did == 0x9905) return "3com_3cr990_fx";
-    if (vid == 0x10b7 && did == 0x9908) return "3com_3cr990svr95";
-    if (vid == 0x10b7 && did == 0x9909) return "3com_3cr990svr97";
-    if (vid == 0x10b7 && did == 0x990a) return "3com_3cr990svr";
-    if (vid == 0x10b9 && did == 0x1533) return "al_m1533";
-    if (vid == 0x10b9 && did == 0x1535) return "al_m1535";
-    if (vid == 0x10b9 && did == 0x1541) return "al_m1541";
-    if (vid == 0x10b9 && did == 0x1563) return "al_m1563";
-    if (vid == 0x10b9 && did == 0x1621) return "al_m1621";
-    if (vid == 0x10b9 && did == 0x1631) return "al_m1631";
-    if (vid == 0x10b9 && did == 0x1632) return "al_m1632";
-    if (vid == 0x10b9 && did == 0x1641) return "al_m1641";
-    if (vid == 0x10b9 && did == 0x1644) return "al_m1644";
-    if (vid == 0x10b9 && did == 0x1647) return "al_m1647";
-    if (vid == 0x10b9 && did == 0x1651) return "al_m1651";
-    if (vid == 0x10b9 && did == 0x1671) return "al_m1671";
-    if (vid == 0x10b9 && did == 0x1681) return "al_m1681";
-    if (vid == 0x10b9 && did == 0x1683) return "al_m1683";
-    if (vid == 0x10b9 && did == 0x1689) return "al_m1689";
-    if (vid == 0x10b9 && did == 0x5219) return "al_m5219";
-    if (vid == 0x10b9 && did == 0x5228) return "al_m5228";
-    if (vid == 0x10b9 && did == 0x5229) return "al_m5229";
-    if (vid == 0x10b9 && did == 0x5451) return "al_m5451";
-    if (vid == 0x10b9 && did == 0x7101) return "al_m7101";
-    if (vid == 0x10c8 && did == 0x8005) return "neomagic_nm256av_audio";
-    if (vid == 0x10c8 && did == 0x8006) return "neomagic_nm256zx_audio";
-    if (vid == 0x10c8 && did == 0x8016) return "neomagic_nm256xl_plus_audio";
-    if (vid == 0x10da && did == 0x0508) return "tconrad_tokenring";
-    if (vid == 0x10de && did == 0x0020) return "nvidia_tnt";
-    if (vid == 0x10de && did == 0x0028) return "nvidia_tnt2";
-    if (vid == 0x10de && did == 0x0029) return "nvidia_utnt2";
-    if (vid == 0x10de && did == 0x002a) return "nvidia_tnt_unknown";
-    if (vid == 0x10de && did == 0x002C) return "nvidia_vtnt2";
-    if (vid == 0x10de && did == 0x002D) return "nvidia_uvtnt2";
-    if (vid == 0x10de && did == 0x0034) return "nvidia_nforce_mcp04_smbus";
-    if (vid == 0x10de && did == 0x0035) return "nvidia_nforce_mcp04_ide";
-    if (vid == 0x10de && did == 0x0036) return "nvidia_nforce_mcp04_sata";
-    if (vid == 0x10de && did == 0x003e) return "nvidia_nforce_mcp04_sata2";
-    if (vid == 0x10de && did == 0x0040) return "nvidia_geforce_6800_ultra";
-    if (vid == 0x10de && did == 0x0041) return "nvidia_geforce_6800";
-    if (vid == 0x10de && did == 0x0042) return "nvidia_geforce_6800_le";
-    if (vid == 0x10de && did == 0x0045) return "nvidia_geforce_6800_gt";
-    if (vid == 0x10de && did == 0x004E) return "nvidia_quadro_fx_4000";
-    if (vid == 0x10de && did == 0x0052) return "nvidia_nforce4_smbus";
-    if (vid == 0x10de && did == 0x0053) return "nvidia_nforce_ck804_ide";
-    if (vid == 0x10de && did == 0x0054) return "nvidia_nforce_ck804_sata";
-    if (vid == 0x10de && did == 0x0055) return "nvidia_nforce_ck804_sata2";
-    if (vid == 0x10de && did == 0x0059) return "nvidia_ck804_audio";
-    if (vid == 0x10de && did == 0x005d) return "nvidia_ck804_pcie";
-    if (vid == 0x10de && did == 0x0064) return "nvidia_nforce2_smbus";
-    if (vid == 0x10de && did == 0x0065) return "nvidia_nforce2_ide";
-    if (vid == 0x10de && did == 0x0069) return "nvidia_mcp2_modem";
-    if (vid == 0x10de && did == 0x006a) return "nvidia_mcp2_audio";
-    if (vid == 0x10de && did == 0x0084) return "nvidia_nforce2s_smbus";
-    if (vid == 0x10de && did == 0x0085) return "nvidia_nforce2s_ide";
-    if (vid == 0x10de && did == 0x0089) return "nvidia_mcp2s_modem";
-    if (vid == 0x10de && did == 0x008a) return "nvidia_ck8_audio";
-    if (vid == 0x10de && did == 0x008e) return "nvidia_nforce2s_sata";
-    if (vid == 0x10de && did == 0x0090) return "nvidia_geforce_7800_gt";
-    if (vid == 0x10de && did == 0x0091) return "nvidia_geforce_7800_gtx";
-    if (vid == 0x10de && did == 0x0098) return "nvidia_geforce_go_7800";
-    if (vid == 0x10de && did == 0x0099) return "nvidia_geforce_go_7800_gtx";
-    if (vid == 0x10de && did == 0x00A0) return "nvidia_itnt2";
-    if (vid == 0x10de && did == 0x00c1) return "geforce_6800a";
-    if (vid == 0x10de && did == 0x00c2) return "geforce_6800a_le";
-    if (vid == 0x10de && did == 0x00c8) return "geforce_go_6800";
-    if (vid == 0x10de && did == 0x00c9) return "geforce_go_6800_ultra";
-    if (vid == 0x10de && did == 0x00cc) return "quadro_fx_go1400";
-    if (vid == 0x10de && did == 0x00ce) return "quadro_fx_1400";
-    if (vid == 0x10de && did == 0x00d1) return "nvidia_nforce3";
-    if (vid == 0x10de && did == 0x00d4) return "nvidia_nforce3_smbus";
-    if (vid == 0x10de && did == 0x00d5) return "nvidia_nforce3_ide";
-    if (vid == 0x10de && did == 0x00d9) return "nvidia_mcp3_modem";
-    if (vid == 0x10de && did == 0x00da) return "nvidia_mcp3_audio";
-    if (vid == 0x10de && did == 0x00e1) return "nvidia_nforce3s";
-    if (vid == 0x10de && did == 0x00e3) return "nvidia_nforce3s_sata";
-    if (vid == 0x10de && did == 0x00e4) return "nvidia_nforce3s_smbus";
-    if (vid == 0x10de && did == 0x00e5) return "nvidia_nforce3s_ide";
-    if (vid == 0x10de && did == 0x00ea) return "nvidia_ck8s_audio";
-    if (vid == 0x10de && did == 0x00ee) return "nvidia_nforce3s_sata2";
-    if (vid == 0x10de && did == 0x0100) return "nvidia_geforce_sdr";
-    if (vid == 0x10de && did == 0x0101) return "nvidia_geforce_ddr";
-    if (vid == 0x10de && did == 0x0103) return "nvidia_quadro";
-    if (vid == 0x10de && did == 0x0110) return "nvidia_geforce2_mx";
-    if (vid == 0x10de && did == 0x0111) return "nvidia_geforce2_mx2";
-    if (vid == 0x10de && did == 0x0112) return "nvidia_geforce2_go";
-    if (vid == 0x10de && did == 0x0113) return "nvidia_quadro2_mxr";
-    if (vid == 0x10de && did == 0x0140) return "nvidia_geforce_6600_gt";
-    if (vid == 0x10de && did == 0x0141) return "nvidia_geforce_6600";
-    if (vid == 0x10de && did == 0x0145) return "nvidia_geforce_6610_xl";
-    if (vid == 0x10de && did == 0x014E) return "nvidia_quadro_fx_540";
-    if (vid == 0x10de && did == 0x014F) return "nvidia_geforce_6200";
-    if (vid == 0x10de && did == 0x0150) return "nvidia_geforce2_gts";
-    if (vid == 0x10de && did == 0x0151) return "nvidia_geforce2_gts2";
-    if (vid == 0x10de && did == 0x0152) return "nvidia_geforce2_ultra";
-    if (vid == 0x10de && did == 0x0153) return "nvidia_quadro2_pro";
-    if (vid == 0x10de && did == 0x0161) return "nvidia_geforce_6200_turbocache";
-    if (vid == 0x10de && did == 0x0164) return "nvidia_geforce_go_6200";
-    if (vid == 0x10de && did == 0x0166) return "nvidia_geforce_go_6250";
-    if (vid == 0x10de && did == 0x0167) return "nvidia_geforce_go_6200_1";
-    if (vid == 0x10de && did == 0x0168) return "nvidia_geforce_go_6250_1";
-    if (vid == 0x10de && did == 0x0170) return "nvidia_geforce4_mx_460";
-    if (vid == 0x10de && did == 0x0171) return "nvidia_geforce4_mx_440";
-    if (vid == 0x10de && did == 0x0172) return "nvidia_geforce4_mx_420";
-    if (vid == 0x10de && did == 0x0173) return "nvidia_geforce4_mx_440_se";
-    if (vid == 0x10de && did == 0x0174) return "nvidia_geforce4_440_go";
-    if (vid == 0x10de && did == 0x0175) return "nvidia_geforce4_420_go";
-    if (vid == 0x10de && did == 0x0176) return "nvidia_geforce4_420_go_m32";
-    if (vid == 0x10de && did == 0x0177) return "nvidia_geforce4_460_go";
-    if (vid == 0x10de && did == 0x0178) return "nvidia_quadro4_500xgl";
-    if (vid == 0x10de && did == 0x0179) return "nvidia_geforce4_440_go_m64";
-    if (vid == 0x10de && did == 0x017A) return "nvidia_quadro4_200";
-    if (vid == 0x10de && did == 0x017B) return "nvidia_quadro4_550xgl";
-    if (vid == 0x10de && did == 0x017C) return "nvidia_quadro4_500_gogl";
-    if (vid == 0x10de && did == 0x017D) return "nvidia_geforce4_410_go_m16";
-    if (vid == 0x10de && did == 0x0181) return "nvidia_geforce4_mx_440_8x";
-    if (vid == 0x10de && did == 0x0182) return "nvidia_geforce4_mx_440se_8x";
-    if (vid == 0x10de && did == 0x0183) return "nvidia_geforce4_mx_420_8x";
-    if (vid == 0x10de && did == 0x0185) return "nvidia_geforce4_mx_4000";
-    if (vid == 0x10de && did == 0x0186) return "nvidia_geforce4_448_go";
-    if (vid == 0x10de && did == 0x0187) return "nvidia_geforce4_488_go";
-    if (vid == 0x10de && did == 0x0188) return "nvidia_quadro4_580_xgl";
-    if (vid == 0x10de && did == 0x0189) return "nvidia_geforce4_mx_mac";
-    if (vid == 0x10de && did == 0x018A) return "nvidia_quadro4_280_nvs";
-    if (vid == 0x10de && did == 0x018B) return "nvidia_quadro4_380_xgl";
-    if (vid == 0x10de && did == 0x01a0) return "nvidia_igeforce2";
-    if (vid == 0x10de && did == 0x01a4) return "nvidia_nforce";
-    if (vid == 0x10de && did == 0x01b1) return "nvidia_mcp1_audio";
-    if (vid == 0x10de && did == 0x01b4) return "nvidia_nforce_smbus";
-    if (vid == 0x10de && did == 0x01bc) return "nvidia_nforce_ide";
-    if (vid == 0x10de && did == 0x01c1) return "nvidia_mcp1_modem";
-    if (vid == 0x10de && did == 0x01e0) return "nvidia_nforce2";
-    if (vid == 0x10de && did == 0x0200) return "nvidia_geforce3";
-    if (vid == 0x10de && did == 0x0201) return "nvidia_geforce3_1";
-    if (vid == 0x10de && did == 0x0202) return "nvidia_geforce3_2";
-    if (vid == 0x10de && did == 0x0203) return "nvidia_quadro_ddc";
-    if (vid == 0x10de && did == 0x0211) return "nvidia_geforce_6800b";
-    if (vid == 0x10de && did == 0x0212) return "nvidia_geforce_6800b_le";
-    if (vid == 0x10de && did == 0x0215) return "nvidia_geforce_6800b_gt";
-    if (vid == 0x10de && did == 0x0250) return "nvidia_geforce4_ti_4600";
-    if (vid == 0x10de && did == 0x0251) return "nvidia_geforce4_ti_4400";
-    if (vid == 0x10de && did == 0x0253) return "nvidia_geforce4_ti_4200";
-    if (vid == 0x10de && did == 0x0258) return "nvidia_quadro4_900xgl";
-    if (vid == 0x10de && did == 0x0259) return "nvidia_quadro4_750xgl";
-    if (vid == 0x10de && did == 0x025B) return "nvidia_quadro4_700xgl";
-    if (vid == 0x10de && did == 0x0264) return "nvidia_nforce_mcp51_smbus";
-    if (vid == 0x10de && did == 0x0265) return "nvidia_nforce_mcp51_ide";
-    if (vid == 0x10de && did == 0x0266) return "nvidia_nforce_mcp51_sata";
-    if (vid == 0x10de && did == 0x0267) return "nvidia_nforce_mcp51_sata2";
-    if (vid == 0x10de && did == 0x0368) return "nvidia_nforce_mcp55_smbus";
-    if (vid == 0x10de && did == 0x036E) return "nvidia_nforce_mcp55_ide";
-    if (vid == 0x10de && did == 0x037E) return "nvidia_nforce_mcp55_sata";
-    if (vid == 0x10de && did == 0x037F) return "nvidia_nforce_mcp55_sata2";
-    if (vid == 0x10de && did == 0x0280) return "nvidia_geforce4_ti_4800";
-    if (vid == 0x10de && did == 0x0281) return "nvidia_geforce4_ti_4800_8x";
-    if (vid == 0x10de && did == 0x0282) return "nvidia_geforce4_ti_4800se";
-    if (vid == 0x10de && did == 0x0286) return "nvidia_geforce4_4200_go";
-    if (vid == 0x10de && did == 0x0288) return "nvidia_quadro4_980_xgl";
-    if (vid == 0x10de && did == 0x0289) return "nvidia_quadro4_780_xgl";
-    if (vid == 0x10de && did == 0x028C) return "nvidia_quadro4_700_gogl";
-    if (vid == 0x10de && did == 0x0301) return "nvidia_geforce_fx_5800_ultra";
-    if (vid == 0x10de && did == 0x0302) return "nvidia_geforce_fx_5800";
-    if (vid == 0x10de && did == 0x0308) return "nvidia_quadro_fx_2000";
-    if (vid == 0x10de && did == 0x0309) return "nvidia_quadro_fx_1000";
-    if (vid == 0x10de && did == 0x0311) return "nvidia_geforce_fx_5600_ultra";
-    if (vid == 0x10de && did == 0x0312) return "nvidia_geforce_fx_5600";
-    if (vid == 0x10de && did == 0x0314) return "nvidia_geforce_fx_5600se";
-    if (vid == 0x10de && did == 0x031A) return "nvidia_geforce_fx_go5600";
-    if (vid == 0x10de && did == 0x031B) return "nvidia_geforce_fx_go5650";
-    if (vid == 0x10de && did == 0x031C) return "nvidia_quadro_fx_go700";
-    if (vid == 0x10de && did == 0x0320) return "nvidia_geforce_fx_5200";
-    if (vid == 0x10de && did == 0x0321) return "nvidia_geforce_fx_5200_ultra";
-    if (vid == 0x10de && did == 0x0322) return "nvidia_geforce_fx_5200_1";
-    if (vid == 0x10de && did == 0x0323) return "nvidia_geforce_fx_5200se";
-    if (vid == 0x10de && did == 0x0324) return "nvidia_geforce_fx_go5200";
-    if (vid == 0x10de && did == 0x0325) return "nvidia_geforce_fx_go5250";
-    if (vid == 0x10de && did == 0x0326) return "nvidia_geforce_fx_5500";
-    if (vid == 0x10de && did == 0x0327) return "nvidia_geforce_fx_5100";
-    if (vid == 0x10de && did == 0x0328) return "nvidia_geforce_fx_go5250_32";
-    if (vid == 0x10de && did == 0x0329) return "nvidia_geforce_fx_go_5200";
-    if (vid == 0x10de && did == 0x032A) return "nvidia_quadro_nvs_280_pci";
-    if (vid == 0x10de && did == 0x032B) return "nvidia_quadro_fx_500";
-    if (vid == 0x10de && did == 0x032C) return "nvidia_geforce_fx_go5300";
-    if (vid == 0x10de && did == 0x032D) return "nvidia_geforce_fx_go5100";
-    if (vid == 0x10de && did == 0x0330) return "nvidia_geforce_fx_5900_ultra";
-    if (vid == 0x10de && did == 0x0331) return "nvidia_geforce_fx_5900";
-    if (vid == 0x10de && did == 0x0332) return "nvidia_geforce_fx_5900xt";
-    if (vid == 0x10de && did == 0x0333) return "nvidia_geforce_fx_5950_ultra";
-    if (vid == 0x10de && did == 0x0334) return "nvidia_geforce_fx_5900zt";
-    if (vid == 0x10de && did == 0x0338) return "nvidia_quadro_fx_3000";
-    if (vid == 0x10de && did == 0x033F) return "nvidia_quadro_fx_700";
-    if (vid == 0x10de && did == 0x0341) return "nvidia_geforce_fx_5700_ultra";
-    if (vid == 0x10de && did == 0x0342) return "nvidia_geforce_fx_5700";
-    if (vid == 0x10de && did == 0x0343) return "nvidia_geforce_fx_5700le";
-    if (vid == 0x10de && did == 0x0344) return "nvidia_geforce_fx_5700ve";
-    if (vid == 0x10de && did == 0x0347) return "nvidia_geforce_fx_go5700_1";
-    if (vid == 0x10de && did == 0x0348) return "nvidia_geforce_fx_go5700_2";
-    if (vid == 0x10de && did == 0x034C) return "nvidia_quadro_fx_go1000";
-    if (vid == 0x10de && did == 0x034E) return "nvidia_quadro_fx_1100";
-    if (vid == 0x10de && did == 0x0360) return "nvidia_mcp55_bridge_v0";
-    if (vid == 0x10de && did == 0x0364) return "nvidia_mcp55_bridge_v4";
-    if (vid == 0x10de && did == 0x0373) return "nvidia_nvenet_15";
-    if (vid == 0x10de && did == 0x03E7) return "nvidia_nforce_mcp61_sata";
-    if (vid == 0x10de && did == 0x03EB) return "nvidia_nforce_mcp61_smbus";
-    if (vid == 0x10de && did == 0x03EC) return "nvidia_nforce_mcp61_ide";
-    if (vid == 0x10de && did == 0x03F6) return "nvidia_nforce_mcp61_sata2";
-    if (vid == 0x10de && did == 0x03F7) return "nvidia_nforce_mcp61_sata3";
-    if (vid == 0x10de && did == 0x0446) return "nvidia_nforce_mcp65_smbus";
-    if (vid == 0x10de && did == 0x0448) return "nvidia_nforce_mcp65_ide";
-    if (vid == 0x10de && did == 0x0542) return "nvidia_nforce_mcp67_smbus";
-    if (vid == 0x10de && did == 0x0560) return "nvidia_nforce_mcp67_ide";
-    if (vid == 0x10de && did == 0x056C) return "nvidia_nforce_mcp73_ide";
-    if (vid == 0x10de && did == 0x0752) return "nvidia_nforce_mcp78s_smbus";
-    if (vid == 0x10de && did == 0x0759) return "nvidia_nforce_mcp77_ide";
-    if (vid == 0x10de && did == 0x07D8) return "nvidia_nforce_mcp73_smbus";
-    if (vid == 0x10de && did == 0x0AA2) return "nvidia_nforce_mcp79_smbus";
-    if (vid == 0x10de && did == 0x0D85) return "nvidia_nforce_mcp89_sata";
-    if (vid == 0x10e0 && did == 0x9128) return "ims_tt128";
-    if (vid == 0x10e0 && did == 0x9135) return "ims_tt3d";
-    if (vid == 0x10ea && did == 0x1682) return "interg_1682";
-    if (vid == 0x10ea && did == 0x2000) return "interg_2000";
-    if (vid == 0x10ea && did == 0x2010) return "interg_2010";
-    if (vid == 0x10ea && did == 0x5000) return "interg_5000";
-    if (vid == 0x10ea && did == 0x5050) return "interg_5050";
-    if (vid == 0x10ec && did == 0x8139) return "realtek_8139";
-    if (vid == 0x10ee && did == 0x3fc0) return "rme_digi96";
-    if (vid == 0x10ee && did == 0x3fc1) return "rme_digi96_8";
-    if (vid == 0x10ee && did == 0x3fc2) return "rme_digi96_8_pro";
-    if (vid == 0x10ee && did == 0x3fc3) return "rme_digi96_8_pad_or_pst";
-    if (vid == 0x10ee && did == 0x3fc5) return "xilinx_hammerfall_dsp";
-    if (vid == 0x10ee && did == 0x3fc6) return "xilinx_hammerfall_dsp_madi";
-    if (vid == 0x1102 && did == 0x0002) return "creative_emu10k1";
-    if (vid == 0x1102 && did == 0x0005) return "creative_20k1";
-    if (vid == 0x1102 && did == 0x000b) return "creative_20k2";
-    if (vid == 0x1102 && did == 0x8938) return "ectiva_ev1938";
-    if (vid == 0x1103 && did == 0x0003) return "tti_hpt343";
-    if (vid == 0x1103 && did == 0x0004) return "tti_hpt366";
-    if (vid == 0x1103 && did == 0x0005) return "tti_hpt372";
-    if (vid == 0x1103 && did == 0x0006) return "tti_hpt302";
-    if (vid == 0x1103 && did == 0x0007) return "tti_hpt371";
-    if (vid == 0x1103 && did == 0x0008) return "tti_hpt374";
-    if (vid == 0x1103 && did == 0x0009) return "tti_hpt372n";
-    if (vid == 0x1106 && did == 0x0198) return "via_8763_0";
-    if (vid == 0x1106 && did == 0x0204) return "via_8380_0";
-    if (vid == 0x1106 && did == 0x0238) return "via_3238_0";
-    if (vid == 0x1106 && did == 0x0258) return "via_pt880";
-    if (vid == 0x1106 && did == 0x0308) return "via_pt880ultra";
-    if (vid == 0x1106 && did == 0x0259) return "via_px8x0_0";
-    if (vid == 0x1106 && did == 0x0269) return "via_3269_0";
-    if (vid == 0x1106 && did == 0x0282) return "via_k8t800pro_0";
-    if (vid == 0x1106 && did == 0x0296) return "via_3296_0";
-    if (vid == 0x1106 && did == 0x0305) return "via_8363_0";
-    if (vid == 0x1106 && did == 0x0314) return "via_p4m800ce";
-    if (vid == 0x1106 && did == 0x0327) return "via_p4m890";
-    if (vid == 0x1106 && did == 0x0324) return "via_vt3324";
-    if (vid == 0x1106 && did == 0x0336) return "via_vt3336";
-    if (vid == 0x1106 && did == 0x0351) return "via_vt3351";
-    if (vid == 0x1106 && did == 0x0364) return "via_vt3364";
-    if (vid == 0x1106 && did == 0x0391) return "via_8371_0";
-    if (vid == 0x1106 && did == 0x0415) return "via_6415";
-    if (vid == 0x1106 && did == 0x0501) return "via_8501_0";
-    if (vid == 0x1106 && did == 0x0561) return "via_82c561";
-    if (vid == 0x1106 && did == 0x0571) return "via_82c586_1";
-    if (vid == 0x1106 && did == 0x0576) return "via_82c576";
-    if (vid == 0x1106 && did == 0x0586) return "via_82c586_0";
-    if (vid == 0x1106 && did == 0x0596) return "via_82c596";
-    if (vid == 0x1106 && did == 0x0597) return "via_82c597_0";
-    if (vid == 0x1106 && did == 0x0598) return "via_82c598_0";
-    if (vid == 0x1106 && did == 0x0601) return "via_8601_0";
-    if (vid == 0x1106 && did == 0x0605) return "via_8605_0";
-    if (vid == 0x1106 && did == 0x0686) return "via_82c686";
-    if (vid == 0x1106 && did == 0x0691) return "via_82c691_0";
-    if (vid == 0x1106 && did == 0x1571) return "via_82c576_1";
-    if (vid == 0x1106 && did == 0x3038) return "via_82c586_2";
-    if (vid == 0x1106 && did == 0x3040) return "via_82c586_3";
-    if (vid == 0x1106 && did == 0x3050) return "via_82c596_3";
-    if (vid == 0x1106 && did == 0x3051) return "via_82c596b_3";
-    if (vid == 0x1106 && did == 0x3057) return "via_82c686_4";
-    if (vid == 0x1106 && did == 0x3058) return "via_82c686_5";
-    if (vid == 0x1106 && did == 0x3059) return "via_8233_5";
-    if (vid == 0x1106 && did == 0x3074) return "via_8233_0";
-    if (vid == 0x1106 && did == 0x3091) return "via_8633_0";
-    if (vid == 0x1106 && did == 0x3099) return "via_8367_0";
-    if (vid == 0x1106 && did == 0x3101) return "via_8653_0";
-    if (vid == 0x1106 && did == 0x3102) return "via_8622";
-    if (vid == 0x1106 && did == 0x3104) return "via_8235_usb_2";
-    if (vid == 0x1106 && did == 0x3109) return "via_8233c_0";
-    if (vid == 0x1106 && did == 0x3112) return "via_8361";
-    if (vid == 0x1106 && did == 0x3116) return "via_xm266";
-    if (vid == 0x1106 && did == 0x3119) return "via_612x";
-    if (vid == 0x1106 && did == 0x3123) return "via_862x_0";
-    if (vid == 0x1106 && did == 0x3128) return "via_8753_0";
-    if (vid == 0x1106 && did == 0x3147) return "via_8233a";
-    if (vid == 0x1106 && did == 0x3148) return "via_8703_51_0";
-    if (vid == 0x1106 && did == 0x3149) return "via_8237_sata";
-    if (vid == 0x1106 && did == 0x3156) return "via_xn266";
-    if (vid == 0x1106 && did == 0x3164) return "via_6410";
-    if (vid == 0x1106 && did == 0x3168) return "via_8754c_0";
-    if (vid == 0x1106 && did == 0x3177) return "via_8235";
-    if (vid == 0x1106 && did == 0x3188) return "via_8385_0";
-    if (vid == 0x1106 && did == 0x3189) return "via_8377_0";
-    if (vid == 0x1106 && did == 0x3205) return "via_8378_0";
-    if (vid == 0x1106 && did == 0x3208) return "via_8783_0";
-    if (vid == 0x1106 && did == 0x3227) return "via_8237";
-    if (vid == 0x1106 && did == 0x3287) return "via_8251";
-    if (vid == 0x1106 && did == 0x3402) return "via_8261";
-    if (vid == 0x1106 && did == 0x3337) return "via_8237a";
-    if (vid == 0x1106 && did == 0x3372) return "via_8237s";
-    if (vid == 0x1106 && did == 0x5324) return "via_sata_eide";
-    if (vid == 0x1106 && did == 0x8231) return "via_8231";
-    if (vid == 0x1106 && did == 0x8235) return "via_8231_4";
-    if (vid == 0x1106 && did == 0x8305) return "via_8365_1";
-    if (vid == 0x1106 && did == 0x8324) return "via_cx700";
-    if (vid == 0x1106 && did == 0x0581) return "via_cx700_ide";
-    if (vid == 0x1106 && did == 0x8353) return "via_vx800";
-    if (vid == 0x1106 && did == 0x8409) return "via_vx855";
-    if (vid == 0x1106 && did == 0x8410) return "via_vx900";
-    if (vid == 0x1106 && did == 0x8391) return "via_8371_1";
-    if (vid == 0x1106 && did == 0x8598) return "via_82c598_1";
-    if (vid == 0x1106 && did == 0xB188) return "via_838x_1";
-    if (vid == 0x1106 && did == 0xB198) return "via_83_87xx_1";
-    if (vid == 0x1106 && did == 0xC409) return "via_vx855_ide";
-    if (vid == 0x1106 && did == 0xFFFF) return "via_anon";
-    if (vid == 0x110A && did == 0x2102) return "siemens_dscc4";
-    if (vid == 0x1119 && did == 0x0001) return "vortex_gdt6000b";
-    if (vid == 0x1119 && did == 0x0004) return "vortex_gdt6530";
-    if (vid == 0x1119 && did == 0x0005) return "vortex_gdt6550";
-    if (vid == 0x1119 && did == 0x0008) return "vortex_gdt6537";
-    if (vid == 0x1119 && did == 0x0009) return "vortex_gdt6557";
-    if (vid == 0x1119 && did == 0x000c) return "vortex_gdt6535";
-    if (vid == 0x1119 && did == 0x000d) return "vortex_gdt6555";
-    if (vid == 0x1119 && did == 0x0102) return "vortex_gdt6537rp";
-    if (vid == 0x1119 && did == 0x0103) return "vortex_gdt6557rp";
-    if (vid == 0x111a && did == 0x0000) return "ef_atm_fpga";
-    if (vid == 0x111a && did == 0x0002) return "ef_atm_asic";
-    if (vid == 0x111a && did == 0x0003) return "ef_atm_lanai2";
-    if (vid == 0x111a && did == 0x0005) return "ef_atm_lanaihb";
-    if (vid == 0x111d && did == 0x0001) return "idt_idt77201";
-    if (vid == 0x1127 && did == 0x0300) return "fore_pca200e";
-    if (vid == 0x1131 && did == 0x7146) return "philips_saa7146";
-    if (vid == 0x1131 && did == 0x9730) return "philips_saa9730";
-    if (vid == 0x1133 && did == 0xe002) return "eicon_diva20";
-    if (vid == 0x1133 && did == 0xe004) return "eicon_diva20_u";
-    if (vid == 0x1133 && did == 0xe005) return "eicon_diva201";
-    if (vid == 0x1133 && did == 0xe00b) return "eicon_diva202";
-    if (vid == 0x1133 && did == 0xe010) return "eicon_maestra";
-    if (vid == 0x1133 && did == 0xe012) return "eicon_maestraq";
-    if (vid == 0x1133 && did == 0xe013) return "eicon_maestraq_u";
-    if (vid == 0x1133 && did == 0xe014) return "eicon_maestrap";
-    if (vid == 0x1138 && did == 0x5550) return "ziatech_5550_hc";
-    if (vid == 0x1148 && did == 0x4200) return "syskonnect_tr";
-    if (vid == 0x1148 && did == 0x4300) return "syskonnect_ge";
-    if (vid == 0x1148 && did == 0x4320) return "syskonnect_yu";
-    if (vid == 0x1148 && did == 0x4400) return "syskonnect_9dxx";
-    if (vid == 0x1148 && did == 0x4500) return "syskonnect_9mxx";
-    if (vid == 0x114f && did == 0x0070) return "digi_df_m_iom2_e";
-    if (vid == 0x114f && did == 0x0071) return "digi_df_m_e";
-    if (vid == 0x114f && did == 0x0072) return "digi_df_m_iom2_a";
-    if (vid == 0x114f && did == 0x0073) return "digi_df_m_a";
-    if (vid == 0x114f && did == 0x00B1) return "digi_neo_8";
-    if (vid == 0x114f && did == 0x00C8) return "neo_2db9";
-    if (vid == 0x114f && did == 0x00C9) return "neo_2db9pri";
-    if (vid == 0x114f && did == 0x00CA) return "neo_2rj45";
-    if (vid == 0x114f && did == 0x00CB) return "neo_2rj45pri";
-    if (vid == 0x115d && did == 0x0101) return "xircom_rbm56g";
-    if (vid == 0x115d && did == 0x0103) return "xircom_x3201_mdm";
-    if (vid == 0x1166 && did == 0x0008) return "serverworks_he";
-    if (vid == 0x1166 && did == 0x0009) return "serverworks_le";
-    if (vid == 0x1166 && did == 0x0017) return "serverworks_gcnb_le";
-    if (vid == 0x1166 && did == 0x0036) return "serverworks_ht1000_pxb";
-    if (vid == 0x1166 && did == 0x0103) return "serverworks_epb";
-    if (vid == 0x1166 && did == 0x0132) return "serverworks_ht2000_pcie";
-    if (vid == 0x1166 && did == 0x0200) return "serverworks_osb4";
-    if (vid == 0x1166 && did == 0x0201) return "serverworks_csb5";
-    if (vid == 0x1166 && did == 0x0203) return "serverworks_csb6";
-    if (vid == 0x1166 && did == 0x0205) return "serverworks_ht1000sb";
-    if (vid == 0x1166 && did == 0x0211) return "serverworks_osb4ide";
-    if (vid == 0x1166 && did == 0x0212) return "serverworks_csb5ide";
-    if (vid == 0x1166 && did == 0x0213) return "serverworks_csb6ide";
-    if (vid == 0x1166 && did == 0x0214) return "serverworks_ht1000ide";
-    if (vid == 0x1166 && did == 0x0217) return "serverworks_csb6ide2";
-    if (vid == 0x1166 && did == 0x0227) return "serverworks_csb6lpc";
-    if (vid == 0x1166 && did == 0x0408) return "serverworks_ht1100ld";
-    if (vid == 0x1176 && did == 0x0301) return "sbe_wanxl100";
-    if (vid == 0x1176 && did == 0x0302) return "sbe_wanxl200";
-    if (vid == 0x1176 && did == 0x0104) return "sbe_wanxl400";
-    if (vid == 0x1179 && did == 0x0101) return "toshiba_piccolo_1";
-    if (vid == 0x1179 && did == 0x0102) return "toshiba_piccolo_2";
-    if (vid == 0x1179 && did == 0x0103) return "toshiba_piccolo_3";
-    if (vid == 0x1179 && did == 0x0105) return "toshiba_piccolo_5";
-    if (vid == 0x1179 && did == 0x060a) return "toshiba_topic95";
-    if (vid == 0x1179 && did == 0x060f) return "toshiba_topic97";
-    if (vid == 0x1179 && did == 0x0617) return "toshiba_topic100";
-    if (vid == 0x102f && did == 0x0030) return "toshiba_tc35815cf";
-    if (vid == 0x102f && did == 0x0031) return "toshiba_tc35815_nwu";
-    if (vid == 0x102f && did == 0x0032) return "toshiba_tc35815_tx4939";
-    if (vid == 0x102f && did == 0x0105) return "toshiba_tc86c001_ide";
-    if (vid == 0x102f && did == 0x0108) return "toshiba_tc86c001_misc";
-    if (vid == 0x102f && did == 0x01b3) return "toshiba_spider_net";
-    if (vid == 0x1180 && did == 0x0465) return "ricoh_rl5c465";
-    if (vid == 0x1180 && did == 0x0466) return "ricoh_rl5c466";
-    if (vid == 0x1180 && did == 0x0475) return "ricoh_rl5c475";
-    if (vid == 0x1180 && did == 0x0476) return "ricoh_rl5c476";
-    if (vid == 0x1180 && did == 0x0478) return "ricoh_rl5c478";
-    if (vid == 0x1180 && did == 0x0822) return "ricoh_r5c822";
-    if (vid == 0x1180 && did == 0xe822) return "ricoh_r5ce822";
-    if (vid == 0x1180 && did == 0xe823) return "ricoh_r5ce823";
-    if (vid == 0x1180 && did == 0x0832) return "ricoh_r5c832";
-    if (vid == 0x1180 && did == 0x0843) return "ricoh_r5c843";
-    if (vid == 0x1186 && did == 0x4c00) return "dlink_dge510t";
-    if (vid == 0x1191 && did == 0x0005) return "artop_atp850uf";
-    if (vid == 0x1191 && did == 0x0006) return "artop_atp860";
-    if (vid == 0x1191 && did == 0x0007) return "artop_atp860r";
-    if (vid == 0x1191 && did == 0x0008) return "artop_atp865";
-    if (vid == 0x1191 && did == 0x0009) return "artop_atp865r";
-    if (vid == 0x1191 && did == 0x000A) return "artop_atp867a";
-    if (vid == 0x1191 && did == 0x000B) return "artop_atp867b";
-    if (vid == 0x1191 && did == 0x8002) return "artop_aec7610";
-    if (vid == 0x1191 && did == 0x8010) return "artop_aec7612uw";
-    if (vid == 0x1191 && did == 0x8020) return "artop_aec7612u";
-    if (vid == 0x1191 && did == 0x8030) return "artop_aec7612s";
-    if (vid == 0x1191 && did == 0x8040) return "artop_aec7612d";
-    if (vid == 0x1191 && did == 0x8050) return "artop_aec7612suw";
-    if (vid == 0x1191 && did == 0x8060) return "artop_8060";
-    if (vid == 0x1193 && did == 0x0001) return "zeitnet_1221";
-    if (vid == 0x1193 && did == 0x0002) return "zeitnet_1225";
-    if (vid == 0x119e && did == 0x0001) return "fujitsu_fs155";
-    if (vid == 0x119e && did == 0x0003) return "fujitsu_fs50";
-    if (vid == 0x1b4b && did == 0x4146) return "marvell_gt64111";
-    if (vid == 0x1b4b && did == 0x6430) return "marvell_gt64260";
-    if (vid == 0x1b4b && did == 0x6460) return "marvell_mv64360";
-    if (vid == 0x1b4b && did == 0x6480) return "marvell_mv64460";
-    if (vid == 0x1b4b && did == 0x4100) return "marvell_88alp01_nand";
-    if (vid == 0x1b4b && did == 0x4101) return "marvell_88alp01_sd";
-    if (vid == 0x1b4b && did == 0x4102) return "marvell_88alp01_ccic";
-    if (vid == 0x11b0 && did == 0x0001) return "v3_v960";
-    if (vid == 0x11b0 && did == 0x0002) return "v3_v351";
-    if (vid == 0x11c1 && did == 0x480) return "att_venus_modem";
-    if (vid == 0x11cb && did == 0x2000) return "specialix_io8";
-    if (vid == 0x11cb && did == 0x8000) return "specialix_rio";
-    if (vid == 0x11d4 && did == 0x1234) return "sega_bba";
-    if (vid == 0x11de && did == 0x6057) return "zoran_36057";
-    if (vid == 0x11de && did == 0x6120) return "zoran_36120";
-    if (vid == 0x11f6 && did == 0x0112) return "compex_enet100vg4";
-    if (vid == 0x11fe && did == 0x000E) return "rp2_232";
-    if (vid == 0x11fe && did == 0x000F) return "rp2_422";
-    if (vid == 0x11fe && did == 0x080C) return "upci_rm3_8port";
-    if (vid == 0x11fe && did == 0x080D) return "upci_rm3_4port";
-    if (vid == 0x120e && did == 0x0300) return "pc300_rx_2";
-    if (vid == 0x120e && did == 0x0301) return "pc300_rx_1";
-    if (vid == 0x120e && did == 0x0310) return "pc300_te_2";
-    if (vid == 0x120e && did == 0x0311) return "pc300_te_1";
-    if (vid == 0x120e && did == 0x0320) return "pc300_te_m_2";
-    if (vid == 0x120e && did == 0x0321) return "pc300_te_m_1";
-    if (vid == 0x120f && did == 0x0001) return "essential_roadrunner";
-    if (vid == 0x1217 && did == 0x6729) return "o2_6729";
-    if (vid == 0x1217 && did == 0x673a) return "o2_6730";
-    if (vid == 0x1217 && did == 0x6832) return "o2_6832";
-    if (vid == 0x1217 && did == 0x6836) return "o2_6836";
-    if (vid == 0x1217 && did == 0x6872) return "o2_6812";
-    if (vid == 0x1217 && did == 0x6933) return "o2_6933";
-    if (vid == 0x1217 && did == 0x8120) return "o2_8120";
-    if (vid == 0x1217 && did == 0x8220) return "o2_8220";
-    if (vid == 0x1217 && did == 0x8221) return "o2_8221";
-    if (vid == 0x1217 && did == 0x8320) return "o2_8320";
-    if (vid == 0x1217 && did == 0x8321) return "o2_8321";
-    if (vid == 0x121a && did == 0x0001) return "3dfx_voodoo";
-    if (vid == 0x121a && did == 0x0002) return "3dfx_voodoo2";
-    if (vid == 0x121a && did == 0x0003) return "3dfx_banshee";
-    if (vid == 0x121a && did == 0x0005) return "3dfx_voodoo3";
-    if (vid == 0x121a && did == 0x0009) return "3dfx_voodoo5";
-    if (vid == 0x1244 && did == 0x0700) return "avm_b1";
-    if (vid == 0x1244 && did == 0x0800) return "avm_c4";
-    if (vid == 0x1244 && did == 0x0a00) return "avm_a1";
-    if (vid == 0x1244 && did == 0x0e00) return "avm_a1_v2";
-    if (vid == 0x1244 && did == 0x1100) return "avm_c2";
-    if (vid == 0x1244 && did == 0x1200) return "avm_t1";
-    if (vid == 0x125d && did == 0x1968) return "ess_ess1968";
-    if (vid == 0x125d && did == 0x1978) return "ess_ess1978";
-    if (vid == 0x125d && did == 0x1988) return "ess_allegro_1";
-    if (vid == 0x125d && did == 0x1989) return "ess_allegro";
-    if (vid == 0x125d && did == 0x1990) return "ess_canyon3d_2le";
-    if (vid == 0x125d && did == 0x1992) return "ess_canyon3d_2";
-    if (vid == 0x125d && did == 0x1998) return "ess_maestro3";
-    if (vid == 0x125d && did == 0x1999) return "ess_maestro3_1";
-    if (vid == 0x125d && did == 0x199a) return "ess_maestro3_hw";
-    if (vid == 0x125d && did == 0x199b) return "ess_maestro3_2";
-    if (vid == 0x1267 && did == 0x1016) return "satsagem_niccy";
-    if (vid == 0x1274 && did == 0x5880) return "ensoniq_ct5880";
-    if (vid == 0x1274 && did == 0x5000) return "ensoniq_es1370";
-    if (vid == 0x1274 && did == 0x1371) return "ensoniq_es1371";
-    if (vid == 0x1283 && did == 0x8172) return "ite_8172";
-    if (vid == 0x1283 && did == 0x8211) return "ite_8211";
-    if (vid == 0x1283 && did == 0x8212) return "ite_8212";
-    if (vid == 0x1283 && did == 0x8213) return "ite_8213";
-    if (vid == 0x1283 && did == 0x8152) return "ite_8152";
-    if (vid == 0x1283 && did == 0x8872) return "ite_8872";
-    if (vid == 0x1283 && did == 0xe886) return "ite_it8330g_0";
-    if (vid == 0x1283 && did == 0x0100) return "ess_ess0100";
-    if (vid == 0x12d2 && did == 0x0018) return "nvidia_sgs_riva128";
-    if (vid == 0x12eb && did == 0x0001) return "aureal_vortex_1";
-    if (vid == 0x12eb && did == 0x0002) return "aureal_vortex_2";
-    if (vid == 0x12eb && did == 0x0003) return "aureal_advantage";
-    if (vid == 0x12f8 && did == 0x8a02) return "lml_33r10";
-    if (vid == 0x12fe && did == 0x0111) return "esdgmbh_cpciasio4";
-    if (vid == 0x1332 && did == 0x5415) return "micro_memory_5415cn";
-    if (vid == 0x1332 && did == 0x5425) return "micro_memory_5425cn";
-    if (vid == 0x1332 && did == 0x6155) return "micro_memory_6155";
-    if (vid == 0x134a && did == 0x0001) return "domex_dmx3191d";
-    if (vid == 0x135a && did == 0x0d80) return "intashield_is200";
-    if (vid == 0x135a && did == 0x0dc0) return "intashield_is400";
-    if (vid == 0x135C && did == 0x0010) return "quatech_qsc100";
-    if (vid == 0x135C && did == 0x0020) return "quatech_dsc100";
-    if (vid == 0x135C && did == 0x0030) return "quatech_dsc200";
-    if (vid == 0x135C && did == 0x0040) return "quatech_qsc200";
-    if (vid == 0x135C && did == 0x0050) return "quatech_esc100d";
-    if (vid == 0x135C && did == 0x0060) return "quatech_esc100m";
-    if (vid == 0x135C && did == 0x0120) return "quatech_qscp100";
-    if (vid == 0x135C && did == 0x0130) return "quatech_dscp100";
-    if (vid == 0x135C && did == 0x0140) return "quatech_qscp200";
-    if (vid == 0x135C && did == 0x0150) return "quatech_dscp200";
-    if (vid == 0x135C && did == 0x0170) return "quatech_qsclp100";
-    if (vid == 0x135C && did == 0x0180) return "quatech_dsclp100";
-    if (vid == 0x135C && did == 0x0181) return "quatech_dsc100e";
-    if (vid == 0x135C && did == 0x0190) return "quatech_ssclp100";
-    if (vid == 0x135C && did == 0x01A0) return "quatech_qsclp200";
-    if (vid == 0x135C && did == 0x01B0) return "quatech_dsclp200";
-    if (vid == 0x135C && did == 0x01B1) return "quatech_dsc200e";
-    if (vid == 0x135C && did == 0x01C0) return "quatech_ssclp200";
-    if (vid == 0x135C && did == 0x01E0) return "quatech_esclp100";
-    if (vid == 0x135C && did == 0x0278) return "quatech_sppxp_100";
-    if (vid == 0x135e && did == 0x7101) return "sealevel_u530";
-    if (vid == 0x135e && did == 0x7201) return "sealevel_ucomm2";
-    if (vid == 0x135e && did == 0x7402) return "sealevel_ucomm422";
-    if (vid == 0x135e && did == 0x7202) return "sealevel_ucomm232";
-    if (vid == 0x135e && did == 0x7401) return "sealevel_comm4";
-    if (vid == 0x135e && did == 0x7801) return "sealevel_comm8";
-    if (vid == 0x135e && did == 0x7803) return "sealevel_7803";
-    if (vid == 0x135e && did == 0x7804) return "sealevel_ucomm8";
-    if (vid == 0x1365 && did == 0x9050) return "hypercope_plx";
-    if (vid == 0x136b && did == 0xff01) return "mchip_kl5a72002";
-    if (vid == 0x1371 && did == 0x434e) return "cnet_gigacard";
-    if (vid == 0x1376 && did == 0x0003) return "lmc_hssi";
-    if (vid == 0x1376 && did == 0x0004) return "lmc_ds3";
-    if (vid == 0x1376 && did == 0x0005) return "lmc_ssi";
-    if (vid == 0x1376 && did == 0x0006) return "lmc_t1";
-    if (vid == 0x1385 && did == 0x620a) return "netgear_ga620";
-    if (vid == 0x1389 && did == 0x0001) return "applicom_pcigeneric";
-    if (vid == 0x1389 && did == 0x0002) return "applicom_pci2000ibs_can";
-    if (vid == 0x1389 && did == 0x0003) return "applicom_pci2000pfb";
-    if (vid == 0x1393 && did == 0x0001) return "moxa_rc7000";
-    if (vid == 0x1393 && did == 0x1020) return "moxa_cp102";
-    if (vid == 0x1393 && did == 0x1021) return "moxa_cp102ul";
-    if (vid == 0x1393 && did == 0x1022) return "moxa_cp102u";
-    if (vid == 0x1393 && did == 0x1040) return "moxa_c104";
-    if (vid == 0x1393 && did == 0x1041) return "moxa_cp104u";
-    if (vid == 0x1393 && did == 0x1042) return "moxa_cp104ju";
-    if (vid == 0x1393 && did == 0x1043) return "moxa_cp104el";
-    if (vid == 0x1393 && did == 0x1140) return "moxa_ct114";
-    if (vid == 0x1393 && did == 0x1141) return "moxa_cp114";
-    if (vid == 0x1393 && did == 0x1180) return "moxa_cp118u";
-    if (vid == 0x1393 && did == 0x1181) return "moxa_cp118el";
-    if (vid == 0x1393 && did == 0x1320) return "moxa_cp132";
-    if (vid == 0x1393 && did == 0x1321) return "moxa_cp132u";
-    if (vid == 0x1393 && did == 0x1340) return "moxa_cp134u";
-    if (vid == 0x1393 && did == 0x1680) return "moxa_c168";
-    if (vid == 0x1393 && did == 0x1681) return "moxa_cp168u";
-    if (vid == 0x1393 && did == 0x1682) return "moxa_cp168el";
-    if (vid == 0x1393 && did == 0x2040) return "moxa_cp204j";
-    if (vid == 0x1393 && did == 0x2180) return "moxa_c218";
-    if (vid == 0x1393 && did == 0x3200) return "moxa_c320";
-    if (vid == 0x1397 && did == 0x08B4) return "ccd_hfc4s";
-    if (vid == 0x1397 && did == 0x16B8) return "ccd_hfc8s";
-    if (vid == 0x1397 && did == 0x2bd0) return "ccd_2bd0";
-    if (vid == 0x1397 && did == 0x30B1) return "ccd_hfce1";
-    if (vid == 0x1397 && did == 0xb000) return "ccd_b000";
-    if (vid == 0x1397 && did == 0xb006) return "ccd_b006";
-    if (vid == 0x1397 && did == 0xb007) return "ccd_b007";
-    if (vid == 0x1397 && did == 0xb008) return "ccd_b008";
-    if (vid == 0x1397 && did == 0xb009) return "ccd_b009";
-    if (vid == 0x1397 && did == 0xb00a) return "ccd_b00a";
-    if (vid == 0x1397 && did == 0xb00b) return "ccd_b00b";
-    if (vid == 0x1397 && did == 0xb00c) return "ccd_b00c";
-    if (vid == 0x1397 && did == 0xb100) return "ccd_b100";
-    if (vid == 0x1397 && did == 0xb700) return "ccd_b700";
-    if (vid == 0x1397 && did == 0xb701) return "ccd_b701";
-    if (vid == 0x13a8 && did == 0x0152) return "exar_xr17c152";
-    if (vid == 0x13a8 && did == 0x0154) return "exar_xr17c154";
-    if (vid == 0x13a8 && did == 0x0158) return "exar_xr17c158";
-    if (vid == 0x13a8 && did == 0x0352) return "exar_xr17v352";
-    if (vid == 0x13a8 && did == 0x0354) return "exar_xr17v354";
-    if (vid == 0x13a8 && did == 0x0358) return "exar_xr17v358";
-    if (vid == 0x13c0 && did == 0x0010) return "microgate_usc";
-    if (vid == 0x13c0 && did == 0x0030) return "microgate_sca";
-    if (vid == 0x13C1 && did == 0x1000) return "3ware_1000";
-    if (vid == 0x13C1 && did == 0x1001) return "3ware_7000";
-    if (vid == 0x13C1 && did == 0x1002) return "3ware_9000";
-    if (vid == 0x13ca && did == 0x4231) return "iomega_buz";
-    if (vid == 0x13D1 && did == 0x2BD1) return "abocom_2bd1";
-    if (vid == 0x13f6 && did == 0x0100) return "cmedia_cm8338a";
-    if (vid == 0x13f6 && did == 0x0101) return "cmedia_cm8338b";
-    if (vid == 0x13f6 && did == 0x0111) return "cmedia_cm8738";
-    if (vid == 0x13f6 && did == 0x0112) return "cmedia_cm8738b";
-    if (vid == 0x1407 && did == 0x0100) return "lava_dserial";
-    if (vid == 0x1407 && did == 0x0101) return "lava_quatro_a";
-    if (vid == 0x1407 && did == 0x0102) return "lava_quatro_b";
-    if (vid == 0x1407 && did == 0x0120) return "lava_quattro_a";
-    if (vid == 0x1407 && did == 0x0121) return "lava_quattro_b";
-    if (vid == 0x1407 && did == 0x0180) return "lava_octo_a";
-    if (vid == 0x1407 && did == 0x0181) return "lava_octo_b";
-    if (vid == 0x1407 && did == 0x0200) return "lava_port_plus";
-    if (vid == 0x1407 && did == 0x0201) return "lava_quad_a";
-    if (vid == 0x1407 && did == 0x0202) return "lava_quad_b";
-    if (vid == 0x1407 && did == 0x0500) return "lava_sserial";
-    if (vid == 0x1407 && did == 0x0600) return "lava_port_650";
-    if (vid == 0x1407 && did == 0x8000) return "lava_parallel";
-    if (vid == 0x1407 && did == 0x8002) return "lava_dual_par_a";
-    if (vid == 0x1407 && did == 0x8003) return "lava_dual_par_b";
-    if (vid == 0x1407 && did == 0x8800) return "lava_boca_ioppar";
-    if (vid == 0x1409 && did == 0x7168) return "timedia_1889";
-    if (vid == 0x1412 && did == 0x1712) return "ice_1712";
-    if (vid == 0x1415 && did == 0x8403) return "oxsemi_12pci840";
-    if (vid == 0x1415 && did == 0x9501) return "oxsemi_16pci954";
-    if (vid == 0x1415 && did == 0x950B) return "oxsemi_c950";
-    if (vid == 0x1415 && did == 0x9511) return "oxsemi_16pci95n";
-    if (vid == 0x1415 && did == 0x9513) return "oxsemi_16pci954pp";
-    if (vid == 0x1415 && did == 0x9521) return "oxsemi_16pci952";
-    if (vid == 0x1415 && did == 0x9523) return "oxsemi_16pci952pp";
-    if (vid == 0x14D2 && did == 0x8001) return "titan_010l";
-    if (vid == 0x14D2 && did == 0x8010) return "titan_100l";
-    if (vid == 0x14D2 && did == 0x8011) return "titan_110l";
-    if (vid == 0x14D2 && did == 0x8020) return "titan_200l";
-    if (vid == 0x14D2 && did == 0x8021) return "titan_210l";
-    if (vid == 0x14D2 && did == 0x8040) return "titan_400l";
-    if (vid == 0x14D2 && did == 0x8080) return "titan_800l";
-    if (vid == 0x14D2 && did == 0xA001) return "titan_100";
-    if (vid == 0x14D2 && did == 0xA005) return "titan_200";
-    if (vid == 0x14D2 && did == 0xA003) return "titan_400";
-    if (vid == 0x14D2 && did == 0xA004) return "titan_800b";
-    if (vid == 0x14d4 && did == 0x0400) return "panacom_quadmodem";
-    if (vid == 0x14d4 && did == 0x0402) return "panacom_dualmodem";
-    if (vid == 0x14db && did == 0x2180) return "afavlab_p028";
-    if (vid == 0x14db && did == 0x2182) return "afavlab_p030";
-    if (vid == 0x14e4 && did == 0x1600) return "tigon3_5752";
-    if (vid == 0x14e4 && did == 0x1601) return "tigon3_5752m";
-    if (vid == 0x14e4 && did == 0x1639) return "nx2_5709";
-    if (vid == 0x14e4 && did == 0x163a) return "nx2_5709s";
-    if (vid == 0x14e4 && did == 0x1644) return "tigon3_5700";
-    if (vid == 0x14e4 && did == 0x1645) return "tigon3_5701";
-    if (vid == 0x14e4 && did == 0x1646) return "tigon3_5702";
-    if (vid == 0x14e4 && did == 0x1647) return "tigon3_5703";
-    if (vid == 0x14e4 && did == 0x1648) return "tigon3_5704";
-    if (vid == 0x14e4 && did == 0x1649) return "tigon3_5704s_2";
-    if (vid == 0x14e4 && did == 0x164a) return "nx2_5706";
-    if (vid == 0x14e4 && did == 0x164c) return "nx2_5708";
-    if (vid == 0x14e4 && did == 0x164d) return "tigon3_5702fe";
-    if (vid == 0x14e4 && did == 0x164e) return "nx2_57710";
-    if (vid == 0x14e4 && did == 0x164f) return "nx2_57711";
-    if (vid == 0x14e4 && did == 0x1650) return "nx2_57711e";
-    if (vid == 0x14e4 && did == 0x1653) return "tigon3_5705";
-    if (vid == 0x14e4 && did == 0x1654) return "tigon3_5705_2";
-    if (vid == 0x14e4 && did == 0x1657) return "tigon3_5719";
-    if (vid == 0x14e4 && did == 0x1659) return "tigon3_5721";
-    if (vid == 0x14e4 && did == 0x165a) return "tigon3_5722";
-    if (vid == 0x14e4 && did == 0x165b) return "tigon3_5723";
-    if (vid == 0x14e4 && did == 0x165d) return "tigon3_5705m";
-    if (vid == 0x14e4 && did == 0x165e) return "tigon3_5705m_2";
-    if (vid == 0x14e4 && did == 0x1662) return "nx2_57712";
-    if (vid == 0x14e4 && did == 0x1663) return "nx2_57712e";
-    if (vid == 0x14e4 && did == 0x1663) return "nx2_57712_mf";
-    if (vid == 0x14e4 && did == 0x1668) return "tigon3_5714";
-    if (vid == 0x14e4 && did == 0x1669) return "tigon3_5714s";
-    if (vid == 0x14e4 && did == 0x166a) return "tigon3_5780";
-    if (vid == 0x14e4 && did == 0x166b) return "tigon3_5780s";
-    if (vid == 0x14e4 && did == 0x166e) return "tigon3_5705f";
-    if (vid == 0x14e4 && did == 0x166f) return "nx2_57712_vf";
-    if (vid == 0x14e4 && did == 0x1672) return "tigon3_5754m";
-    if (vid == 0x14e4 && did == 0x1673) return "tigon3_5755m";
-    if (vid == 0x14e4 && did == 0x1674) return "tigon3_5756";
-    if (vid == 0x14e4 && did == 0x1676) return "tigon3_5750";
-    if (vid == 0x14e4 && did == 0x1677) return "tigon3_5751";
-    if (vid == 0x14e4 && did == 0x1678) return "tigon3_5715";
-    if (vid == 0x14e4 && did == 0x1679) return "tigon3_5715s";
-    if (vid == 0x14e4 && did == 0x167a) return "tigon3_5754";
-    if (vid == 0x14e4 && did == 0x167b) return "tigon3_5755";
-    if (vid == 0x14e4 && did == 0x167d) return "tigon3_5751m";
-    if (vid == 0x14e4 && did == 0x167e) return "tigon3_5751f";
-    if (vid == 0x14e4 && did == 0x167f) return "tigon3_5787f";
-    if (vid == 0x14e4 && did == 0x1680) return "tigon3_5761e";
-    if (vid == 0x14e4 && did == 0x1681) return "tigon3_5761";
-    if (vid == 0x14e4 && did == 0x1684) return "tigon3_5764";
-    if (vid == 0x14e4 && did == 0x168a) return "nx2_57800";
-    if (vid == 0x14e4 && did == 0x168d) return "nx2_57840";
-    if (vid == 0x14e4 && did == 0x168e) return "nx2_57810";
-    if (vid == 0x14e4 && did == 0x1693) return "tigon3_5787m";
-    if (vid == 0x14e4 && did == 0x1696) return "tigon3_5782";
-    if (vid == 0x14e4 && did == 0x1698) return "tigon3_5784";
-    if (vid == 0x14e4 && did == 0x169a) return "tigon3_5786";
-    if (vid == 0x14e4 && did == 0x169b) return "tigon3_5787";
-    if (vid == 0x14e4 && did == 0x169c) return "tigon3_5788";
-    if (vid == 0x14e4 && did == 0x169d) return "tigon3_5789";
-    if (vid == 0x14e4 && did == 0x16a1) return "nx2_57840_4_10";
-    if (vid == 0x14e4 && did == 0x16a2) return "nx2_57840_2_20";
-    if (vid == 0x14e4 && did == 0x16a4) return "nx2_57840_mf";
-    if (vid == 0x14e4 && did == 0x16a5) return "nx2_57800_mf";
-    if (vid == 0x14e4 && did == 0x16a6) return "tigon3_5702x";
-    if (vid == 0x14e4 && did == 0x16a7) return "tigon3_5703x";
-    if (vid == 0x14e4 && did == 0x16a8) return "tigon3_5704s";
-    if (vid == 0x14e4 && did == 0x16a9) return "nx2_57800_vf";
-    if (vid == 0x14e4 && did == 0x16aa) return "nx2_5706s";
-    if (vid == 0x14e4 && did == 0x16ac) return "nx2_5708s";
-    if (vid == 0x14e4 && did == 0x16ad) return "nx2_57840_vf";
-    if (vid == 0x14e4 && did == 0x16ae) return "nx2_57810_mf";
-    if (vid == 0x14e4 && did == 0x16af) return "nx2_57810_vf";
-    if (vid == 0x14e4 && did == 0x16c6) return "tigon3_5702a3";
-    if (vid == 0x14e4 && did == 0x16c7) return "tigon3_5703a3";
-    if (vid == 0x14e4 && did == 0x16dd) return "tigon3_5781";
-    if (vid == 0x14e4 && did == 0x16f7) return "tigon3_5753";
-    if (vid == 0x14e4 && did == 0x16fd) return "tigon3_5753m";
-    if (vid == 0x14e4 && did == 0x16fe) return "tigon3_5753f";
-    if (vid == 0x14e4 && did == 0x170d) return "tigon3_5901";
-    if (vid == 0x14e4 && did == 0x170e) return "tigon3_5901_2";
-    if (vid == 0x14e4 && did == 0x1712) return "tigon3_5906";
-    if (vid == 0x14e4 && did == 0x1713) return "tigon3_5906m";
-    if (vid == 0x151f && did == 0x0000) return "topic_tp560";
-    if (vid == 0x1522 && did == 0x0100) return "mainpine_pbridge";
-    if (vid == 0x1524 && did == 0x0510) return "ene_cb710_flash";
-    if (vid == 0x1524 && did == 0x0550) return "ene_cb712_sd";
-    if (vid == 0x1524 && did == 0x0551) return "ene_cb712_sd_2";
-    if (vid == 0x1524 && did == 0x0750) return "ene_cb714_sd";
-    if (vid == 0x1524 && did == 0x0751) return "ene_cb714_sd_2";
-    if (vid == 0x1524 && did == 0x1211) return "ene_1211";
-    if (vid == 0x1524 && did == 0x1225) return "ene_1225";
-    if (vid == 0x1524 && did == 0x1410) return "ene_1410";
-    if (vid == 0x1524 && did == 0x1411) return "ene_710";
-    if (vid == 0x1524 && did == 0x1412) return "ene_712";
-    if (vid == 0x1524 && did == 0x1420) return "ene_1420";
-    if (vid == 0x1524 && did == 0x1421) return "ene_720";
-    if (vid == 0x1524 && did == 0x1422) return "ene_722";
-    if (vid == 0x1592 && did == 0x0782) return "syba_2p_epp";
-    if (vid == 0x1592 && did == 0x0783) return "syba_1p_ecp";
-    if (vid == 0x15aa && did == 0x2000) return "rastel_2port";
-    if (vid == 0x15b0 && did == 0x2bd0) return "zoltrix_2bd0";
-    if (vid == 0x15b3 && did == 0x5a44) return "mellanox_tavor";
-    if (vid == 0x15b3 && did == 0x5a46) return "mellanox_tavor_bridge";
-    if (vid == 0x15b3 && did == 0x6278) return "mellanox_arbel_compat";
-    if (vid == 0x15b3 && did == 0x6282) return "mellanox_arbel";
-    if (vid == 0x15b3 && did == 0x5e8c) return "mellanox_sinai_old";
-    if (vid == 0x15b3 && did == 0x6274) return "mellanox_sinai";
-    if (vid == 0x15e2 && did == 0x0500) return "quicknet_xj";
-    if (vid == 0x15B8 && did == 0x7000) return "addidata_apci7500";
-    if (vid == 0x15B8 && did == 0x7001) return "addidata_apci7420";
-    if (vid == 0x15B8 && did == 0x7002) return "addidata_apci7300";
-    if (vid == 0x15B8 && did == 0x818E) return "addidata_apci7800";
-    if (vid == 0x15B8 && did == 0x7009) return "addidata_apci7500_2";
-    if (vid == 0x15B8 && did == 0x700A) return "addidata_apci7420_2";
-    if (vid == 0x15B8 && did == 0x700B) return "addidata_apci7300_2";
-    if (vid == 0x15B8 && did == 0x700C) return "addidata_apci7500_3";
-    if (vid == 0x15B8 && did == 0x700D) return "addidata_apci7420_3";
-    if (vid == 0x15B8 && did == 0x700E) return "addidata_apci7300_3";
-    if (vid == 0x15B8 && did == 0x700F) return "addidata_apci7800_3";
-    if (vid == 0x1619 && did == 0x0400) return "farsite_t2p";
-    if (vid == 0x1619 && did == 0x0440) return "farsite_t4p";
-    if (vid == 0x1619 && did == 0x0610) return "farsite_t1u";
-    if (vid == 0x1619 && did == 0x0620) return "farsite_t2u";
-    if (vid == 0x1619 && did == 0x0640) return "farsite_t4u";
-    if (vid == 0x1619 && did == 0x1610) return "farsite_te1";
-    if (vid == 0x1619 && did == 0x1612) return "farsite_te1c";
-    if (vid == 0x1657 && did == 0x0014) return "brocade_ct";
-    if (vid == 0x1657 && did == 0x0017) return "brocade_fc_8g1p";
-    if (vid == 0x1657 && did == 0x0021) return "brocade_ct_fc";
-    if (vid == 0x166d && did == 0x0001) return "bcm1250_pci";
-    if (vid == 0x166d && did == 0x0002) return "bcm1250_ht";
-    if (vid == 0x16CA && did == 0x0001) return "cenatek_ide";
-    if (vid == 0x1725 && did == 0x7174) return "vitesse_vsc7174";
-    if (vid == 0x1737 && did == 0x1064) return "linksys_eg1064";
-    if (vid == 0x173b && did == 0x03e8) return "altima_ac1000";
-    if (vid == 0x173b && did == 0x03e9) return "altima_ac1001";
-    if (vid == 0x173b && did == 0x03ea) return "altima_ac9100";
-    if (vid == 0x173b && did == 0x03eb) return "altima_ac1003";
-    if (vid == 0x1799 && did == 0x701f) return "belkin_f5d7010v7";
-    if (vid == 0x17f3 && did == 0x6020) return "rdc_r6020";
-    if (vid == 0x17f3 && did == 0x6030) return "rdc_r6030";
-    if (vid == 0x17f3 && did == 0x6040) return "rdc_r6040";
-    if (vid == 0x17f3 && did == 0x6060) return "rdc_r6060";
-    if (vid == 0x17f3 && did == 0x6061) return "rdc_r6061";
-    if (vid == 0x17f3 && did == 0x1010) return "rdc_d1010";
-    if (vid == 0x17d3 && did == 0x1110) return "areca_1110";
-    if (vid == 0x17d3 && did == 0x1120) return "areca_1120";
-    if (vid == 0x17d3 && did == 0x1130) return "areca_1130";
-    if (vid == 0x17d3 && did == 0x1160) return "areca_1160";
-    if (vid == 0x17d3 && did == 0x1170) return "areca_1170";
-    if (vid == 0x17d3 && did == 0x1200) return "areca_1200";
-    if (vid == 0x17d3 && did == 0x1201) return "areca_1201";
-    if (vid == 0x17d3 && did == 0x1202) return "areca_1202";
-    if (vid == 0x17d3 && did == 0x1210) return "areca_1210";
-    if (vid == 0x17d3 && did == 0x1220) return "areca_1220";
-    if (vid == 0x17d3 && did == 0x1230) return "areca_1230";
-    if (vid == 0x17d3 && did == 0x1260) return "areca_1260";
-    if (vid == 0x17d3 && did == 0x1270) return "areca_1270";
-    if (vid == 0x17d3 && did == 0x1280) return "areca_1280";
-    if (vid == 0x17d3 && did == 0x1380) return "areca_1380";
-    if (vid == 0x17d3 && did == 0x1381) return "areca_1381";
-    if (vid == 0x17d3 && did == 0x1680) return "areca_1680";
-    if (vid == 0x17d3 && did == 0x1681) return "areca_1681";
-    if (vid == 0x17d5 && did == 0x5731) return "s2io_win";
-    if (vid == 0x17d5 && did == 0x5831) return "s2io_uni";
-    if (vid == 0x17d5 && did == 0x5732) return "herc_win";
-    if (vid == 0x17d5 && did == 0x5832) return "herc_uni";
-    if (vid == 0x182d && did == 0x3069) return "sitecom_dc105v2";
-    if (vid == 0x1912 && did == 0x0001) return "renesas_sh7781";
-    if (vid == 0x1912 && did == 0x0002) return "renesas_sh7780";
-    if (vid == 0x1912 && did == 0x0004) return "renesas_sh7763";
-    if (vid == 0x1912 && did == 0x0007) return "renesas_sh7785";
-    if (vid == 0x1912 && did == 0x0010) return "renesas_sh7786";
-    if (vid == 0x1924 && did == 0x0703) return "solarflare_sfc4000a_0";
-    if (vid == 0x1924 && did == 0x6703) return "solarflare_sfc4000a_1";
-    if (vid == 0x1924 && did == 0x0710) return "solarflare_sfc4000b";
-    if (vid == 0x192E && did == 0x0101) return "tdi_ehci";
-    if (vid == 0x1969 && did == 0x1048) return "attansic_l1";
-    if (vid == 0x1969 && did == 0x2048) return "attansic_l2";
-    if (vid == 0x197B && did == 0x2360) return "jmicron_jmb360";
-    if (vid == 0x197B && did == 0x2361) return "jmicron_jmb361";
-    if (vid == 0x197B && did == 0x2362) return "jmicron_jmb362";
-    if (vid == 0x197B && did == 0x2363) return "jmicron_jmb363";
-    if (vid == 0x197B && did == 0x2364) return "jmicron_jmb364";
-    if (vid == 0x197B && did == 0x2365) return "jmicron_jmb365";
-    if (vid == 0x197B && did == 0x2366) return "jmicron_jmb366";
-    if (vid == 0x197B && did == 0x2368) return "jmicron_jmb368";
-    if (vid == 0x197B && did == 0x2369) return "jmicron_jmb369";
-    if (vid == 0x197B && did == 0x2381) return "jmicron_jmb38x_sd";
-    if (vid == 0x197B && did == 0x2382) return "jmicron_jmb38x_mmc";
-    if (vid == 0x197B && did == 0x2383) return "jmicron_jmb38x_ms";
-    if (vid == 0x197B && did == 0x2388) return "jmicron_jmb385_ms";
-    if (vid == 0x197B && did == 0x2391) return "jmicron_jmb388_sd";
-    if (vid == 0x197B && did == 0x2392) return "jmicron_jmb388_esd";
-    if (vid == 0x197B && did == 0x2393) return "jmicron_jmb390_ms";
-    if (vid == 0x1982 && did == 0x1600) return "korenix_jetcardf0";
-    if (vid == 0x1982 && did == 0x16ff) return "korenix_jetcardf1";
-    if (vid == 0x1982 && did == 0x1700) return "korenix_jetcardf2";
-    if (vid == 0x1982 && did == 0x17ff) return "korenix_jetcardf3";
-    if (vid == 0x1de1 && did == 0xdc29) return "tekram_dc290";
-    if (vid == 0x1fc9 && did == 0x3009) return "tehuti_3009";
-    if (vid == 0x1fc9 && did == 0x3010) return "tehuti_3010";
-    if (vid == 0x1fc9 && did == 0x3014) return "tehuti_3014";
-    if (vid == 0x3388 && did == 0x8013) return "hint_vxproii_ide";
-    if (vid == 0x3d3d && did == 0x0007) return "3dlabs_permedia2";
-    if (vid == 0x3d3d && did == 0x0009) return "3dlabs_permedia2v";
-    if (vid == 0x4040 && did == 0x0001) return "nx2031_10gxsr";
-    if (vid == 0x4040 && did == 0x0002) return "nx2031_10gcx4";
-    if (vid == 0x4040 && did == 0x0003) return "nx2031_4gcu";
-    if (vid == 0x4040 && did == 0x0004) return "nx2031_imez";
-    if (vid == 0x4040 && did == 0x0005) return "nx2031_hmez";
-    if (vid == 0x4040 && did == 0x0024) return "nx2031_xg_mgmt";
-    if (vid == 0x4040 && did == 0x0025) return "nx2031_xg_mgmt2";
-    if (vid == 0x416c && did == 0x0100) return "aks_aladdincard";
-    if (vid == 0x494f && did == 0x22c0) return "accessio_wdg_csm";
-    if (vid == 0x5333 && did == 0x8811) return "s3_trio";
-    if (vid == 0x5333 && did == 0x8880) return "s3_868";
-    if (vid == 0x5333 && did == 0x88f0) return "s3_968";
-    if (vid == 0x5333 && did == 0x8a25) return "s3_savage4";
-    if (vid == 0x5333 && did == 0x8d04) return "s3_prosavage8";
-    if (vid == 0x5333 && did == 0xca00) return "s3_sonicvibes";
-    if (vid == 0x5544 && did == 0x0001) return "dunord_i3000";
-    if (vid == 0x6666 && did == 0x0001) return "dci_pccom4";
-    if (vid == 0x6666 && did == 0x0002) return "dci_pccom8";
-    if (vid == 0x6666 && did == 0x0004) return "dci_pccom2";
-    if (vid == 0x8086 && did == 0x0008) return "intel_eessc";
-    if (vid == 0x8086 && did == 0x0320) return "intel_pxhd_0";
-    if (vid == 0x8086 && did == 0x0321) return "intel_pxhd_1";
-    if (vid == 0x8086 && did == 0x0329) return "intel_pxh_0";
-    if (vid == 0x8086 && did == 0x032A) return "intel_pxh_1";
-    if (vid == 0x8086 && did == 0x032C) return "intel_pxhv";
-    if (vid == 0x8086 && did == 0x0330) return "intel_80332_0";
-    if (vid == 0x8086 && did == 0x0332) return "intel_80332_1";
-    if (vid == 0x8086 && did == 0x0370) return "intel_80333_0";
-    if (vid == 0x8086 && did == 0x0372) return "intel_80333_1";
-    if (vid == 0x8086 && did == 0x0482) return "intel_82375";
-    if (vid == 0x8086 && did == 0x0483) return "intel_82424";
-    if (vid == 0x8086 && did == 0x0484) return "intel_82378";
-    if (vid == 0x8086 && did == 0x0807) return "intel_mrst_sd0";
-    if (vid == 0x8086 && did == 0x0808) return "intel_mrst_sd1";
-    if (vid == 0x8086 && did == 0x0820) return "intel_mfd_sd";
-    if (vid == 0x8086 && did == 0x0821) return "intel_mfd_sdio1";
-    if (vid == 0x8086 && did == 0x0822) return "intel_mfd_sdio2";
-    if (vid == 0x8086 && did == 0x0823) return "intel_mfd_emmc0";
-    if (vid == 0x8086 && did == 0x0824) return "intel_mfd_emmc1";
-    if (vid == 0x8086 && did == 0x084F) return "intel_mrst_sd2";
-    if (vid == 0x8086 && did == 0x0960) return "intel_i960";
-    if (vid == 0x8086 && did == 0x0962) return "intel_i960rm";
-    if (vid == 0x8086 && did == 0x0c60) return "intel_centerton_ilb";
-    if (vid == 0x8086 && did == 0x1062) return "intel_8257x_sol";
-    if (vid == 0x8086 && did == 0x1085) return "intel_82573e_sol";
-    if (vid == 0x8086 && did == 0x108F) return "intel_82573l_sol";
-    if (vid == 0x8086 && did == 0x1130) return "intel_82815_mc";
-    if (vid == 0x8086 && did == 0x1132) return "intel_82815_cgc";
-    if (vid == 0x8086 && did == 0x1221) return "intel_82092aa_0";
-    if (vid == 0x8086 && did == 0x2550) return "intel_7505_0";
-    if (vid == 0x8086 && did == 0x255d) return "intel_7205_0";
-    if (vid == 0x8086 && did == 0x122d) return "intel_82437";
-    if (vid == 0x8086 && did == 0x122e) return "intel_82371fb_0";
-    if (vid == 0x8086 && did == 0x1230) return "intel_82371fb_1";
-    if (vid == 0x8086 && did == 0x1234) return "intel_82371mx";
-    if (vid == 0x8086 && did == 0x1237) return "intel_82441";
-    if (vid == 0x8086 && did == 0x124b) return "intel_82380fb";
-    if (vid == 0x8086 && did == 0x1250) return "intel_82439";
-    if (vid == 0x8086 && did == 0x1960) return "intel_80960_rp";
-    if (vid == 0x8086 && did == 0x1a21) return "intel_82840_hb";
-    if (vid == 0x8086 && did == 0x1a30) return "intel_82845_hb";
-    if (vid == 0x8086 && did == 0x1a38) return "intel_ioat";
-    if (vid == 0x8086 && did == 0x1c41) return "intel_cougarpoint_lpc_min";
-    if (vid == 0x8086 && did == 0x1c5f) return "intel_cougarpoint_lpc_max";
-    if (vid == 0x8086 && did == 0x1d40) return "intel_patsburg_lpc_0";
-    if (vid == 0x8086 && did == 0x1d41) return "intel_patsburg_lpc_1";
-    if (vid == 0x8086 && did == 0x1e31) return "intel_pantherpoint_xhci";
-    if (vid == 0x8086 && did == 0x1e40) return "intel_pantherpoint_lpc_min";
-    if (vid == 0x8086 && did == 0x1e5f) return "intel_pantherpoint_lpc_max";
-    if (vid == 0x8086 && did == 0x2310) return "intel_dh89xxcc_lpc_min";
-    if (vid == 0x8086 && did == 0x231f) return "intel_dh89xxcc_lpc_max";
-    if (vid == 0x8086 && did == 0x2410) return "intel_82801aa_0";
-    if (vid == 0x8086 && did == 0x2411) return "intel_82801aa_1";
-    if (vid == 0x8086 && did == 0x2413) return "intel_82801aa_3";
-    if (vid == 0x8086 && did == 0x2415) return "intel_82801aa_5";
-    if (vid == 0x8086 && did == 0x2416) return "intel_82801aa_6";
-    if (vid == 0x8086 && did == 0x2418) return "intel_82801aa_8";
-    if (vid == 0x8086 && did == 0x2420) return "intel_82801ab_0";
-    if (vid == 0x8086 && did == 0x2421) return "intel_82801ab_1";
-    if (vid == 0x8086 && did == 0x2423) return "intel_82801ab_3";
-    if (vid == 0x8086 && did == 0x2425) return "intel_82801ab_5";
-    if (vid == 0x8086 && did == 0x2426) return "intel_82801ab_6";
-    if (vid == 0x8086 && did == 0x2428) return "intel_82801ab_8";
-    if (vid == 0x8086 && did == 0x2440) return "intel_82801ba_0";
-    if (vid == 0x8086 && did == 0x2443) return "intel_82801ba_2";
-    if (vid == 0x8086 && did == 0x2445) return "intel_82801ba_4";
-    if (vid == 0x8086 && did == 0x2448) return "intel_82801ba_6";
-    if (vid == 0x8086 && did == 0x244a) return "intel_82801ba_8";
-    if (vid == 0x8086 && did == 0x244b) return "intel_82801ba_9";
-    if (vid == 0x8086 && did == 0x244c) return "intel_82801ba_10";
-    if (vid == 0x8086 && did == 0x244e) return "intel_82801ba_11";
-    if (vid == 0x8086 && did == 0x2450) return "intel_82801e_0";
-    if (vid == 0x8086 && did == 0x245b) return "intel_82801e_11";
-    if (vid == 0x8086 && did == 0x2480) return "intel_82801ca_0";
-    if (vid == 0x8086 && did == 0x2483) return "intel_82801ca_3";
-    if (vid == 0x8086 && did == 0x2485) return "intel_82801ca_5";
-    if (vid == 0x8086 && did == 0x2486) return "intel_82801ca_6";
-    if (vid == 0x8086 && did == 0x248a) return "intel_82801ca_10";
-    if (vid == 0x8086 && did == 0x248b) return "intel_82801ca_11";
-    if (vid == 0x8086 && did == 0x248c) return "intel_82801ca_12";
-    if (vid == 0x8086 && did == 0x24c0) return "intel_82801db_0";
-    if (vid == 0x8086 && did == 0x24c1) return "intel_82801db_1";
-    if (vid == 0x8086 && did == 0x24c2) return "intel_82801db_2";
-    if (vid == 0x8086 && did == 0x24c3) return "intel_82801db_3";
-    if (vid == 0x8086 && did == 0x24c5) return "intel_82801db_5";
-    if (vid == 0x8086 && did == 0x24c6) return "intel_82801db_6";
-    if (vid == 0x8086 && did == 0x24c9) return "intel_82801db_9";
-    if (vid == 0x8086 && did == 0x24ca) return "intel_82801db_10";
-    if (vid == 0x8086 && did == 0x24cb) return "intel_82801db_11";
-    if (vid == 0x8086 && did == 0x24cc) return "intel_82801db_12";
-    if (vid == 0x8086 && did == 0x24d0) return "intel_82801eb_0";
-    if (vid == 0x8086 && did == 0x24d1) return "intel_82801eb_1";
-    if (vid == 0x8086 && did == 0x24d3) return "intel_82801eb_3";
-    if (vid == 0x8086 && did == 0x24d5) return "intel_82801eb_5";
-    if (vid == 0x8086 && did == 0x24d6) return "intel_82801eb_6";
-    if (vid == 0x8086 && did == 0x24db) return "intel_82801eb_11";
-    if (vid == 0x8086 && did == 0x24dc) return "intel_82801eb_12";
-    if (vid == 0x8086 && did == 0x24dd) return "intel_82801eb_13";
-    if (vid == 0x8086 && did == 0x25a1) return "intel_esb_1";
-    if (vid == 0x8086 && did == 0x25a2) return "intel_esb_2";
-    if (vid == 0x8086 && did == 0x25a4) return "intel_esb_4";
-    if (vid == 0x8086 && did == 0x25a6) return "intel_esb_5";
-    if (vid == 0x8086 && did == 0x25ab) return "intel_esb_9";
-    if (vid == 0x8086 && did == 0x25ac) return "intel_esb_10";
-    if (vid == 0x8086 && did == 0x2500) return "intel_82820_hb";
-    if (vid == 0x8086 && did == 0x2501) return "intel_82820_up_hb";
-    if (vid == 0x8086 && did == 0x2530) return "intel_82850_hb";
-    if (vid == 0x8086 && did == 0x2531) return "intel_82860_hb";
-    if (vid == 0x8086 && did == 0x254c) return "intel_e7501_mch";
-    if (vid == 0x8086 && did == 0x2560) return "intel_82845g_hb";
-    if (vid == 0x8086 && did == 0x2562) return "intel_82845g_ig";
-    if (vid == 0x8086 && did == 0x2570) return "intel_82865_hb";
-    if (vid == 0x8086 && did == 0x2572) return "intel_82865_ig";
-    if (vid == 0x8086 && did == 0x2578) return "intel_82875_hb";
-    if (vid == 0x8086 && did == 0x2580) return "intel_82915g_hb";
-    if (vid == 0x8086 && did == 0x2582) return "intel_82915g_ig";
-    if (vid == 0x8086 && did == 0x2590) return "intel_82915gm_hb";
-    if (vid == 0x8086 && did == 0x2592) return "intel_82915gm_ig";
-    if (vid == 0x8086 && did == 0x25F0) return "intel_5000_err";
-    if (vid == 0x8086 && did == 0x25F5) return "intel_5000_fbd0";
-    if (vid == 0x8086 && did == 0x25F6) return "intel_5000_fbd1";
-    if (vid == 0x8086 && did == 0x2770) return "intel_82945g_hb";
-    if (vid == 0x8086 && did == 0x2772) return "intel_82945g_ig";
-    if (vid == 0x8086 && did == 0x2778) return "intel_3000_hb";
-    if (vid == 0x8086 && did == 0x27A0) return "intel_82945gm_hb";
-    if (vid == 0x8086 && did == 0x27A2) return "intel_82945gm_ig";
-    if (vid == 0x8086 && did == 0x2640) return "intel_ich6_0";
-    if (vid == 0x8086 && did == 0x2641) return "intel_ich6_1";
-    if (vid == 0x8086 && did == 0x2642) return "intel_ich6_2";
-    if (vid == 0x8086 && did == 0x266a) return "intel_ich6_16";
-    if (vid == 0x8086 && did == 0x266d) return "intel_ich6_17";
-    if (vid == 0x8086 && did == 0x266e) return "intel_ich6_18";
-    if (vid == 0x8086 && did == 0x266f) return "intel_ich6_19";
-    if (vid == 0x8086 && did == 0x2670) return "intel_esb2_0";
-    if (vid == 0x8086 && did == 0x2698) return "intel_esb2_14";
-    if (vid == 0x8086 && did == 0x269b) return "intel_esb2_17";
-    if (vid == 0x8086 && did == 0x269e) return "intel_esb2_18";
-    if (vid == 0x8086 && did == 0x27b8) return "intel_ich7_0";
-    if (vid == 0x8086 && did == 0x27b9) return "intel_ich7_1";
-    if (vid == 0x8086 && did == 0x27b0) return "intel_ich7_30";
-    if (vid == 0x8086 && did == 0x27bc) return "intel_tgp_lpc";
-    if (vid == 0x8086 && did == 0x27bd) return "intel_ich7_31";
-    if (vid == 0x8086 && did == 0x27da) return "intel_ich7_17";
-    if (vid == 0x8086 && did == 0x27dd) return "intel_ich7_19";
-    if (vid == 0x8086 && did == 0x27de) return "intel_ich7_20";
-    if (vid == 0x8086 && did == 0x27df) return "intel_ich7_21";
-    if (vid == 0x8086 && did == 0x2810) return "intel_ich8_0";
-    if (vid == 0x8086 && did == 0x2811) return "intel_ich8_1";
-    if (vid == 0x8086 && did == 0x2812) return "intel_ich8_2";
-    if (vid == 0x8086 && did == 0x2814) return "intel_ich8_3";
-    if (vid == 0x8086 && did == 0x2815) return "intel_ich8_4";
-    if (vid == 0x8086 && did == 0x283e) return "intel_ich8_5";
-    if (vid == 0x8086 && did == 0x2850) return "intel_ich8_6";
-    if (vid == 0x8086 && did == 0x2910) return "intel_ich9_0";
-    if (vid == 0x8086 && did == 0x2917) return "intel_ich9_1";
-    if (vid == 0x8086 && did == 0x2912) return "intel_ich9_2";
-    if (vid == 0x8086 && did == 0x2913) return "intel_ich9_3";
-    if (vid == 0x8086 && did == 0x2914) return "intel_ich9_4";
-    if (vid == 0x8086 && did == 0x2919) return "intel_ich9_5";
-    if (vid == 0x8086 && did == 0x2930) return "intel_ich9_6";
-    if (vid == 0x8086 && did == 0x2916) return "intel_ich9_7";
-    if (vid == 0x8086 && did == 0x2918) return "intel_ich9_8";
-    if (vid == 0x8086 && did == 0x2c18) return "intel_i7_mcr";
-    if (vid == 0x8086 && did == 0x2c19) return "intel_i7_mc_tad";
-    if (vid == 0x8086 && did == 0x2c1a) return "intel_i7_mc_ras";
-    if (vid == 0x8086 && did == 0x2c1c) return "intel_i7_mc_test";
-    if (vid == 0x8086 && did == 0x2c20) return "intel_i7_mc_ch0_ctrl";
-    if (vid == 0x8086 && did == 0x2c21) return "intel_i7_mc_ch0_addr";
-    if (vid == 0x8086 && did == 0x2c22) return "intel_i7_mc_ch0_rank";
-    if (vid == 0x8086 && did == 0x2c23) return "intel_i7_mc_ch0_tc";
-    if (vid == 0x8086 && did == 0x2c28) return "intel_i7_mc_ch1_ctrl";
-    if (vid == 0x8086 && did == 0x2c29) return "intel_i7_mc_ch1_addr";
-    if (vid == 0x8086 && did == 0x2c2a) return "intel_i7_mc_ch1_rank";
-    if (vid == 0x8086 && did == 0x2c2b) return "intel_i7_mc_ch1_tc";
-    if (vid == 0x8086 && did == 0x2c30) return "intel_i7_mc_ch2_ctrl";
-    if (vid == 0x8086 && did == 0x2c31) return "intel_i7_mc_ch2_addr";
-    if (vid == 0x8086 && did == 0x2c32) return "intel_i7_mc_ch2_rank";
-    if (vid == 0x8086 && did == 0x2c33) return "intel_i7_mc_ch2_tc";
-    if (vid == 0x8086 && did == 0x2c41) return "intel_i7_noncore";
-    if (vid == 0x8086 && did == 0x2c40) return "intel_i7_noncore_alt";
-    if (vid == 0x8086 && did == 0x2c50) return "intel_lynnfield_noncore";
-    if (vid == 0x8086 && did == 0x2c51) return "intel_lynnfield_noncore_alt";
-    if (vid == 0x8086 && did == 0x2c70) return "intel_lynnfield_noncore_rev2";
-    if (vid == 0x8086 && did == 0x2c81) return "intel_lynnfield_sad";
-    if (vid == 0x8086 && did == 0x2c90) return "intel_lynnfield_qpi_link0";
-    if (vid == 0x8086 && did == 0x2c91) return "intel_lynnfield_qpi_phy0";
-    if (vid == 0x8086 && did == 0x2c98) return "intel_lynnfield_mcr";
-    if (vid == 0x8086 && did == 0x2c99) return "intel_lynnfield_mc_tad";
-    if (vid == 0x8086 && did == 0x2c9C) return "intel_lynnfield_mc_test";
-    if (vid == 0x8086 && did == 0x2ca0) return "intel_lynnfield_mc_ch0_ctrl";
-    if (vid == 0x8086 && did == 0x2ca1) return "intel_lynnfield_mc_ch0_addr";
-    if (vid == 0x8086 && did == 0x2ca2) return "intel_lynnfield_mc_ch0_rank";
-    if (vid == 0x8086 && did == 0x2ca3) return "intel_lynnfield_mc_ch0_tc";
-    if (vid == 0x8086 && did == 0x2ca8) return "intel_lynnfield_mc_ch1_ctrl";
-    if (vid == 0x8086 && did == 0x2ca9) return "intel_lynnfield_mc_ch1_addr";
-    if (vid == 0x8086 && did == 0x2caa) return "intel_lynnfield_mc_ch1_rank";
-    if (vid == 0x8086 && did == 0x2cab) return "intel_lynnfield_mc_ch1_tc";
-    if (vid == 0x8086 && did == 0x2d98) return "intel_lynnfield_mcr_rev2";
-    if (vid == 0x8086 && did == 0x2d99) return "intel_lynnfield_mc_tad_rev2";
-    if (vid == 0x8086 && did == 0x2d9a) return "intel_lynnfield_mc_ras_rev2";
-    if (vid == 0x8086 && did == 0x2d9c) return "intel_lynnfield_mc_test_rev2";
-    if (vid == 0x8086 && did == 0x2da0) return "intel_lynnfield_mc_ch0_ctrl_rev2";
-    if (vid == 0x8086 && did == 0x2da1) return "intel_lynnfield_mc_ch0_addr_rev2";
-    if (vid == 0x8086 && did == 0x2da2) return "intel_lynnfield_mc_ch0_rank_rev2";
-    if (vid == 0x8086 && did == 0x2da3) return "intel_lynnfield_mc_ch0_tc_rev2";
-    if (vid == 0x8086 && did == 0x2da8) return "intel_lynnfield_mc_ch1_ctrl_rev2";
-    if (vid == 0x8086 && did == 0x2da9) return "intel_lynnfield_mc_ch1_addr_rev2";
-    if (vid == 0x8086 && did == 0x2daa) return "intel_lynnfield_mc_ch1_rank_rev2";
-    if (vid == 0x8086 && did == 0x2dab) return "intel_lynnfield_mc_ch1_tc_rev2";
-    if (vid == 0x8086 && did == 0x2db0) return "intel_lynnfield_mc_ch2_ctrl_rev2";
-    if (vid == 0x8086 && did == 0x2db1) return "intel_lynnfield_mc_ch2_addr_rev2";
-    if (vid == 0x8086 && did == 0x2db2) return "intel_lynnfield_mc_ch2_rank_rev2";
-    if (vid == 0x8086 && did == 0x2db3) return "intel_lynnfield_mc_ch2_tc_rev2";
-    if (vid == 0x8086 && did == 0x3340) return "intel_82855pm_hb";
-    if (vid == 0x8086 && did == 0x3429) return "intel_ioat_tbg4";
-    if (vid == 0x8086 && did == 0x342a) return "intel_ioat_tbg5";
-    if (vid == 0x8086 && did == 0x342b) return "intel_ioat_tbg6";
-    if (vid == 0x8086 && did == 0x342c) return "intel_ioat_tbg7";
-    if (vid == 0x8086 && did == 0x342e) return "intel_x58_hub_mgmt";
-    if (vid == 0x8086 && did == 0x3430) return "intel_ioat_tbg0";
-    if (vid == 0x8086 && did == 0x3431) return "intel_ioat_tbg1";
-    if (vid == 0x8086 && did == 0x3432) return "intel_ioat_tbg2";
-    if (vid == 0x8086 && did == 0x3433) return "intel_ioat_tbg3";
-    if (vid == 0x8086 && did == 0x3575) return "intel_82830_hb";
-    if (vid == 0x8086 && did == 0x3577) return "intel_82830_cgc";
-    if (vid == 0x8086 && did == 0x358c) return "intel_82854_hb";
-    if (vid == 0x8086 && did == 0x358e) return "intel_82854_ig";
-    if (vid == 0x8086 && did == 0x3580) return "intel_82855gm_hb";
-    if (vid == 0x8086 && did == 0x3582) return "intel_82855gm_ig";
-    if (vid == 0x8086 && did == 0x3590) return "intel_e7520_mch";
-    if (vid == 0x8086 && did == 0x3592) return "intel_e7320_mch";
-    if (vid == 0x8086 && did == 0x3595) return "intel_mch_pa";
-    if (vid == 0x8086 && did == 0x3596) return "intel_mch_pa1";
-    if (vid == 0x8086 && did == 0x3597) return "intel_mch_pb";
-    if (vid == 0x8086 && did == 0x3598) return "intel_mch_pb1";
-    if (vid == 0x8086 && did == 0x3599) return "intel_mch_pc";
-    if (vid == 0x8086 && did == 0x359a) return "intel_mch_pc1";
-    if (vid == 0x8086 && did == 0x359e) return "intel_e7525_mch";
-    if (vid == 0x8086 && did == 0x360c) return "intel_i7300_mch_err";
-    if (vid == 0x8086 && did == 0x360f) return "intel_i7300_mch_fb0";
-    if (vid == 0x8086 && did == 0x3610) return "intel_i7300_mch_fb1";
-    if (vid == 0x8086 && did == 0x360b) return "intel_ioat_cnb";
-    if (vid == 0x8086 && did == 0x360c) return "intel_fbd_cnb";
-    if (vid == 0x8086 && did == 0x3710) return "intel_ioat_jsf0";
-    if (vid == 0x8086 && did == 0x3711) return "intel_ioat_jsf1";
-    if (vid == 0x8086 && did == 0x3712) return "intel_ioat_jsf2";
-    if (vid == 0x8086 && did == 0x3713) return "intel_ioat_jsf3";
-    if (vid == 0x8086 && did == 0x3714) return "intel_ioat_jsf4";
-    if (vid == 0x8086 && did == 0x3715) return "intel_ioat_jsf5";
-    if (vid == 0x8086 && did == 0x3716) return "intel_ioat_jsf6";
-    if (vid == 0x8086 && did == 0x3717) return "intel_ioat_jsf7";
-    if (vid == 0x8086 && did == 0x3718) return "intel_ioat_jsf8";
-    if (vid == 0x8086 && did == 0x3719) return "intel_ioat_jsf9";
-    if (vid == 0x8086 && did == 0x3a14) return "intel_ich10_0";
-    if (vid == 0x8086 && did == 0x3a16) return "intel_ich10_1";
-    if (vid == 0x8086 && did == 0x3a18) return "intel_ich10_2";
-    if (vid == 0x8086 && did == 0x3a1a) return "intel_ich10_3";
-    if (vid == 0x8086 && did == 0x3a30) return "intel_ich10_4";
-    if (vid == 0x8086 && did == 0x3a60) return "intel_ich10_5";
-    if (vid == 0x8086 && did == 0x3b00) return "intel_5_3400_series_lpc_min";
-    if (vid == 0x8086 && did == 0x3b1f) return "intel_5_3400_series_lpc_max";
-    if (vid == 0x8086 && did == 0x3c20) return "intel_ioat_snb0";
-    if (vid == 0x8086 && did == 0x3c21) return "intel_ioat_snb1";
-    if (vid == 0x8086 && did == 0x3c22) return "intel_ioat_snb2";
-    if (vid == 0x8086 && did == 0x3c23) return "intel_ioat_snb3";
-    if (vid == 0x8086 && did == 0x3c24) return "intel_ioat_snb4";
-    if (vid == 0x8086 && did == 0x3c25) return "intel_ioat_snb5";
-    if (vid == 0x8086 && did == 0x3c26) return "intel_ioat_snb6";
-    if (vid == 0x8086 && did == 0x3c27) return "intel_ioat_snb7";
-    if (vid == 0x8086 && did == 0x3c2e) return "intel_ioat_snb8";
-    if (vid == 0x8086 && did == 0x3c2f) return "intel_ioat_snb9";
-    if (vid == 0x8086 && did == 0x3c46) return "intel_unc_ha";
-    if (vid == 0x8086 && did == 0x3cb0) return "intel_unc_imc0";
-    if (vid == 0x8086 && did == 0x3cb1) return "intel_unc_imc1";
-    if (vid == 0x8086 && did == 0x3cb4) return "intel_unc_imc2";
-    if (vid == 0x8086 && did == 0x3cb5) return "intel_unc_imc3";
-    if (vid == 0x8086 && did == 0x3c41) return "intel_unc_qpi0";
-    if (vid == 0x8086 && did == 0x3c42) return "intel_unc_qpi1";
-    if (vid == 0x8086 && did == 0x3c43) return "intel_unc_r2pcie";
-    if (vid == 0x8086 && did == 0x3c44) return "intel_unc_r3qpi0";
-    if (vid == 0x8086 && did == 0x3c45) return "intel_unc_r3qpi1";
-    if (vid == 0x8086 && did == 0x3ce0) return "intel_jaketown_ubox";
-    if (vid == 0x8086 && did == 0x402f) return "intel_ioat_snb";
-    if (vid == 0x8086 && did == 0x65f0) return "intel_5100_16";
-    if (vid == 0x8086 && did == 0x65f3) return "intel_5100_19";
-    if (vid == 0x8086 && did == 0x65f5) return "intel_5100_21";
-    if (vid == 0x8086 && did == 0x65f6) return "intel_5100_22";
-    if (vid == 0x8086 && did == 0x4030) return "intel_5400_err";
-    if (vid == 0x8086 && did == 0x4035) return "intel_5400_fbd0";
-    if (vid == 0x8086 && did == 0x4036) return "intel_5400_fbd1";
-    if (vid == 0x8086 && did == 0x65ff) return "intel_ioat_scnb";
-    if (vid == 0x8086 && did == 0x5031) return "intel_ep80579_0";
-    if (vid == 0x8086 && did == 0x5032) return "intel_ep80579_1";
-    if (vid == 0x8086 && did == 0x7000) return "intel_82371sb_0";
-    if (vid == 0x8086 && did == 0x7010) return "intel_82371sb_1";
-    if (vid == 0x8086 && did == 0x7020) return "intel_82371sb_2";
-    if (vid == 0x8086 && did == 0x7030) return "intel_82437vx";
-    if (vid == 0x8086 && did == 0x7100) return "intel_82439tx";
-    if (vid == 0x8086 && did == 0x7110) return "intel_82371ab_0";
-    if (vid == 0x8086 && did == 0x7111) return "intel_82371ab";
-    if (vid == 0x8086 && did == 0x7112) return "intel_82371ab_2";
-    if (vid == 0x8086 && did == 0x7113) return "intel_82371ab_3";
-    if (vid == 0x8086 && did == 0x7120) return "intel_82810_mc1";
-    if (vid == 0x8086 && did == 0x7121) return "intel_82810_ig1";
-    if (vid == 0x8086 && did == 0x7122) return "intel_82810_mc3";
-    if (vid == 0x8086 && did == 0x7123) return "intel_82810_ig3";
-    if (vid == 0x8086 && did == 0x7124) return "intel_82810e_mc";
-    if (vid == 0x8086 && did == 0x7125) return "intel_82810e_ig";
-    if (vid == 0x8086 && did == 0x7180) return "intel_82443lx_0";
-    if (vid == 0x8086 && did == 0x7181) return "intel_82443lx_1";
-    if (vid == 0x8086 && did == 0x7190) return "intel_82443bx_0";
-    if (vid == 0x8086 && did == 0x7191) return "intel_82443bx_1";
-    if (vid == 0x8086 && did == 0x7192) return "intel_82443bx_2";
-    if (vid == 0x8086 && did == 0x7195) return "intel_440mx";
-    if (vid == 0x8086 && did == 0x7196) return "intel_440mx_6";
-    if (vid == 0x8086 && did == 0x7198) return "intel_82443mx_0";
-    if (vid == 0x8086 && did == 0x7199) return "intel_82443mx_1";
-    if (vid == 0x8086 && did == 0x719b) return "intel_82443mx_3";
-    if (vid == 0x8086 && did == 0x71a0) return "intel_82443gx_0";
-    if (vid == 0x8086 && did == 0x71a2) return "intel_82443gx_2";
-    if (vid == 0x8086 && did == 0x7601) return "intel_82372fb_1";
-    if (vid == 0x8086 && did == 0x8119) return "intel_sch_lpc";
-    if (vid == 0x8086 && did == 0x811a) return "intel_sch_ide";
-    if (vid == 0x8086 && did == 0x8186) return "intel_itc_lpc";
-    if (vid == 0x8086 && did == 0x84c4) return "intel_82454gx";
-    if (vid == 0x8086 && did == 0x84c5) return "intel_82450gx";
-    if (vid == 0x8086 && did == 0x84ca) return "intel_82451nx";
-    if (vid == 0x8086 && did == 0x84cb) return "intel_82454nx";
-    if (vid == 0x8086 && did == 0x84ea) return "intel_84460gx";
-    if (vid == 0x8086 && did == 0x8500) return "intel_ixp4xx";
-    if (vid == 0x8086 && did == 0x9004) return "intel_ixp2800";
-    if (vid == 0x8086 && did == 0xb152) return "intel_s21152bb";
-    if (vid == 0x8686 && did == 0x1010) return "scalemp_vsmp_ctl";
-    if (vid == 0x8e0e && did == 0x0291) return "computone_ip2ex";
-    if (vid == 0x8e0e && did == 0x0302) return "computone_pg";
-    if (vid == 0x9004 && did == 0x1078) return "adaptec_7810";
-    if (vid == 0x9004 && did == 0x2178) return "adaptec_7821";
-    if (vid == 0x9004 && did == 0x3860) return "adaptec_38602";
-    if (vid == 0x9004 && did == 0x5078) return "adaptec_7850";
-    if (vid == 0x9004 && did == 0x5578) return "adaptec_7855";
-    if (vid == 0x9004 && did == 0x6038) return "adaptec_3860";
-    if (vid == 0x9004 && did == 0x6075) return "adaptec_1480a";
-    if (vid == 0x9004 && did == 0x6078) return "adaptec_7860";
-    if (vid == 0x9004 && did == 0x6178) return "adaptec_7861";
-    if (vid == 0x9004 && did == 0x7078) return "adaptec_7870";
-    if (vid == 0x9004 && did == 0x7178) return "adaptec_7871";
-    if (vid == 0x9004 && did == 0x7278) return "adaptec_7872";
-    if (vid == 0x9004 && did == 0x7378) return "adaptec_7873";
-    if (vid == 0x9004 && did == 0x7478) return "adaptec_7874";
-    if (vid == 0x9004 && did == 0x7895) return "adaptec_7895";
-    if (vid == 0x9004 && did == 0x8078) return "adaptec_7880";
-    if (vid == 0x9004 && did == 0x8178) return "adaptec_7881";
-    if (vid == 0x9004 && did == 0x8278) return "adaptec_7882";
-    if (vid == 0x9004 && did == 0x8378) return "adaptec_7883";
-    if (vid == 0x9004 && did == 0x8478) return "adaptec_7884";
-    if (vid == 0x9004 && did == 0x8578) return "adaptec_7885";
-    if (vid == 0x9004 && did == 0x8678) return "adaptec_7886";
-    if (vid == 0x9004 && did == 0x8778) return "adaptec_7887";
-    if (vid == 0x9004 && did == 0x8878) return "adaptec_7888";
-    if (vid == 0x9005 && did == 0x0010) return "adaptec2_2940u2";
-    if (vid == 0x9005 && did == 0x0011) return "adaptec2_2930u2";
-    if (vid == 0x9005 && did == 0x0013) return "adaptec2_7890b";
-    if (vid == 0x9005 && did == 0x001f) return "adaptec2_7890";
-    if (vid == 0x9005 && did == 0x0050) return "adaptec2_3940u2";
-    if (vid == 0x9005 && did == 0x0051) return "adaptec2_3950u2d";
-    if (vid == 0x9005 && did == 0x005f) return "adaptec2_7896";
-    if (vid == 0x9005 && did == 0x0080) return "adaptec2_7892a";
-    if (vid == 0x9005 && did == 0x0081) return "adaptec2_7892b";
-    if (vid == 0x9005 && did == 0x0083) return "adaptec2_7892d";
-    if (vid == 0x9005 && did == 0x008f) return "adaptec2_7892p";
-    if (vid == 0x9005 && did == 0x00c0) return "adaptec2_7899a";
-    if (vid == 0x9005 && did == 0x00c1) return "adaptec2_7899b";
-    if (vid == 0x9005 && did == 0x00c3) return "adaptec2_7899d";
-    if (vid == 0x9005 && did == 0x00cf) return "adaptec2_7899p";
-    if (vid == 0x9005 && did == 0x0500) return "adaptec2_obsidian";
-    if (vid == 0x9005 && did == 0x0503) return "adaptec2_scamp";
-    if (vid == 0x9412 && did == 0x6565) return "holtek_6565";
-    if (vid == 0x9710 && did == 0x9705) return "netmos_9705";
-    if (vid == 0x9710 && did == 0x9715) return "netmos_9715";
-    if (vid == 0x9710 && did == 0x9735) return "netmos_9735";
-    if (vid == 0x9710 && did == 0x9745) return "netmos_9745";
-    if (vid == 0x9710 && did == 0x9755) return "netmos_9755";
-    if (vid == 0x9710 && did == 0x9805) return "netmos_9805";
-    if (vid == 0x9710 && did == 0x9815) return "netmos_9815";
-    if (vid == 0x9710 && did == 0x9835) return "netmos_9835";
-    if (vid == 0x9710 && did == 0x9845) return "netmos_9845";
-    if (vid == 0x9710 && did == 0x9855) return "netmos_9855";
-    if (vid == 0x9710 && did == 0x9865) return "netmos_9865";
-    if (vid == 0x9710 && did == 0x9900) return "netmos_9900";
-    if (vid == 0x9710 && did == 0x9901) return "netmos_9901";
-    if (vid == 0x9710 && did == 0x9904) return "netmos_9904";
-    if (vid == 0x9710 && did == 0x9912) return "netmos_9912";
-    if (vid == 0x9710 && did == 0x9922) return "netmos_9922";
-    if (vid == 0xd161 && did == 0xb410) return "digium_hfc4s";
-    if (vid == 0xe159 && did == 0x0001) return "tigerjet_300";
-    if (vid == 0xe159 && did == 0x0002) return "tigerjet_100";
-    if (vid == 0xea60 && did == 0x9896) return "rme_digi32";
-    if (vid == 0xea60 && did == 0x9897) return "rme_digi32_pro";
-    if (vid == 0xea60 && did == 0x9898) return "rme_digi32_8";
-    if (vid == 0x5853 && did == 0x0001) return "xen_platform";
-    if (vid == 0x15ad && did == 0x0790) return "vmware_pci_bridge";
-    if (vid == 0x15ad && did == 0x07a0) return "vmware_pci_expres";
-    if (vid == 0x15ad && did == 0x0770) return "vmware_pci_to_usb";
-    if (vid == 0x15ad && did == 0x0778) return "vmware_usb_to_pll";
-    if (vid == 0x15ad && did == 0x1977) return "vmware_vhda_audio";
-    if (vid == 0x15ad && did == 0x1975) return "vmware_vhda_codec";
-    if (vid == 0x15ad && did == 0x0740) return "vmware_vmci_bus";
-    if (vid == 0x15ad && did == 0x0801) return "vmware_vmemctrl";
-    if (vid == 0x15ad && did == 0x0720) return "vmware_vmxnet";
-    if (vid == 0x15ad && did == 0x07b0) return "vmware_vmxnet3";
-    if (vid == 0x15ad && did == 0x0710) return "vmware_vsvga";
-    if (vid == 0x15ad && did == 0x0405) return "vmware_vsvga2";
+const char* libpci_deviceID_str(int vid, int did) {
     return "Unknown device ID.";
 }
+
+#endif /* CONFIG_LIB_PCI_NAMES */
@@ -12,6 +12,7 @@
 #include <stdio.h>
 #include <assert.h>
 #include <pci/pci.h>
+#include <pci/ecam.h>
 #include <pci/ioreg.h>
 
 void libpci_out(uint32_t port_no, uint32_t val, uint8_t size) {
@@ -52,38 +53,68 @@ uint32_t libpci_in8(uint32_t port_no) {
     return libpci_in(port_no, 1);
 }
 
+/* Config space accesses use the memory mapped ECAM region covering the bus if there is one,
+ * and fall back to the port pair otherwise. */
+
 uint32_t libpci_read_reg32(uint8_t bus, uint8_t dev, uint8_t fun, uint8_t reg) {
     reg &= ~MASK(2);
+    volatile void *cfg = libpci_ecam_addr(0, bus, dev, fun, reg);
+    if (cfg) {
+        return *(volatile uint32_t*)cfg;
+    }
     libpci_out32(PCI_CONF_PORT_ADDR, 0x80000000 | bus << 16 | dev << 11 | fun << 8 | reg);
     return libpci_in32(PCI_CONF_PORT_DATA);
 }
 
 void libpci_write_reg32(uint8_t bus, uint8_t dev, uint8_t fun, uint8_t reg, uint32_t val) {
     reg &= ~MASK(2);
+    volatile void *cfg = libpci_ecam_addr(0, bus, dev, fun, reg);
+    if (cfg) {
+        *(volatile uint32_t*)cfg = val;
+        return;
+    }
     libpci_out32(PCI_CONF_PORT_ADDR, 0x80000000 | bus << 16 | dev << 11 | fun << 8 | reg);
     libpci_out32(PCI_CONF_PORT_DATA, val);
 }
 
 uint16_t libpci_read_reg16(uint8_t bus, uint8_t dev, uint8_t fun, uint8_t reg) {
     reg &= ~MASK(1);
+    volatile void *cfg = libpci_ecam_addr(0, bus, dev, fun, reg);
+    if (cfg) {
+        return *(volatile uint16_t*)cfg;
+    }
     libpci_out32(PCI_CONF_PORT_ADDR, 0x80000000 | bus << 16 | dev << 11 | fun << 8 | (reg & ~MASK(2)));
     return ( libpci_in32(PCI_CONF_PORT_DATA) >> ((reg & MASK(2)) * 8) ) & 0xFFFF;
 }
 
 void libpci_write_reg16(uint8_t bus, uint8_t dev, uint8_t fun, uint8_t reg, uint16_t val) {
     reg &= ~MASK(1);
-    libpci_out32(PCI_CONF_PORT_ADDR, 0x80000000 | bus << 16 | dev << 11 | fun << 8 | reg);
-    libpci_out16(PCI_CONF_PORT_DATA, val);
+    volatile void *cfg = libpci_ecam_addr(0, bus, dev, fun, reg);
+    if (cfg) {
+        *(volatile uint16_t*)cfg = val;
+        return;
+    }
+    libpci_out32(PCI_CONF_PORT_ADDR, 0x80000000 | bus << 16 | dev << 11 | fun << 8 | (reg & ~MASK(2)));
+    libpci_out16(PCI_CONF_PORT_DATA + (reg & MASK(2)), val);
 }
 
 uint16_t libpci_read_reg8(uint8_t bus, uint8_t dev, uint8_t fun, uint8_t reg) {
+    volatile void *cfg = libpci_ecam_addr(0, bus, dev, fun, reg);
+    if (cfg) {
+        return *(volatile uint8_t*)cfg;
+    }
     libpci_out32(PCI_CONF_PORT_ADDR, 0x80000000 | bus << 16 | dev << 11 | fun << 8 | (reg & ~MASK(2)));
     return ( libpci_in32(PCI_CONF_PORT_DATA) >> ((reg & MASK(2)) * 8) ) & 0xFF;
 }
 
 void libpci_write_reg8(uint8_t bus, uint8_t dev, uint8_t fun, uint8_t reg, uint8_t val) {
-    libpci_out32(PCI_CONF_PORT_ADDR, 0x80000000 | bus << 16 | dev << 11 | fun << 8 | reg);
-    libpci_out8(PCI_CONF_PORT_DATA, val);
+    volatile void *cfg = libpci_ecam_addr(0, bus, dev, fun, reg);
+    if (cfg) {
+        *(volatile uint8_t*)cfg = val;
+        return;
+    }
+    libpci_out32(PCI_CONF_PORT_ADDR, 0x80000000 | bus << 16 | dev << 11 | fun << 8 | (reg & ~MASK(2)));
+    libpci_out8(PCI_CONF_PORT_DATA + (reg & MASK(2)), val);
 }
 
 uint32_t libpci_read_reg(uint8_t bus, uint8_t dev, uint8_t fun, uint8_t reg, uint8_t size) {
@@ -13,18 +13,120 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pci/gen_config.h>
 #include <pci/pci.h>
 #include <pci/helper.h>
 #include <pci/ioreg.h>
 #include <utils/attribute.h>
 #include <utils/zf_log.h>
 
-#define PCI_DISPLAY_FOUND_DEVICES
-
-libpci_device_t libpci_device_list[PCI_MAX_DEVICES];
+libpci_device_t *libpci_device_list = NULL;
 uint32_t libpci_num_devices = 0;
+static uint32_t libpci_device_list_size = 0;
 static ps_io_port_ops_t global_port_ops;
 
+/* Open addressing hash indices over libpci_device_list, one keyed by segment/bus/dev/fun
+ * and one keyed by vendor/device ID. Entries store device indices plus one, so that zero
+ * marks an empty slot. Devices sharing a vendor/device ID are chained through id_next in
+ * the order they were found. */
+typedef struct libpci_index_entry {
+    uint32_t key;
+    uint32_t head;
+    uint32_t tail;
+} libpci_index_entry_t;
+
+static libpci_index_entry_t *bdf_index = NULL;
+static libpci_index_entry_t *id_index = NULL;
+static uint32_t *id_next = NULL;
+static uint32_t index_size_bits = 0;
+
+static inline uint32_t sbdf_key(uint16_t segment, uint8_t bus, uint8_t dev, uint8_t fun) {
+    return (uint32_t)segment << 16 | (uint32_t)bus << 8 | (dev & MASK(5)) << 3 | (fun & MASK(3));
+}
+
+static inline uint32_t id_key(uint16_t vendor_id, uint16_t device_id) {
+    return (uint32_t)vendor_id << 16 | device_id;
+}
+
+/* Find the entry for key, or the empty slot where it would be inserted. */
+static libpci_index_entry_t *index_slot(libpci_index_entry_t *index, uint32_t key) {
+    uint32_t mask = MASK(index_size_bits);
+    /* Fibonacci hashing, the top bits of the product are the well mixed ones */
+    uint32_t i = (uint32_t)(key * 2654435761u) >> (32 - index_size_bits);
+    while (index[i].head != 0 && index[i].key != key) {
+        i = (i + 1) & mask;
+    }
+    return &index[i];
+}
+
+static void index_insert(uint32_t n) {
+    libpci_device_t *d = &libpci_device_list[n];
+    libpci_index_entry_t *e = index_slot(bdf_index, sbdf_key(d->segment, d->bus, d->dev, d->fun));
+    if (e->head == 0) {
+        *e = (libpci_index_entry_t) {
+            .key = sbdf_key(d->segment, d->bus, d->dev, d->fun), .head = n + 1, .tail = n + 1
+        };
+    }
+    id_next[n] = 0;
+    e = index_slot(id_index, id_key(d->vendor_id, d->device_id));
+    if (e->head == 0) {
+        *e = (libpci_index_entry_t) {
+            .key = id_key(d->vendor_id, d->device_id), .head = n + 1, .tail = n + 1
+        };
+    } else {
+        id_next[e->tail - 1] = n + 1;
+        e->tail = n + 1;
+    }
+}
+
+/* Rebuild both indices so that they can hold at least 'count' devices at a load factor
+ * of no more than a half. */
+static int index_rebuild(uint32_t count) {
+    uint32_t bits = 4;
+    while (BIT(bits) < count * 2) {
+        bits++;
+    }
+    libpci_index_entry_t *new_bdf = calloc(BIT(bits), sizeof(libpci_index_entry_t));
+    libpci_index_entry_t *new_id = calloc(BIT(bits), sizeof(libpci_index_entry_t));
+    if (!new_bdf || !new_id) {
+        free(new_bdf);
+        free(new_id);
+        return -1;
+    }
+    free(bdf_index);
+    free(id_index);
+    bdf_index = new_bdf;
+    id_index = new_id;
+    index_size_bits = bits;
+    for (uint32_t i = 0; i < libpci_num_devices; i++) {
+        index_insert(i);
+    }
+    return 0;
+}
+
+/* Make room for one more device in the device list and the indices. */
+static int device_list_grow(void) {
+    if (libpci_num_devices < libpci_device_list_size) {
+        return 0;
+    }
+    uint32_t size = libpci_device_list_size ? libpci_device_list_size * 2 : 32;
+    libpci_device_t *list = realloc(libpci_device_list, size * sizeof(libpci_device_t));
+    if (!list) {
+        return -1;
+    }
+    libpci_device_list = list;
+    uint32_t *next = realloc(id_next, size * sizeof(uint32_t));
+    if (!next) {
+        return -1;
+    }
+    id_next = next;
+    if (index_rebuild(size)) {
+        return -1;
+    }
+    libpci_device_list_size = size;
+    return 0;
+}
+
 uint32_t libpci_ioread(uint32_t port_no, uint32_t* val, uint32_t size) {
     return (uint32_t)ps_io_port_in(&global_port_ops, port_no, (int)size, val);
 }
@@ -34,92 +136,175 @@ uint32_t libpci_iowrite(uint32_t port_no, uint32_t val, uint32_t size) {
 }
 
 libpci_device_t* libpci_find_device(uint16_t vendor_id, uint16_t device_id) {
-    for (uint32_t i = 0; i < libpci_num_devices; i++) {
-        if (libpci_device_list[i].vendor_id == vendor_id &&
-            libpci_device_list[i].device_id == device_id) {
-            return &libpci_device_list[i];
-        }
+    if (!libpci_num_devices) {
+        return NULL;
     }
-    return NULL;
+    libpci_index_entry_t *e = index_slot(id_index, id_key(vendor_id, device_id));
+    return e->head ? &libpci_device_list[e->head - 1] : NULL;
 }
 
-int libpci_find_device_all(uint16_t vendor_id, uint16_t device_id, libpci_device_t** out) {
+int libpci_find_device_all_n(uint16_t vendor_id, uint16_t device_id, libpci_device_t** out, int max) {
     assert(out);
+    if (!libpci_num_devices) {
+        return 0;
+    }
     int n = 0;
-    for (uint32_t i = 0; i < libpci_num_devices; i++) {
-        if (libpci_device_list[i].vendor_id == vendor_id &&
-            libpci_device_list[i].device_id == device_id) {
-            out[n++] = &libpci_device_list[i];
-        }
+    libpci_index_entry_t *e = index_slot(id_index, id_key(vendor_id, device_id));
+    for (uint32_t i = e->head; i != 0 && n < max; i = id_next[i - 1]) {
+        out[n++] = &libpci_device_list[i - 1];
     }
     return n;
 }
 
+int libpci_find_device_all(uint16_t vendor_id, uint16_t device_id, libpci_device_t** out) {
+    return libpci_find_device_all_n(vendor_id, device_id, out, PCI_MAX_DEVICES);
+}
+
 libpci_device_t* libpci_find_device_matching(libpci_device_t *device) {
-    for (uint32_t i = 0; i < libpci_num_devices; i++) {
-        if (libpci_device_list[i].bus == device->bus &&
-            libpci_device_list[i].dev == device->dev &&
-            libpci_device_list[i].fun == device->fun &&
-            libpci_device_list[i].vendor_id == device->vendor_id &&
-            libpci_device_list[i].device_id == device->device_id) {
-            return &libpci_device_list[i];
-        }
+    libpci_device_t *found = libpci_find_device_sbdf(device->segment, device->bus, device->dev,
+                                                     device->fun);
+    if (found &&
+        found->vendor_id == device->vendor_id &&
+        found->device_id == device->device_id) {
+        return found;
     }
     return NULL;
 }
 
+libpci_device_t* libpci_find_device_sbdf(uint16_t segment, uint8_t bus, uint8_t dev, uint8_t fun) {
+    if (!libpci_num_devices) {
+        return NULL;
+    }
+    libpci_index_entry_t *e = index_slot(bdf_index, sbdf_key(segment, bus, dev, fun));
+    return e->head ? &libpci_device_list[e->head - 1] : NULL;
+}
+
 libpci_device_t* libpci_find_device_bdf(uint8_t bus, uint8_t dev, uint8_t fun) {
-    for (uint32_t i = 0; i < libpci_num_devices; i++) {
-        if (libpci_device_list[i].bus == bus &&
-            libpci_device_list[i].dev == dev &&
-            libpci_device_list[i].fun == fun) {
-            return &libpci_device_list[i];
-        }
+    return libpci_find_device_sbdf(0, bus, dev, fun);
+}
+
+/* Magic and version identifying a device table snapshot. The version covers the layout of
+ * libpci_snapshot_entry_t, so a snapshot from an incompatible build is rejected. */
+#define PCI_SNAPSHOT_MAGIC 0x50434953
+#define PCI_SNAPSHOT_VERSION (1 << 16 | sizeof(libpci_snapshot_entry_t))
+
+typedef struct libpci_snapshot_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t num_devices;
+    uint32_t checksum;
+} libpci_snapshot_header_t;
+
+typedef struct libpci_snapshot_entry {
+    uint16_t segment;
+    uint8_t bus;
+    uint8_t dev;
+    uint8_t fun;
+    uint16_t vendor_id;
+    uint16_t device_id;
+    uint16_t subsystem_id;
+    libpci_device_iocfg_t cfg;
+} libpci_snapshot_entry_t;
+
+/* Snapshot being used by the current scan. Found devices are expected in the same order as
+ * in the snapshot, and it is abandoned at the first device that does not match. */
+static const libpci_snapshot_entry_t *scan_snapshot = NULL;
+static uint32_t scan_snapshot_num = 0;
+
+/* Buses visited by the current scan, so that misconfigured bridges cannot make us scan a bus
+ * twice or recurse forever. */
+static uint32_t scan_visited[256 / 32];
+
+static uint32_t snapshot_checksum(const void *data, size_t len) {
+    /* FNV-1a */
+    const uint8_t *p = data;
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ p[i]) * 16777619u;
     }
-    return NULL;
+    return hash;
 }
 
-static int libpci_add_fun(uint8_t bus, uint8_t dev, uint8_t fun) {
-    uint16_t vendor_id = libpci_read_reg16(bus, dev, fun, PCI_VENDOR_ID);
+/* Number of BARs implemented by each header type. */
+static int libpci_num_bars(uint8_t header_type) {
+    switch (header_type & 0x7f) {
+    case PCI_HEADER_TYPE_NORMAL: return 6;
+    case PCI_HEADER_TYPE_BRIDGE: return 2;
+    case PCI_HEADER_TYPE_CARDBUS: return 1;
+    default: return 0;
+    }
+}
 
-    if (vendor_id == PCI_VENDOR_ID_INVALID) {
-        /* No device here. */
-        return 0;
+/* Take the config of the device being added from the snapshot, if the device still matches
+ * it and its BARs still hold the addresses they held when the snapshot was taken. Reading the
+ * BARs is cheap, unlike sizing them which needs a write, a read and a restore for each. */
+static bool libpci_snapshot_take(libpci_device_t *d, int num_bars) {
+    if (scan_snapshot == NULL) {
+        return false;
+    }
+    if (libpci_num_devices >= scan_snapshot_num) {
+        ZF_LOGI("PCI :: Snapshot is stale, more devices found than recorded");
+        scan_snapshot = NULL;
+        return false;
+    }
+    const libpci_snapshot_entry_t *e = &scan_snapshot[libpci_num_devices];
+    bool match = e->segment == d->segment && e->bus == d->bus && e->dev == d->dev &&
+                 e->fun == d->fun && e->vendor_id == d->vendor_id &&
+                 e->device_id == d->device_id && e->subsystem_id == d->subsystem_id;
+    for (int i = 0; match && i < num_bars; i++) {
+        match = libpci_read_reg32(d->bus, d->dev, d->fun, PCI_BASE_ADDRESS_0 + (i * 4)) ==
+                e->cfg.base_addr_raw[i];
     }
+    if (!match) {
+        ZF_LOGI("PCI :: Snapshot is stale at %.2x.%.2x.%.2x, probing devices", d->bus, d->dev, d->fun);
+        scan_snapshot = NULL;
+        return false;
+    }
+    d->cfg = e->cfg;
+    return true;
+}
+
+static int libpci_add_fun(uint8_t bus, uint8_t dev, uint8_t fun, uint32_t id, uint8_t header_type) {
+    uint16_t vendor_id = id & 0xFFFF;
+    uint16_t device_id = id >> 16;
 
     ZF_LOGD("PCI :: Device found at BUS %d DEV %d FUN %d:\n", (int)bus, (int)dev, (int)fun);
-    ZF_LOGD("    vendorID = %s [0x%x]\n", libpci_vendorID_str(vendor_id), vendor_id);
-
-    uint16_t device_id = libpci_read_reg16(bus, dev, fun, PCI_DEVICE_ID);
-    ZF_LOGD("    deviceID = %s [0x%x]\n", libpci_deviceID_str(vendor_id, device_id), device_id);
-
-    assert(libpci_num_devices + 1<= PCI_MAX_DEVICES);
-    libpci_device_list[libpci_num_devices].bus = bus;
-    libpci_device_list[libpci_num_devices].dev = dev;
-    libpci_device_list[libpci_num_devices].fun = fun;
-    libpci_device_list[libpci_num_devices].vendor_id = vendor_id;
-    libpci_device_list[libpci_num_devices].device_id = device_id;
-    libpci_device_list[libpci_num_devices].vendor_name = libpci_vendorID_str(vendor_id);
-    libpci_device_list[libpci_num_devices].device_name = libpci_deviceID_str(vendor_id, device_id);
-    libpci_device_list[libpci_num_devices].interrupt_line = libpci_read_reg8(bus, dev, fun, PCI_INTERRUPT_LINE);
-    libpci_device_list[libpci_num_devices].interrupt_pin = libpci_read_reg8(bus, dev, fun, PCI_INTERRUPT_PIN);
-    libpci_device_list[libpci_num_devices].subsystem_id = libpci_read_reg16(bus, dev, fun, PCI_SUBSYSTEM_ID);
-    libpci_read_ioconfig(&libpci_device_list[libpci_num_devices].cfg, bus, dev, fun);
+
+    if (device_list_grow()) {
+        ZF_LOGE("PCI :: Out of memory recording device %.2x.%.2x.%.2x", bus, dev, fun);
+        return 0;
+    }
+    libpci_device_t *d = &libpci_device_list[libpci_num_devices];
+    d->segment = 0;
+    d->bus = bus;
+    d->dev = dev;
+    d->fun = fun;
+    d->vendor_id = vendor_id;
+    d->device_id = device_id;
+    d->vendor_name = libpci_vendorID_str(vendor_id);
+    d->device_name = libpci_deviceID_str(vendor_id, device_id);
+    ZF_LOGD("    vendorID = %s [0x%x]\n", d->vendor_name, vendor_id);
+    ZF_LOGD("    deviceID = %s [0x%x]\n", d->device_name, device_id);
+    d->interrupt_line = libpci_read_reg8(bus, dev, fun, PCI_INTERRUPT_LINE);
+    d->interrupt_pin = libpci_read_reg8(bus, dev, fun, PCI_INTERRUPT_PIN);
+    d->subsystem_id = libpci_read_reg16(bus, dev, fun, PCI_SUBSYSTEM_ID);
+    if (!libpci_snapshot_take(d, libpci_num_bars(header_type))) {
+        libpci_read_ioconfig(&d->cfg, bus, dev, fun);
+    }
 
 #if (ZF_LOG_LEVEL == ZF_LOG_VERBOSE)
-    libpci_device_iocfg_debug_print(&libpci_device_list[libpci_num_devices].cfg, false);
+    libpci_device_iocfg_debug_print(&d->cfg, false);
 #endif
 
-    #ifdef PCI_DISPLAY_FOUND_DEVICES
+#ifdef CONFIG_LIB_PCI_DISPLAY_FOUND_DEVICES
     printf("PCI :: %.2x.%.2x.%.2x : %s %s (vid 0x%x did 0x%x) line%d pin%d\n", bus, dev, fun,
-        libpci_vendorID_str(vendor_id), libpci_deviceID_str(vendor_id, device_id),
-        vendor_id, device_id,
-        libpci_read_reg8(bus, dev, fun, PCI_INTERRUPT_LINE),
-        libpci_read_reg8(bus, dev, fun, PCI_INTERRUPT_PIN)
+        d->vendor_name, d->device_name, vendor_id, device_id,
+        d->interrupt_line, d->interrupt_pin
     );
-    libpci_device_iocfg_debug_print(&libpci_device_list[libpci_num_devices].cfg, true);
-    #endif
+    libpci_device_iocfg_debug_print(&d->cfg, true);
+#endif
 
+    index_insert(libpci_num_devices);
     libpci_num_devices++;
 
     return 1;
@@ -127,33 +312,49 @@ static int libpci_add_fun(uint8_t bus, uint8_t dev, uint8_t fun) {
 
 static void lib_pci_scan_bus(int bus);
 
-static void lib_pci_scan_fun(int bus, int dev, int fun) {
-    libpci_add_fun(bus, dev, fun);
-    if ( libpci_read_reg16(bus, dev, fun, PCI_CLASS_DEVICE) == 0x0604) {
-        int new_bus = libpci_read_reg8(bus, dev, fun, PCI_SECONDARY_BUS);
-        printf("%s found additional bus %d from %d %d %d\n", __FUNCTION__, new_bus, bus, dev, fun);
-        lib_pci_scan_bus(new_bus);
+static void lib_pci_scan_fun(int bus, int dev, int fun, uint32_t id, uint8_t header_type) {
+    libpci_add_fun(bus, dev, fun, id, header_type);
+    if ((header_type & 0x7f) == PCI_HEADER_TYPE_BRIDGE) {
+        /* Only the bus directly behind the bridge needs scanning, any further buses in its
+         * range sit behind bridges on that bus. */
+        uint32_t buses = libpci_read_reg32(bus, dev, fun, PCI_PRIMARY_BUS);
+        int secondary = (buses >> 8) & 0xFF;
+        int subordinate = (buses >> 16) & 0xFF;
+        if (secondary <= bus || subordinate < secondary) {
+            ZF_LOGW("PCI :: Ignoring unconfigured bridge at %.2x.%.2x.%.2x (bus %d - %d)",
+                    bus, dev, fun, secondary, subordinate);
+            return;
+        }
+        ZF_LOGD("PCI :: Found bus %d from %d %d %d\n", secondary, bus, dev, fun);
+        lib_pci_scan_bus(secondary);
     }
 }
 
 static void lib_pci_scan_dev(int bus, int dev) {
-    uint16_t vendor_id = libpci_read_reg16(bus, dev, 0, PCI_VENDOR_ID);
-    if (vendor_id == PCI_VENDOR_ID_INVALID) {
+    uint32_t id = libpci_read_reg32(bus, dev, 0, PCI_VENDOR_ID);
+    if ((id & 0xFFFF) == PCI_VENDOR_ID_INVALID) {
         return;
     }
-    printf("%s found pci device %d %d\n", __FUNCTION__, bus, dev);
-    lib_pci_scan_fun(bus, dev, 0);
-    if ( (libpci_read_reg8(bus, dev, 0, PCI_HEADER_TYPE) & 0x80) != 0) {
-        printf("%s found multi function device %d %d\n", __FUNCTION__, bus, dev);
+    uint8_t header_type = libpci_read_reg8(bus, dev, 0, PCI_HEADER_TYPE);
+    lib_pci_scan_fun(bus, dev, 0, id, header_type);
+    if ((header_type & 0x80) != 0) {
+        ZF_LOGD("PCI :: Found multi function device %d %d\n", bus, dev);
         for (int function = 1; function < 8; function++) {
-            if (libpci_read_reg16(bus, dev, function, PCI_VENDOR_ID) != PCI_VENDOR_ID_INVALID) {
-                lib_pci_scan_fun(bus, dev, function);
+            id = libpci_read_reg32(bus, dev, function, PCI_VENDOR_ID);
+            if ((id & 0xFFFF) != PCI_VENDOR_ID_INVALID) {
+                lib_pci_scan_fun(bus, dev, function, id,
+                                 libpci_read_reg8(bus, dev, function, PCI_HEADER_TYPE));
             }
         }
     }
 }
 
 static void lib_pci_scan_bus(int bus) {
+    if (scan_visited[bus / 32] & BIT(bus % 32)) {
+        ZF_LOGW("PCI :: Bus %d reached twice, not scanning it again", bus);
+        return;
+    }
+    scan_visited[bus / 32] |= BIT(bus % 32);
     for (int dev = 0; dev < 32; dev++) {
         lib_pci_scan_dev(bus, dev);
     }
@@ -161,25 +362,80 @@ static void lib_pci_scan_bus(int bus) {
 
 void libpci_scan(ps_io_port_ops_t port_ops) {
     global_port_ops = port_ops;
+    memset(scan_visited, 0, sizeof(scan_visited));
     ZF_LOGD("PCI :: Scanning...\n");
     if ( (libpci_read_reg8(0, 0, 0, PCI_HEADER_TYPE) & 0x80) == 0) {
-        printf("Single bus detected\n");
+        ZF_LOGD("PCI :: Single bus detected\n");
         lib_pci_scan_bus(0);
     } else {
         for (int function = 0; function < 8; function++) {
             if (libpci_read_reg16(0, 0, function, PCI_VENDOR_ID) != PCI_VENDOR_ID_INVALID) {
-                printf("%s detected bus %d\n", __FUNCTION__, function);
+                ZF_LOGD("PCI :: Detected bus %d\n", function);
                 lib_pci_scan_bus(function);
             }
         }
     }
 }
 
+int libpci_scan_snapshot(ps_io_port_ops_t port_ops, const void *snapshot, size_t len) {
+    const libpci_snapshot_header_t *hdr = snapshot;
+    if (snapshot == NULL || len < sizeof(*hdr) || hdr->magic != PCI_SNAPSHOT_MAGIC ||
+        hdr->version != PCI_SNAPSHOT_VERSION ||
+        (len - sizeof(*hdr)) / sizeof(libpci_snapshot_entry_t) < hdr->num_devices ||
+        hdr->checksum != snapshot_checksum(hdr + 1, hdr->num_devices * sizeof(libpci_snapshot_entry_t))) {
+        ZF_LOGI("PCI :: Invalid snapshot, probing devices");
+        libpci_scan(port_ops);
+        return -1;
+    }
+    /* The snapshot describes a scan starting from an empty device list */
+    if (libpci_num_devices == 0) {
+        scan_snapshot = (const libpci_snapshot_entry_t*)(hdr + 1);
+        scan_snapshot_num = hdr->num_devices;
+    }
+    libpci_scan(port_ops);
+    int ret = scan_snapshot != NULL && libpci_num_devices == scan_snapshot_num ? 0 : -1;
+    scan_snapshot = NULL;
+    return ret;
+}
+
+size_t libpci_snapshot_size(void) {
+    return sizeof(libpci_snapshot_header_t) + libpci_num_devices * sizeof(libpci_snapshot_entry_t);
+}
+
+int libpci_snapshot_save(void *buf, size_t len) {
+    if (buf == NULL || len < libpci_snapshot_size()) {
+        ZF_LOGE("PCI :: Snapshot buffer too small");
+        return -1;
+    }
+    libpci_snapshot_header_t *hdr = buf;
+    libpci_snapshot_entry_t *entries = (libpci_snapshot_entry_t*)(hdr + 1);
+    /* Zero everything so that padding does not make the checksum unstable */
+    memset(buf, 0, libpci_snapshot_size());
+    for (uint32_t i = 0; i < libpci_num_devices; i++) {
+        libpci_device_t *d = &libpci_device_list[i];
+        entries[i].segment = d->segment;
+        entries[i].bus = d->bus;
+        entries[i].dev = d->dev;
+        entries[i].fun = d->fun;
+        entries[i].vendor_id = d->vendor_id;
+        entries[i].device_id = d->device_id;
+        entries[i].subsystem_id = d->subsystem_id;
+        entries[i].cfg = d->cfg;
+    }
+    hdr->magic = PCI_SNAPSHOT_MAGIC;
+    hdr->version = PCI_SNAPSHOT_VERSION;
+    hdr->num_devices = libpci_num_devices;
+    hdr->checksum = snapshot_checksum(entries, libpci_num_devices * sizeof(libpci_snapshot_entry_t));
+    return (int)libpci_snapshot_size();
+}
+
 void libpci_read_ioconfig(libpci_device_iocfg_t *cfg, uint8_t bus, uint8_t dev, uint8_t fun) {
     assert(cfg);
     memset(cfg, 0, sizeof(libpci_device_iocfg_t));
 
-    for (int i = 0; i < 6; i++) {
+    /* Bridges only have two BARs, the rest of their header holds bus numbers and windows */
+    int num_bars = libpci_num_bars(libpci_read_reg8(bus, dev, fun, PCI_HEADER_TYPE));
+    for (int i = 0; i < num_bars; i++) {
         // Read and save the base address assigned by the BIOS.
         uint32_t bios_base_addr = libpci_read_reg32(bus, dev, fun, PCI_BASE_ADDRESS_0 + (i * 4));
         cfg->base_addr_raw[i] = bios_base_addr;
@@ -48,6 +48,16 @@ static void libpci_vdevice_rebase_callback_iowrite(libpci_vdevice_t* vdevice, in
     rebased_addr_ptr[byte_offset] |= val & rebased_mask_ptr[byte_offset];
 }
 
+/* Record, for every offset, how many bytes from there on are passed through, so that accesses
+ * can tell at a glance whether they can go straight to the device. */
+static void libpci_vdevice_compile_runs(libpci_vdevice_t* self) {
+    int run = 0;
+    for (int i = PCI_CONFIG_HEADER_SIZE_BYTES - 1; i >= 0; i--) {
+        run = self->mode[i].mode == PCI_VDEVICE_MODE_PASSTHROUGH ? run + 1 : 0;
+        self->passthrough_run[i] = run;
+    }
+}
+
 void libpci_vdevice_enable(libpci_vdevice_t* self, uint8_t bus, uint8_t dev, uint8_t fun,
                            libpci_device_t* pdevice_passthrough) {
     assert(self);
@@ -56,11 +66,17 @@ void libpci_vdevice_enable(libpci_vdevice_t* self, uint8_t bus, uint8_t dev, uin
     self->location_fun = fun;
     self->physical_device_passthrough = pdevice_passthrough;
     self->enabled = true;
+    if (self->owner) {
+        libpci_virtual_pci_rebuild(self->owner);
+    }
 }
 
 void libpci_vdevice_disable(libpci_vdevice_t* self) {
     assert(self);
     self->enabled = false;
+    if (self->owner) {
+        libpci_virtual_pci_rebuild(self->owner);
+    }
 }
 
 bool libpci_vdevice_match(libpci_vdevice_t* self, uint8_t bus, uint8_t dev, uint8_t fun) {
@@ -85,6 +101,7 @@ void libpci_vdevice_set_mode(libpci_vdevice_t* self, int offset,
     for (int i = 0; i < sz; i++) {
         self->mode[offset + i] = m;
     }
+    libpci_vdevice_compile_runs(self);
 }
 
 void libpci_vdevice_rebase_addr_realdevice(libpci_vdevice_t* self,
@@ -197,7 +214,7 @@ uint32_t libpci_vdevice_ioread(libpci_vdevice_t* self, int offset, int size){
     uint8_t* result_p = (uint8_t*)(&result);
 
     /* Check for attempted access to extended PCI space. */
-    if ((offset + size) >= PCI_STD_HEADER_SIZEOF) {
+    if ((offset + size) > PCI_STD_HEADER_SIZEOF) {
         if (!self->allow_extended_pci_config_space) {
             printf("ERROR: device tried to access extended PCI config space offset %d, but "
                    "allow_extended_pci_config_space was disabled. This is most likely a "
@@ -213,7 +230,19 @@ uint32_t libpci_vdevice_ioread(libpci_vdevice_t* self, int offset, int size){
                                offset, size);
     }
 
-    /* Loop through each byte and handle accordingly. */
+    /* Special case handle the case when the entire range is under passthrough. */
+    if (self->passthrough_run[offset] >= size && (offset & (size - 1)) == 0) {
+        assert(self->physical_device_passthrough);
+        return libpci_read_reg(self->physical_device_passthrough->bus,
+                               self->physical_device_passthrough->dev,
+                               self->physical_device_passthrough->fun,
+                               offset, size);
+    }
+
+    /* Loop through each byte and handle accordingly. Passthrough bytes are taken from a
+     * single read of the dword containing them. */
+    uint32_t hw_dword = 0;
+    int hw_offset = -1;
     for (int i = 0; i < size; i++) {
         libpci_vdevice_mode_t* m = &self->mode[offset + i];
         uint8_t result_byte = 0;
@@ -221,10 +250,14 @@ uint32_t libpci_vdevice_ioread(libpci_vdevice_t* self, int offset, int size){
         switch (m->mode) {
         case PCI_VDEVICE_MODE_PASSTHROUGH:
             assert(self->physical_device_passthrough);
-            result_byte = libpci_read_reg8(self->physical_device_passthrough->bus,
-                                           self->physical_device_passthrough->dev,
-                                           self->physical_device_passthrough->fun,
-                                           offset + i);
+            if (hw_offset != ((offset + i) & ~MASK(2))) {
+                hw_offset = (offset + i) & ~MASK(2);
+                hw_dword = libpci_read_reg32(self->physical_device_passthrough->bus,
+                                             self->physical_device_passthrough->dev,
+                                             self->physical_device_passthrough->fun,
+                                             hw_offset);
+            }
+            result_byte = hw_dword >> (((offset + i) & MASK(2)) * 8);
             break;
 
         case PCI_VDEVICE_MODE_FATAL_ERROR:
@@ -256,7 +289,7 @@ void libpci_vdevice_iowrite(libpci_vdevice_t* self, int offset, int size, uint32
     uint8_t* val_p = (uint8_t*) &val;
 
     /* Check for attempted access to extended PCI space. */
-    if ((offset + size) >= PCI_STD_HEADER_SIZEOF) {
+    if ((offset + size) > PCI_STD_HEADER_SIZEOF) {
         if (!self->allow_extended_pci_config_space) {
             printf("ERROR: device tried to access extended PCI config space offset %d, but "
                    "allow_extended_pci_config_space was disabled. This is most likely a "
@@ -274,15 +307,7 @@ void libpci_vdevice_iowrite(libpci_vdevice_t* self, int offset, int size, uint32
     }
 
     /* Special case handle the case when the entire range is under passthrough. */
-    bool passthrough_entire = true;
-    for (int i = 0; i < size; i++) {
-        libpci_vdevice_mode_t* m = &self->mode[offset + i];
-        if (m->mode != PCI_VDEVICE_MODE_PASSTHROUGH) {
-            passthrough_entire = false;
-            break;
-        }
-    }
-    if (passthrough_entire) {
+    if (self->passthrough_run[offset] >= size && (offset & (size - 1)) == 0) {
         assert(self->physical_device_passthrough);
         libpci_write_reg(self->physical_device_passthrough->bus,
                          self->physical_device_passthrough->dev,
@@ -291,14 +316,24 @@ void libpci_vdevice_iowrite(libpci_vdevice_t* self, int offset, int size, uint32
         return;
     }
 
-    /* Loop through each byte and handle accordingly. */
+    /* Loop through each byte and handle accordingly. Aligned pairs of passthrough bytes are
+     * written to the device in one access. Emulated bytes can't be covered by a wider write,
+     * as that would clobber whatever the real device holds in them. */
     for (int i = 0; i < size; i++) {
         libpci_vdevice_mode_t* m = &self->mode[offset + i];
 
         switch (m->mode) {
         case PCI_VDEVICE_MODE_PASSTHROUGH:
             assert(self->physical_device_passthrough);
-            printf("    writing 0x%x into offset %d (total val = 0x%x)\n", val_p[i], offset + i, val);
+            ZF_LOGD("    writing 0x%x into offset %d (total val = 0x%x)\n", val_p[i], offset + i, val);
+            if (i + 1 < size && self->passthrough_run[offset + i] >= 2 && ((offset + i) & 1) == 0) {
+                libpci_write_reg16(self->physical_device_passthrough->bus,
+                                   self->physical_device_passthrough->dev,
+                                   self->physical_device_passthrough->fun,
+                                   offset + i, val_p[i] | val_p[i + 1] << 8);
+                i++;
+                break;
+            }
             libpci_write_reg8(self->physical_device_passthrough->bus,
                               self->physical_device_passthrough->dev,
                               self->physical_device_passthrough->fun,
@@ -327,6 +362,7 @@ void libpci_vdevice_iowrite(libpci_vdevice_t* self, int offset, int size, uint32
 void libpci_vdevice_init(libpci_vdevice_t* vd) {
     assert(vd);
     memset(vd, 0, sizeof(libpci_vdevice_t));
+    libpci_vdevice_compile_runs(vd);
     vd->enable = libpci_vdevice_enable;
     vd->disable = libpci_vdevice_disable;
     vd->match = libpci_vdevice_match;
@@ -20,6 +20,57 @@
 #include <pci/virtual_device.h>
 #include <utils/zf_log.h>
 
+static inline uint16_t vpci_bdf(uint8_t bus, uint8_t dev, uint8_t fun) {
+    return (uint16_t)bus << 8 | (dev & MASK(5)) << 3 | (fun & MASK(3));
+}
+
+/* Find the dispatch entry for a location, or the empty slot where it would go. */
+static libpci_vpci_dispatch_t *vpci_dispatch_slot(libpci_virtual_pci_t* self, uint16_t bdf) {
+    /* Fibonacci hashing, as for the device list indices */
+    uint32_t i = (uint32_t)(bdf * 2654435761u) >> (32 - PCI_VPCI_DISPATCH_BITS);
+    libpci_vpci_dispatch_t *e = &self->dispatch[i];
+    while ((e->vdevice || e->allowed) && e->bdf != bdf) {
+        i = (i + 1) & MASK(PCI_VPCI_DISPATCH_BITS);
+        e = &self->dispatch[i];
+    }
+    return e;
+}
+
+static libpci_vpci_dispatch_t *vpci_dispatch_insert(libpci_virtual_pci_t* self, uint16_t bdf) {
+    libpci_vpci_dispatch_t *e = vpci_dispatch_slot(self, bdf);
+    e->bdf = bdf;
+    return e;
+}
+
+static inline libpci_vpci_dispatch_t *vpci_dispatch_lookup(libpci_virtual_pci_t* self, uint8_t bus,
+                                                           uint8_t dev, uint8_t fun) {
+    return vpci_dispatch_slot(self, vpci_bdf(bus, dev, fun));
+}
+
+void libpci_virtual_pci_rebuild(libpci_virtual_pci_t* self) {
+    assert(self);
+    memset(self->dispatch, 0, sizeof(self->dispatch));
+    self->custom_match = false;
+    for (uint32_t i = 0; i < self->num_allowed_devices; i++) {
+        libpci_passthrough_vdevice_t *pd = &self->allowed_devices[i];
+        if (pd->host_bus == PCI_HOST_BUS_INVALID) continue;
+        vpci_dispatch_insert(self, vpci_bdf(pd->host_bus, pd->host_dev, pd->host_fun))->allowed = true;
+    }
+    for (uint32_t i = 0; i < self->num_virtual_devices; i++) {
+        libpci_vdevice_t *vd = &self->virtual_devices[i];
+        if (vd->match != libpci_vdevice_match) {
+            self->custom_match = true;
+        }
+        if (!vd->enabled) continue;
+        libpci_vpci_dispatch_t *e =
+            vpci_dispatch_insert(self, vpci_bdf(vd->location_bus, vd->location_dev, vd->location_fun));
+        /* The first matching device wins, as it did when searching the list. */
+        if (e->vdevice == 0) {
+            e->vdevice = i + 1;
+        }
+    }
+}
+
 bool libpci_virtual_pci_device_allow(libpci_virtual_pci_t* self, libpci_device_t *device) {
     assert(self);
     if (!device) {
@@ -36,6 +87,7 @@ bool libpci_virtual_pci_device_allow(libpci_virtual_pci_t* self, libpci_device_t
     vd->host_dev = device->dev;
     vd->host_fun = device->fun;
     self->num_allowed_devices++;
+    vpci_dispatch_insert(self, vpci_bdf(device->bus, device->dev, device->fun))->allowed = true;
     return true;
 }
 
@@ -57,6 +109,7 @@ bool libpci_virtual_pci_device_disallow(libpci_virtual_pci_t* self, const libpci
             vd->host_dev == device->dev &&
             vd->host_fun == device->fun) {
             vd->host_bus = PCI_HOST_BUS_INVALID;
+            libpci_virtual_pci_rebuild(self);
             return true;
         }
     }
@@ -68,23 +121,16 @@ bool libpci_virtual_pci_device_device_check(libpci_virtual_pci_t* self, uint8_t
     if (self->override_allow_all_devices) {
         return true;
     }
-    for (uint32_t i = 0; i < self->num_allowed_devices; i++) {
-        libpci_passthrough_vdevice_t *vd = &self->allowed_devices[i];
-        if (vd->host_bus == PCI_HOST_BUS_INVALID) continue;
-        if (vd->host_bus == bus &&
-            vd->host_dev == dev &&
-            vd->host_fun == fun) {
-            return true;
-        }
-    }
-    return false;
+    return vpci_dispatch_lookup(self, bus, dev, fun)->allowed;
 }
 
 libpci_vdevice_t* libpci_virtual_pci_vdevice_assign(libpci_virtual_pci_t* self) {
     assert(self);
     assert(self->num_virtual_devices + 1 < PCI_MAX_VDEVICES);
-    libpci_vdevice_init(&self->virtual_devices[self->num_virtual_devices]);
-    return &self->virtual_devices[self->num_virtual_devices++];
+    libpci_vdevice_t *vd = &self->virtual_devices[self->num_virtual_devices++];
+    libpci_vdevice_init(vd);
+    vd->owner = self;
+    return vd;
 }
 
 void libpci_virtual_pci_vdevice_resign(libpci_virtual_pci_t* self, libpci_vdevice_t* vdev) {
@@ -97,13 +143,33 @@ void libpci_virtual_pci_vdevice_resign(libpci_virtual_pci_t* self, libpci_vdevic
 libpci_vdevice_t* libpci_virtual_pci_vdevice_check(libpci_virtual_pci_t* self,
                                                    uint8_t bus, uint8_t dev, uint8_t fun) {
     assert(self);
-    for(uint32_t i = 0; i < self->num_virtual_devices; i++) {
-        libpci_vdevice_t *vd = &self->virtual_devices[i];
-        if (vd->match(vd, bus, dev, fun)) {
-            return vd;
+    if (self->custom_match) {
+        /* The table only knows where devices are located, so let the callbacks decide. */
+        for (uint32_t i = 0; i < self->num_virtual_devices; i++) {
+            libpci_vdevice_t *vd = &self->virtual_devices[i];
+            if (vd->match(vd, bus, dev, fun)) {
+                return vd;
+            }
         }
+        return NULL;
     }
-    return NULL;
+    libpci_vpci_dispatch_t *e = vpci_dispatch_lookup(self, bus, dev, fun);
+    return e->vdevice ? &self->virtual_devices[e->vdevice - 1] : NULL;
+}
+
+/* Whether a data port access to a passthrough device is a config access the accessors can
+ * perform: the enable bit of the address must be set, as it must be for the hardware to do a
+ * config cycle, and the access must be naturally aligned within the data port. */
+static bool passthrough_access_valid(libpci_virtual_pci_t* self, uint32_t port_no, uint32_t size) {
+    if (size != 1 && size != 2 && size != 4) {
+        ZF_LOGD("vpci WARNING: port_no 0x%x size %d invalid.\n", port_no, size);
+        return false;
+    }
+    if ((port_no - PCI_CONF_PORT_DATA) % size != 0) {
+        ZF_LOGD("vpci WARNING: port_no 0x%x size %d unaligned.\n", port_no, size);
+        return false;
+    }
+    return (self->current_addr & BIT(31)) != 0;
 }
 
 int libpci_virtual_pci_ioread(libpci_virtual_pci_t* self, uint32_t port_no, uint32_t* val, uint32_t size) {
@@ -144,10 +210,14 @@ int libpci_virtual_pci_ioread(libpci_virtual_pci_t* self, uint32_t port_no, uint
         return 0;
     }
 
-    // Address is allowed. Perform normal ioread.
-    libpci_out32(PCI_CONF_PORT_ADDR, self->current_addr);
-    int ret = libpci_ioread(port_no, val, size);
-    return ret;
+    // Address is allowed. Perform a normal config read, which goes through ECAM where the bus
+    // has a region.
+    if (!passthrough_access_valid(self, port_no, size)) {
+        *val = PCI_INVALID_READ_VALUE;
+        return size == 1 || size == 2 || size == 4 ? 0 : 1;
+    }
+    *val = libpci_read_reg(bus, dev, fun, (reg & ~MASK(2)) + (port_no - PCI_CONF_PORT_DATA), size);
+    return 0;
 }
 
 int libpci_virtual_pci_iowrite(libpci_virtual_pci_t* self, uint32_t port_no, uint32_t val, uint32_t size) {
@@ -184,10 +254,13 @@ int libpci_virtual_pci_iowrite(libpci_virtual_pci_t* self, uint32_t port_no, uin
         return 0;
     }
 
-    // Address is allowed. Perform normal iowrite.
-    libpci_out32(PCI_CONF_PORT_ADDR, self->current_addr);
-    int ret = libpci_iowrite(port_no, val, size);
-    return ret;
+    // Address is allowed. Perform a normal config write, which goes through ECAM where the bus
+    // has a region.
+    if (!passthrough_access_valid(self, port_no, size)) {
+        return size == 1 || size == 2 || size == 4 ? 0 : 1;
+    }
+    libpci_write_reg(bus, dev, fun, (reg & ~MASK(2)) + (port_no - PCI_CONF_PORT_DATA), val, size);
+    return 0;
 }
 
 void libpci_virtual_pci_init(libpci_virtual_pci_t* vp) {
@@ -198,6 +271,8 @@ void libpci_virtual_pci_init(libpci_virtual_pci_t* vp) {
     vp->num_virtual_devices = 0;
     vp->override_allow_all_devices = false;
     vp->current_addr = PCI_INVALID_READ_VALUE;
+    memset(vp->dispatch, 0, sizeof(vp->dispatch));
+    vp->custom_match = false;
 
     /* connect interface */
     vp->device_allow = libpci_virtual_pci_device_allow;
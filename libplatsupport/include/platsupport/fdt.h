@@ -0,0 +1,82 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the BSD 2-Clause license. Note that NO WARRANTY is provided.
+ * See "LICENSE_BSD2.txt" for details.
+ *
+ * @TAG(DATA61_BSD)
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <platsupport/io.h>
+#include <platsupport/irq.h>
+#include <platsupport/pmem.h>
+
+/*
+ * Device tree probing. Drivers find their device in the FDT provided through
+ * ps_io_fdt_t rather than with the addresses and interrupts compiled in for
+ * the platform, so one image can run on board variants and leave out devices
+ * that a board doesn't have.
+ *
+ * The resources of a node are resolved once and cached, so repeated probes
+ * (e.g. from ltimer_default_describe and then ltimer_default_init) are cheap.
+ * The FDT must therefore not be modified once it has been probed.
+ */
+
+#define PS_FDT_MAX_REGS     4
+#define PS_FDT_MAX_IRQS     4
+#define PS_FDT_MAX_CLOCKS   4
+
+typedef struct ps_fdt_clock {
+    /* phandle of the clock controller */
+    uint32_t provider;
+    /* first cell of the clock specifier, 0 if the controller has none */
+    uint32_t id;
+} ps_fdt_clock_t;
+
+typedef struct ps_fdt_dev {
+    /* offset of the device node in the FDT */
+    int node;
+    /* 'reg' translated to physical addresses */
+    size_t num_regs;
+    pmem_region_t regs[PS_FDT_MAX_REGS];
+    /* 'interrupts' or 'interrupts-extended'. For GIC interrupts the number is
+     * the interrupt ID, with SPIs starting at 32 */
+    size_t num_irqs;
+    ps_irq_t irqs[PS_FDT_MAX_IRQS];
+    size_t num_clocks;
+    ps_fdt_clock_t clocks[PS_FDT_MAX_CLOCKS];
+} ps_fdt_dev_t;
+
+/**
+ * Find a device by compatible string and resolve its resources
+ *
+ * @param ops         I/O operations providing the FDT, and memory for an index
+ *                    of the FDT if malloc is implemented
+ * @param compatible  Compatible string of the device
+ * @param instance    Which of the nodes with that compatible string to use,
+ *                    counting in tree order, disabled nodes included
+ * @param dev         Filled in with the resources of the device
+ *
+ * @return            0 on success, ENOSYS if ops does not provide an FDT,
+ *                    ENODEV if the node does not exist or is disabled, EINVAL
+ *                    if the FDT or the node's properties are malformed
+ */
+int ps_fdt_probe(const ps_io_ops_t *ops, const char *compatible, int instance, ps_fdt_dev_t *dev);
+
+/**
+ * Like ps_fdt_probe, but for the device at a path or alias
+ */
+int ps_fdt_probe_path(const ps_io_ops_t *ops, const char *path, ps_fdt_dev_t *dev);
+
+/**
+ * Probe the device named by stdout-path in /chosen, ignoring any options
+ * after a ':'
+ */
+int ps_fdt_probe_stdout(const ps_io_ops_t *ops, ps_fdt_dev_t *dev);
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the BSD 2-Clause license. Note that NO WARRANTY is provided.
+ * See "LICENSE_BSD2.txt" for details.
+ *
+ * @TAG(DATA61_BSD)
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <platsupport/io.h>
+#include <platsupport/sync/spinlock.h>
+
+/*
+ * Slab allocator for fixed size objects, layered on a ps_malloc_ops_t.
+ *
+ * Each size class gets memory from the backing allocator one slab at a time
+ * and carves it into objects, which are kept on a free list threaded through
+ * the free objects themselves. Allocation and free are O(1). Requests larger
+ * than the biggest class are passed to the backing allocator.
+ *
+ * Optionally each CPU has a magazine of free objects per class, which it
+ * allocates from and frees to without taking the lock. Only when a magazine is
+ * empty or full is half of it exchanged with the shared free list. The CPU
+ * index comes from a callback, and each index must only be used by one thread
+ * at a time (e.g. one thread per core).
+ *
+ * Slabs are not returned to the backing allocator until ps_slab_destroy.
+ */
+
+#define PS_SLAB_MAX_CLASSES     8
+#define PS_SLAB_MAGAZINE_SIZE   16
+
+/* Alignment of every object, and granularity of the class sizes. */
+#define PS_SLAB_ALIGN           (2 * sizeof(void *))
+
+/* Returns the index of the CPU the caller is running on. */
+typedef int (*ps_slab_cpu_fn_t)(void *cookie);
+
+typedef struct ps_slab_config {
+    /* object sizes of the classes, in increasing order */
+    const size_t *sizes;
+    size_t num_sizes;
+    /* bytes requested from the backing allocator for each slab, 4K if 0 */
+    size_t slab_size;
+    /* number of CPUs to create magazines for, 0 to always use the lock */
+    int num_cpus;
+    ps_slab_cpu_fn_t cpu_fn;
+    void *cpu_cookie;
+} ps_slab_config_t;
+
+typedef struct ps_slab_magazine {
+    size_t count;
+    void *objs[PS_SLAB_MAGAZINE_SIZE];
+    /* allocations and frees through this magazine, for statistics */
+    size_t allocs;
+    size_t frees;
+    size_t bytes_allocated;
+    size_t bytes_freed;
+} ps_slab_magazine_t;
+
+typedef struct ps_slab_class {
+    size_t obj_size;
+    size_t objs_per_slab;
+    /* free objects not in any magazine */
+    void *free_list;
+    /* slabs of this class, linked through their first word */
+    void *slabs;
+    size_t num_slabs;
+    /* allocations and frees through the lock */
+    size_t allocs;
+    size_t frees;
+    size_t bytes_allocated;
+    size_t bytes_freed;
+} ps_slab_class_t;
+
+typedef struct ps_slab {
+    ps_malloc_ops_t backing;
+    size_t slab_size;
+    int num_classes;
+    ps_slab_class_t classes[PS_SLAB_MAX_CLASSES];
+    /* num_cpus * num_classes magazines, indexed by cpu * num_classes + class */
+    ps_slab_magazine_t *magazines;
+    int num_cpus;
+    ps_slab_cpu_fn_t cpu_fn;
+    void *cpu_cookie;
+    /* live allocations passed to the backing allocator */
+    size_t large_allocs;
+    size_t large_bytes;
+    sync_spinlock_t lock;
+} ps_slab_t;
+
+typedef struct ps_slab_class_stats {
+    size_t obj_size;
+    size_t slabs;
+    /* objects the slabs hold, and how many of them are allocated */
+    size_t objs_total;
+    size_t objs_in_use;
+    /* sum of the sizes requested for the objects in use. The internal
+     * fragmentation of the class is objs_in_use * obj_size - bytes_in_use */
+    size_t bytes_in_use;
+} ps_slab_class_stats_t;
+
+typedef struct ps_slab_stats {
+    int num_classes;
+    ps_slab_class_stats_t classes[PS_SLAB_MAX_CLASSES];
+    /* memory held from the backing allocator for slabs */
+    size_t slab_bytes;
+    /* live allocations too large for any class */
+    size_t large_allocs;
+    size_t large_bytes;
+} ps_slab_stats_t;
+
+/**
+ * Initialise a slab allocator
+ *
+ * @param slab     Allocator to initialise.
+ * @param backing  Allocator to get slabs (and magazines) from. Copied.
+ * @param config   Size classes and magazine configuration.
+ *
+ * @return 0 on success, EINVAL if the configuration is invalid, or the error
+ *         of the backing allocator.
+ */
+int ps_slab_init(ps_slab_t *slab, const ps_malloc_ops_t *backing, const ps_slab_config_t *config);
+
+/**
+ * Return all slabs and magazines to the backing allocator. Large allocations
+ * that are still live are not freed.
+ */
+void ps_slab_destroy(ps_slab_t *slab);
+
+/**
+ * Allocate an object of at least size bytes
+ *
+ * @return 0 on success, EINVAL if ptr is NULL or size is 0, or ENOMEM.
+ */
+int ps_slab_alloc(ps_slab_t *slab, size_t size, void **ptr);
+
+/**
+ * Free an object. size must be the size it was allocated with, as it picks
+ * the class the object is returned to.
+ */
+int ps_slab_free(ps_slab_t *slab, size_t size, void *ptr);
+
+/**
+ * Get occupancy and fragmentation statistics. When magazines are in use, this
+ * is a snapshot that may be slightly out of date for other CPUs.
+ */
+int ps_slab_get_stats(ps_slab_t *slab, ps_slab_stats_t *stats);
+
+/**
+ * Populate a malloc ops that allocates from the slab, which can be passed to
+ * anything that takes a ps_malloc_ops_t.
+ *
+ * Callers of ps_free don't always pass the size they allocated, so each object
+ * allocated this way carries a PS_SLAB_ALIGN byte header recording its size,
+ * and the size given to free is ignored.
+ */
+int ps_slab_malloc_ops(ps_slab_t *slab, ps_malloc_ops_t *ops);
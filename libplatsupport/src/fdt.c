@@ -0,0 +1,426 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the BSD 2-Clause license. Note that NO WARRANTY is provided.
+ * See "LICENSE_BSD2.txt" for details.
+ *
+ * @TAG(DATA61_BSD)
+ */
+
+#include <string.h>
+#include <libfdt.h>
+#include <platsupport/fdt.h>
+#include <utils/util.h>
+
+/* Number of resolved device nodes that are remembered */
+#define PS_FDT_CACHE_SIZE 16
+
+static struct {
+    const void *fdt;
+    ps_fdt_dev_t dev;
+} cache[PS_FDT_CACHE_SIZE];
+static int cache_next;
+
+/* The libfdt lookup index, for the most recently probed FDT only. It is
+ * replaced when another FDT is probed, so it doesn't hold on to one of
+ * libfdt's index slots or its memory for a blob that is no longer used */
+static struct {
+    const void *fdt;
+    void *buf;
+    int size;
+    ps_malloc_ops_t malloc_ops;
+} fdt_index;
+
+static const char *gic_compatibles[] = {
+    "arm,gic-400",
+    "arm,gic-v3",
+    "arm,cortex-a15-gic",
+    "arm,cortex-a9-gic",
+    "arm,cortex-a7-gic",
+};
+
+static uint64_t read_cells(const fdt32_t *cells, int n)
+{
+    uint64_t val = 0;
+    for (int i = 0; i < n; i++) {
+        val = (val << 32) | fdt32_to_cpu(cells[i]);
+    }
+    return val;
+}
+
+static int get_u32(const void *fdt, int node, const char *name, uint32_t *val)
+{
+    int len;
+    const fdt32_t *prop = fdt_getprop(fdt, node, name, &len);
+    if (prop == NULL || len != sizeof(*prop)) {
+        return EINVAL;
+    }
+    *val = fdt32_to_cpu(*prop);
+    return 0;
+}
+
+static void drop_index(void)
+{
+    if (fdt_index.buf == NULL) {
+        return;
+    }
+    fdt_index_detach(fdt_index.fdt);
+    ps_free(&fdt_index.malloc_ops, fdt_index.size, fdt_index.buf);
+    fdt_index.fdt = NULL;
+    fdt_index.buf = NULL;
+}
+
+static void build_index(const void *fdt, const ps_io_ops_t *ops)
+{
+    ps_malloc_ops_t malloc_ops = ops->malloc_ops;
+    void *index;
+
+    if (fdt_index.fdt == fdt || malloc_ops.malloc == NULL || malloc_ops.free == NULL) {
+        return;
+    }
+    drop_index();
+
+    int size = fdt_index_size(fdt);
+    if (size < 0 || ps_malloc(&malloc_ops, size, &index)) {
+        return;
+    }
+    /* the lookups work without it, just more slowly */
+    if (fdt_index_init(fdt, index, size)) {
+        ps_free(&malloc_ops, size, index);
+        return;
+    }
+    fdt_index.fdt = fdt;
+    fdt_index.buf = index;
+    fdt_index.size = size;
+    fdt_index.malloc_ops = malloc_ops;
+}
+
+static int get_fdt(const ps_io_ops_t *ops, const void **fdtp)
+{
+    ps_io_fdt_t io_fdt = ops->io_fdt;
+
+    /* Not having an FDT is not an error, the caller falls back to the
+     * platform's defaults */
+    if (io_fdt.get_fn == NULL) {
+        return ENOSYS;
+    }
+    const void *fdt = ps_io_fdt_get(&io_fdt);
+    if (fdt == NULL) {
+        return ENOSYS;
+    }
+    if (fdt_check_header(fdt)) {
+        ZF_LOGE("Invalid FDT");
+        return EINVAL;
+    }
+
+    build_index(fdt, ops);
+    *fdtp = fdt;
+    return 0;
+}
+
+static bool node_enabled(const void *fdt, int node)
+{
+    const char *status = fdt_getprop(fdt, node, "status", NULL);
+    return status == NULL || strcmp(status, "okay") == 0 || strcmp(status, "ok") == 0;
+}
+
+/* Translate an address on the bus of 'bus' to a physical address, through the
+ * 'ranges' of every bus up to the root */
+static int translate_address(const void *fdt, int bus, uint64_t *addr)
+{
+    while (bus != 0) {
+        int parent = fdt_parent_offset(fdt, bus);
+        int len;
+        const fdt32_t *ranges = fdt_getprop(fdt, bus, "ranges", &len);
+        if (parent < 0 || ranges == NULL) {
+            ZF_LOGE("%s has no ranges to translate through", fdt_get_name(fdt, bus, NULL));
+            return EINVAL;
+        }
+
+        if (len > 0) {
+            int child_cells = fdt_address_cells(fdt, bus);
+            int parent_cells = fdt_address_cells(fdt, parent);
+            int size_cells = fdt_size_cells(fdt, bus);
+            if (child_cells < 1 || child_cells > 2 || parent_cells < 1 || parent_cells > 2
+                || size_cells < 0 || size_cells > 2) {
+                return EINVAL;
+            }
+
+            int entry_cells = child_cells + parent_cells + size_cells;
+            int n = len / (entry_cells * sizeof(*ranges));
+            int i;
+            for (i = 0; i < n; i++, ranges += entry_cells) {
+                uint64_t child = read_cells(ranges, child_cells);
+                uint64_t size = read_cells(ranges + child_cells + parent_cells, size_cells);
+                if (*addr >= child && *addr - child < size) {
+                    *addr = read_cells(ranges + child_cells, parent_cells) + (*addr - child);
+                    break;
+                }
+            }
+            if (i == n) {
+                ZF_LOGE("Address %"PRIx64" is outside the ranges of %s", *addr,
+                        fdt_get_name(fdt, bus, NULL));
+                return EINVAL;
+            }
+        }
+        /* empty ranges map the child bus one to one */
+        bus = parent;
+    }
+    return 0;
+}
+
+static int resolve_regs(const void *fdt, int node, ps_fdt_dev_t *dev)
+{
+    int len;
+    const fdt32_t *reg = fdt_getprop(fdt, node, "reg", &len);
+    if (reg == NULL) {
+        return 0;
+    }
+
+    int parent = fdt_parent_offset(fdt, node);
+    if (parent < 0) {
+        return EINVAL;
+    }
+    int addr_cells = fdt_address_cells(fdt, parent);
+    int size_cells = fdt_size_cells(fdt, parent);
+    if (addr_cells < 1 || addr_cells > 2 || size_cells < 0 || size_cells > 2) {
+        ZF_LOGE("Unsupported reg format for %s", fdt_get_name(fdt, node, NULL));
+        return EINVAL;
+    }
+
+    int n = len / ((addr_cells + size_cells) * sizeof(*reg));
+    for (int i = 0; i < n && dev->num_regs < PS_FDT_MAX_REGS; i++) {
+        uint64_t addr = read_cells(reg, addr_cells);
+        uint64_t size = read_cells(reg + addr_cells, size_cells);
+        reg += addr_cells + size_cells;
+
+        int error = translate_address(fdt, parent, &addr);
+        if (error) {
+            return error;
+        }
+        dev->regs[dev->num_regs++] = (pmem_region_t) {
+            .type = PMEM_TYPE_DEVICE,
+            .base_addr = addr,
+            .length = size
+        };
+    }
+    return 0;
+}
+
+static int interrupt_parent(const void *fdt, int node)
+{
+    uint32_t phandle;
+
+    while (node >= 0) {
+        if (get_u32(fdt, node, "interrupt-parent", &phandle) == 0) {
+            return fdt_node_offset_by_phandle(fdt, phandle);
+        }
+        node = fdt_parent_offset(fdt, node);
+    }
+    return node;
+}
+
+static bool is_gic(const void *fdt, int node)
+{
+    for (int i = 0; i < ARRAY_SIZE(gic_compatibles); i++) {
+        if (fdt_node_check_compatible(fdt, node, gic_compatibles[i]) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void decode_irq(const void *fdt, int controller, const fdt32_t *cells, int ncells, ps_irq_t *irq)
+{
+    long number = fdt32_to_cpu(cells[0]);
+    uint32_t flags = ncells > 1 ? fdt32_to_cpu(cells[1]) : 0;
+
+    /* GIC specifiers are <type number flags>, with type 0 for SPIs and 1 for
+     * PPIs, which start at interrupt ID 32 and 16 respectively */
+    if (ncells >= 3 && is_gic(fdt, controller)) {
+        number = fdt32_to_cpu(cells[1]) + (fdt32_to_cpu(cells[0]) == 0 ? 32 : 16);
+        flags = fdt32_to_cpu(cells[2]);
+    }
+
+    /* IRQ_TYPE_EDGE_RISING and IRQ_TYPE_EDGE_FALLING */
+    if (flags & 0x3) {
+        irq->type = PS_TRIGGER;
+        irq->trigger.number = number;
+        irq->trigger.trigger = 1;
+    } else {
+        irq->type = PS_INTERRUPT;
+        irq->irq.number = number;
+    }
+}
+
+static int resolve_irqs(const void *fdt, int node, ps_fdt_dev_t *dev)
+{
+    uint32_t ncells;
+    int controller, len;
+
+    /* interrupts-extended gives the controller for every interrupt */
+    const fdt32_t *prop = fdt_getprop(fdt, node, "interrupts-extended", &len);
+    if (prop != NULL) {
+        const fdt32_t *end = prop + len / sizeof(*prop);
+        while (prop < end && dev->num_irqs < PS_FDT_MAX_IRQS) {
+            controller = fdt_node_offset_by_phandle(fdt, fdt32_to_cpu(*prop++));
+            if (controller < 0 || get_u32(fdt, controller, "#interrupt-cells", &ncells)
+                || ncells < 1 || end - prop < ncells) {
+                ZF_LOGE("Bad interrupts-extended in %s", fdt_get_name(fdt, node, NULL));
+                return EINVAL;
+            }
+            decode_irq(fdt, controller, prop, ncells, &dev->irqs[dev->num_irqs++]);
+            prop += ncells;
+        }
+        return 0;
+    }
+
+    prop = fdt_getprop(fdt, node, "interrupts", &len);
+    if (prop == NULL) {
+        return 0;
+    }
+    controller = interrupt_parent(fdt, node);
+    if (controller < 0 || get_u32(fdt, controller, "#interrupt-cells", &ncells) || ncells < 1) {
+        ZF_LOGE("No interrupt controller for %s", fdt_get_name(fdt, node, NULL));
+        return EINVAL;
+    }
+    int n = len / (ncells * sizeof(*prop));
+    for (int i = 0; i < n && dev->num_irqs < PS_FDT_MAX_IRQS; i++) {
+        decode_irq(fdt, controller, prop + i * ncells, ncells, &dev->irqs[dev->num_irqs++]);
+    }
+    return 0;
+}
+
+static int resolve_clocks(const void *fdt, int node, ps_fdt_dev_t *dev)
+{
+    uint32_t ncells;
+    int len;
+
+    const fdt32_t *prop = fdt_getprop(fdt, node, "clocks", &len);
+    if (prop == NULL) {
+        return 0;
+    }
+    const fdt32_t *end = prop + len / sizeof(*prop);
+    while (prop < end && dev->num_clocks < PS_FDT_MAX_CLOCKS) {
+        uint32_t phandle = fdt32_to_cpu(*prop++);
+        int provider = fdt_node_offset_by_phandle(fdt, phandle);
+        if (provider < 0 || get_u32(fdt, provider, "#clock-cells", &ncells) || end - prop < ncells) {
+            ZF_LOGE("Bad clocks in %s", fdt_get_name(fdt, node, NULL));
+            return EINVAL;
+        }
+        dev->clocks[dev->num_clocks++] = (ps_fdt_clock_t) {
+            .provider = phandle,
+            .id = ncells ? fdt32_to_cpu(*prop) : 0
+        };
+        prop += ncells;
+    }
+    return 0;
+}
+
+static int probe_node(const void *fdt, int node, ps_fdt_dev_t *dev)
+{
+    if (node == -FDT_ERR_NOTFOUND) {
+        return ENODEV;
+    } else if (node < 0) {
+        ZF_LOGE("FDT lookup failed: %s", fdt_strerror(node));
+        return EINVAL;
+    }
+    if (!node_enabled(fdt, node)) {
+        return ENODEV;
+    }
+
+    for (int i = 0; i < PS_FDT_CACHE_SIZE; i++) {
+        if (cache[i].fdt == fdt && cache[i].dev.node == node) {
+            *dev = cache[i].dev;
+            return 0;
+        }
+    }
+
+    memset(dev, 0, sizeof(*dev));
+    dev->node = node;
+    int error = resolve_regs(fdt, node, dev);
+    if (!error) {
+        error = resolve_irqs(fdt, node, dev);
+    }
+    if (!error) {
+        error = resolve_clocks(fdt, node, dev);
+    }
+    if (error) {
+        return error;
+    }
+
+    cache[cache_next].fdt = fdt;
+    cache[cache_next].dev = *dev;
+    cache_next = (cache_next + 1) % PS_FDT_CACHE_SIZE;
+    return 0;
+}
+
+int ps_fdt_probe(const ps_io_ops_t *ops, const char *compatible, int instance, ps_fdt_dev_t *dev)
+{
+    const void *fdt;
+    int node = -1;
+
+    if (ops == NULL || compatible == NULL || dev == NULL || instance < 0) {
+        return EINVAL;
+    }
+    int error = get_fdt(ops, &fdt);
+    if (error) {
+        return error;
+    }
+
+    /* -1 starts the search at the root, so stop at the first negative result
+     * rather than letting -FDT_ERR_NOTFOUND start it again */
+    for (int i = 0; i <= instance; i++) {
+        node = fdt_node_offset_by_compatible(fdt, node, compatible);
+        if (node < 0) {
+            break;
+        }
+    }
+    return probe_node(fdt, node, dev);
+}
+
+int ps_fdt_probe_path(const ps_io_ops_t *ops, const char *path, ps_fdt_dev_t *dev)
+{
+    const void *fdt;
+
+    if (ops == NULL || path == NULL || dev == NULL) {
+        return EINVAL;
+    }
+    int error = get_fdt(ops, &fdt);
+    if (error) {
+        return error;
+    }
+
+    int node = fdt_path_offset(fdt, path);
+    return probe_node(fdt, node == -FDT_ERR_BADPATH ? -FDT_ERR_NOTFOUND : node, dev);
+}
+
+int ps_fdt_probe_stdout(const ps_io_ops_t *ops, ps_fdt_dev_t *dev)
+{
+    const void *fdt;
+    int len;
+
+    if (ops == NULL || dev == NULL) {
+        return EINVAL;
+    }
+    int error = get_fdt(ops, &fdt);
+    if (error) {
+        return error;
+    }
+
+    int chosen = fdt_path_offset(fdt, "/chosen");
+    const char *path = fdt_getprop(fdt, chosen, "stdout-path", &len);
+    if (path == NULL) {
+        path = fdt_getprop(fdt, chosen, "linux,stdout-path", &len);
+    }
+    if (path == NULL || len < 1) {
+        return ENODEV;
+    }
+
+    const char *options = memchr(path, ':', len);
+    int node = fdt_path_offset_namelen(fdt, path, options ? options - path : strnlen(path, len));
+    return probe_node(fdt, node == -FDT_ERR_BADPATH ? -FDT_ERR_NOTFOUND : node, dev);
+}
@@ -18,6 +18,7 @@
 #include "../../chardev.h"
 #include "../../common.h"
 #include <utils/util.h>
+#include <platsupport/fdt.h>
 
 #include "../../chardev.h"
 
@@ -41,12 +42,41 @@ static const struct dev_defn dev_defn[] = {
     UART_DEFN(3),
 };
 
+static int uart_fdt_irqs[ARRAY_SIZE(dev_defn)][2];
+
+/* Take the address and interrupt of a UART from the device tree, if there is
+ * one, in which case UARTs that aren't in it are not touched */
+static int
+fdt_defn(struct dev_defn* defn, int n, const ps_io_ops_t* o)
+{
+    ps_fdt_dev_t dev;
+    int error = ps_fdt_probe(o, "arm,pl011", n, &dev);
+    if (error == ENOSYS) {
+        return 0;
+    }
+    if (error || dev.num_regs == 0) {
+        return -1;
+    }
+
+    defn->paddr = dev.regs[0].base_addr;
+    if (dev.num_irqs) {
+        uart_fdt_irqs[n][0] = dev.irqs[0].irq.number;
+        uart_fdt_irqs[n][1] = -1;
+        defn->irqs = uart_fdt_irqs[n];
+    }
+    return 0;
+}
+
 struct ps_chardevice*
 ps_cdev_init(enum chardev_id id, const ps_io_ops_t* o, struct ps_chardevice* d) {
     unsigned int i;
     for (i = 0; i < ARRAY_SIZE(dev_defn); i++) {
         if (dev_defn[i].id == id) {
-            return (dev_defn[i].init_fn(dev_defn + i, o, d)) ? NULL : d;
+            struct dev_defn defn = dev_defn[i];
+            if (fdt_defn(&defn, i, o)) {
+                return NULL;
+            }
+            return (defn.init_fn(&defn, o, d)) ? NULL : d;
         }
     }
     return NULL;
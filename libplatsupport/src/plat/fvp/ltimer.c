@@ -18,6 +18,7 @@
 #include <platsupport/ltimer.h>
 #include <platsupport/plat/sp804.h>
 #include <platsupport/io.h>
+#include <platsupport/fdt.h>
 
 /*
  * We use two sp804 timers: one to keep track of an absolute time, the other for timeouts.
@@ -36,6 +37,37 @@ typedef struct {
     uint32_t high_bits;
 } fvp_ltimer_t;
 
+/* sp804s found in the device tree, if one was provided. The describe functions
+ * are called without any timer data, so these are kept here */
+static bool use_fdt;
+static ps_fdt_dev_t sp804_fdt[NUM_SP804_TIMERS];
+
+static int probe_fdt(ps_io_ops_t *ops)
+{
+    use_fdt = false;
+    for (int i = 0; i < NUM_SP804_TIMERS; i++) {
+        int error = ps_fdt_probe(ops, "arm,sp804", i, &sp804_fdt[i]);
+        if (error == ENOSYS) {
+            /* no device tree, use the compiled in addresses */
+            return 0;
+        }
+        if (!error && (sp804_fdt[i].num_regs == 0 || sp804_fdt[i].num_irqs == 0)) {
+            error = EINVAL;
+        }
+        if (error) {
+            ZF_LOGE("sp804 %d not available on this board", i);
+            return error;
+        }
+    }
+    use_fdt = true;
+    return 0;
+}
+
+static long timer_irq(int n)
+{
+    return use_fdt ? sp804_fdt[n].irqs[0].irq.number : sp804_get_irq(SP804_ID + n);
+}
+
 static size_t get_num_irqs(void *data)
 {
     /* one for each sp804 */
@@ -45,6 +77,10 @@ static size_t get_num_irqs(void *data)
 static int get_nth_irq(void *data, size_t n, ps_irq_t *irq)
 {
     assert(n < get_num_irqs(data));
+    if (use_fdt) {
+        *irq = sp804_fdt[n].irqs[0];
+        return 0;
+    }
     irq->type = PS_INTERRUPT;
     irq->irq.number = sp804_get_irq(SP804_ID + n);
     return 0;
@@ -58,6 +94,11 @@ static size_t get_num_pmems(void *data)
 
 static int get_nth_pmem(void *data, size_t n, pmem_region_t *region)
 {
+    if (use_fdt) {
+        *region = sp804_fdt[n].regs[0];
+        region->length = ROUND_UP(region->length, PAGE_SIZE_4K);
+        return 0;
+    }
     region->length = PAGE_SIZE_4K;
     region->base_addr = (uintptr_t) sp804_get_paddr(n);
     return 0;
@@ -80,9 +121,9 @@ static int get_time(void *data, uint64_t *time)
 int handle_irq(void *data, ps_irq_t *irq)
 {
     fvp_ltimer_t *fvp_ltimer = data;
-    if (irq->irq.number == sp804_get_irq(SP804_ID + TIMEOUT_SP804)) {
+    if (irq->irq.number == timer_irq(TIMEOUT_SP804)) {
         sp804_handle_irq(&fvp_ltimer->sp804s[TIMEOUT_SP804]);
-    } else if (irq->irq.number == sp804_get_irq(SP804_ID + TIMESTAMP_SP804)) {
+    } else if (irq->irq.number == timer_irq(TIMESTAMP_SP804)) {
         sp804_handle_irq(&fvp_ltimer->sp804s[TIMESTAMP_SP804]);
         fvp_ltimer->high_bits++;
     } else {
@@ -154,7 +195,10 @@ int ltimer_default_init(ltimer_t *ltimer, ps_io_ops_t ops)
         return EINVAL;
     }
 
-    ltimer_default_describe(ltimer, ops);
+    int error = ltimer_default_describe(ltimer, ops);
+    if (error) {
+        return error;
+    }
     ltimer->handle_irq = handle_irq;
     ltimer->get_time = get_time;
     ltimer->get_resolution = get_resolution;
@@ -162,7 +206,7 @@ int ltimer_default_init(ltimer_t *ltimer, ps_io_ops_t ops)
     ltimer->reset = reset;
     ltimer->destroy = destroy;
 
-    int error = ps_calloc(&ops.malloc_ops, 1, sizeof(fvp_ltimer_t), &ltimer->data);
+    error = ps_calloc(&ops.malloc_ops, 1, sizeof(fvp_ltimer_t), &ltimer->data);
     if (error) {
         return error;
     }
@@ -232,5 +276,5 @@ int ltimer_default_describe(ltimer_t *ltimer, ps_io_ops_t ops)
     ltimer->get_nth_irq = get_nth_irq;
     ltimer->get_num_pmems = get_num_pmems;
     ltimer->get_nth_pmem = get_nth_pmem;
-    return 0;
+    return probe_fdt(&ops);
 }
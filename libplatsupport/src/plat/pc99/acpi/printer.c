@@ -222,8 +222,8 @@ print_mcfg_desc(acpi_mcfg_desc_t* mcfg_desc)
     printf("<PCI Device Description %p>\n", mcfg_desc);
     printf("Address: 0x%016lx\n", (unsigned long)mcfg_desc->address);
     printf("Segment 0x%04x\n", mcfg_desc->segment);
-    printf("Bus 0x%02x - 0x%02x\n", mcfg_desc->bus_end,
-           mcfg_desc->bus_start);
+    printf("Bus 0x%02x - 0x%02x\n", mcfg_desc->bus_start,
+           mcfg_desc->bus_end);
 }
 
 static void
@@ -15,9 +15,20 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <utils/ring.h>
+
+/*
+ * Characters are decoded by the interrupt handler and queued in a ring for the
+ * reader. Until the first interrupt has been handled, reads poll the
+ * controller directly.
+ */
+#define KEYBOARD_RING_SIZE 64
 
 static struct keyboard_state kb_state;
 static keycode_state_t kc_state;
+static ring_t kb_ring;
+static uint8_t kb_ring_data[KEYBOARD_RING_SIZE];
+static bool kb_irq_driven;
 
 void
 keyboard_cdev_handle_led_changed(void *cookie)
@@ -49,7 +60,14 @@ keyboard_read(ps_chardevice_t* d, void* vdata, size_t count, chardev_callback_t
     int ret;
     int i;
     char* data = (char*) vdata;
-    for (i = 0; i < count; i++) {
+
+    i = ring_spsc_dequeue(&kb_ring, data, count);
+    if (i == count || __atomic_load_n(&kb_irq_driven, __ATOMIC_RELAXED)) {
+        return i;
+    }
+    data += i;
+
+    for (; i < count; i++) {
         ret = keyboard_getchar(d);
         if (ret != EOF) {
             *data++ = ret;
@@ -63,7 +81,27 @@ keyboard_read(ps_chardevice_t* d, void* vdata, size_t count, chardev_callback_t
 static void
 keyboard_handle_irq(ps_chardevice_t* device UNUSED)
 {
-    /* No IRQ handling required here. */
+    uint8_t chunk[16];
+    size_t n = 0;
+    keyboard_key_event_t ev;
+
+    __atomic_store_n(&kb_irq_driven, true, __ATOMIC_RELAXED);
+
+    /* Stops at the prefix byte of a multi byte scancode, the rest of which
+     * raises another interrupt. */
+    while ((ev = keyboard_poll_ps2_keyevent(&kb_state)).vkey != -1) {
+        int c = keycode_process_vkey_event_to_char(&kc_state, ev.vkey, ev.pressed, NULL);
+        if (c < 0) {
+            continue;
+        }
+        chunk[n++] = c;
+        if (n == sizeof(chunk)) {
+            ring_spsc_enqueue(&kb_ring, chunk, n);
+            n = 0;
+        }
+    }
+    /* Keys that don't fit in the ring are dropped. */
+    ring_spsc_enqueue(&kb_ring, chunk, n);
 }
 
 int
@@ -80,6 +118,9 @@ keyboard_cdev_init(const struct dev_defn* defn, const ps_io_ops_t* ops, ps_chard
     dev->irqs       = defn->irqs;
     dev->ioops      = *ops;
 
+    kb_irq_driven = false;
+    ring_init(&kb_ring, kb_ring_data, KEYBOARD_RING_SIZE, 1);
+
     /* Initialise keyboard drivers. */
     if (keyboard_init(&kb_state, ops, NULL)) {
         return -1;
@@ -10,9 +10,12 @@
  * @TAG(DATA61_BSD)
  */
 
+#include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
+#include <assert.h>
 #include <utils/util.h>
+#include <utils/ring.h>
 
 #include "../../chardev.h"
 
@@ -41,6 +44,22 @@
 #define SERIAL_LSR_DATA_READY BIT(0)
 #define SERIAL_LSR_TRANSMITTER_EMPTY BIT(5)
 
+/*
+ * Received bytes are moved from the 16 byte FIFO of the UART into a ring by
+ * the interrupt handler, so input isn't lost while the reader is busy and the
+ * handler and reader can run concurrently. Until the first interrupt has been
+ * handled, reads poll the UART directly.
+ */
+#define SERIAL_RX_RING_SIZE 256
+
+struct uart_rx {
+    ring_t ring;
+    bool irq_driven;
+    uint8_t data[SERIAL_RX_RING_SIZE];
+};
+
+static struct uart_rx uart_rx[PC99_SERIAL_COM4 + 1];
+
 int uart_getchar(ps_chardevice_t *device)
 {
     uint32_t res;
@@ -97,24 +116,57 @@ int uart_putchar(ps_chardevice_t* device, int c)
     return c;
 }
 
-static void uart_handle_irq(ps_chardevice_t* device UNUSED)
+static void uart_handle_irq(ps_chardevice_t* device)
+{
+    struct uart_rx *rx = &uart_rx[device->id];
+    uint8_t chunk[16];
+    size_t n = 0;
+    int c;
+
+    __atomic_store_n(&rx->irq_driven, true, __ATOMIC_RELAXED);
+
+    /* Bytes that don't fit in the ring are dropped, as on a FIFO overrun. */
+    while ((c = uart_getchar(device)) != EOF) {
+        chunk[n++] = c;
+        if (n == sizeof(chunk)) {
+            ring_spsc_enqueue(&rx->ring, chunk, n);
+            n = 0;
+        }
+    }
+    ring_spsc_enqueue(&rx->ring, chunk, n);
+}
+
+static ssize_t
+serial_read(ps_chardevice_t* d, void* vdata, size_t count, chardev_callback_t rcb, void* token)
 {
-    /* No IRQ handling required here. */
+    struct uart_rx *rx = &uart_rx[d->id];
+    size_t n = ring_spsc_dequeue(&rx->ring, vdata, count);
+
+    if (n < count && !__atomic_load_n(&rx->irq_driven, __ATOMIC_RELAXED)) {
+        return n + uart_read(d, (char*) vdata + n, count - n, rcb, token);
+    }
+    return n;
 }
 
 int
 uart_init(const struct dev_defn* defn, const ps_io_ops_t* ops, ps_chardevice_t* dev)
 {
+    assert(defn->id < ARRAY_SIZE(uart_rx));
+
     memset(dev, 0, sizeof(*dev));
     /* Set up all the  device properties. */
     dev->id         = defn->id;
     dev->vaddr      = (void*) defn->paddr; /* Save the IO port base number. */
-    dev->read       = &uart_read;
+    dev->read       = &serial_read;
     dev->write      = &uart_write;
     dev->handle_irq = &uart_handle_irq;
     dev->irqs       = defn->irqs;
     dev->ioops      = *ops;
 
+    struct uart_rx *rx = &uart_rx[defn->id];
+    rx->irq_driven = false;
+    ring_init(&rx->ring, rx->data, SERIAL_RX_RING_SIZE, 1);
+
     /* Initialise the device. */
     uint32_t io_port = (uint32_t) (uintptr_t)dev->vaddr;
 
@@ -0,0 +1,340 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the BSD 2-Clause license. Note that NO WARRANTY is provided.
+ * See "LICENSE_BSD2.txt" for details.
+ *
+ * @TAG(DATA61_BSD)
+ */
+
+#include <string.h>
+#include <utils/util.h>
+#include <platsupport/slab.h>
+
+/* Each slab starts with a pointer to the next slab of its class, padded so
+ * that the objects after it are aligned. */
+#define SLAB_HEADER_SIZE ROUND_UP_UNSAFE(sizeof(void *), PS_SLAB_ALIGN)
+
+/* Magazines are refilled to, and flushed down to, half full. */
+#define MAGAZINE_BATCH (PS_SLAB_MAGAZINE_SIZE / 2)
+
+static int find_class(ps_slab_t *slab, size_t size)
+{
+    for (int i = 0; i < slab->num_classes; i++) {
+        if (size <= slab->classes[i].obj_size) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static ps_slab_magazine_t *get_magazine(ps_slab_t *slab, int cls)
+{
+    if (slab->magazines == NULL) {
+        return NULL;
+    }
+    int cpu = slab->cpu_fn(slab->cpu_cookie);
+    if (cpu < 0 || cpu >= slab->num_cpus) {
+        ZF_LOGE("CPU index %d out of range, using the lock", cpu);
+        return NULL;
+    }
+    return &slab->magazines[cpu * slab->num_classes + cls];
+}
+
+/* Get another slab for the class and put its objects on the free list. Called
+ * with the lock held. */
+static int grow(ps_slab_t *slab, ps_slab_class_t *class)
+{
+    char *mem;
+    int error = ps_malloc(&slab->backing, slab->slab_size, (void **) &mem);
+    if (error) {
+        return error;
+    }
+
+    *(void **) mem = class->slabs;
+    class->slabs = mem;
+    class->num_slabs++;
+
+    /* Push in reverse so the objects are handed out in address order. */
+    for (size_t i = class->objs_per_slab; i > 0; i--) {
+        void **obj = (void **)(mem + SLAB_HEADER_SIZE + (i - 1) * class->obj_size);
+        *obj = class->free_list;
+        class->free_list = obj;
+    }
+    return 0;
+}
+
+/* Take up to n objects off the free list, growing the class as needed. Called
+ * with the lock held. Returns how many were taken. */
+static size_t take(ps_slab_t *slab, ps_slab_class_t *class, void **objs, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; i++) {
+        if (class->free_list == NULL && grow(slab, class) != 0) {
+            break;
+        }
+        objs[i] = class->free_list;
+        class->free_list = *(void **) objs[i];
+    }
+    return i;
+}
+
+/* Put n objects on the free list. Called with the lock held. */
+static void give(ps_slab_class_t *class, void **objs, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        *(void **) objs[i] = class->free_list;
+        class->free_list = objs[i];
+    }
+}
+
+int ps_slab_init(ps_slab_t *slab, const ps_malloc_ops_t *backing, const ps_slab_config_t *config)
+{
+    if (slab == NULL || backing == NULL || config == NULL) {
+        ZF_LOGE("Arguments cannot be NULL");
+        return EINVAL;
+    }
+    if (config->num_sizes == 0 || config->num_sizes > PS_SLAB_MAX_CLASSES || config->sizes == NULL) {
+        ZF_LOGE("Between 1 and %d size classes are required", PS_SLAB_MAX_CLASSES);
+        return EINVAL;
+    }
+    if (config->num_cpus < 0 || (config->num_cpus > 0 && config->cpu_fn == NULL)) {
+        ZF_LOGE("Magazines need a CPU index function");
+        return EINVAL;
+    }
+
+    memset(slab, 0, sizeof(*slab));
+    slab->backing = *backing;
+    slab->slab_size = config->slab_size ? config->slab_size : PAGE_SIZE_4K;
+    slab->num_classes = config->num_sizes;
+
+    for (int i = 0; i < slab->num_classes; i++) {
+        ps_slab_class_t *class = &slab->classes[i];
+        if (config->sizes[i] == 0 || config->sizes[i] > slab->slab_size) {
+            ZF_LOGE("Size class %zu does not fit in a slab", config->sizes[i]);
+            return EINVAL;
+        }
+        class->obj_size = ROUND_UP(config->sizes[i], PS_SLAB_ALIGN);
+        if (i > 0 && class->obj_size <= slab->classes[i - 1].obj_size) {
+            ZF_LOGE("Size classes must increase by at least %zu bytes", PS_SLAB_ALIGN);
+            return EINVAL;
+        }
+        if (slab->slab_size < SLAB_HEADER_SIZE + class->obj_size) {
+            ZF_LOGE("Size class %zu does not fit in a slab", config->sizes[i]);
+            return EINVAL;
+        }
+        class->objs_per_slab = (slab->slab_size - SLAB_HEADER_SIZE) / class->obj_size;
+    }
+
+    if (config->num_cpus > 0) {
+        int error = ps_calloc(&slab->backing, config->num_cpus * slab->num_classes,
+                              sizeof(ps_slab_magazine_t), (void **) &slab->magazines);
+        if (error) {
+            ZF_LOGE("Failed to allocate magazines");
+            return error;
+        }
+        slab->num_cpus = config->num_cpus;
+        slab->cpu_fn = config->cpu_fn;
+        slab->cpu_cookie = config->cpu_cookie;
+    }
+
+    return sync_spinlock_init(&slab->lock);
+}
+
+void ps_slab_destroy(ps_slab_t *slab)
+{
+    for (int i = 0; i < slab->num_classes; i++) {
+        ps_slab_class_t *class = &slab->classes[i];
+        while (class->slabs != NULL) {
+            void *mem = class->slabs;
+            class->slabs = *(void **) mem;
+            ps_free(&slab->backing, slab->slab_size, mem);
+        }
+        class->num_slabs = 0;
+        class->free_list = NULL;
+    }
+    if (slab->magazines != NULL) {
+        ps_free(&slab->backing, slab->num_cpus * slab->num_classes * sizeof(ps_slab_magazine_t),
+                slab->magazines);
+        slab->magazines = NULL;
+    }
+    sync_spinlock_destroy(&slab->lock);
+}
+
+int ps_slab_alloc(ps_slab_t *slab, size_t size, void **ptr)
+{
+    if (slab == NULL || ptr == NULL || size == 0) {
+        ZF_LOGE("Invalid arguments");
+        return EINVAL;
+    }
+
+    int cls = find_class(slab, size);
+    if (cls < 0) {
+        int error = ps_malloc(&slab->backing, size, ptr);
+        if (!error) {
+            sync_spinlock_lock(&slab->lock);
+            slab->large_allocs++;
+            slab->large_bytes += size;
+            sync_spinlock_unlock(&slab->lock);
+        }
+        return error;
+    }
+
+    ps_slab_class_t *class = &slab->classes[cls];
+    ps_slab_magazine_t *mag = get_magazine(slab, cls);
+    if (mag != NULL) {
+        if (mag->count == 0) {
+            sync_spinlock_lock(&slab->lock);
+            mag->count = take(slab, class, mag->objs, MAGAZINE_BATCH);
+            sync_spinlock_unlock(&slab->lock);
+            if (mag->count == 0) {
+                return ENOMEM;
+            }
+        }
+        *ptr = mag->objs[--mag->count];
+        mag->allocs++;
+        mag->bytes_allocated += size;
+        return 0;
+    }
+
+    sync_spinlock_lock(&slab->lock);
+    size_t taken = take(slab, class, ptr, 1);
+    if (taken) {
+        class->allocs++;
+        class->bytes_allocated += size;
+    }
+    sync_spinlock_unlock(&slab->lock);
+    return taken ? 0 : ENOMEM;
+}
+
+int ps_slab_free(ps_slab_t *slab, size_t size, void *ptr)
+{
+    if (slab == NULL || ptr == NULL || size == 0) {
+        ZF_LOGE("Invalid arguments");
+        return EINVAL;
+    }
+
+    int cls = find_class(slab, size);
+    if (cls < 0) {
+        sync_spinlock_lock(&slab->lock);
+        slab->large_allocs--;
+        slab->large_bytes -= size;
+        sync_spinlock_unlock(&slab->lock);
+        return ps_free(&slab->backing, size, ptr);
+    }
+
+    ps_slab_class_t *class = &slab->classes[cls];
+    ps_slab_magazine_t *mag = get_magazine(slab, cls);
+    if (mag != NULL) {
+        if (mag->count == PS_SLAB_MAGAZINE_SIZE) {
+            sync_spinlock_lock(&slab->lock);
+            give(class, mag->objs + MAGAZINE_BATCH, PS_SLAB_MAGAZINE_SIZE - MAGAZINE_BATCH);
+            sync_spinlock_unlock(&slab->lock);
+            mag->count = MAGAZINE_BATCH;
+        }
+        mag->objs[mag->count++] = ptr;
+        mag->frees++;
+        mag->bytes_freed += size;
+        return 0;
+    }
+
+    sync_spinlock_lock(&slab->lock);
+    give(class, &ptr, 1);
+    class->frees++;
+    class->bytes_freed += size;
+    sync_spinlock_unlock(&slab->lock);
+    return 0;
+}
+
+int ps_slab_get_stats(ps_slab_t *slab, ps_slab_stats_t *stats)
+{
+    if (slab == NULL || stats == NULL) {
+        ZF_LOGE("Arguments cannot be NULL");
+        return EINVAL;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    stats->num_classes = slab->num_classes;
+
+    sync_spinlock_lock(&slab->lock);
+    for (int i = 0; i < slab->num_classes; i++) {
+        ps_slab_class_t *class = &slab->classes[i];
+        ps_slab_class_stats_t *cs = &stats->classes[i];
+        /* The counters only ever increase, so the differences come out right
+         * even when they have wrapped. */
+        size_t allocs = class->allocs;
+        size_t frees = class->frees;
+        size_t bytes_allocated = class->bytes_allocated;
+        size_t bytes_freed = class->bytes_freed;
+
+        for (int cpu = 0; cpu < slab->num_cpus; cpu++) {
+            ps_slab_magazine_t *mag = &slab->magazines[cpu * slab->num_classes + i];
+            allocs += mag->allocs;
+            frees += mag->frees;
+            bytes_allocated += mag->bytes_allocated;
+            bytes_freed += mag->bytes_freed;
+        }
+
+        cs->obj_size = class->obj_size;
+        cs->slabs = class->num_slabs;
+        cs->objs_total = class->num_slabs * class->objs_per_slab;
+        cs->objs_in_use = allocs - frees;
+        cs->bytes_in_use = bytes_allocated - bytes_freed;
+        stats->slab_bytes += class->num_slabs * slab->slab_size;
+    }
+    stats->large_allocs = slab->large_allocs;
+    stats->large_bytes = slab->large_bytes;
+    sync_spinlock_unlock(&slab->lock);
+
+    return 0;
+}
+
+/* The adapter keeps the size of each object in a header in front of it. */
+static int slab_ops_malloc(void *cookie, size_t size, void **ptr)
+{
+    size_t *hdr;
+    if (size > SIZE_MAX - PS_SLAB_ALIGN) {
+        return ENOMEM;
+    }
+    int error = ps_slab_alloc(cookie, size + PS_SLAB_ALIGN, (void **) &hdr);
+    if (error) {
+        return error;
+    }
+    *hdr = size + PS_SLAB_ALIGN;
+    *ptr = (char *) hdr + PS_SLAB_ALIGN;
+    return 0;
+}
+
+static int slab_ops_calloc(void *cookie, size_t nmemb, size_t size, void **ptr)
+{
+    if (size != 0 && nmemb > SIZE_MAX / size) {
+        return ENOMEM;
+    }
+    int error = slab_ops_malloc(cookie, nmemb * size, ptr);
+    if (!error) {
+        memset(*ptr, 0, nmemb * size);
+    }
+    return error;
+}
+
+static int slab_ops_free(void *cookie, UNUSED size_t size, void *ptr)
+{
+    size_t *hdr = (size_t *)((char *) ptr - PS_SLAB_ALIGN);
+    return ps_slab_free(cookie, *hdr, hdr);
+}
+
+int ps_slab_malloc_ops(ps_slab_t *slab, ps_malloc_ops_t *ops)
+{
+    if (slab == NULL || ops == NULL) {
+        ZF_LOGE("Arguments cannot be NULL");
+        return EINVAL;
+    }
+    ops->malloc = slab_ops_malloc;
+    ops->calloc = slab_ops_calloc;
+    ops->free = slab_ops_free;
+    ops->cookie = slab;
+    return 0;
+}
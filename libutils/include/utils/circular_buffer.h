@@ -13,6 +13,9 @@
 /**
  * @file circular_buffer.h
  * @brief A circular buffer implementation
+ *
+ * This buffer is not safe to share between an interrupt handler and a reader,
+ * or between cores. utils/ring.h provides lock-free rings with bulk operations.
  */
 
 #pragma once
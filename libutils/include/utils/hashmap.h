@@ -0,0 +1,200 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the BSD 2-Clause license. Note that NO WARRANTY is provided.
+ * See "LICENSE_BSD2.txt" for details.
+ *
+ * @TAG(DATA61_BSD)
+ */
+
+/* Open addressing hash map from integer (or pointer) keys to non-NULL values.
+ *
+ * Keys and values are stored inline in an array of slots provided by the
+ * caller, so lookups touch one or two cache lines and nothing is allocated. A
+ * slot is free when its value is NULL. Collisions are resolved by linear
+ * probing, and removal shifts later entries of the probe sequence back rather
+ * than leaving tombstones, so lookups never slow down with use.
+ *
+ * The number of slots must be a power of two and at least one slot is always
+ * kept free. Probe sequences get long as the map fills up, so size it for a
+ * load of 3/4 or less, and use hashmap_rehash to move to a bigger array when
+ * hashmap_put fails.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct hashmap_slot {
+    uintptr_t key;
+    void *value;
+} hashmap_slot_t;
+
+typedef struct {
+    hashmap_slot_t *slots;
+    size_t mask;
+    size_t count;
+} hashmap_t;
+
+/* Fibonacci hashing, which spreads keys that differ only in their upper or
+ * lower bits (such as aligned pointers) across the table.
+ */
+static inline size_t _hashmap_hash(const hashmap_t *m, uintptr_t key)
+{
+    uint64_t h = (uint64_t) key * UINT64_C(0x9e3779b97f4a7c15);
+    return (size_t)(h ^ (h >> 32)) & m->mask;
+}
+
+/* Create a new, empty map using the given slots. nslots must be a power of two
+ * of at least 2. Returns 0 on success.
+ */
+static inline int hashmap_init(hashmap_t *m, hashmap_slot_t *slots, size_t nslots)
+{
+    size_t i;
+    if (nslots < 2 || (nslots & (nslots - 1)) != 0) {
+        return -1;
+    }
+    for (i = 0; i < nslots; i++) {
+        slots[i].key = 0;
+        slots[i].value = NULL;
+    }
+    m->slots = slots;
+    m->mask = nslots - 1;
+    m->count = 0;
+    return 0;
+}
+
+/* Returns the number of entries in the map. */
+static inline size_t hashmap_count(const hashmap_t *m)
+{
+    return m->count;
+}
+
+/* Returns the number of slots of the map. */
+static inline size_t hashmap_capacity(const hashmap_t *m)
+{
+    return m->mask + 1;
+}
+
+static inline hashmap_slot_t *_hashmap_find(const hashmap_t *m, uintptr_t key)
+{
+    size_t i = _hashmap_hash(m, key);
+    while (m->slots[i].value != NULL) {
+        if (m->slots[i].key == key) {
+            return &m->slots[i];
+        }
+        i = (i + 1) & m->mask;
+    }
+    return &m->slots[i];
+}
+
+/* Returns the value for key, or NULL if the key isn't in the map. */
+static inline void *hashmap_get(const hashmap_t *m, uintptr_t key)
+{
+    return _hashmap_find(m, key)->value;
+}
+
+/* Returns true if the key is in the map. */
+static inline bool hashmap_exists(const hashmap_t *m, uintptr_t key)
+{
+    return hashmap_get(m, key) != NULL;
+}
+
+/* Set the value for key, replacing any existing value. value must not be NULL.
+ * Returns 0 on success, or -1 if the key is new and the map has no room.
+ */
+static inline int hashmap_put(hashmap_t *m, uintptr_t key, void *value)
+{
+    hashmap_slot_t *slot;
+    if (value == NULL) {
+        return -1;
+    }
+    slot = _hashmap_find(m, key);
+    if (slot->value == NULL) {
+        if (m->count + 1 >= hashmap_capacity(m)) {
+            return -1;
+        }
+        slot->key = key;
+        m->count++;
+    }
+    slot->value = value;
+    return 0;
+}
+
+/* Remove key from the map. Returns the value it had, or NULL if it wasn't in
+ * the map.
+ */
+static inline void *hashmap_remove(hashmap_t *m, uintptr_t key)
+{
+    hashmap_slot_t *slot = _hashmap_find(m, key);
+    void *value = slot->value;
+    size_t hole, i;
+
+    if (value == NULL) {
+        return NULL;
+    }
+    m->count--;
+
+    /* Move back any later entry of the run whose home slot is not between the
+     * hole and its current slot, so that it stays reachable from its home. */
+    hole = slot - m->slots;
+    i = hole;
+    for (;;) {
+        size_t home;
+        i = (i + 1) & m->mask;
+        if (m->slots[i].value == NULL) {
+            break;
+        }
+        home = _hashmap_hash(m, m->slots[i].key);
+        if (((i - home) & m->mask) >= ((i - hole) & m->mask)) {
+            m->slots[hole] = m->slots[i];
+            hole = i;
+        }
+    }
+    m->slots[hole].key = 0;
+    m->slots[hole].value = NULL;
+
+    return value;
+}
+
+/* Iterate over the entries of the map. Start with *iter set to 0, and each call
+ * returns the next occupied slot or NULL after the last one. The map must not
+ * be modified during the iteration.
+ */
+static inline hashmap_slot_t *hashmap_next(const hashmap_t *m, size_t *iter)
+{
+    while (*iter <= m->mask) {
+        hashmap_slot_t *slot = &m->slots[(*iter)++];
+        if (slot->value != NULL) {
+            return slot;
+        }
+    }
+    return NULL;
+}
+
+/* Move all entries of the map into a new array of slots, typically a bigger
+ * one once hashmap_put has failed. The old slots are no longer used after
+ * this. Returns 0 on success, or -1 if the entries don't fit.
+ */
+static inline int hashmap_rehash(hashmap_t *m, hashmap_slot_t *slots, size_t nslots)
+{
+    hashmap_t new_map;
+    size_t iter = 0;
+    hashmap_slot_t *slot;
+
+    if (nslots <= m->count || hashmap_init(&new_map, slots, nslots) != 0) {
+        return -1;
+    }
+    while ((slot = hashmap_next(m, &iter)) != NULL) {
+        hashmap_slot_t *dest = _hashmap_find(&new_map, slot->key);
+        *dest = *slot;
+        new_map.count++;
+    }
+    *m = new_map;
+    return 0;
+}
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the BSD 2-Clause license. Note that NO WARRANTY is provided.
+ * See "LICENSE_BSD2.txt" for details.
+ *
+ * @TAG(DATA61_BSD)
+ */
+
+/* Intrusive doubly-linked list. Unlike list_t, the links are embedded in the
+ * elements themselves, so nothing is allocated and every operation apart from
+ * ilist_length is O(1). An element can be on as many lists as it has
+ * ilist_node_t members.
+ *
+ * The list is circular through the head, so insertion and removal never need
+ * to special case the ends.
+ *
+ *     struct thing {
+ *         int value;
+ *         ilist_node_t link;
+ *     };
+ *
+ *     ilist_push_back(&things, &t->link);
+ *     ilist_foreach(&things, n) {
+ *         struct thing *t = ILIST_ENTRY(n, struct thing, link);
+ *     }
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct ilist_node {
+    struct ilist_node *next;
+    struct ilist_node *prev;
+} ilist_node_t;
+
+/* Type of a list. The head is a node that is never an element. */
+typedef struct {
+    ilist_node_t head;
+} ilist_t;
+
+/* Get the element that contains the given node. */
+#define ILIST_ENTRY(node, type, member) \
+    ((type *)((char *)(node) - offsetof(type, member)))
+
+/* Iterate over the nodes of the list. The current node must not be removed. */
+#define ilist_foreach(l, n) \
+    for ((n) = (l)->head.next; (n) != &(l)->head; (n) = (n)->next)
+
+/* Iterate over the nodes of the list, allowing the current node to be
+ * removed. tmp is another ilist_node_t pointer.
+ */
+#define ilist_foreach_safe(l, n, tmp) \
+    for ((n) = (l)->head.next, (tmp) = (n)->next; (n) != &(l)->head; \
+         (n) = (tmp), (tmp) = (n)->next)
+
+/* Create a new, empty list. */
+static inline void ilist_init(ilist_t *l)
+{
+    l->head.next = &l->head;
+    l->head.prev = &l->head;
+}
+
+/* Returns true if the given list contains no elements. */
+static inline bool ilist_is_empty(const ilist_t *l)
+{
+    return l->head.next == &l->head;
+}
+
+/* Insert node after pos, which is either an element or the head. */
+static inline void ilist_insert_after(ilist_node_t *pos, ilist_node_t *node)
+{
+    node->prev = pos;
+    node->next = pos->next;
+    pos->next->prev = node;
+    pos->next = node;
+}
+
+/* Insert node before pos, which is either an element or the head. */
+static inline void ilist_insert_before(ilist_node_t *pos, ilist_node_t *node)
+{
+    ilist_insert_after(pos->prev, node);
+}
+
+static inline void ilist_push_front(ilist_t *l, ilist_node_t *node)
+{
+    ilist_insert_after(&l->head, node);
+}
+
+static inline void ilist_push_back(ilist_t *l, ilist_node_t *node)
+{
+    ilist_insert_before(&l->head, node);
+}
+
+/* Remove the node from whichever list it is on. The list itself isn't needed,
+ * and the node's links are left pointing at itself so removing it again is
+ * harmless.
+ */
+static inline void ilist_remove(ilist_node_t *node)
+{
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    node->next = node;
+    node->prev = node;
+}
+
+/* Returns the first element, or NULL if the list is empty. */
+static inline ilist_node_t *ilist_first(const ilist_t *l)
+{
+    return ilist_is_empty(l) ? NULL : l->head.next;
+}
+
+/* Returns the last element, or NULL if the list is empty. */
+static inline ilist_node_t *ilist_last(const ilist_t *l)
+{
+    return ilist_is_empty(l) ? NULL : l->head.prev;
+}
+
+/* Returns the element after node, or NULL if node is the last element. */
+static inline ilist_node_t *ilist_next(const ilist_t *l, const ilist_node_t *node)
+{
+    return node->next == &l->head ? NULL : node->next;
+}
+
+/* Remove and return the first element, or NULL if the list is empty. */
+static inline ilist_node_t *ilist_pop_front(ilist_t *l)
+{
+    ilist_node_t *node = ilist_first(l);
+    if (node != NULL) {
+        ilist_remove(node);
+    }
+    return node;
+}
+
+/* Remove and return the last element, or NULL if the list is empty. */
+static inline ilist_node_t *ilist_pop_back(ilist_t *l)
+{
+    ilist_node_t *node = ilist_last(l);
+    if (node != NULL) {
+        ilist_remove(node);
+    }
+    return node;
+}
+
+/* Move all elements of from to the end of l, leaving from empty. */
+static inline void ilist_splice_back(ilist_t *l, ilist_t *from)
+{
+    if (ilist_is_empty(from)) {
+        return;
+    }
+    from->head.next->prev = l->head.prev;
+    l->head.prev->next = from->head.next;
+    from->head.prev->next = &l->head;
+    l->head.prev = from->head.prev;
+    ilist_init(from);
+}
+
+/* Returns the number of elements in the list. This walks the list. */
+static inline size_t ilist_length(const ilist_t *l)
+{
+    size_t len = 0;
+    const ilist_node_t *n;
+    for (n = l->head.next; n != &l->head; n = n->next) {
+        len++;
+    }
+    return len;
+}
@@ -0,0 +1,282 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the BSD 2-Clause license. Note that NO WARRANTY is provided.
+ * See "LICENSE_BSD2.txt" for details.
+ *
+ * @TAG(DATA61_BSD)
+ */
+
+/**
+ * @file ring.h
+ * @brief Lock-free ring buffers of fixed size elements
+ *
+ * The ring holds a power of two number of elements of elem_size bytes each, in
+ * storage provided by the caller. Byte streams use an elem_size of 1.
+ *
+ * Positions are free running 32-bit counters which are masked to index the
+ * storage, so every slot is usable and counts are simple differences. Bulk
+ * operations copy whole contiguous spans with memcpy, in at most two pieces
+ * where the span wraps.
+ *
+ * There are two sets of operations, which must not be mixed on one ring:
+ *
+ *  - ring_spsc_*: one producer and one consumer, which may run concurrently
+ *    (e.g. an interrupt handler and a reader, or two cores).
+ *  - ring_mpmc_*: any number of concurrent producers and consumers. Each side
+ *    reserves space with a compare and swap on its head, copies, and then
+ *    publishes in reservation order by advancing its tail. Publishing spins
+ *    until every earlier reservation on the same side is published, so these
+ *    must not be used from an interrupt handler that can preempt another
+ *    producer or consumer of the ring on the same core, which would deadlock.
+ *
+ * Enqueue and dequeue transfer as many elements as possible up to the number
+ * asked for, and return how many were transferred.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include <utils/attribute.h>
+#include <utils/arith.h>
+#include <utils/zf_log.h>
+
+/* Keeps the producer and consumer positions on separate cache lines. */
+#define RING_CACHE_LINE 64
+
+typedef struct ring {
+    /* Producer positions. Slots up to prod_head are reserved by producers,
+     * and slots up to prod_tail are filled and visible to consumers. */
+    uint32_t prod_head ALIGN(RING_CACHE_LINE);
+    uint32_t prod_tail;
+    /* Consumer positions. Slots up to cons_head are reserved by consumers,
+     * and slots up to cons_tail are free for producers to reuse. */
+    uint32_t cons_head ALIGN(RING_CACHE_LINE);
+    uint32_t cons_tail;
+    /* Read only after initialisation */
+    uint32_t mask ALIGN(RING_CACHE_LINE);
+    uint32_t elem_size;
+    uint8_t *buf;
+} ring_t;
+
+/**
+ * Initialise a ring
+ *
+ * @param r         Ring structure allocated by the user.
+ * @param buf       Storage for count * elem_size bytes.
+ * @param count     Number of elements, a power of two.
+ * @param elem_size Size of each element in bytes.
+ *
+ * @return 0 on success, EINVAL if the arguments are invalid.
+ */
+static inline int ring_init(ring_t *r, void *buf, size_t count, size_t elem_size)
+{
+    if (!r || !buf || count == 0 || (count & (count - 1)) != 0 ||
+            count > (UINT32_C(1) << 31) || elem_size == 0 || elem_size > UINT32_MAX) {
+        ZF_LOGE("Invalid arguments");
+        return EINVAL;
+    }
+
+    r->prod_head = 0;
+    r->prod_tail = 0;
+    r->cons_head = 0;
+    r->cons_tail = 0;
+    r->mask = count - 1;
+    r->elem_size = elem_size;
+    r->buf = buf;
+
+    return 0;
+}
+
+/**
+ * @return The number of elements the ring can hold.
+ */
+static inline size_t ring_capacity(const ring_t *r)
+{
+    return (size_t) r->mask + 1;
+}
+
+/**
+ * @return The number of elements waiting to be dequeued. Only a snapshot when
+ *         the other side is running concurrently.
+ */
+static inline size_t ring_count(const ring_t *r)
+{
+    /* Load the consumer side first: prod_tail can only have moved further
+     * ahead of it by the second load, so the difference can't go negative.
+     * It can exceed the capacity if the consumer frees slots and the producer
+     * fills them in between, so clamp it. */
+    uint32_t cons_tail = __atomic_load_n(&r->cons_tail, __ATOMIC_ACQUIRE);
+    uint32_t count = __atomic_load_n(&r->prod_tail, __ATOMIC_ACQUIRE) - cons_tail;
+    return MIN((size_t) count, ring_capacity(r));
+}
+
+/**
+ * @return The number of elements that can be enqueued. Only a snapshot when
+ *         the other side is running concurrently.
+ */
+static inline size_t ring_space(const ring_t *r)
+{
+    return ring_capacity(r) - ring_count(r);
+}
+
+static inline bool ring_is_empty(const ring_t *r)
+{
+    return ring_count(r) == 0;
+}
+
+static inline bool ring_is_full(const ring_t *r)
+{
+    return ring_space(r) == 0;
+}
+
+static inline void _ring_copy_in(ring_t *r, uint32_t pos, const void *src, uint32_t n)
+{
+    uint32_t idx = pos & r->mask;
+    uint32_t first = MIN(n, r->mask + 1 - idx);
+
+    memcpy(r->buf + (size_t) idx * r->elem_size, src, (size_t) first * r->elem_size);
+    if (first < n) {
+        memcpy(r->buf, (const uint8_t *) src + (size_t) first * r->elem_size,
+               (size_t)(n - first) * r->elem_size);
+    }
+}
+
+static inline void _ring_copy_out(const ring_t *r, uint32_t pos, void *dst, uint32_t n)
+{
+    uint32_t idx = pos & r->mask;
+    uint32_t first = MIN(n, r->mask + 1 - idx);
+
+    memcpy(dst, r->buf + (size_t) idx * r->elem_size, (size_t) first * r->elem_size);
+    if (first < n) {
+        memcpy((uint8_t *) dst + (size_t) first * r->elem_size, r->buf,
+               (size_t)(n - first) * r->elem_size);
+    }
+}
+
+/**
+ * Enqueue up to n elements. Single producer only.
+ *
+ * @param r   Ring to enqueue to.
+ * @param src Elements to enqueue.
+ * @param n   Number of elements in src.
+ *
+ * @return The number of elements enqueued.
+ */
+static inline size_t ring_spsc_enqueue(ring_t *r, const void *src, size_t n)
+{
+    uint32_t head = r->prod_tail;
+    /* Acquire so that the consumer has finished reading the slots it freed
+     * before they are overwritten. */
+    uint32_t space = r->mask + 1 - (head - __atomic_load_n(&r->cons_tail, __ATOMIC_ACQUIRE));
+
+    n = MIN(n, space);
+    if (n == 0) {
+        return 0;
+    }
+
+    _ring_copy_in(r, head, src, n);
+    r->prod_head = head + n;
+    /* Release so the consumer sees the data before the new position. */
+    __atomic_store_n(&r->prod_tail, head + n, __ATOMIC_RELEASE);
+
+    return n;
+}
+
+/**
+ * Dequeue up to n elements. Single consumer only.
+ *
+ * @param r   Ring to dequeue from.
+ * @param dst Storage for n elements.
+ * @param n   Maximum number of elements to dequeue.
+ *
+ * @return The number of elements dequeued.
+ */
+static inline size_t ring_spsc_dequeue(ring_t *r, void *dst, size_t n)
+{
+    uint32_t head = r->cons_tail;
+    uint32_t avail = __atomic_load_n(&r->prod_tail, __ATOMIC_ACQUIRE) - head;
+
+    n = MIN(n, avail);
+    if (n == 0) {
+        return 0;
+    }
+
+    _ring_copy_out(r, head, dst, n);
+    r->cons_head = head + n;
+    __atomic_store_n(&r->cons_tail, head + n, __ATOMIC_RELEASE);
+
+    return n;
+}
+
+/**
+ * Enqueue up to n elements. Safe with any number of concurrent producers.
+ *
+ * @param r   Ring to enqueue to.
+ * @param src Elements to enqueue.
+ * @param n   Number of elements in src.
+ *
+ * @return The number of elements enqueued.
+ */
+static inline size_t ring_mpmc_enqueue(ring_t *r, const void *src, size_t n)
+{
+    uint32_t head = __atomic_load_n(&r->prod_head, __ATOMIC_RELAXED);
+    uint32_t num;
+
+    do {
+        uint32_t space = r->mask + 1 - (head - __atomic_load_n(&r->cons_tail, __ATOMIC_ACQUIRE));
+        num = MIN(n, space);
+        if (num == 0) {
+            return 0;
+        }
+    } while (!__atomic_compare_exchange_n(&r->prod_head, &head, head + num, true,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    _ring_copy_in(r, head, src, num);
+
+    /* Producers that reserved earlier slots publish first. */
+    while (__atomic_load_n(&r->prod_tail, __ATOMIC_ACQUIRE) != head);
+    __atomic_store_n(&r->prod_tail, head + num, __ATOMIC_RELEASE);
+
+    return num;
+}
+
+/**
+ * Dequeue up to n elements. Safe with any number of concurrent consumers.
+ *
+ * @param r   Ring to dequeue from.
+ * @param dst Storage for n elements.
+ * @param n   Maximum number of elements to dequeue.
+ *
+ * @return The number of elements dequeued.
+ */
+static inline size_t ring_mpmc_dequeue(ring_t *r, void *dst, size_t n)
+{
+    uint32_t head = __atomic_load_n(&r->cons_head, __ATOMIC_RELAXED);
+    uint32_t num;
+
+    do {
+        uint32_t avail = __atomic_load_n(&r->prod_tail, __ATOMIC_ACQUIRE) - head;
+        num = MIN(n, avail);
+        if (num == 0) {
+            return 0;
+        }
+    } while (!__atomic_compare_exchange_n(&r->cons_head, &head, head + num, true,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    _ring_copy_out(r, head, dst, num);
+
+    /* Consumers that reserved earlier slots release them first. */
+    while (__atomic_load_n(&r->cons_tail, __ATOMIC_ACQUIRE) != head);
+    __atomic_store_n(&r->cons_tail, head + num, __ATOMIC_RELEASE);
+
+    return num;
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2017, Data61
+ * Commonwealth Scientific and Industrial Research Organisation (CSIRO)
+ * ABN 41 687 119 230.
+ *
+ * This software may be distributed and modified according to the terms of
+ * the BSD 2-Clause license. Note that NO WARRANTY is provided.
+ * See "LICENSE_BSD2.txt" for details.
+ *
+ * @TAG(DATA61_BSD)
+ */
+
+/* Small vector. Elements are stored in an array inside the vector itself until
+ * it fills up. After that they can be moved to a bigger array provided by the
+ * caller, so the common small case needs no allocation and stays next to the
+ * rest of the structure it is embedded in.
+ *
+ *     SMALLVEC(int, 4) v;
+ *     smallvec_init(&v);
+ *     if (smallvec_push(&v, 42) != 0) {
+ *         smallvec_grow(&v, bigger_array, 64);
+ *         smallvec_push(&v, 42);
+ *     }
+ *
+ * The operations are macros so they work on any element type.
+ *
+ * A vector must not be copied by value (assigned, or passed or returned by
+ * value) while it uses its inline storage, as the copy's data would still
+ * point into the original. Pass it around by pointer instead.
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+/* Type of a vector of type with room for n elements inline. */
+#define SMALLVEC(type, n)         \
+    struct {                      \
+        size_t len;               \
+        size_t cap;               \
+        type *data;               \
+        type inline_data[n];      \
+    }
+
+/* Create a new, empty vector using its inline storage. */
+#define smallvec_init(v) do {                                                   \
+        (v)->len = 0;                                                           \
+        (v)->cap = sizeof((v)->inline_data) / sizeof((v)->inline_data[0]);      \
+        (v)->data = (v)->inline_data;                                           \
+    } while (0)
+
+#define smallvec_len(v)         ((v)->len)
+#define smallvec_is_empty(v)    ((v)->len == 0)
+#define smallvec_is_full(v)     ((v)->len == (v)->cap)
+#define smallvec_is_inline(v)   ((v)->data == (v)->inline_data)
+
+/* Element i of the vector, as an lvalue. i is not checked. */
+#define smallvec_at(v, i)       ((v)->data[(i)])
+
+/* Append x. Evaluates to 0 on success, or -1 if the vector is full. */
+#define smallvec_push(v, x) \
+    ((v)->len < (v)->cap ? ((v)->data[(v)->len++] = (x), 0) : -1)
+
+/* Remove and evaluate to the last element. The vector must not be empty. */
+#define smallvec_pop(v)         ((v)->data[--(v)->len])
+
+/* Remove element i by moving the last element into its place. O(1) but does
+ * not preserve order. */
+#define smallvec_remove_swap(v, i) do {                                         \
+        size_t _i = (i);                                                        \
+        (v)->data[_i] = (v)->data[--(v)->len];                                  \
+    } while (0)
+
+#define smallvec_clear(v)       ((v)->len = 0)
+
+/* Move the elements to the array buf of n elements. Evaluates to 0 on success,
+ * or -1 if they don't fit, in which case the vector is unchanged. The caller
+ * owns buf and the previous array, if that wasn't the inline storage, once
+ * this succeeds.
+ */
+#define smallvec_grow(v, buf, n) ({                                             \
+        size_t _n = (n);                                                        \
+        int _ret = -1;                                                          \
+        if (_n >= (v)->len) {                                                   \
+            typeof((v)->data) _buf = (buf);                                     \
+            for (size_t _j = 0; _j < (v)->len; _j++) {                          \
+                _buf[_j] = (v)->data[_j];                                       \
+            }                                                                   \
+            (v)->data = _buf;                                                   \
+            (v)->cap = _n;                                                      \
+            _ret = 0;                                                           \
+        }                                                                       \
+        _ret;                                                                   \
+    })
+
+/* Iterate over the elements by index. */
+#define smallvec_foreach(v, i) \
+    for ((i) = 0; (i) < (v)->len; (i)++)
@@ -30,11 +30,14 @@
 #include <utils/force.h>
 #include <utils/formats.h>
 #include <utils/frequency.h>
+#include <utils/hashmap.h>
+#include <utils/ilist.h>
 #include <utils/list.h>
 #include <utils/math.h>
 #include <utils/page.h>
 #include <utils/print.h>
 #include <utils/sglib.h>
+#include <utils/smallvec.h>
 #include <utils/stringify.h>
 #include <utils/stack.h>
 #include <utils/time.h>